@@ -0,0 +1,65 @@
+/**
+ * @file xCpu.h
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief Processor feature detection for xcFramework.
+ * @version 0.1
+ * @date 18.10.2026.
+ *
+ * Module detects instruction set extensions available on the running processor. Other modules use it to select their SIMD
+ * implementations once at startup. All functions have prefix `xCpu_`.
+ */
+
+#ifndef XBASE_CPU_H
+#define XBASE_CPU_H
+
+#include "xBase/xTypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief
+ * Size of cache line in bytes assumed by framework modules (used for padding and alignment).
+ */
+#define XCPU_CACHELINE_SIZE 64
+
+/**
+ * @brief
+ * Instruction set extensions recognized by xCpu module.
+ */
+typedef enum {
+    XCPU_FEATURE_NONE = 0,         /**< No extensions (portable code only). */
+    XCPU_FEATURE_SSE2 = 1 << 0,    /**< x86 SSE2 instructions. */
+    XCPU_FEATURE_SSE42 = 1 << 1,   /**< x86 SSE4.2 instructions. */
+    XCPU_FEATURE_AVX = 1 << 2,     /**< x86 AVX instructions (with OS support for YMM state). */
+    XCPU_FEATURE_AVX2 = 1 << 3,    /**< x86 AVX2 instructions. */
+    XCPU_FEATURE_FMA = 1 << 4,     /**< x86 FMA3 instructions. */
+    XCPU_FEATURE_NEON = 1 << 5,    /**< ARM Advanced SIMD (NEON) instructions. */
+} xCpuFeature;
+
+/**
+ * @brief
+ * Get bit mask of all instruction set extensions available on the running processor.
+ *
+ * @return xUInt32 Bitwise OR of xCpuFeature values.
+ *
+ * @note
+ * Detection is performed on first call and cached for all subsequent calls.
+ */
+xUInt32 xCpu_getFeatures(void);
+
+/**
+ * @brief
+ * Check if given instruction set extension is available on the running processor.
+ *
+ * @param feature Feature to check for.
+ * @return xBool true if feature is available, false otherwise.
+ */
+xBool xCpu_hasFeature(xCpuFeature feature);
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // XBASE_CPU_H
@@ -2,10 +2,11 @@
  * @file xMemtools.h
  * @author 0xDontCare (https://github.com/0xDontCare)
  * @brief Memory manipulation functions for xcFramework.
- * @version 0.2
- * @date 06.08.2024.
+ * @version 0.3
+ * @date 18.10.2026.
  *
- * Module implements memory manipulation functions like copying, setting and comparing memory blocks.
+ * Module implements memory manipulation functions like copying, setting and comparing memory blocks. Bulk operations work on whole
+ * machine words or SIMD vectors (SSE2/AVX2 on x86, NEON on ARM) selected once at runtime through xCpu module.
  */
 
 #ifndef XBASE_MEMTOOLS_H
@@ -35,6 +36,10 @@ extern "C" {
  *
  * @note
  * If source and destination memory blocks overlap, data could be corrupted. Use xMemMove() instead.
+ *
+ * @note
+ * When destination starts inside of source block, copying is done byte by byte from the beginning, so the start of source block
+ * gets repeated over destination.
  */
 void xMemCopy(void *dest, const void *src, xSize size);
 
@@ -74,6 +79,199 @@ void xMemSet(void *dest, xUInt8 value, xSize size);
  */
 xBool xMemCmp(const void *block1, const void *block2, xSize size);
 
+/**
+ * @brief
+ * Lexicographically compare two memory blocks and locate first difference between them.
+ *
+ * @param block1 First memory block.
+ * @param block2 Second memory block.
+ * @param size Size of memory blocks in bytes.
+ * @param mismatch Optional pointer to variable to store index of first differing byte in (can be NULL).
+ * @return Zero if memory blocks are equal, negative if first block precedes second, positive if first block follows second.
+ *
+ * @note
+ * Bytes are compared as unsigned values (same ordering as standard memcmp()).
+ *
+ * @note
+ * If blocks are equal, index stored to `mismatch` is equal to `size`.
+ *
+ * @note
+ * NULL block precedes any valid block of non-zero size. In that case, stored mismatch index is zero.
+ */
+int xMemCompare(const void *block1, const void *block2, xSize size, xSize *mismatch);
+
+/**
+ * @brief
+ * Find first occurrence of byte value in memory block.
+ *
+ * @param block Address of memory block.
+ * @param size Size of memory block in bytes.
+ * @param value Byte value to search for.
+ * @return xSize Index of first matching byte, XSIZE_MAX if value is not found or block is NULL.
+ */
+xSize xMemFindByte(const void *block, xSize size, xUInt8 value);
+
+/**
+ * @brief
+ * Find first occurrence of byte sequence (needle) in memory block.
+ *
+ * @param block Address of memory block.
+ * @param size Size of memory block in bytes.
+ * @param needle Address of searched byte sequence.
+ * @param needleSize Length of searched byte sequence.
+ * @return xSize Index where first occurrence starts, XSIZE_MAX if needle is not found or arguments are invalid.
+ *
+ * @note
+ * Empty needle is found at index 0.
+ *
+ * @note
+ * Candidate positions are located by vectorized comparison of first and last needle byte, so typical searches touch each byte of
+ * the block once. Inputs producing many false candidates are finished by Two-Way algorithm, so search runs in O(size +
+ * needleSize) time in the worst case. Function does not allocate memory.
+ */
+xSize xMemFind(const void *block, xSize size, const void *needle, xSize needleSize);
+
+/**
+ * @brief
+ * Find last occurrence of byte sequence (needle) in memory block.
+ *
+ * @param block Address of memory block.
+ * @param size Size of memory block in bytes.
+ * @param needle Address of searched byte sequence.
+ * @param needleSize Length of searched byte sequence.
+ * @return xSize Index where last occurrence starts, XSIZE_MAX if needle is not found or arguments are invalid.
+ *
+ * @note
+ * Empty needle is found at index `size`. Worst case time is O(size + needleSize), same as for xMemFind().
+ */
+xSize xMemFindLast(const void *block, xSize size, const void *needle, xSize needleSize);
+
+/**
+ * @brief
+ * Count occurrences of byte sequence (needle) in memory block.
+ *
+ * @param block Address of memory block.
+ * @param size Size of memory block in bytes.
+ * @param needle Address of searched byte sequence.
+ * @param needleSize Length of searched byte sequence.
+ * @param overlapping Whether occurrences may overlap (e.g. "aba" occurs twice in "ababa" if true, once otherwise).
+ * @return xSize Number of occurrences (0 if needle is empty or arguments are invalid).
+ *
+ * @note
+ * Non-overlapping occurrences are counted from the start of the block. Worst case time is O(size + needleSize).
+ */
+xSize xMemCount(const void *block, xSize size, const void *needle, xSize needleSize, xBool overlapping);
+
+/**
+ * @brief
+ * Precomputed state for repeated searches of one byte sequence (needle).
+ *
+ * @note
+ * Do not access structure members directly. Use xMemFinderInit() and xMemFinder functions instead.
+ *
+ * @note
+ * Finder refers to needle bytes without copying them, so needle must stay unchanged while finder is used.
+ */
+typedef struct xMemFinder_s {
+    const xUInt8 *needle; /**< Searched bytes. */
+    xSize size;           /**< Length of needle (XSIZE_MAX if finder is invalid). */
+    xSize rare[2];        /**< Ascending offsets of two rarest needle bytes compared by candidate filter. */
+    xSize critical[2];    /**< Critical positions of needle for forward and backward Two-Way search. */
+    xSize period[2];      /**< Shifts after mismatch in left half of needle for forward and backward Two-Way search. */
+    xBool periodic[2];    /**< Whether shifted needle keeps matched prefix for forward and backward Two-Way search. */
+} xMemFinder;
+
+/**
+ * @brief
+ * Initialize finder for given needle.
+ *
+ * @param finder Pointer to finder.
+ * @param needle Address of searched byte sequence.
+ * @param size Length of searched byte sequence.
+ *
+ * @note
+ * Initialization takes O(size) time and does not allocate memory. Candidate filter compares two needle bytes expected to be
+ * rarest in text (instead of first and last one used by xMemFind()), which reduces false candidates for needles starting or
+ * ending with common characters.
+ *
+ * @note
+ * If needle is NULL and size is not zero, finder never matches.
+ */
+void xMemFinderInit(xMemFinder *finder, const void *needle, xSize size);
+
+/**
+ * @brief
+ * Find first occurrence of finder needle in memory block.
+ *
+ * @param finder Pointer to initialized finder.
+ * @param block Address of memory block.
+ * @param size Size of memory block in bytes.
+ * @return xSize Index where first occurrence starts, XSIZE_MAX if needle is not found or arguments are invalid.
+ *
+ * @note
+ * Result is equal to result of xMemFind() with the same needle.
+ */
+xSize xMemFinderFind(const xMemFinder *finder, const void *block, xSize size);
+
+/**
+ * @brief
+ * Find last occurrence of finder needle in memory block.
+ *
+ * @param finder Pointer to initialized finder.
+ * @param block Address of memory block.
+ * @param size Size of memory block in bytes.
+ * @return xSize Index where last occurrence starts, XSIZE_MAX if needle is not found or arguments are invalid.
+ */
+xSize xMemFinderFindLast(const xMemFinder *finder, const void *block, xSize size);
+
+/**
+ * @brief
+ * Count occurrences of finder needle in memory block.
+ *
+ * @param finder Pointer to initialized finder.
+ * @param block Address of memory block.
+ * @param size Size of memory block in bytes.
+ * @param overlapping Whether occurrences may overlap.
+ * @return xSize Number of occurrences (0 if needle is empty or arguments are invalid).
+ */
+xSize xMemFinderCount(const xMemFinder *finder, const void *block, xSize size, xBool overlapping);
+
+/**
+ * @brief
+ * 128-bit hash value.
+ */
+typedef struct xHash128_s {
+    xUInt64 low;  /**< Lower 64 bits of hash value. */
+    xUInt64 high; /**< Upper 64 bits of hash value. */
+} xHash128;
+
+/**
+ * @brief
+ * Number of bytes consumed by single step of hash function on long inputs.
+ */
+#define XMEM_HASH_STRIPE 48
+
+/**
+ * @brief
+ * Number of already consumed bytes kept by streaming hash state (hash function always mixes last 16 bytes of input).
+ */
+#define XMEM_HASH_HISTORY 16
+
+/**
+ * @brief
+ * State of incremental (streaming) hash calculation.
+ *
+ * @note
+ * Do not access structure members directly. Use xMemHashInit(), xMemHashUpdate() and xMemHashFinal() functions instead.
+ */
+typedef struct xMemHashState_s {
+    xUInt64 lanes[3];                                     /**< Lane accumulators. */
+    xUInt64 secret[3];                                    /**< Secrets derived from seed. */
+    xUInt64 total;                                        /**< Total number of bytes passed to the state. */
+    xSize buffered;                                       /**< Number of pending bytes in buffer. */
+    xUInt8 buffer[XMEM_HASH_HISTORY + XMEM_HASH_STRIPE];  /**< History of last consumed bytes followed by pending bytes. */
+} xMemHashState;
+
 /**
  * @brief
  * Calculate hash of data within memory block using general purpose hash function.
@@ -83,10 +281,96 @@ xBool xMemCmp(const void *block1, const void *block2, xSize size);
  * @return xUInt64 Hash value.
  *
  * @note
+ * Hash function is multiply-mix construction (in style of wyhash) consuming 48 bytes per step on long inputs. Result is equal to
+ * xMemHashSeeded() with seed value of zero.
+ *
+ * @warning
+ * Seed of zero is publicly known, so colliding keys can be crafted in advance. Hash untrusted keys with xMemHashSeeded().
+ *
+ * @note
+ * If block address is NULL and size is not zero, zero is returned.
+ *
+ * @note
  * This function is not suitable for cryptographic purposes.
  */
 xUInt64 xMemHash(const void *block, xSize size);
 
+/**
+ * @brief
+ * Calculate hash of data within memory block using general purpose hash function with custom seed.
+ *
+ * @param block Address of memory block.
+ * @param size Size of memory block in bytes.
+ * @param seed Seed value altering produced hashes.
+ * @return xUInt64 Hash value.
+ *
+ * @note
+ * Secrets mixed with input are derived from seed, so using random seed per process (or per table) that is never revealed
+ * makes it hard for attacker to craft colliding keys in advance.
+ *
+ * @note
+ * This function is not suitable for cryptographic purposes.
+ */
+xUInt64 xMemHashSeeded(const void *block, xSize size, xUInt64 seed);
+
+/**
+ * @brief
+ * Calculate 128-bit hash of data within memory block.
+ *
+ * @param block Address of memory block.
+ * @param size Size of memory block in bytes.
+ * @param seed Seed value altering produced hashes.
+ * @return xHash128 Hash value.
+ *
+ * @note
+ * Lower half of the result is equal to value returned by xMemHashSeeded() for the same input. Upper half is mixed from the
+ * same internal state, so it makes accidental collisions less likely, but not collisions crafted against the state.
+ */
+xHash128 xMemHash128(const void *block, xSize size, xUInt64 seed);
+
+/**
+ * @brief
+ * Initialize streaming hash state.
+ *
+ * @param state Pointer to hash state.
+ * @param seed Seed value (zero for result matching xMemHash()).
+ */
+void xMemHashInit(xMemHashState *state, xUInt64 seed);
+
+/**
+ * @brief
+ * Pass next part of data to streaming hash state.
+ *
+ * @param state Pointer to hash state.
+ * @param block Address of memory block.
+ * @param size Size of memory block in bytes.
+ *
+ * @note
+ * Hash of data passed in multiple parts is equal to hash of their concatenation passed at once.
+ */
+void xMemHashUpdate(xMemHashState *state, const void *block, xSize size);
+
+/**
+ * @brief
+ * Get hash value of all data passed to streaming hash state.
+ *
+ * @param state Pointer to hash state.
+ * @return xUInt64 Hash value (same as xMemHashSeeded() of all passed data).
+ *
+ * @note
+ * State is not modified, so more data can be passed to it after calling this function.
+ */
+xUInt64 xMemHashFinal(const xMemHashState *state);
+
+/**
+ * @brief
+ * Get 128-bit hash value of all data passed to streaming hash state.
+ *
+ * @param state Pointer to hash state.
+ * @return xHash128 Hash value (same as xMemHash128() of all passed data).
+ */
+xHash128 xMemHashFinal128(const xMemHashState *state);
+
 /**
  * @brief
  * Swap data between two memory blocks.
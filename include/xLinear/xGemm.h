@@ -0,0 +1,92 @@
+/**
+ * @file xGemm.h
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief General matrix multiplication kernels.
+ * @version 0.1
+ * @date 18.10.2026.
+ *
+ * Module declares low-level matrix multiplication routines working on raw row-major arrays of single and double precision,
+ * 32-bit integer and 8-bit integer elements. Operands are split into cache-sized blocks which are packed into contiguous panels
+ * and multiplied by register-blocked SIMD micro-kernel selected for running processor (AVX2/FMA, NEON or portable code). All
+ * routines are generated from single type-generic implementation. All functions have prefix `xGemm_`.
+ */
+
+#ifndef XLINEAR_GEMM_H
+#define XLINEAR_GEMM_H
+
+#include "xBase/xTypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief
+ * Compute C = alpha * A * B + beta * C for single precision row-major matrices.
+ *
+ * @param m Number of rows of A and C.
+ * @param n Number of columns of B and C.
+ * @param k Number of columns of A and rows of B.
+ * @param alpha Scale of product.
+ * @param a Pointer to first element of A.
+ * @param lda Distance between rows of A in elements (at least k).
+ * @param b Pointer to first element of B.
+ * @param ldb Distance between rows of B in elements (at least n).
+ * @param beta Scale of original C (if zero, C is not read, so it may be uninitialized).
+ * @param c Pointer to first element of C.
+ * @param ldc Distance between rows of C in elements (at least n).
+ * @return xBool true on success, false if arguments are invalid or memory for packed panels could not be allocated.
+ *
+ * @note
+ * If m or n is zero, nothing is done. If k is zero, C is only scaled by beta.
+ *
+ * @note
+ * Row blocks of large products are processed by threads of shared xThreadPool. Every block is computed the same way on any
+ * thread, so result does not depend on number of threads.
+ *
+ * @warning
+ * C must not overlap A or B.
+ */
+xBool xGemm_sgemm(xSize m, xSize n, xSize k, float alpha, const float *a, xSize lda, const float *b, xSize ldb, float beta,
+                  float *c, xSize ldc);
+
+/**
+ * @brief
+ * Compute C = alpha * A * B + beta * C for double precision row-major matrices.
+ *
+ * @note
+ * Parameters, behavior and requirements are the same as for xGemm_sgemm().
+ */
+xBool xGemm_dgemm(xSize m, xSize n, xSize k, double alpha, const double *a, xSize lda, const double *b, xSize ldb, double beta,
+                  double *c, xSize ldc);
+
+/**
+ * @brief
+ * Compute C = alpha * A * B + beta * C for 32-bit integer row-major matrices.
+ *
+ * @note
+ * Parameters, behavior and requirements are the same as for xGemm_sgemm(). Integer overflow wraps around (modulo 2^32).
+ */
+xBool xGemm_i32gemm(xSize m, xSize n, xSize k, xInt32 alpha, const xInt32 *a, xSize lda, const xInt32 *b, xSize ldb,
+                    xInt32 beta, xInt32 *c, xSize ldc);
+
+/**
+ * @brief
+ * Compute C = alpha * A * B + beta * C for 8-bit integer row-major matrices A and B, accumulating into 32-bit integer C.
+ *
+ * @note
+ * Parameters, behavior and requirements are the same as for xGemm_sgemm(). Products are accumulated exactly in 32 bits, so
+ * result is exact as long as it fits into 32-bit integer (always the case for k up to 131071); otherwise it wraps around.
+ *
+ * @note
+ * This is the kernel for quantized inference: on AVX2 pairs of widened 8-bit products are summed by single multiply-add
+ * instruction, giving several times more multiply-adds per cycle than single precision.
+ */
+xBool xGemm_i8gemm(xSize m, xSize n, xSize k, xInt32 alpha, const xInt8 *a, xSize lda, const xInt8 *b, xSize ldb, xInt32 beta,
+                   xInt32 *c, xSize ldc);
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // XLINEAR_GEMM_H
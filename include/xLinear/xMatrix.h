@@ -5,18 +5,34 @@
  * @version 0.11
  * @date 04.10.2024.
  *
- * Module declares matrix structure and mathematical operations applicable to them. All functions have prefix `xMatrix_`.
+ * Module declares matrix structure and mathematical operations applicable to them. All functions have prefix `xMatrix_`, except
+ * functions working on non-owning strided views of matrix memory, which have prefix `xMatrixView_`.
+ *
+ * Matrix data starts at XMATRIX_ALIGNMENT-byte boundary and rows of matrices at least one aligned block wide are padded to
+ * multiple of XMATRIX_ALIGNMENT bytes, so every row starts on cache line boundary. Distance between rows (leading dimension)
+ * is returned by xMatrix_getStride() and used as row stride of matrix views.
+ *
+ * Element-wise operations, transposition and multiplication of large matrices are split into row blocks processed by
+ * library-wide xThreadPool (number of threads is set with xThreadPool_setSharedThreadCount()). Results do not depend on
+ * number of threads.
  */
 
 #ifndef XLINEAR_MATRIX_H
 #define XLINEAR_MATRIX_H
 
 #include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif  // __cplusplus
 
+/**
+ * @brief
+ * Alignment of matrix data and padded matrix rows in bytes (size of cache line and widest SIMD register).
+ */
+#define XMATRIX_ALIGNMENT 64
+
 /**
  * @brief
  * Matrix structure introduced by xcFramework.
@@ -29,6 +45,23 @@ extern "C" {
  */
 typedef struct xMatrix_s xMatrix;
 
+/**
+ * @brief
+ * Non-owning view of rectangular part of matrix memory.
+ *
+ * @note
+ * View is small value type which is passed and returned by value. It does not own memory it refers to and is valid only while
+ * viewed matrix exists. Views of blocks, rows, columns and transposes are made without copying elements. View with NULL data
+ * is invalid.
+ */
+typedef struct xMatrixView_s {
+    float *data;     /**< Pointer to first element of view. */
+    xSize rows;      /**< Number of rows. */
+    xSize cols;      /**< Number of columns. */
+    xSize rowStride; /**< Distance between consecutive rows in elements. */
+    xSize colStride; /**< Distance between consecutive columns in elements (1 unless view is transposed). */
+} xMatrixView;
+
 /**
  * @brief
  * Creates empty xMatrix object of given size.
@@ -39,6 +72,21 @@ typedef struct xMatrix_s xMatrix;
  */
 xMatrix *xMatrix_new(xSize rows, xSize cols);
 
+/**
+ * @brief
+ * Creates empty xMatrix object of given size which obtains its memory from given allocator.
+ *
+ * @param rows Number of rows.
+ * @param cols Number of columns.
+ * @param allocator Allocator used for matrix memory (default allocator if NULL).
+ * @return Pointer to zero-initialized xMatrix object.
+ *
+ * @note
+ * Matrices returned by operations on this matrix (e.g. xMatrix_add(), xMatrix_transpose()) use allocator of their first operand.
+ * Arrays returned by xMatrix_flatten() are always allocated with standard library.
+ */
+xMatrix *xMatrix_newWithAllocator(xSize rows, xSize cols, const xAllocator *allocator);
+
 /**
  * @brief
  * Free xMatrix object and its data from memory.
@@ -68,6 +116,22 @@ extern xSize xMatrix_getRows(const xMatrix *matrix);
  */
 extern xSize xMatrix_getCols(const xMatrix *matrix);
 
+/**
+ * @brief
+ * Get distance between starts of consecutive rows of matrix data in elements (leading dimension).
+ *
+ * @param matrix Pointer to xMatrix object.
+ * @return xSize Leading dimension (at least number of columns, 0 for NULL matrix).
+ *
+ * @note
+ * Rows at least XMATRIX_ALIGNMENT bytes long are padded to multiple of XMATRIX_ALIGNMENT bytes, with one more aligned block
+ * added when padded row length is multiple of 1 KiB. This keeps power-of-two widths from mapping whole columns to same cache
+ * sets and from 4K aliasing between rows. Narrower rows are stored packed. Matrix transposed in place by
+ * xMatrix_transpose_inplace() keeps packed rows if padded layout of transposed matrix would not fit into its memory. Matrices
+ * loaded by xMatrix_loadMapped() have packed rows as well.
+ */
+extern xSize xMatrix_getStride(const xMatrix *matrix);
+
 /**
  * @brief
  * Check if matrix is valid.
@@ -156,6 +220,11 @@ xMatrix *xMatrix_transpose(const xMatrix *matrix);
  *
  * @note
  * If passed matrix is invalid, no operation is performed and NULL is returned.
+ *
+ * @note
+ * Square matrices are transposed by swapping tiles across diagonal without extra memory. Other matrices are permuted by
+ * passes over rows and groups of columns, using temporary memory of O(max(rows, cols)) elements, at most eighth of matrix for
+ * matrices at least 8 columns wide (NULL is returned if it could not be allocated).
  */
 xMatrix *xMatrix_transpose_inplace(xMatrix *matrix);
 
@@ -237,6 +306,10 @@ xMatrix *xMatrix_mul(const xMatrix *lhs, const xMatrix *rhs);
  *
  * @note
  * If either of passed matrices are invalid or they have incompatible dimensions, no operation is performed and NULL is returned.
+ *
+ * @note
+ * Product is computed by cache-blocked SIMD kernel from xGemm module. Result matrix may be the same object as one of the
+ * operands, in which case product is computed in temporary buffer and then copied into it.
  */
 xMatrix *xMatrix_mul_inplace(xMatrix *res, const xMatrix *lhs, const xMatrix *rhs);
 
@@ -434,6 +507,9 @@ xMatrix *xMatrix_minor(const xMatrix *matrix, xSize row, xSize col);
  *
  * @note
  * Function should take float as argument and return float.
+ *
+ * @warning
+ * For large matrices function is called from multiple threads at once, so it must be thread-safe.
  */
 xMatrix *xMatrix_map(const xMatrix *matrix, float (*func)(float));
 
@@ -451,6 +527,9 @@ xMatrix *xMatrix_map(const xMatrix *matrix, float (*func)(float));
  *
  * @note
  * Function should take two floats as arguments and return float.
+ *
+ * @warning
+ * For large matrices function is called from multiple threads at once, so it must be thread-safe.
  */
 xMatrix *xMatrix_map2(const xMatrix *lhs, const xMatrix *rhs, float (*func)(float, float));
 
@@ -468,6 +547,9 @@ xMatrix *xMatrix_map2(const xMatrix *lhs, const xMatrix *rhs, float (*func)(floa
  *
  * @note
  * Function should take two floats as arguments and return float.
+ *
+ * @warning
+ * For large matrices function is called from multiple threads at once, so it must be thread-safe.
  */
 xMatrix *xMatrix_mapScalar(const xMatrix *matrix, float scalar, float (*func)(float, float));
 
@@ -507,6 +589,322 @@ float *xMatrix_flatten(const xMatrix *matrix);
  */
 xMatrix *xMatrix_unflatten(const float *data, xSize rows, xSize cols);
 
+/**
+ * @brief
+ * Save matrix to binary file in NumPy .npy format.
+ *
+ * @param matrix Pointer to xMatrix object.
+ * @param path Path of file to create (existing file is overwritten).
+ * @return xBool true on success, false if arguments are invalid or file could not be written.
+ *
+ * @note
+ * File consists of short text header describing element type and shape, padded so that raw row-major elements following it
+ * start at offset divisible by XMATRIX_ALIGNMENT. Files can be loaded by numpy.load() and matrices saved by numpy.save() from
+ * C-ordered 2-D (or 1-D) float32 arrays can be loaded by xMatrix_load() and xMatrix_loadMapped().
+ */
+xBool xMatrix_save(const xMatrix *matrix, const char *path);
+
+/**
+ * @brief
+ * Load matrix from file in NumPy .npy format.
+ *
+ * @param path Path of file to load.
+ * @return Pointer to xMatrix object holding copy of file data (NULL if file can not be read or does not hold C-ordered 1-D or
+ * 2-D array of native byte order float32 elements, or allocation fails).
+ *
+ * @note
+ * 1-D arrays are loaded as matrices with single row.
+ */
+xMatrix *xMatrix_load(const char *path);
+
+/**
+ * @brief
+ * Load matrix from file in NumPy .npy format by mapping file into memory, without reading or copying its data.
+ *
+ * @param path Path of file to load.
+ * @return Pointer to xMatrix object whose data is mapped from file (NULL if file can not be mapped or does not hold C-ordered
+ * 1-D or 2-D array of native byte order float32 elements).
+ *
+ * @note
+ * Loading takes constant time regardless of size of file, and pages of data are read by operating system on first access.
+ * Pages which are not modified are shared with page cache, so processes mapping same file share single copy of its data.
+ *
+ * @note
+ * Rows of mapped matrix are packed as in file (stride equal to number of columns). Modifying elements of mapped matrix is
+ * allowed, but modified pages are copied privately and changes are never written back to file. File may be deleted or
+ * replaced after loading (but must not be truncated while matrix is in use).
+ *
+ * @note
+ * If data in file does not start at XMATRIX_ALIGNMENT boundary (e.g. file was written by old NumPy version), matrix is
+ * loaded by copying as with xMatrix_load().
+ *
+ * @warning
+ * Mapped matrix must be freed with xMatrix_free() like any other matrix, which also unmaps file.
+ */
+xMatrix *xMatrix_loadMapped(const char *path);
+
+/**
+ * @brief
+ * Get view of whole matrix.
+ *
+ * @param matrix Pointer to xMatrix object.
+ * @return xMatrixView View of all matrix elements (invalid view if matrix is invalid).
+ *
+ * @note
+ * Elements of matrix may be modified through returned view even if matrix was passed as constant.
+ */
+xMatrixView xMatrix_view(const xMatrix *matrix);
+
+/**
+ * @brief
+ * Get view of rectangular block of matrix.
+ *
+ * @param matrix Pointer to xMatrix object.
+ * @param row First row of block.
+ * @param col First column of block.
+ * @param rows Number of rows of block.
+ * @param cols Number of columns of block.
+ * @return xMatrixView View of block (invalid view if matrix is invalid or block is empty or out of range).
+ */
+xMatrixView xMatrix_viewBlock(const xMatrix *matrix, xSize row, xSize col, xSize rows, xSize cols);
+
+/**
+ * @brief
+ * Get view of single row of matrix.
+ *
+ * @param matrix Pointer to xMatrix object.
+ * @param row Index of row.
+ * @return xMatrixView View with one row (invalid view if matrix is invalid or row is out of range).
+ */
+xMatrixView xMatrix_viewRow(const xMatrix *matrix, xSize row);
+
+/**
+ * @brief
+ * Get view of single column of matrix.
+ *
+ * @param matrix Pointer to xMatrix object.
+ * @param col Index of column.
+ * @return xMatrixView View with one column (invalid view if matrix is invalid or column is out of range).
+ */
+xMatrixView xMatrix_viewCol(const xMatrix *matrix, xSize col);
+
+/**
+ * @brief
+ * Create new matrix holding copy of elements of view.
+ *
+ * @param view View to copy.
+ * @return Pointer to new xMatrix object (NULL if view is invalid or allocation fails).
+ */
+xMatrix *xMatrix_newFromView(xMatrixView view);
+
+/**
+ * @brief
+ * Check if view is valid.
+ *
+ * @param view View to check.
+ * @return xBool Non-zero if view refers to at least one element, zero otherwise.
+ */
+extern xBool xMatrixView_isValid(xMatrixView view);
+
+/**
+ * @brief
+ * Get element of view.
+ *
+ * @param view View to read from.
+ * @param row Row of element.
+ * @param col Column of element.
+ * @return float Element value (NaN if view is invalid or indices are out of range).
+ */
+extern float xMatrixView_get(xMatrixView view, xSize row, xSize col);
+
+/**
+ * @brief
+ * Set element of view.
+ *
+ * @param view View to write to.
+ * @param row Row of element.
+ * @param col Column of element.
+ * @param value Value to set.
+ *
+ * @note
+ * If view is invalid or indices are out of range, nothing is done.
+ */
+extern void xMatrixView_set(xMatrixView view, xSize row, xSize col, float value);
+
+/**
+ * @brief
+ * Get view of rectangular block of other view.
+ *
+ * @param view Parent view.
+ * @param row First row of block.
+ * @param col First column of block.
+ * @param rows Number of rows of block.
+ * @param cols Number of columns of block.
+ * @return xMatrixView View of block (invalid view if parent is invalid or block is empty or out of range).
+ */
+xMatrixView xMatrixView_block(xMatrixView view, xSize row, xSize col, xSize rows, xSize cols);
+
+/**
+ * @brief
+ * Get transposed view of view.
+ *
+ * @param view View to transpose.
+ * @return xMatrixView View with rows and columns (and their strides) swapped.
+ */
+xMatrixView xMatrixView_transpose(xMatrixView view);
+
+/**
+ * @brief
+ * Copy elements of one view into another.
+ *
+ * @param dest Destination view.
+ * @param src Source view.
+ * @return xBool true on success, false if views are invalid or have different dimensions.
+ *
+ * @note
+ * Copying from transposed view transposes elements in cache-sized tiles.
+ */
+xBool xMatrixView_copy(xMatrixView dest, xMatrixView src);
+
+/**
+ * @brief
+ * Add two views element-wise and store result in third view.
+ *
+ * @param res View to store result in.
+ * @param lhs Left-hand side view.
+ * @param rhs Right-hand side view.
+ * @return xBool true on success, false if views are invalid or have different dimensions.
+ *
+ * @warning
+ * For all element-wise operations, result view may be the same as operand view, but must not partially overlap it.
+ */
+xBool xMatrixView_add(xMatrixView res, xMatrixView lhs, xMatrixView rhs);
+
+/**
+ * @brief
+ * Subtract two views element-wise and store result in third view.
+ *
+ * @param res View to store result in.
+ * @param lhs Left-hand side view.
+ * @param rhs Right-hand side view.
+ * @return xBool true on success, false if views are invalid or have different dimensions.
+ */
+xBool xMatrixView_sub(xMatrixView res, xMatrixView lhs, xMatrixView rhs);
+
+/**
+ * @brief
+ * Multiply two views element-wise (Hadamard product) and store result in third view.
+ *
+ * @param res View to store result in.
+ * @param lhs Left-hand side view.
+ * @param rhs Right-hand side view.
+ * @return xBool true on success, false if views are invalid or have different dimensions.
+ */
+xBool xMatrixView_dotmul(xMatrixView res, xMatrixView lhs, xMatrixView rhs);
+
+/**
+ * @brief
+ * Add scalar to all elements of view and store result in another view.
+ *
+ * @param res View to store result in.
+ * @param src Source view.
+ * @param scalar Scalar value.
+ * @return xBool true on success, false if views are invalid or have different dimensions.
+ */
+xBool xMatrixView_scalarAdd(xMatrixView res, xMatrixView src, float scalar);
+
+/**
+ * @brief
+ * Subtract scalar from all elements of view and store result in another view.
+ *
+ * @param res View to store result in.
+ * @param src Source view.
+ * @param scalar Scalar value.
+ * @return xBool true on success, false if views are invalid or have different dimensions.
+ */
+xBool xMatrixView_scalarSub(xMatrixView res, xMatrixView src, float scalar);
+
+/**
+ * @brief
+ * Multiply all elements of view by scalar and store result in another view.
+ *
+ * @param res View to store result in.
+ * @param src Source view.
+ * @param scalar Scalar value.
+ * @return xBool true on success, false if views are invalid or have different dimensions.
+ */
+xBool xMatrixView_scalarMul(xMatrixView res, xMatrixView src, float scalar);
+
+/**
+ * @brief
+ * Divide all elements of view by scalar and store result in another view.
+ *
+ * @param res View to store result in.
+ * @param src Source view.
+ * @param scalar Scalar value.
+ * @return xBool true on success, false if views are invalid or have different dimensions.
+ */
+xBool xMatrixView_scalarDiv(xMatrixView res, xMatrixView src, float scalar);
+
+/**
+ * @brief
+ * Apply function to each element of view and store result in another view.
+ *
+ * @param res View to store result in.
+ * @param src Source view.
+ * @param func Function to apply to each element.
+ * @return xBool true on success, false if views are invalid, have different dimensions or function is NULL.
+ *
+ * @warning
+ * For large views function is called from multiple threads at once, so it must be thread-safe.
+ */
+xBool xMatrixView_map(xMatrixView res, xMatrixView src, float (*func)(float));
+
+/**
+ * @brief
+ * Apply function to matching elements of two views and store result in third view.
+ *
+ * @param res View to store result in.
+ * @param lhs Left-hand side view.
+ * @param rhs Right-hand side view.
+ * @param func Function to apply to each pair of elements.
+ * @return xBool true on success, false if views are invalid, have different dimensions or function is NULL.
+ *
+ * @warning
+ * For large views function is called from multiple threads at once, so it must be thread-safe.
+ */
+xBool xMatrixView_map2(xMatrixView res, xMatrixView lhs, xMatrixView rhs, float (*func)(float, float));
+
+/**
+ * @brief
+ * Apply function to each element of view and scalar and store result in another view.
+ *
+ * @param res View to store result in.
+ * @param src Source view.
+ * @param scalar Scalar value passed as second argument of function.
+ * @param func Function to apply to each element.
+ * @return xBool true on success, false if views are invalid, have different dimensions or function is NULL.
+ *
+ * @warning
+ * For large views function is called from multiple threads at once, so it must be thread-safe.
+ */
+xBool xMatrixView_mapScalar(xMatrixView res, xMatrixView src, float scalar, float (*func)(float, float));
+
+/**
+ * @brief
+ * Multiply two views (matrix product) and store result in third view.
+ *
+ * @param res View to store result in.
+ * @param lhs Left-hand side view.
+ * @param rhs Right-hand side view.
+ * @return xBool true on success, false if views are invalid, have incompatible dimensions or memory allocation fails.
+ *
+ * @note
+ * Views with unit column stride are multiplied in place by xGemm kernel. Transposed operands and result overlapping operand
+ * are handled through contiguous temporary copies.
+ */
+xBool xMatrixView_mul(xMatrixView res, xMatrixView lhs, xMatrixView rhs);
+
 #ifdef __cplusplus
 }
 #endif  // __cplusplus
@@ -0,0 +1,327 @@
+/**
+ * @file xMatrixDecomp.h
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief Matrix decompositions and linear system solvers.
+ * @version 0.1
+ * @date 18.10.2026.
+ *
+ * Module declares LU decomposition with partial pivoting (prefix `xMatrixLU_`), Cholesky decomposition of symmetric positive
+ * definite matrices (prefix `xMatrixCholesky_`) and Householder QR decomposition (prefix `xMatrixQR_`), together with
+ * triangular solves, linear and least squares solves, inverse and determinant of xMatrix built on them (prefix `xMatrix_`).
+ *
+ * All decompositions are blocked: narrow panel of columns is factored by unblocked algorithm and rest of matrix is updated by
+ * matrix multiplication from xGemm module, which does almost all O(n^3) work. Decomposing n x n matrix therefore takes O(n^3)
+ * time, instead of factorial time of cofactor expansion over xMatrix_minor().
+ *
+ * @note
+ * Matrices are decomposed in single precision, so results of ill-conditioned problems carry proportionally large errors.
+ */
+
+#ifndef XLINEAR_MATRIXDECOMP_H
+#define XLINEAR_MATRIXDECOMP_H
+
+#include "xBase/xTypes.h"
+#include "xLinear/xMatrix.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief
+ * LU decomposition PA = LU of square matrix, with unit lower triangular L, upper triangular U and row permutation P.
+ *
+ * @note
+ * Do not access structure members directly. Use provided functions for managing xMatrixLU object.
+ */
+typedef struct xMatrixLU_s xMatrixLU;
+
+/**
+ * @brief
+ * Cholesky decomposition A = LL^T of symmetric positive definite matrix, with lower triangular L.
+ *
+ * @note
+ * Do not access structure members directly. Use provided functions for managing xMatrixCholesky object.
+ */
+typedef struct xMatrixCholesky_s xMatrixCholesky;
+
+/**
+ * @brief
+ * QR decomposition A = QR of matrix with at least as many rows as columns, with Q having orthonormal columns and upper
+ * triangular R.
+ *
+ * @note
+ * Do not access structure members directly. Use provided functions for managing xMatrixQR object.
+ */
+typedef struct xMatrixQR_s xMatrixQR;
+
+/**
+ * @brief
+ * Compute LU decomposition of square matrix with partial (row) pivoting.
+ *
+ * @param matrix Pointer to square xMatrix object to decompose (not modified).
+ * @return Pointer to xMatrixLU object (NULL if matrix is invalid or not square or allocation fails).
+ *
+ * @note
+ * Singular matrix is decomposed as well (see xMatrixLU_isSingular()), but can not be used to solve systems.
+ */
+xMatrixLU *xMatrixLU_new(const xMatrix *matrix);
+
+/**
+ * @brief
+ * Free LU decomposition from memory.
+ *
+ * @param lu Pointer to xMatrixLU object to free.
+ */
+void xMatrixLU_free(xMatrixLU *lu);
+
+/**
+ * @brief
+ * Check if decomposed matrix is singular (some pivot is exactly zero).
+ *
+ * @param lu Pointer to xMatrixLU object.
+ * @return xBool true if matrix is singular or decomposition is invalid, false otherwise.
+ */
+xBool xMatrixLU_isSingular(const xMatrixLU *lu);
+
+/**
+ * @brief
+ * Get unit lower triangular factor L.
+ *
+ * @param lu Pointer to xMatrixLU object.
+ * @return Pointer to new xMatrix object holding L (NULL if decomposition is invalid or allocation fails).
+ */
+xMatrix *xMatrixLU_getL(const xMatrixLU *lu);
+
+/**
+ * @brief
+ * Get upper triangular factor U.
+ *
+ * @param lu Pointer to xMatrixLU object.
+ * @return Pointer to new xMatrix object holding U (NULL if decomposition is invalid or allocation fails).
+ */
+xMatrix *xMatrixLU_getU(const xMatrixLU *lu);
+
+/**
+ * @brief
+ * Get row of decomposed matrix which became given row of PA.
+ *
+ * @param lu Pointer to xMatrixLU object.
+ * @param row Row of PA (and of L and U).
+ * @return xSize Row of original matrix (0 if decomposition is invalid or row is out of range).
+ */
+xSize xMatrixLU_getPermutation(const xMatrixLU *lu, xSize row);
+
+/**
+ * @brief
+ * Get determinant of decomposed matrix.
+ *
+ * @param lu Pointer to xMatrixLU object.
+ * @return float Determinant (0 if matrix is singular or decomposition is invalid).
+ *
+ * @note
+ * Determinant is product of diagonal of U, so it may overflow to infinity or underflow to zero for large matrices even if
+ * they are well conditioned.
+ */
+float xMatrixLU_determinant(const xMatrixLU *lu);
+
+/**
+ * @brief
+ * Solve linear system AX = B using LU decomposition of A.
+ *
+ * @param lu Pointer to xMatrixLU object of A.
+ * @param rhs Pointer to xMatrix object holding B (any number of columns, one system per column).
+ * @return Pointer to new xMatrix object holding X (NULL if arguments are invalid, A is singular or allocation fails).
+ */
+xMatrix *xMatrixLU_solve(const xMatrixLU *lu, const xMatrix *rhs);
+
+/**
+ * @brief
+ * Compute inverse of decomposed matrix.
+ *
+ * @param lu Pointer to xMatrixLU object.
+ * @return Pointer to new xMatrix object holding inverse (NULL if decomposition is invalid, matrix is singular or allocation
+ * fails).
+ */
+xMatrix *xMatrixLU_inverse(const xMatrixLU *lu);
+
+/**
+ * @brief
+ * Compute Cholesky decomposition of symmetric positive definite matrix.
+ *
+ * @param matrix Pointer to square xMatrix object to decompose (not modified).
+ * @return Pointer to xMatrixCholesky object (NULL if matrix is invalid, not square or not positive definite, or allocation
+ * fails).
+ *
+ * @note
+ * Only upper triangle of matrix is read, symmetry is not checked. Cholesky decomposition needs half the work of LU
+ * decomposition and no pivoting, and failure of decomposition is cheap test for positive definiteness.
+ */
+xMatrixCholesky *xMatrixCholesky_new(const xMatrix *matrix);
+
+/**
+ * @brief
+ * Free Cholesky decomposition from memory.
+ *
+ * @param cholesky Pointer to xMatrixCholesky object to free.
+ */
+void xMatrixCholesky_free(xMatrixCholesky *cholesky);
+
+/**
+ * @brief
+ * Get lower triangular factor L.
+ *
+ * @param cholesky Pointer to xMatrixCholesky object.
+ * @return Pointer to new xMatrix object holding L (NULL if decomposition is invalid or allocation fails).
+ */
+xMatrix *xMatrixCholesky_getL(const xMatrixCholesky *cholesky);
+
+/**
+ * @brief
+ * Get determinant of decomposed matrix.
+ *
+ * @param cholesky Pointer to xMatrixCholesky object.
+ * @return float Determinant (0 if decomposition is invalid).
+ */
+float xMatrixCholesky_determinant(const xMatrixCholesky *cholesky);
+
+/**
+ * @brief
+ * Solve linear system AX = B using Cholesky decomposition of A.
+ *
+ * @param cholesky Pointer to xMatrixCholesky object of A.
+ * @param rhs Pointer to xMatrix object holding B (any number of columns, one system per column).
+ * @return Pointer to new xMatrix object holding X (NULL if arguments are invalid or allocation fails).
+ */
+xMatrix *xMatrixCholesky_solve(const xMatrixCholesky *cholesky, const xMatrix *rhs);
+
+/**
+ * @brief
+ * Compute QR decomposition of matrix by Householder reflections.
+ *
+ * @param matrix Pointer to xMatrix object to decompose with at least as many rows as columns (not modified).
+ * @return Pointer to xMatrixQR object (NULL if matrix is invalid, has more columns than rows, or allocation fails).
+ *
+ * @note
+ * Q is not formed explicitly. Decomposition keeps Householder vectors, which are applied to right-hand sides in blocks using
+ * matrix multiplication.
+ */
+xMatrixQR *xMatrixQR_new(const xMatrix *matrix);
+
+/**
+ * @brief
+ * Free QR decomposition from memory.
+ *
+ * @param qr Pointer to xMatrixQR object to free.
+ */
+void xMatrixQR_free(xMatrixQR *qr);
+
+/**
+ * @brief
+ * Check if decomposed matrix has full column rank (no diagonal element of R is exactly zero).
+ *
+ * @param qr Pointer to xMatrixQR object.
+ * @return xBool true if matrix has full column rank, false otherwise or if decomposition is invalid.
+ */
+xBool xMatrixQR_isFullRank(const xMatrixQR *qr);
+
+/**
+ * @brief
+ * Get factor Q with orthonormal columns (same dimensions as decomposed matrix).
+ *
+ * @param qr Pointer to xMatrixQR object.
+ * @return Pointer to new xMatrix object holding Q (NULL if decomposition is invalid or allocation fails).
+ */
+xMatrix *xMatrixQR_getQ(const xMatrixQR *qr);
+
+/**
+ * @brief
+ * Get square upper triangular factor R.
+ *
+ * @param qr Pointer to xMatrixQR object.
+ * @return Pointer to new xMatrix object holding R (NULL if decomposition is invalid or allocation fails).
+ */
+xMatrix *xMatrixQR_getR(const xMatrixQR *qr);
+
+/**
+ * @brief
+ * Find X minimizing Frobenius norm of AX - B using QR decomposition of A.
+ *
+ * @param qr Pointer to xMatrixQR object of A.
+ * @param rhs Pointer to xMatrix object holding B (same number of rows as A, one problem per column).
+ * @return Pointer to new xMatrix object holding X (NULL if arguments are invalid, A does not have full column rank or
+ * allocation fails).
+ *
+ * @note
+ * For square A this is solution of linear system AX = B. Unlike solving normal equations A^T AX = A^T B, accuracy of result
+ * is not limited by squared condition number of A.
+ */
+xMatrix *xMatrixQR_solve(const xMatrixQR *qr, const xMatrix *rhs);
+
+/**
+ * @brief
+ * Solve linear system TX = B with triangular matrix T.
+ *
+ * @param tri Pointer to square xMatrix object holding T (only its lower or upper triangle is read).
+ * @param rhs Pointer to xMatrix object holding B (any number of columns, one system per column).
+ * @param lower true if T is lower triangular, false if it is upper triangular.
+ * @param unitDiagonal true if diagonal of T is taken to be ones (diagonal elements are not read).
+ * @return Pointer to new xMatrix object holding X (NULL if arguments are invalid, T has zero on diagonal or allocation fails).
+ */
+xMatrix *xMatrix_solveTriangular(const xMatrix *tri, const xMatrix *rhs, xBool lower, xBool unitDiagonal);
+
+/**
+ * @brief
+ * Solve linear system AX = B with square matrix A.
+ *
+ * @param matrix Pointer to square xMatrix object holding A.
+ * @param rhs Pointer to xMatrix object holding B (any number of columns, one system per column).
+ * @return Pointer to new xMatrix object holding X (NULL if arguments are invalid, A is singular or allocation fails).
+ *
+ * @note
+ * System is solved by LU decomposition. When solving multiple systems with same matrix at different times, decompose it once
+ * with xMatrixLU_new() and use xMatrixLU_solve().
+ */
+xMatrix *xMatrix_solve(const xMatrix *matrix, const xMatrix *rhs);
+
+/**
+ * @brief
+ * Find X minimizing Frobenius norm of AX - B (least squares fit).
+ *
+ * @param matrix Pointer to xMatrix object holding A with at least as many rows as columns.
+ * @param rhs Pointer to xMatrix object holding B (same number of rows as A, one problem per column).
+ * @return Pointer to new xMatrix object holding X (NULL if arguments are invalid, A does not have full column rank or
+ * allocation fails).
+ *
+ * @note
+ * Problem is solved by QR decomposition (see xMatrixQR_solve()).
+ */
+xMatrix *xMatrix_leastSquares(const xMatrix *matrix, const xMatrix *rhs);
+
+/**
+ * @brief
+ * Compute inverse of square matrix.
+ *
+ * @param matrix Pointer to square xMatrix object.
+ * @return Pointer to new xMatrix object holding inverse (NULL if matrix is invalid, not square or singular, or allocation
+ * fails).
+ *
+ * @note
+ * Solving system with xMatrix_solve() is faster and more accurate than multiplying by inverse.
+ */
+xMatrix *xMatrix_inverse(const xMatrix *matrix);
+
+/**
+ * @brief
+ * Compute determinant of square matrix by LU decomposition.
+ *
+ * @param matrix Pointer to square xMatrix object.
+ * @return float Determinant (0 if matrix is invalid, not square or singular, or allocation fails).
+ */
+float xMatrix_determinant(const xMatrix *matrix);
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // XLINEAR_MATRIXDECOMP_H
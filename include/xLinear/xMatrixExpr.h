@@ -0,0 +1,248 @@
+/**
+ * @file xMatrixExpr.h
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief Lazy fused element-wise matrix expressions.
+ * @version 0.1
+ * @date 18.10.2026.
+ *
+ * Module declares expression object recording chain of element-wise operations on matrix views. Recorded chain is evaluated
+ * in single pass over memory, processing short strips of each row through all operations while they stay in L1 cache, so no
+ * full-size intermediate matrices are created. All functions have prefix `xMatrixExpr_`.
+ */
+
+#ifndef XLINEAR_MATRIXEXPR_H
+#define XLINEAR_MATRIXEXPR_H
+
+#include "xBase/xTypes.h"
+#include "xLinear/xMatrix.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief
+ * Maximum number of nodes (inputs, constants and operations) in single expression.
+ */
+#define XMATRIXEXPR_MAX_NODES 64
+
+/**
+ * @brief
+ * Node handle returned when node could not be added to expression.
+ *
+ * @note
+ * Operations taking invalid node handle as operand return invalid handle as well, so errors propagate to evaluation.
+ */
+#define XMATRIXEXPR_INVALID ((xSize)-1)
+
+/**
+ * @brief
+ * Element-wise expression structure introduced by xcFramework.
+ *
+ * @note
+ * Do not access structure members directly. Use provided functions for managing xMatrixExpr object.
+ *
+ * @note
+ * Nodes are identified by handles returned when they are added. Operand of operation must be added before operation, so
+ * expression can not contain cycles.
+ */
+typedef struct xMatrixExpr_s xMatrixExpr;
+
+/**
+ * @brief
+ * Create empty expression.
+ *
+ * @return Pointer to xMatrixExpr object (NULL if allocation fails).
+ */
+xMatrixExpr *xMatrixExpr_new(void);
+
+/**
+ * @brief
+ * Free expression from memory.
+ *
+ * @param expr Pointer to xMatrixExpr object to free.
+ *
+ * @note
+ * Views bound to input nodes are not affected.
+ */
+void xMatrixExpr_free(xMatrixExpr *expr);
+
+/**
+ * @brief
+ * Get number of nodes in expression.
+ *
+ * @param expr Pointer to xMatrixExpr object.
+ * @return xSize Number of nodes added to expression.
+ */
+extern xSize xMatrixExpr_getNodeCount(const xMatrixExpr *expr);
+
+/**
+ * @brief
+ * Add input node reading elements of view.
+ *
+ * @param expr Pointer to xMatrixExpr object.
+ * @param view View read by node (only referenced, not copied).
+ * @return xSize Handle of new node (XMATRIXEXPR_INVALID if view is invalid or expression is full).
+ */
+xSize xMatrixExpr_input(xMatrixExpr *expr, xMatrixView view);
+
+/**
+ * @brief
+ * Bind different view to existing input node, so expression can be evaluated again on other data.
+ *
+ * @param expr Pointer to xMatrixExpr object.
+ * @param input Handle of input node.
+ * @param view New view read by node.
+ * @return xBool true on success, false if node is not input node or view is invalid.
+ */
+xBool xMatrixExpr_bind(xMatrixExpr *expr, xSize input, xMatrixView view);
+
+/**
+ * @brief
+ * Add constant node having same value for every element.
+ *
+ * @param expr Pointer to xMatrixExpr object.
+ * @param value Value of every element.
+ * @return xSize Handle of new node (XMATRIXEXPR_INVALID if expression is full).
+ */
+xSize xMatrixExpr_constant(xMatrixExpr *expr, float value);
+
+/**
+ * @brief
+ * Add node computing lhs + rhs element-wise.
+ *
+ * @param expr Pointer to xMatrixExpr object.
+ * @param lhs Handle of left operand.
+ * @param rhs Handle of right operand.
+ * @return xSize Handle of new node (XMATRIXEXPR_INVALID if operands are invalid or expression is full).
+ */
+xSize xMatrixExpr_add(xMatrixExpr *expr, xSize lhs, xSize rhs);
+
+/**
+ * @brief
+ * Add node computing lhs - rhs element-wise.
+ *
+ * @param expr Pointer to xMatrixExpr object.
+ * @param lhs Handle of left operand.
+ * @param rhs Handle of right operand.
+ * @return xSize Handle of new node (XMATRIXEXPR_INVALID if operands are invalid or expression is full).
+ */
+xSize xMatrixExpr_sub(xMatrixExpr *expr, xSize lhs, xSize rhs);
+
+/**
+ * @brief
+ * Add node computing lhs * rhs element-wise (Hadamard product).
+ *
+ * @param expr Pointer to xMatrixExpr object.
+ * @param lhs Handle of left operand.
+ * @param rhs Handle of right operand.
+ * @return xSize Handle of new node (XMATRIXEXPR_INVALID if operands are invalid or expression is full).
+ */
+xSize xMatrixExpr_mul(xMatrixExpr *expr, xSize lhs, xSize rhs);
+
+/**
+ * @brief
+ * Add node computing lhs / rhs element-wise.
+ *
+ * @param expr Pointer to xMatrixExpr object.
+ * @param lhs Handle of left operand.
+ * @param rhs Handle of right operand.
+ * @return xSize Handle of new node (XMATRIXEXPR_INVALID if operands are invalid or expression is full).
+ */
+xSize xMatrixExpr_div(xMatrixExpr *expr, xSize lhs, xSize rhs);
+
+/**
+ * @brief
+ * Add node computing smaller of lhs and rhs element-wise.
+ *
+ * @param expr Pointer to xMatrixExpr object.
+ * @param lhs Handle of left operand.
+ * @param rhs Handle of right operand.
+ * @return xSize Handle of new node (XMATRIXEXPR_INVALID if operands are invalid or expression is full).
+ */
+xSize xMatrixExpr_min(xMatrixExpr *expr, xSize lhs, xSize rhs);
+
+/**
+ * @brief
+ * Add node computing larger of lhs and rhs element-wise.
+ *
+ * @param expr Pointer to xMatrixExpr object.
+ * @param lhs Handle of left operand.
+ * @param rhs Handle of right operand.
+ * @return xSize Handle of new node (XMATRIXEXPR_INVALID if operands are invalid or expression is full).
+ */
+xSize xMatrixExpr_max(xMatrixExpr *expr, xSize lhs, xSize rhs);
+
+/**
+ * @brief
+ * Add node negating operand element-wise.
+ *
+ * @param expr Pointer to xMatrixExpr object.
+ * @param operand Handle of operand.
+ * @return xSize Handle of new node (XMATRIXEXPR_INVALID if operand is invalid or expression is full).
+ */
+xSize xMatrixExpr_neg(xMatrixExpr *expr, xSize operand);
+
+/**
+ * @brief
+ * Add node computing absolute value of operand element-wise.
+ *
+ * @param expr Pointer to xMatrixExpr object.
+ * @param operand Handle of operand.
+ * @return xSize Handle of new node (XMATRIXEXPR_INVALID if operand is invalid or expression is full).
+ */
+xSize xMatrixExpr_abs(xMatrixExpr *expr, xSize operand);
+
+/**
+ * @brief
+ * Add node applying function to each element of operand.
+ *
+ * @param expr Pointer to xMatrixExpr object.
+ * @param operand Handle of operand.
+ * @param func Function to apply.
+ * @return xSize Handle of new node (XMATRIXEXPR_INVALID if operand or function is invalid or expression is full).
+ *
+ * @note
+ * Built-in operations are vectorized, while user functions are called once per element. Prefer built-in operations where
+ * possible.
+ *
+ * @warning
+ * For large results function is called from multiple threads at once, so it must be thread-safe.
+ */
+xSize xMatrixExpr_map(xMatrixExpr *expr, xSize operand, float (*func)(float));
+
+/**
+ * @brief
+ * Add node applying function to matching elements of two operands.
+ *
+ * @param expr Pointer to xMatrixExpr object.
+ * @param lhs Handle of first operand.
+ * @param rhs Handle of second operand.
+ * @param func Function to apply.
+ * @return xSize Handle of new node (XMATRIXEXPR_INVALID if operands or function are invalid or expression is full).
+ *
+ * @warning
+ * For large results function is called from multiple threads at once, so it must be thread-safe.
+ */
+xSize xMatrixExpr_map2(xMatrixExpr *expr, xSize lhs, xSize rhs, float (*func)(float, float));
+
+/**
+ * @brief
+ * Evaluate node of expression into view in single fused pass.
+ *
+ * @param expr Pointer to xMatrixExpr object.
+ * @param node Handle of node to evaluate (nodes it does not depend on are skipped).
+ * @param res View receiving result.
+ * @return xBool true on success, false if node is invalid or dimensions of input views differ from result view.
+ *
+ * @note
+ * Result view may be the same as input view (e.g. for in-place normalization), but must not partially overlap it. Large
+ * results are split into row blocks processed by shared xThreadPool.
+ */
+xBool xMatrixExpr_eval(const xMatrixExpr *expr, xSize node, xMatrixView res);
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // XLINEAR_MATRIXEXPR_H
@@ -0,0 +1,106 @@
+/**
+ * @file xMatrixTyped.h
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief Matrices of double precision and integer elements.
+ * @version 0.1
+ * @date 18.10.2026.
+ *
+ * Module declares matrix structures with element types other than single precision float of xMatrix: xMatrixF64 (double),
+ * xMatrixI32 (32-bit integer) and xMatrixI8 (8-bit integer, multiplied with 32-bit accumulation for quantized inference).
+ * All three are generated from single type-generic implementation and share the same interface, prefixed with name of the
+ * structure (e.g. `xMatrixF64_`). Each uses matrix multiplication kernel of its own element type from xGemm module.
+ */
+
+#ifndef XLINEAR_MATRIXTYPED_H
+#define XLINEAR_MATRIXTYPED_H
+
+#include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief
+ * Declare matrix structure `Name` with elements of type `T`, whose product is matrix of type `Product`.
+ *
+ * Declared functions behave like their xMatrix counterparts:
+ * - `Name *Name_new(rows, cols)` and `Name *Name_newWithAllocator(rows, cols, allocator)` create zero-initialized matrix.
+ * - `void Name_free(matrix)` frees matrix.
+ * - `Name_getRows(matrix)`, `Name_getCols(matrix)`, `Name_getStride(matrix)` and `Name_isValid(matrix)` query matrix.
+ * - `Name_set(matrix, row, col, value)` and `Name_get(matrix, row, col)` access elements (get returns 0 on invalid access).
+ * - `Name_duplicate(matrix)`, `Name_fill(matrix, value)` and `Name_transpose(matrix)` copy, fill and transpose matrix.
+ * - `Name_add`, `Name_sub`, `Name_dotmul` and `Name_scalarMul` (with `_inplace` variants) compute element-wise results.
+ * - `Product *Name_mul(lhs, rhs)` and `Product *Name_mul_inplace(res, lhs, rhs)` compute matrix product.
+ * - `T *Name_flatten(matrix)` and `Name *Name_unflatten(arr, rows, cols)` convert matrix from and to row-major array.
+ *
+ * @note
+ * Data of matrices is laid out like data of xMatrix: aligned to XMATRIX_ALIGNMENT bytes, with rows padded to multiple of
+ * XMATRIX_ALIGNMENT bytes when they are at least that long (see xMatrix_getStride()).
+ *
+ * @note
+ * Arithmetic on integer matrices wraps around on overflow (modulo 2^32 for xMatrixI32, modulo 2^8 for element-wise results
+ * of xMatrixI8). Product of xMatrixI8 matrices is xMatrixI32 matrix, exact as long as inner dimension (columns of lhs) is at
+ * most 131071. Longer sums of products of 8-bit elements may exceed 32-bit range and wrap around as well.
+ */
+#define XMATRIX_DECLARE_TYPED(Name, T, Product)                                         \
+    typedef struct Name##_s Name;                                                       \
+                                                                                        \
+    Name *Name##_new(xSize rows, xSize cols);                                           \
+    Name *Name##_newWithAllocator(xSize rows, xSize cols, const xAllocator *allocator); \
+    void Name##_free(Name *matrix);                                                     \
+    extern xSize Name##_getRows(const Name *matrix);                                    \
+    extern xSize Name##_getCols(const Name *matrix);                                    \
+    extern xSize Name##_getStride(const Name *matrix);                                  \
+    extern xBool Name##_isValid(const Name *matrix);                                    \
+    extern void Name##_set(Name *matrix, xSize row, xSize col, T value);                \
+    extern T Name##_get(const Name *matrix, xSize row, xSize col);                      \
+    Name *Name##_duplicate(const Name *matrix);                                         \
+    void Name##_fill(Name *matrix, T value);                                            \
+    Name *Name##_transpose(const Name *matrix);                                         \
+    Name *Name##_add(const Name *lhs, const Name *rhs);                                 \
+    Name *Name##_add_inplace(Name *res, const Name *lhs, const Name *rhs);              \
+    Name *Name##_sub(const Name *lhs, const Name *rhs);                                 \
+    Name *Name##_sub_inplace(Name *res, const Name *lhs, const Name *rhs);              \
+    Name *Name##_dotmul(const Name *lhs, const Name *rhs);                              \
+    Name *Name##_dotmul_inplace(Name *res, const Name *lhs, const Name *rhs);           \
+    Name *Name##_scalarMul(const Name *matrix, T scalar);                               \
+    Name *Name##_scalarMul_inplace(Name *res, const Name *matrix, T scalar);            \
+    Product *Name##_mul(const Name *lhs, const Name *rhs);                              \
+    Product *Name##_mul_inplace(Product *res, const Name *lhs, const Name *rhs);        \
+    T *Name##_flatten(const Name *matrix);                                              \
+    Name *Name##_unflatten(const T *arr, xSize rows, xSize cols)
+
+/**
+ * @brief
+ * Matrix of double precision elements, for computations where single precision accumulation error is unacceptable.
+ *
+ * @note
+ * Do not access structure members directly. Use provided functions for managing xMatrixF64 object.
+ */
+XMATRIX_DECLARE_TYPED(xMatrixF64, xFloat64, xMatrixF64);
+
+/**
+ * @brief
+ * Matrix of 32-bit integer elements.
+ *
+ * @note
+ * Do not access structure members directly. Use provided functions for managing xMatrixI32 object.
+ */
+XMATRIX_DECLARE_TYPED(xMatrixI32, xInt32, xMatrixI32);
+
+/**
+ * @brief
+ * Matrix of 8-bit integer elements (e.g. quantized weights and activations), whose product is xMatrixI32.
+ *
+ * @note
+ * Do not access structure members directly. Use provided functions for managing xMatrixI8 object.
+ */
+XMATRIX_DECLARE_TYPED(xMatrixI8, xInt8, xMatrixI32);
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // XLINEAR_MATRIXTYPED_H
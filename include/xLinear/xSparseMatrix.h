@@ -0,0 +1,271 @@
+/**
+ * @file xSparseMatrix.h
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief Sparse matrix structure in compressed row and column formats.
+ * @version 0.1
+ * @date 18.10.2026.
+ *
+ * Module declares sparse matrix structure storing only non-zero elements, in compressed sparse row (CSR) or compressed sparse
+ * column (CSC) format. Matrices are constructed from coordinate (COO) triplets, from compressed arrays or from dense xMatrix,
+ * and multiplied with dense vectors (SpMV) and dense matrices (SpMM). All functions have prefix `xSparseMatrix_`.
+ *
+ * Matrix with `nnz` stored elements and `n` compressed rows (or columns) takes `(n + 1 + nnz) * sizeof(xSize) + nnz *
+ * sizeof(float)` bytes, so graphs and other matrices with small fraction of non-zero elements take orders of magnitude less
+ * memory than dense xMatrix of same dimensions.
+ *
+ * Products of large matrices are split into parts with similar number of stored elements, processed by library-wide
+ * xThreadPool. Results do not depend on number of threads.
+ */
+
+#ifndef XLINEAR_SPARSEMATRIX_H
+#define XLINEAR_SPARSEMATRIX_H
+
+#include "xBase/xTypes.h"
+#include "xLinear/xMatrix.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief
+ * Storage format of sparse matrix.
+ */
+typedef enum {
+    XSPARSEMATRIX_CSR = 0, /**< Compressed sparse row: elements grouped by rows (fast products with dense operands). */
+    XSPARSEMATRIX_CSC      /**< Compressed sparse column: elements grouped by columns (fast access to columns). */
+} xSparseMatrixFormat;
+
+/**
+ * @brief
+ * Sparse matrix structure introduced by xcFramework.
+ *
+ * @note
+ * Do not access structure members directly. Use provided functions for managing xSparseMatrix object.
+ *
+ * @note
+ * In CSR format, elements of row `i` are stored at positions `pointers[i]` to `pointers[i + 1] - 1` of indices (holding their
+ * columns) and values arrays. In CSC format the same holds for columns, with indices holding rows. Indices are strictly
+ * ascending within each row (column).
+ */
+typedef struct xSparseMatrix_s xSparseMatrix;
+
+/**
+ * @brief
+ * Create sparse matrix from coordinate (COO) triplets.
+ *
+ * @param rows Number of rows.
+ * @param cols Number of columns.
+ * @param count Number of triplets.
+ * @param rowIndices Array of row indices of triplets.
+ * @param colIndices Array of column indices of triplets.
+ * @param values Array of values of triplets.
+ * @param format Storage format of created matrix.
+ * @return Pointer to xSparseMatrix object (NULL if arguments are invalid, some index is out of range or allocation fails).
+ *
+ * @note
+ * Triplets may come in any order. Values of triplets with same coordinates are summed. Triplets are sorted by counting sort
+ * in O(count + rows + cols) time.
+ */
+xSparseMatrix *xSparseMatrix_newFromCOO(xSize rows, xSize cols, xSize count, const xSize *rowIndices, const xSize *colIndices,
+                                        const float *values, xSparseMatrixFormat format);
+
+/**
+ * @brief
+ * Create sparse matrix from copy of compressed (CSR or CSC) arrays.
+ *
+ * @param rows Number of rows.
+ * @param cols Number of columns.
+ * @param pointers Array of rows + 1 (CSR) or cols + 1 (CSC) positions where each row (column) starts, with first element 0
+ * and last element equal to number of stored elements.
+ * @param indices Array of column (CSR) or row (CSC) indices of stored elements.
+ * @param values Array of values of stored elements.
+ * @param format Format of arrays.
+ * @return Pointer to xSparseMatrix object (NULL if arrays are not valid compressed matrix or allocation fails).
+ */
+xSparseMatrix *xSparseMatrix_newFromCompressed(xSize rows, xSize cols, const xSize *pointers, const xSize *indices,
+                                               const float *values, xSparseMatrixFormat format);
+
+/**
+ * @brief
+ * Create sparse matrix holding non-zero elements of dense matrix.
+ *
+ * @param matrix Pointer to xMatrix object.
+ * @param format Storage format of created matrix.
+ * @return Pointer to xSparseMatrix object (NULL if matrix is invalid or allocation fails).
+ */
+xSparseMatrix *xSparseMatrix_newFromDense(const xMatrix *matrix, xSparseMatrixFormat format);
+
+/**
+ * @brief
+ * Free sparse matrix from memory.
+ *
+ * @param matrix Pointer to xSparseMatrix object to free.
+ */
+void xSparseMatrix_free(xSparseMatrix *matrix);
+
+/**
+ * @brief
+ * Get number of rows of sparse matrix.
+ *
+ * @param matrix Pointer to xSparseMatrix object.
+ * @return xSize Number of rows (0 if matrix is NULL).
+ */
+extern xSize xSparseMatrix_getRows(const xSparseMatrix *matrix);
+
+/**
+ * @brief
+ * Get number of columns of sparse matrix.
+ *
+ * @param matrix Pointer to xSparseMatrix object.
+ * @return xSize Number of columns (0 if matrix is NULL).
+ */
+extern xSize xSparseMatrix_getCols(const xSparseMatrix *matrix);
+
+/**
+ * @brief
+ * Get number of stored elements of sparse matrix.
+ *
+ * @param matrix Pointer to xSparseMatrix object.
+ * @return xSize Number of stored elements (0 if matrix is NULL).
+ */
+extern xSize xSparseMatrix_getNonZeroCount(const xSparseMatrix *matrix);
+
+/**
+ * @brief
+ * Get storage format of sparse matrix.
+ *
+ * @param matrix Pointer to xSparseMatrix object.
+ * @return xSparseMatrixFormat Format of matrix (XSPARSEMATRIX_CSR if matrix is NULL).
+ */
+extern xSparseMatrixFormat xSparseMatrix_getFormat(const xSparseMatrix *matrix);
+
+/**
+ * @brief
+ * Get array of positions where each compressed row (column) starts.
+ *
+ * @param matrix Pointer to xSparseMatrix object.
+ * @return const xSize* Array of rows + 1 (CSR) or cols + 1 (CSC) elements (NULL if matrix is NULL).
+ */
+extern const xSize *xSparseMatrix_getPointers(const xSparseMatrix *matrix);
+
+/**
+ * @brief
+ * Get array of column (CSR) or row (CSC) indices of stored elements.
+ *
+ * @param matrix Pointer to xSparseMatrix object.
+ * @return const xSize* Array of indices (NULL if matrix is NULL).
+ */
+extern const xSize *xSparseMatrix_getIndices(const xSparseMatrix *matrix);
+
+/**
+ * @brief
+ * Get array of values of stored elements.
+ *
+ * @param matrix Pointer to xSparseMatrix object.
+ * @return const float* Array of values (NULL if matrix is NULL).
+ */
+extern const float *xSparseMatrix_getValues(const xSparseMatrix *matrix);
+
+/**
+ * @brief
+ * Get element of sparse matrix.
+ *
+ * @param matrix Pointer to xSparseMatrix object.
+ * @param row Row of element.
+ * @param col Column of element.
+ * @return float Value of element (0 if it is not stored or arguments are invalid).
+ *
+ * @note
+ * Element is found by binary search over its row (CSR) or column (CSC).
+ */
+float xSparseMatrix_get(const xSparseMatrix *matrix, xSize row, xSize col);
+
+/**
+ * @brief
+ * Create copy of sparse matrix in given storage format.
+ *
+ * @param matrix Pointer to xSparseMatrix object.
+ * @param format Storage format of created matrix.
+ * @return Pointer to new xSparseMatrix object (NULL if matrix is invalid or allocation fails).
+ *
+ * @note
+ * Conversion between formats takes O(rows + cols + nnz) time.
+ */
+xSparseMatrix *xSparseMatrix_convert(const xSparseMatrix *matrix, xSparseMatrixFormat format);
+
+/**
+ * @brief
+ * Create transpose of sparse matrix.
+ *
+ * @param matrix Pointer to xSparseMatrix object.
+ * @return Pointer to new xSparseMatrix object (NULL if matrix is invalid or allocation fails).
+ *
+ * @note
+ * CSR arrays of matrix are CSC arrays of its transpose, so transpose is plain copy in opposite format. Convert it to original
+ * format with xSparseMatrix_convert() if needed (e.g. CSR transpose for fast products with transposed graph).
+ */
+xSparseMatrix *xSparseMatrix_transpose(const xSparseMatrix *matrix);
+
+/**
+ * @brief
+ * Create dense matrix with elements of sparse matrix.
+ *
+ * @param matrix Pointer to xSparseMatrix object.
+ * @return Pointer to new xMatrix object (NULL if matrix is invalid or allocation fails).
+ */
+xMatrix *xSparseMatrix_toDense(const xSparseMatrix *matrix);
+
+/**
+ * @brief
+ * Multiply sparse matrix by dense vector (SpMV), computing y = Ax.
+ *
+ * @param matrix Pointer to xSparseMatrix object holding A.
+ * @param x Array of cols elements of vector x.
+ * @param y Array of rows elements receiving vector y (overwritten).
+ * @return xBool true on success, false if arguments are invalid.
+ *
+ * @note
+ * Products of large matrices are computed by shared xThreadPool, in row ranges with similar number of stored elements. CSC
+ * matrices first count elements of each row and every part scans all columns for its rows, so convert matrices multiplied
+ * repeatedly to CSR.
+ *
+ * @warning
+ * Arrays x and y must not overlap.
+ */
+xBool xSparseMatrix_mulVector(const xSparseMatrix *matrix, const float *x, float *y);
+
+/**
+ * @brief
+ * Multiply sparse matrix by dense matrix (SpMM).
+ *
+ * @param lhs Pointer to xSparseMatrix object.
+ * @param rhs Pointer to xMatrix object.
+ * @return Pointer to new xMatrix object holding product (NULL if arguments are invalid, dimensions are incompatible or
+ * allocation fails).
+ */
+xMatrix *xSparseMatrix_mul(const xSparseMatrix *lhs, const xMatrix *rhs);
+
+/**
+ * @brief
+ * Multiply sparse matrix by dense matrix (SpMM) and store result in dense matrix without allocating new matrix.
+ *
+ * @param res Pointer to xMatrix object receiving product.
+ * @param lhs Pointer to xSparseMatrix object.
+ * @param rhs Pointer to xMatrix object.
+ * @return Passthrough pointer to res matrix (NULL if arguments are invalid or dimensions are incompatible).
+ *
+ * @note
+ * Large products are computed by shared xThreadPool: CSR matrices in row ranges with similar number of stored elements, CSC
+ * matrices in strips of columns of result (or in row ranges like CSR matrices if result is single strip wide).
+ *
+ * @warning
+ * Result matrix must be different object than rhs matrix.
+ */
+xMatrix *xSparseMatrix_mul_inplace(xMatrix *res, const xSparseMatrix *lhs, const xMatrix *rhs);
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // XLINEAR_SPARSEMATRIX_H
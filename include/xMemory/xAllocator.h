@@ -0,0 +1,88 @@
+/**
+ * @file xAllocator.h
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief Pluggable memory allocator interface.
+ * @version 0.1
+ * @date 18.10.2026.
+ *
+ * Module declares allocator interface used by all xcFramework containers for their internal memory. Containers created with
+ * `_newWithAllocator` constructors route every allocation through given allocator, while plain constructors use default
+ * allocator backed by standard library. All functions have prefix `xAllocator_`.
+ */
+
+#ifndef XMEMORY_ALLOCATOR_H
+#define XMEMORY_ALLOCATOR_H
+
+#include "xBase/xTypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief
+ * Allocator interface (table of allocation functions with user context).
+ *
+ * @note
+ * All functions receive `ctx` member as their first argument. Sizes passed to `realloc` and `free` are always equal to size
+ * of block given at its allocation (or last reallocation), so allocators do not need to track sizes themselves.
+ *
+ * @note
+ * `realloc` may be NULL, in which case reallocation is performed using `alloc`, copy and `free`. `free` may be NULL for
+ * allocators which release memory in bulk (e.g. arenas).
+ *
+ * @warning
+ * Containers keep pointer to allocator object, so it has to outlive every container constructed with it.
+ */
+typedef struct xAllocator_s {
+    void *(*alloc)(void *ctx, xSize size);
+    void *(*realloc)(void *ctx, void *ptr, xSize oldSize, xSize newSize);
+    void (*free)(void *ctx, void *ptr, xSize size);
+    void *ctx;
+} xAllocator;
+
+/**
+ * @brief
+ * Get default allocator (standard library malloc, realloc and free).
+ *
+ * @return const xAllocator* Pointer to default allocator.
+ */
+const xAllocator *xAllocator_getDefault(void);
+
+/**
+ * @brief
+ * Allocate memory block using given allocator.
+ *
+ * @param allocator Pointer to allocator (default allocator if NULL).
+ * @param size Size of memory block in bytes.
+ * @return void* Pointer to allocated memory or NULL on failure.
+ */
+void *xAllocator_alloc(const xAllocator *allocator, xSize size);
+
+/**
+ * @brief
+ * Resize memory block previously allocated with given allocator.
+ *
+ * @param allocator Pointer to allocator (default allocator if NULL).
+ * @param ptr Pointer to memory block (NULL behaves like allocation).
+ * @param oldSize Current size of memory block in bytes.
+ * @param newSize Requested size of memory block in bytes.
+ * @return void* Pointer to resized memory or NULL on failure (original block is left untouched).
+ */
+void *xAllocator_realloc(const xAllocator *allocator, void *ptr, xSize oldSize, xSize newSize);
+
+/**
+ * @brief
+ * Release memory block previously allocated with given allocator.
+ *
+ * @param allocator Pointer to allocator (default allocator if NULL).
+ * @param ptr Pointer to memory block (NULL is ignored).
+ * @param size Size of memory block in bytes.
+ */
+void xAllocator_free(const xAllocator *allocator, void *ptr, xSize size);
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // XMEMORY_ALLOCATOR_H
@@ -0,0 +1,192 @@
+/**
+ * @file xArena.h
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief Arena (bump) allocator implementation.
+ * @version 0.1
+ * @date 18.10.2026.
+ *
+ * Module declares arena allocator which hands out memory by advancing pointer inside large blocks. Individual allocations are
+ * never freed, instead whole arena is reset or rewound to previously taken mark at once. All functions have prefix `xArena_`.
+ */
+
+#ifndef XMEMORY_ARENA_H
+#define XMEMORY_ARENA_H
+
+#include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief
+ * Size of memory block requested by arena when no block size is given.
+ */
+#define XARENA_DEFAULT_BLOCK_SIZE 65536
+
+/**
+ * @brief
+ * Alignment of memory returned by xArena_alloc() (sufficient for any fundamental type).
+ */
+#define XARENA_DEFAULT_ALIGNMENT 16
+
+/**
+ * @brief
+ * Arena structure introduced by xcFramework.
+ *
+ * @note
+ * Do not access structure members directly. Use provided functions for managing xArena object.
+ */
+typedef struct xArena_s xArena;
+
+/**
+ * @brief
+ * Snapshot of arena allocation position used for rewinding.
+ *
+ * @note
+ * Do not access structure members directly. Use xArena_mark() to take mark and xArena_rewind() to return to it.
+ */
+typedef struct xArenaMark_s {
+    xArena *arena;
+    void *block;
+    xSize used;
+} xArenaMark;
+
+/**
+ * @brief
+ * Create new empty arena.
+ *
+ * @param blockSize Size of memory blocks arena requests from system (XARENA_DEFAULT_BLOCK_SIZE if 0).
+ * @return xArena* Pointer to new arena or NULL if memory allocation failed.
+ *
+ * @note
+ * No memory block is allocated until first allocation from arena.
+ */
+xArena *xArena_new(xSize blockSize);
+
+/**
+ * @brief
+ * Create new empty arena which obtains its blocks from given allocator.
+ *
+ * @param blockSize Size of memory blocks arena requests from allocator (XARENA_DEFAULT_BLOCK_SIZE if 0).
+ * @param allocator Allocator providing arena blocks (default allocator if NULL).
+ * @return xArena* Pointer to new arena or NULL if memory allocation failed.
+ */
+xArena *xArena_newWithAllocator(xSize blockSize, const xAllocator *allocator);
+
+/**
+ * @brief
+ * Free arena and all memory allocated from it.
+ *
+ * @param arena Pointer to arena to free.
+ *
+ * @warning
+ * All pointers previously returned by arena become invalid.
+ */
+void xArena_free(xArena *arena);
+
+/**
+ * @brief
+ * Allocate memory block from arena with default alignment.
+ *
+ * @param arena Pointer to arena.
+ * @param size Size of memory block in bytes.
+ * @return void* Pointer to uninitialized memory or NULL on failure.
+ *
+ * @note
+ * Returned memory is aligned to XARENA_DEFAULT_ALIGNMENT bytes. Allocation of 0 bytes returns NULL.
+ */
+void *xArena_alloc(xArena *arena, xSize size);
+
+/**
+ * @brief
+ * Allocate memory block from arena with given alignment.
+ *
+ * @param arena Pointer to arena.
+ * @param size Size of memory block in bytes.
+ * @param alignment Required alignment in bytes (must be power of 2).
+ * @return void* Pointer to uninitialized memory or NULL on failure or invalid alignment.
+ */
+void *xArena_allocAligned(xArena *arena, xSize size, xSize alignment);
+
+/**
+ * @brief
+ * Get allocator interface serving memory from arena.
+ *
+ * @param arena Pointer to arena.
+ * @return const xAllocator* Pointer to allocator owned by arena (valid until arena is freed) or NULL if arena is NULL.
+ *
+ * @note
+ * Passing returned allocator to `_newWithAllocator` constructors places container memory into arena. Freeing memory through
+ * this allocator is no-op except for most recent allocation, so containers should be released by resetting or rewinding arena.
+ */
+const xAllocator *xArena_getAllocator(xArena *arena);
+
+/**
+ * @brief
+ * Get number of bytes currently allocated from arena.
+ *
+ * @param arena Pointer to arena.
+ * @return xSize Number of bytes in use, including alignment padding.
+ */
+xSize xArena_getUsed(const xArena *arena);
+
+/**
+ * @brief
+ * Release all allocations made from arena at once.
+ *
+ * @param arena Pointer to arena.
+ *
+ * @note
+ * Memory blocks are kept by arena and reused by following allocations, so reset itself is constant-time.
+ *
+ * @warning
+ * All pointers previously returned by arena become invalid.
+ */
+void xArena_reset(xArena *arena);
+
+/**
+ * @brief
+ * Take snapshot of current allocation position of arena.
+ *
+ * @param arena Pointer to arena.
+ * @return xArenaMark Mark that can be passed to xArena_rewind().
+ */
+xArenaMark xArena_mark(xArena *arena);
+
+/**
+ * @brief
+ * Release all allocations made from arena after mark was taken.
+ *
+ * @param mark Pointer to mark previously returned by xArena_mark().
+ *
+ * @note
+ * Function takes pointer so it can be deferred directly, see XARENA_DEFER_REWIND.
+ *
+ * @warning
+ * Mark becomes unusable once arena is reset or rewound to older mark.
+ */
+void xArena_rewind(const xArenaMark *mark);
+
+/**
+ * @brief
+ * Take mark of arena and rewind arena to it on exit of enclosing defer scope.
+ *
+ * @param arena Pointer to arena.
+ *
+ * @note
+ * Must be used inside XDEFER_SCOPE (see xDefer.h). Allocations made from arena after this statement are released when scope
+ * exits, after all functions deferred later in the scope are called.
+ */
+#define XARENA_DEFER_REWIND(arena) XARENA_DEFER_REWIND_(arena, __LINE__)
+#define XARENA_DEFER_REWIND_(arena, line) XARENA_DEFER_REWIND__(arena, line)
+#define XARENA_DEFER_REWIND__(arena, line)                     \
+    xArenaMark _xc_ArenaMark_##line##_ = xArena_mark(arena); \
+    DEFER(xArena_rewind, &_xc_ArenaMark_##line##_)
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // XMEMORY_ARENA_H
@@ -16,6 +16,7 @@
 #define XMEMORY_DEFER_H
 
 #include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +31,7 @@ typedef struct DeferStack_s {
     DeferFunc *funcs;
     xSize size;
     xSize capacity;
+    const xAllocator *allocator;
 } DeferStack;
 
 #define DEFER_STACK_INIT_CAPACITY 16
@@ -45,6 +47,18 @@ typedef struct DeferStack_s {
  */
 void xDefer_stackInit(DeferStack *stack);
 
+/**
+ * @brief
+ * Initialize a defer stack which obtains its memory from given allocator.
+ *
+ * @param stack The defer stack to be initialized.
+ * @param allocator Allocator used for the stack (default allocator if NULL).
+ *
+ * @warning
+ * This function should not be called directly. Use XDEFER_SCOPE_WITH_ALLOCATOR instead to declare a defer scope.
+ */
+void xDefer_stackInitWithAllocator(DeferStack *stack, const xAllocator *allocator);
+
 /**
  * @brief
  * Push a function call with argument to the defer stack.
@@ -77,6 +91,16 @@ void xDefer_stackPopAll(DeferStack *stack);
     DeferStack _xc_DeferStack_ __attribute__((cleanup(xDefer_stackPopAll))) = {0}; \
     xDefer_stackInit(&_xc_DeferStack_);
 
+/**
+ * @brief
+ * Declare a defer scope whose bookkeeping memory comes from given allocator.
+ *
+ * @param allocator Pointer to allocator (must stay valid until the scope exits).
+ */
+#define XDEFER_SCOPE_WITH_ALLOCATOR(allocator)                                     \
+    DeferStack _xc_DeferStack_ __attribute__((cleanup(xDefer_stackPopAll))) = {0}; \
+    xDefer_stackInitWithAllocator(&_xc_DeferStack_, (allocator));
+
 /**
  * @brief
  * Defer a function call with argument.
@@ -0,0 +1,152 @@
+/**
+ * @file xPool.h
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief Fixed-size object pool allocator implementation.
+ * @version 0.1
+ * @date 18.10.2026.
+ *
+ * Module declares pool allocator serving small objects from per-size-class free lists carved out of large pages. It is meant
+ * as backing allocator for containers doing many same-sized allocations (list nodes, string headers). All functions have
+ * prefix `xPool_`.
+ */
+
+#ifndef XMEMORY_POOL_H
+#define XMEMORY_POOL_H
+
+#include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief
+ * Size of memory page requested by pool when no page size is given.
+ */
+#define XPOOL_DEFAULT_PAGE_SIZE 65536
+
+/**
+ * @brief
+ * Granularity of pool size classes in bytes (also alignment of every object served from pages).
+ */
+#define XPOOL_SIZE_CLASS_GRANULARITY 16
+
+/**
+ * @brief
+ * Largest object size served from pool pages. Larger requests are forwarded to backing allocator.
+ */
+#define XPOOL_MAX_OBJECT_SIZE 512
+
+/**
+ * @brief
+ * Pool structure introduced by xcFramework.
+ *
+ * @note
+ * Do not access structure members directly. Use provided functions for managing xPool object.
+ */
+typedef struct xPool_s xPool;
+
+/**
+ * @brief
+ * Create new empty pool.
+ *
+ * @param pageSize Size of pages pool requests from system (XPOOL_DEFAULT_PAGE_SIZE if 0).
+ * @param threadCache Whether objects should be cached per thread (makes pool safe to use from multiple threads).
+ * @return xPool* Pointer to new pool or NULL if memory allocation failed.
+ *
+ * @note
+ * Page size smaller than required to hold at least one object of largest size class is rounded up.
+ */
+xPool *xPool_new(xSize pageSize, xBool threadCache);
+
+/**
+ * @brief
+ * Create new empty pool which obtains its pages from given allocator.
+ *
+ * @param pageSize Size of pages pool requests from allocator (XPOOL_DEFAULT_PAGE_SIZE if 0).
+ * @param threadCache Whether objects should be cached per thread (makes pool safe to use from multiple threads).
+ * @param allocator Allocator providing pages and objects larger than XPOOL_MAX_OBJECT_SIZE (default allocator if NULL).
+ * @return xPool* Pointer to new pool or NULL if memory allocation failed.
+ *
+ * @warning
+ * With thread caches enabled, backing allocator has to be thread-safe as well (default allocator is).
+ */
+xPool *xPool_newWithAllocator(xSize pageSize, xBool threadCache, const xAllocator *allocator);
+
+/**
+ * @brief
+ * Free pool and all memory allocated from it.
+ *
+ * @param pool Pointer to pool to free.
+ *
+ * @warning
+ * All objects previously returned by pool become invalid, including ones still held by other threads.
+ */
+void xPool_free(xPool *pool);
+
+/**
+ * @brief
+ * Allocate object from pool.
+ *
+ * @param pool Pointer to pool.
+ * @param size Size of object in bytes.
+ * @return void* Pointer to uninitialized memory or NULL on failure.
+ *
+ * @note
+ * Size is rounded up to multiple of XPOOL_SIZE_CLASS_GRANULARITY and returned memory is aligned to it. Allocation of 0 bytes
+ * returns NULL.
+ */
+void *xPool_alloc(xPool *pool, xSize size);
+
+/**
+ * @brief
+ * Return object to pool.
+ *
+ * @param pool Pointer to pool object was allocated from.
+ * @param ptr Pointer to object (NULL is ignored).
+ * @param size Size of object in bytes, same as passed to xPool_alloc().
+ */
+void xPool_release(xPool *pool, void *ptr, xSize size);
+
+/**
+ * @brief
+ * Get allocator interface serving memory from pool.
+ *
+ * @param pool Pointer to pool.
+ * @return const xAllocator* Pointer to allocator owned by pool (valid until pool is freed) or NULL if pool is NULL.
+ *
+ * @note
+ * Passing returned allocator to `_newWithAllocator` constructors makes small container allocations (list nodes, string
+ * headers and reference counters) come from pool, while large buffers are forwarded to backing allocator.
+ */
+const xAllocator *xPool_getAllocator(xPool *pool);
+
+/**
+ * @brief
+ * Get number of pages currently owned by pool.
+ *
+ * @param pool Pointer to pool.
+ * @return xSize Number of pages (0 if pool is NULL).
+ */
+xSize xPool_getPageCount(const xPool *pool);
+
+/**
+ * @brief
+ * Return objects cached by calling thread back to their pool.
+ *
+ * @note
+ * Each thread caches objects of up to 4 pools at once, so code alternating between few pools does not return objects on
+ * every switch. Cache of least recently used pool is returned when objects of fifth pool are requested.
+ *
+ * @note
+ * Thread caches hold limited number of objects per size class. Objects left in cache of exited thread become reusable only
+ * after their pool is freed, so long-running programs should call this function before worker threads exit.
+ */
+void xPool_flushThreadCache(void);
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // XMEMORY_POOL_H
@@ -16,7 +16,9 @@
 extern "C" {
 #endif
 
+#include "xBase/xMemtools.h"
 #include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
 
 /**
  * @brief
@@ -31,6 +33,12 @@ xSize cstrlen(const xChar *cstr);
  * @brief
  * String type introduced by xcFramework.
  *
+ * @note
+ * Strings of up to 23 characters are stored inside the string structure (in place of fields describing heap data, so the
+ * structure does not grow), so they take single allocation and are copied instead of shared. Data of longer strings is
+ * shared between copies and substrings, and its atomic reference counter is stored at the start of the same heap block, so
+ * that copying never allocates counter or modifies the source string, and const strings may be copied concurrently.
+ *
  * @warning
  * Even if structure is stack-allocated, it is recommended to free it with xString_free function due to internal pointers.
  */
@@ -41,16 +49,26 @@ typedef struct xString_s xString;
  * Creates new blank xString object.
  *
  * @note
- * Initially string capacity is 0, length is 0, and data is NULL. Only reference counter is allocated and initialized.
- *
- * @note
- * If reference counter is not allocated successfully, its pointer will also be set to NULL.
+ * Initially string capacity is 0, length is 0, and data is NULL. Only string structure is allocated.
  *
  * @return
  * xString object with no data.
  */
 xString *xString_new(void);
 
+/**
+ * @brief
+ * Creates new blank xString object which obtains all of its memory from given allocator.
+ *
+ * @param allocator Allocator used for string structure, data and reference counter (default allocator if NULL).
+ * @return xString object with no data.
+ *
+ * @note
+ * Strings derived from this one (copies, substrings, results of append, insert, replace and remove) use the same allocator.
+ * C strings returned by xString_toCString() are always allocated with standard library.
+ */
+xString *xString_newWithAllocator(const xAllocator *allocator);
+
 /**
  * @brief
  * Frees xString heap elements of xString object.
@@ -212,7 +230,7 @@ xString *xString_substring(const xString *str, xSize start, xSize end);
  * matches found or invalid arguments given.
  *
  * @note
- * If function fails anywhere internally, it will return XSIZE_MAX.
+ * Search is done by xMemFind() in linear time without allocating memory, so it is cheap to call in loops.
  */
 xSize xString_find(const xString *str, const xChar *data, xSize len);
 
@@ -229,12 +247,12 @@ xSize xString_findLast(const xString *str, const xChar *data, xSize len);
 
 /**
  * @brief
- * Count number of occurences of pattern in xString object.
+ * Count number of non-overlapping occurences of pattern in xString object.
  *
  * @param haystack Pointer to xString object to serach in.
  * @param needle Pattern to search for.
  * @param len Length of pattern.
- * @return Number of pattern matches in xString object.
+ * @return Number of pattern matches in xString object (same as number of replacements done by xString_replaceAll()).
  */
 xSize xString_count(const xString *haystack, const xChar *needle, xSize len);
 
@@ -322,9 +340,70 @@ xString *xString_insert(const xString *str, const xChar *data, xSize len, xSize
  * @param delimiter Delimiter string.
  * @param delimiterLen Length of delimiter string.
  * @param count Pointer to variable to store number of split parts.
- * @return Array of xString objects.
+ * @return Array of count pointers to xString objects (NULL if arguments are invalid or allocation fails).
+ *
+ * @note
+ * Parts are substrings sharing data of original string (only parts of strings stored inside string structure copy their
+ * characters), and whole array with its parts takes single allocation. String with n non-overlapping delimiter occurrences
+ * splits into n + 1 parts, including empty parts between adjacent delimiters and at both ends of string.
+ *
+ * @warning
+ * Returned array must be freed with xString_freeSplit(), never free its parts with xString_free(). Use xString_copy() on part
+ * to keep it after array is freed.
+ */
+xString **xString_split(const xString *str, const xChar *delimiter, xSize delimiterLen, xSize *count);
+
+/**
+ * @brief
+ * Free array of parts returned by xString_split().
+ *
+ * @param parts Array of parts.
+ * @param count Number of parts.
+ */
+void xString_freeSplit(xString **parts, xSize count);
+
+/**
+ * @brief
+ * Iterator over parts of string split by delimiter.
+ *
+ * @note
+ * Do not access structure members directly. Use xString_splitBegin() and xString_splitNext() instead.
+ *
+ * @note
+ * Iterator refers to string data and delimiter without copying them, so both must stay unchanged while iterator is used.
+ */
+typedef struct xStringSplitIterator_s {
+    const xChar *data;  /**< Characters remaining after last returned part. */
+    xSize remaining;    /**< Number of remaining characters. */
+    xBool finished;     /**< Whether last part was returned. */
+    xMemFinder finder;  /**< Finder of delimiter. */
+} xStringSplitIterator;
+
+/**
+ * @brief
+ * Initialize iterator over parts of xString object split by delimiter.
+ *
+ * @param iter Pointer to iterator.
+ * @param str Pointer to xString object to split.
+ * @param delimiter Delimiter string.
+ * @param delimiterLen Length of delimiter string.
+ *
+ * @note
+ * Iterator returns same parts as xString_split() without allocating memory. If arguments are invalid, iterator returns no
+ * parts.
+ */
+void xString_splitBegin(xStringSplitIterator *iter, const xString *str, const xChar *delimiter, xSize delimiterLen);
+
+/**
+ * @brief
+ * Get next part of split string.
+ *
+ * @param iter Pointer to initialized iterator.
+ * @param part Pointer to variable receiving address of part characters (not null-terminated, NULL for empty string).
+ * @param len Pointer to variable receiving length of part.
+ * @return xBool true if part was returned, false if all parts were already returned.
  */
-xString *xString_split(const xString *str, const xChar *delimiter, xSize delimiterLen, xSize *count);
+xBool xString_splitNext(xStringSplitIterator *iter, const xChar **part, xSize *len);
 
 /**
  * @brief
@@ -0,0 +1,199 @@
+/**
+ * @file xStringMatcher.h
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief Multi-pattern string matching with Aho-Corasick automaton.
+ * @version 0.1
+ * @date 18.10.2026.
+ *
+ * Module declares matcher object built once from set of patterns (keywords), which then finds occurrences of all of them in
+ * single pass over xString object or character buffer. Matcher is Aho-Corasick automaton converted to dense DFA over byte
+ * classes (byte values not distinguished by any pattern share one column of transition table), so each input byte costs single
+ * table lookup regardless of number of patterns. All functions have prefix `xStringMatcher_`.
+ */
+
+#ifndef XSTRING_MATCHER_H
+#define XSTRING_MATCHER_H
+
+#include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
+#include "xString/xString.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief
+ * Multi-pattern matcher introduced by xcFramework.
+ *
+ * @note
+ * Do not access structure members directly. Use provided functions for managing xStringMatcher object.
+ *
+ * @note
+ * Matcher is immutable after construction, so single matcher can be used by multiple threads at once.
+ */
+typedef struct xStringMatcher_s xStringMatcher;
+
+/**
+ * @brief
+ * Single occurrence of pattern found by matcher.
+ */
+typedef struct xStringMatch_s {
+    xSize pattern; /**< Index of matched pattern (in order patterns were passed to xStringMatcher_new()). */
+    xSize start;   /**< Index of first character of occurrence. */
+    xSize end;     /**< Index one past last character of occurrence. */
+} xStringMatch;
+
+/**
+ * @brief
+ * Function receiving matches found by xStringMatcher_scan().
+ *
+ * @param context User pointer passed to scanning function.
+ * @param match Pointer to found match (valid only during the call).
+ * @return xBool true to continue scanning, false to stop.
+ */
+typedef xBool (*xStringMatcherFunc)(void *context, const xStringMatch *match);
+
+/**
+ * @brief
+ * Build matcher for set of patterns.
+ *
+ * @param patterns Array of pointers to pattern characters.
+ * @param lengths Array of pattern lengths.
+ * @param count Number of patterns.
+ * @return Pointer to xStringMatcher object (NULL if arguments are invalid, some pattern is empty or allocation fails).
+ *
+ * @note
+ * Patterns are not referenced after construction. Construction takes O(total length * byte classes) time and memory, where
+ * number of byte classes is number of distinct bytes occurring in patterns plus one.
+ *
+ * @note
+ * Duplicate patterns are allowed and reported separately.
+ */
+xStringMatcher *xStringMatcher_new(const xChar *const *patterns, const xSize *lengths, xSize count);
+
+/**
+ * @brief
+ * Build matcher for set of patterns, obtaining matcher memory from given allocator.
+ *
+ * @param patterns Array of pointers to pattern characters.
+ * @param lengths Array of pattern lengths.
+ * @param count Number of patterns.
+ * @param allocator Allocator used for matcher and temporary construction memory (default allocator if NULL).
+ * @return Pointer to xStringMatcher object (NULL if arguments are invalid, some pattern is empty or allocation fails).
+ */
+xStringMatcher *xStringMatcher_newWithAllocator(const xChar *const *patterns, const xSize *lengths, xSize count,
+                                                const xAllocator *allocator);
+
+/**
+ * @brief
+ * Free matcher from memory.
+ *
+ * @param matcher Pointer to xStringMatcher object to free.
+ */
+void xStringMatcher_free(xStringMatcher *matcher);
+
+/**
+ * @brief
+ * Get number of patterns of matcher.
+ *
+ * @param matcher Pointer to xStringMatcher object.
+ * @return xSize Number of patterns (0 if matcher is NULL).
+ */
+extern xSize xStringMatcher_getPatternCount(const xStringMatcher *matcher);
+
+/**
+ * @brief
+ * Get number of states of matcher automaton.
+ *
+ * @param matcher Pointer to xStringMatcher object.
+ * @return xSize Number of states (0 if matcher is NULL).
+ */
+extern xSize xStringMatcher_getStateCount(const xStringMatcher *matcher);
+
+/**
+ * @brief
+ * Report all occurrences of all patterns in xString object.
+ *
+ * @param matcher Pointer to xStringMatcher object.
+ * @param str Pointer to xString object to search in.
+ * @param func Function receiving matches.
+ * @param context User pointer passed to func.
+ * @return xSize Number of reported matches (0 if arguments are invalid).
+ *
+ * @note
+ * Matches are reported in order of their end index. Matches ending at the same index are reported from longest to shortest,
+ * and matches of the same pattern text in order of pattern index. Overlapping matches are all reported.
+ */
+xSize xStringMatcher_scan(const xStringMatcher *matcher, const xString *str, xStringMatcherFunc func, void *context);
+
+/**
+ * @brief
+ * Report all occurrences of all patterns in character buffer.
+ *
+ * @param matcher Pointer to xStringMatcher object.
+ * @param data Pointer to characters to search in.
+ * @param len Number of characters.
+ * @param func Function receiving matches.
+ * @param context User pointer passed to func.
+ * @return xSize Number of reported matches (0 if arguments are invalid).
+ */
+xSize xStringMatcher_scanIn(const xStringMatcher *matcher, const xChar *data, xSize len, xStringMatcherFunc func,
+                            void *context);
+
+/**
+ * @brief
+ * Count occurrences of all patterns in xString object.
+ *
+ * @param matcher Pointer to xStringMatcher object.
+ * @param str Pointer to xString object to search in.
+ * @return xSize Number of occurrences, same as number of matches reported by xStringMatcher_scan() (0 if arguments are invalid).
+ *
+ * @note
+ * Counting does not visit individual matches, so it costs single table lookup per input byte.
+ */
+xSize xStringMatcher_count(const xStringMatcher *matcher, const xString *str);
+
+/**
+ * @brief
+ * Count occurrences of all patterns in character buffer.
+ *
+ * @param matcher Pointer to xStringMatcher object.
+ * @param data Pointer to characters to search in.
+ * @param len Number of characters.
+ * @return xSize Number of occurrences (0 if arguments are invalid).
+ */
+xSize xStringMatcher_countIn(const xStringMatcher *matcher, const xChar *data, xSize len);
+
+/**
+ * @brief
+ * Find first occurrence of any pattern in xString object.
+ *
+ * @param matcher Pointer to xStringMatcher object.
+ * @param str Pointer to xString object to search in.
+ * @param match Pointer to variable receiving found match (can be NULL if only presence is tested).
+ * @return xBool true if some pattern occurs in string, false otherwise.
+ *
+ * @note
+ * Found match is the one with smallest end index (longest one if several end at the same index), which is the first match
+ * reported by xStringMatcher_scan(). Scanning stops at that index.
+ */
+xBool xStringMatcher_findFirst(const xStringMatcher *matcher, const xString *str, xStringMatch *match);
+
+/**
+ * @brief
+ * Find first occurrence of any pattern in character buffer.
+ *
+ * @param matcher Pointer to xStringMatcher object.
+ * @param data Pointer to characters to search in.
+ * @param len Number of characters.
+ * @param match Pointer to variable receiving found match (can be NULL if only presence is tested).
+ * @return xBool true if some pattern occurs in buffer, false otherwise.
+ */
+xBool xStringMatcher_findFirstIn(const xStringMatcher *matcher, const xChar *data, xSize len, xStringMatch *match);
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // XSTRING_MATCHER_H
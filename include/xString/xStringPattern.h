@@ -0,0 +1,162 @@
+/**
+ * @file xStringPattern.h
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief Precompiled search patterns for repeated substring lookups.
+ * @version 0.1
+ * @date 18.10.2026.
+ *
+ * Module declares pattern object compiled once from needle and then searched for in any number of xString objects or raw
+ * character buffers. Compiled pattern holds copy of needle with its search state (rare bytes used by vectorized candidate
+ * filter and Two-Way factorizations), so searches do not repeat needle preprocessing and never allocate memory. All functions
+ * have prefix `xStringPattern_`.
+ */
+
+#ifndef XSTRING_PATTERN_H
+#define XSTRING_PATTERN_H
+
+#include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
+#include "xString/xString.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief
+ * Compiled search pattern introduced by xcFramework.
+ *
+ * @note
+ * Do not access structure members directly. Use provided functions for managing xStringPattern object.
+ *
+ * @note
+ * Pattern is immutable after compilation, so single pattern can be used by multiple threads at once.
+ */
+typedef struct xStringPattern_s xStringPattern;
+
+/**
+ * @brief
+ * Compile search pattern from needle.
+ *
+ * @param needle Pointer to needle characters (copied into pattern).
+ * @param len Length of needle.
+ * @return Pointer to xStringPattern object (NULL if needle is NULL or allocation fails).
+ *
+ * @note
+ * Empty needle is allowed and matches at start of every string, same as in xString_find().
+ */
+xStringPattern *xStringPattern_new(const xChar *needle, xSize len);
+
+/**
+ * @brief
+ * Compile search pattern from needle, obtaining pattern memory from given allocator.
+ *
+ * @param needle Pointer to needle characters (copied into pattern).
+ * @param len Length of needle.
+ * @param allocator Allocator used for pattern (default allocator if NULL).
+ * @return Pointer to xStringPattern object (NULL if needle is NULL or allocation fails).
+ */
+xStringPattern *xStringPattern_newWithAllocator(const xChar *needle, xSize len, const xAllocator *allocator);
+
+/**
+ * @brief
+ * Free compiled pattern from memory.
+ *
+ * @param pattern Pointer to xStringPattern object to free.
+ */
+void xStringPattern_free(xStringPattern *pattern);
+
+/**
+ * @brief
+ * Get length of pattern needle.
+ *
+ * @param pattern Pointer to xStringPattern object.
+ * @return xSize Length of needle (0 if pattern is NULL).
+ */
+extern xSize xStringPattern_getLength(const xStringPattern *pattern);
+
+/**
+ * @brief
+ * Get needle characters of pattern.
+ *
+ * @param pattern Pointer to xStringPattern object.
+ * @return const xChar* Pointer to needle (NULL if pattern is NULL).
+ */
+extern const xChar *xStringPattern_getData(const xStringPattern *pattern);
+
+/**
+ * @brief
+ * Find first occurrence of pattern in xString object.
+ *
+ * @param pattern Pointer to xStringPattern object.
+ * @param str Pointer to xString object to search in.
+ * @return xSize Index of first occurrence, XSIZE_MAX if pattern is not found or arguments are invalid.
+ *
+ * @note
+ * Result is the same as result of xString_find() with pattern needle.
+ */
+xSize xStringPattern_find(const xStringPattern *pattern, const xString *str);
+
+/**
+ * @brief
+ * Find first occurrence of pattern in xString object at or after given index.
+ *
+ * @param pattern Pointer to xStringPattern object.
+ * @param str Pointer to xString object to search in.
+ * @param start Index where search starts.
+ * @return xSize Index of first occurrence at or after start, XSIZE_MAX if pattern is not found or arguments are invalid.
+ */
+xSize xStringPattern_findFrom(const xStringPattern *pattern, const xString *str, xSize start);
+
+/**
+ * @brief
+ * Find last occurrence of pattern in xString object.
+ *
+ * @param pattern Pointer to xStringPattern object.
+ * @param str Pointer to xString object to search in.
+ * @return xSize Index of last occurrence, XSIZE_MAX if pattern is not found or arguments are invalid.
+ *
+ * @note
+ * Result is the same as result of xString_findLast() with pattern needle.
+ */
+xSize xStringPattern_findLast(const xStringPattern *pattern, const xString *str);
+
+/**
+ * @brief
+ * Find first occurrence of pattern in character buffer.
+ *
+ * @param pattern Pointer to xStringPattern object.
+ * @param data Pointer to characters to search in.
+ * @param len Number of characters.
+ * @return xSize Index of first occurrence, XSIZE_MAX if pattern is not found or arguments are invalid.
+ *
+ * @note
+ * Useful for scanning lines of large input (e.g. memory-mapped log file) without creating xString object per line.
+ */
+xSize xStringPattern_findIn(const xStringPattern *pattern, const xChar *data, xSize len);
+
+/**
+ * @brief
+ * Count non-overlapping occurrences of pattern in xString object.
+ *
+ * @param pattern Pointer to xStringPattern object.
+ * @param str Pointer to xString object to search in.
+ * @return xSize Number of occurrences (0 if needle is empty or arguments are invalid).
+ */
+xSize xStringPattern_count(const xStringPattern *pattern, const xString *str);
+
+/**
+ * @brief
+ * Count overlapping occurrences of pattern in xString object.
+ *
+ * @param pattern Pointer to xStringPattern object.
+ * @param str Pointer to xString object to search in.
+ * @return xSize Number of occurrences (0 if needle is empty or arguments are invalid).
+ */
+xSize xStringPattern_count_overlapping(const xStringPattern *pattern, const xString *str);
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // XSTRING_PATTERN_H
@@ -12,6 +12,7 @@
 #define XSTRUCTURES_ARRAY_H
 
 #include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -42,6 +43,19 @@ typedef struct xArray_s xArray;
  */
 xArray *xArray_new(xSize elemSize);
 
+/**
+ * @brief
+ * Creates empty xArray object which obtains all of its memory from given allocator.
+ *
+ * @param elemSize Size of single element in bytes.
+ * @param allocator Allocator used for array structure and its data (default allocator if NULL).
+ * @return xArray object with no data.
+ *
+ * @note
+ * Arrays created from this one (copy, filter, map) use the same allocator.
+ */
+xArray *xArray_newWithAllocator(xSize elemSize, const xAllocator *allocator);
+
 /**
  * @brief
  * Free xArray object and its data from memory.
@@ -0,0 +1,177 @@
+/**
+ * @file xConcurrentQueue.h
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief Lock-free bounded queue implementation in xStructures module.
+ * @version 0.1
+ * @date 18.10.2026.
+ *
+ * Module declares fixed-capacity queue safe to use from multiple threads without locks. Queue is either wait-free ring for
+ * single producer and single consumer, or bounded multi-producer multi-consumer queue based on per-slot sequence numbers
+ * (Dmitry Vyukov's design). All functions have prefix `xConcurrentQueue_`.
+ */
+
+#ifndef XSTRUCTURES_CONCURRENTQUEUE_H
+#define XSTRUCTURES_CONCURRENTQUEUE_H
+
+#include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief
+ * Concurrent queue structure introduced by xcFramework.
+ *
+ * @note
+ * Do not access structure members directly. Use provided functions for managing xConcurrentQueue object.
+ */
+typedef struct xConcurrentQueue_s xConcurrentQueue;
+
+/**
+ * @brief
+ * Thread access patterns supported by xConcurrentQueue.
+ */
+typedef enum {
+    XCONCURRENTQUEUE_SPSC = 0, /**< Single producer and single consumer thread (wait-free). */
+    XCONCURRENTQUEUE_MPMC = 1, /**< Any number of producer and consumer threads (lock-free). */
+} xConcurrentQueueMode;
+
+/**
+ * @brief
+ * Create empty xConcurrentQueue object.
+ *
+ * @param elemSize Size of single element in bytes.
+ * @param capacity Maximum number of elements in queue (rounded up to power of 2).
+ * @param mode Thread access pattern queue is used with.
+ * @return Pointer to xConcurrentQueue object or NULL if `elemSize` or `capacity` is zero, mode is unknown or memory
+ * allocation failed.
+ *
+ * @note
+ * Queue never grows, all memory is allocated by this function.
+ */
+xConcurrentQueue *xConcurrentQueue_new(xSize elemSize, xSize capacity, xConcurrentQueueMode mode);
+
+/**
+ * @brief
+ * Create empty xConcurrentQueue object which obtains its memory from given allocator.
+ *
+ * @param elemSize Size of single element in bytes.
+ * @param capacity Maximum number of elements in queue (rounded up to power of 2).
+ * @param mode Thread access pattern queue is used with.
+ * @param allocator Allocator used for queue structure and its slots (default allocator if NULL).
+ * @return Pointer to xConcurrentQueue object or NULL on failure.
+ */
+xConcurrentQueue *xConcurrentQueue_newWithAllocator(xSize elemSize, xSize capacity, xConcurrentQueueMode mode,
+                                                    const xAllocator *allocator);
+
+/**
+ * @brief
+ * Free xConcurrentQueue object and its data from memory.
+ *
+ * @param queue Pointer to xConcurrentQueue object to free.
+ *
+ * @warning
+ * No other thread may use queue while or after it is freed.
+ */
+void xConcurrentQueue_free(xConcurrentQueue *queue);
+
+/**
+ * @brief
+ * Get number of elements in queue.
+ *
+ * @param queue Pointer to xConcurrentQueue object.
+ * @return xSize Number of elements in queue.
+ *
+ * @note
+ * While other threads are using queue, returned value is only approximate.
+ */
+xSize xConcurrentQueue_getSize(const xConcurrentQueue *queue);
+
+/**
+ * @brief
+ * Get maximum number of elements in queue.
+ *
+ * @param queue Pointer to xConcurrentQueue object.
+ * @return xSize Capacity of queue (power of 2).
+ */
+extern xSize xConcurrentQueue_getCapacity(const xConcurrentQueue *queue);
+
+/**
+ * @brief
+ * Get size of single element in queue in bytes.
+ *
+ * @param queue Pointer to xConcurrentQueue object.
+ * @return xSize Size of single element in queue in bytes.
+ */
+extern xSize xConcurrentQueue_getElemSize(const xConcurrentQueue *queue);
+
+/**
+ * @brief
+ * Get thread access pattern of queue.
+ *
+ * @param queue Pointer to xConcurrentQueue object.
+ * @return xConcurrentQueueMode Mode queue was created with (XCONCURRENTQUEUE_SPSC if queue is NULL).
+ */
+extern xConcurrentQueueMode xConcurrentQueue_getMode(const xConcurrentQueue *queue);
+
+/**
+ * @brief
+ * Check if xConcurrentQueue object is valid.
+ *
+ * @param queue Pointer to xConcurrentQueue object.
+ * @return xBool Non-zero if object is valid, zero otherwise.
+ */
+extern xBool xConcurrentQueue_isValid(const xConcurrentQueue *queue);
+
+/**
+ * @brief
+ * Enqueue copy of data to the queue if there is room for it.
+ *
+ * @param queue Pointer to the queue object.
+ * @param data Pointer to element to enqueue.
+ * @return xBool true if element was enqueued, false if queue is full or arguments are invalid.
+ */
+xBool xConcurrentQueue_tryEnqueue(xConcurrentQueue *queue, const void *data);
+
+/**
+ * @brief
+ * Dequeue front element of the queue into caller provided memory if queue is not empty.
+ *
+ * @param queue Pointer to the queue object.
+ * @param dest Pointer to memory of at least element size bytes receiving dequeued element.
+ * @return xBool true if element was dequeued, false if queue is empty or arguments are invalid.
+ */
+xBool xConcurrentQueue_tryDequeue(xConcurrentQueue *queue, void *dest);
+
+/**
+ * @brief
+ * Enqueue copies of multiple consecutive elements to the queue at once.
+ *
+ * @param queue Pointer to the queue object.
+ * @param data Pointer to array of elements to enqueue.
+ * @param count Number of elements in array.
+ * @return xSize Number of elements enqueued from front of array (less than count if queue became full).
+ *
+ * @note
+ * Enqueued elements occupy consecutive positions in queue, elements of other producers are never interleaved with them.
+ */
+xSize xConcurrentQueue_tryEnqueueBatch(xConcurrentQueue *queue, const void *data, xSize count);
+
+/**
+ * @brief
+ * Dequeue multiple front elements of the queue into caller provided array at once.
+ *
+ * @param queue Pointer to the queue object.
+ * @param dest Pointer to array receiving dequeued elements.
+ * @param maxCount Maximum number of elements to dequeue (array length).
+ * @return xSize Number of elements dequeued (0 if queue is empty or arguments are invalid).
+ */
+xSize xConcurrentQueue_tryDequeueBatch(xConcurrentQueue *queue, void *dest, xSize maxCount);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // XSTRUCTURES_CONCURRENTQUEUE_H
@@ -0,0 +1,166 @@
+/**
+ * @file xConcurrentStack.h
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief Lock-free stack implementation in xStructures module.
+ * @version 0.1
+ * @date 18.10.2026.
+ *
+ * Module declares stack structure safe to use from multiple threads without locks (Treiber stack with elimination backoff).
+ * All functions have prefix `xConcurrentStack_`.
+ */
+
+#ifndef XSTRUCTURES_CONCURRENTSTACK_H
+#define XSTRUCTURES_CONCURRENTSTACK_H
+
+#include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief
+ * Concurrent stack structure introduced by xcFramework.
+ *
+ * @note
+ * Do not access structure members directly. Use provided functions for managing xConcurrentStack object.
+ *
+ * @note
+ * Elements are kept in nodes which are recycled by stack and released only when stack is freed. Stack heads hold node
+ * indices tagged with modification counters, so node reuse between read and update of head (ABA problem) is detected.
+ */
+typedef struct xConcurrentStack_s xConcurrentStack;
+
+/**
+ * @brief
+ * Create empty xConcurrentStack object for elements of given size.
+ *
+ * @param elemSize Size of single element in bytes.
+ * @return Pointer to xConcurrentStack object with no data.
+ *
+ * @note
+ * If function fails to allocate memory or `elemSize` is zero, NULL be returned.
+ */
+xConcurrentStack *xConcurrentStack_new(xSize elemSize);
+
+/**
+ * @brief
+ * Create empty xConcurrentStack object which obtains its memory from given allocator.
+ *
+ * @param elemSize Size of single element in bytes.
+ * @param allocator Allocator used for stack structure and its nodes (default allocator if NULL).
+ * @return Pointer to xConcurrentStack object with no data.
+ *
+ * @warning
+ * Allocator has to be thread-safe, as node storage grows from whichever thread pushes to full stack.
+ */
+xConcurrentStack *xConcurrentStack_newWithAllocator(xSize elemSize, const xAllocator *allocator);
+
+/**
+ * @brief
+ * Free xConcurrentStack object and its data from memory.
+ *
+ * @param stack Pointer to xConcurrentStack object to free.
+ *
+ * @warning
+ * No other thread may use stack while or after it is freed.
+ */
+void xConcurrentStack_free(xConcurrentStack *stack);
+
+/**
+ * @brief
+ * Get number of elements in xConcurrentStack object.
+ *
+ * @param stack Pointer to xConcurrentStack object.
+ * @return xSize Number of elements in stack.
+ *
+ * @note
+ * While other threads are using stack, returned value is only approximate.
+ */
+xSize xConcurrentStack_getSize(const xConcurrentStack *stack);
+
+/**
+ * @brief
+ * Get number of element nodes allocated by xConcurrentStack object.
+ *
+ * @param stack Pointer to xConcurrentStack object.
+ * @return xSize Number of nodes stack can hold before it has to allocate more memory.
+ */
+xSize xConcurrentStack_getCapacity(const xConcurrentStack *stack);
+
+/**
+ * @brief
+ * Get size of single element in xConcurrentStack object.
+ *
+ * @param stack Pointer to xConcurrentStack object.
+ * @return xSize Size of single element in bytes.
+ */
+extern xSize xConcurrentStack_getElemSize(const xConcurrentStack *stack);
+
+/**
+ * @brief
+ * Check if xConcurrentStack object is valid.
+ *
+ * @param stack Pointer to xConcurrentStack object.
+ * @return xBool Non-zero if object is valid, zero otherwise.
+ */
+extern xBool xConcurrentStack_isValid(const xConcurrentStack *stack);
+
+/**
+ * @brief
+ * Push data to xConcurrentStack object.
+ *
+ * @param stack Pointer to xConcurrentStack object.
+ * @param data Pointer to data to push.
+ * @return xBool true if element was pushed, false if memory allocation failed or arguments are invalid.
+ *
+ * @note
+ * Upon pushing, a shallow copy of data is made, same as with xStack_push().
+ */
+xBool xConcurrentStack_push(xConcurrentStack *stack, const void *data);
+
+/**
+ * @brief
+ * Pop data from xConcurrentStack object.
+ *
+ * @param stack Pointer to xConcurrentStack object.
+ * @return Pointer to popped data.
+ *
+ * @note
+ * Caller is responsible for freeing memory of returned element.
+ *
+ * @note
+ * If stack is empty, function fails to allocate memory or `stack` is NULL, it will return NULL and remove no data from stack.
+ */
+void *xConcurrentStack_pop(xConcurrentStack *stack);
+
+/**
+ * @brief
+ * Pop data from xConcurrentStack object into caller provided memory.
+ *
+ * @param stack Pointer to xConcurrentStack object.
+ * @param dest Pointer to memory of at least element size bytes receiving popped data.
+ * @return xBool true if element was popped, false if stack is empty or arguments are invalid.
+ *
+ * @note
+ * Unlike xConcurrentStack_pop(), this function does not allocate memory for returned element.
+ */
+xBool xConcurrentStack_popInto(xConcurrentStack *stack, void *dest);
+
+/**
+ * @brief
+ * Clear xConcurrentStack object and remove all elements.
+ *
+ * @param stack Pointer to xConcurrentStack object.
+ *
+ * @note
+ * Elements pushed concurrently with clearing may or may not be removed.
+ */
+void xConcurrentStack_clear(xConcurrentStack *stack);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // XSTRUCTURES_CONCURRENTSTACK_H
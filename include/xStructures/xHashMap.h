@@ -0,0 +1,235 @@
+/**
+ * @file xHashMap.h
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief Open-addressing hash table implementation in xStructures module.
+ * @version 0.1
+ * @date 18.10.2026.
+ *
+ * Module declares hash map structure mapping fixed-size keys to fixed-size values and functions for managing it. Table uses
+ * open addressing with control byte per slot (Swiss table layout) so lookups probe 16 slots at once using SIMD comparisons where
+ * available. Keys are hashed using xMemHashSeeded() and compared using xMemCmp() (by string contents for maps created with
+ * xHashMap_newStringKeyed()). Every map hashes with its own random seed, so keys colliding in one map cannot be prepared in
+ * advance and order of entries differs between maps. All functions have prefix `xHashMap_`.
+ */
+
+#ifndef XSTRUCTURES_HASHMAP_H
+#define XSTRUCTURES_HASHMAP_H
+
+#include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief
+ * Hash map structure introduced by xcFramework.
+ *
+ * @note
+ * Do not access structure members directly. Use provided functions for managing xHashMap object.
+ */
+typedef struct xHashMap_s xHashMap;
+
+/**
+ * @brief
+ * Creates empty xHashMap object with fixed-size keys.
+ *
+ * @param keySize Size of single key in bytes.
+ * @param valueSize Size of single value in bytes.
+ * @return xHashMap* Pointer to new xHashMap object or NULL on failure.
+ *
+ * @note
+ * Keys are hashed and compared bytewise, so structures used as keys should not contain uninitialized padding bytes.
+ *
+ * @note
+ * If either size is 0 or memory allocation fails, function returns NULL.
+ */
+xHashMap *xHashMap_new(xSize keySize, xSize valueSize);
+
+/**
+ * @brief
+ * Creates empty xHashMap object with fixed-size keys which obtains its memory from given allocator.
+ *
+ * @param keySize Size of single key in bytes.
+ * @param valueSize Size of single value in bytes.
+ * @param allocator Allocator used for map structure and its table (default allocator if NULL).
+ * @return xHashMap* Pointer to new xHashMap object or NULL on failure.
+ */
+xHashMap *xHashMap_newWithAllocator(xSize keySize, xSize valueSize, const xAllocator *allocator);
+
+/**
+ * @brief
+ * Creates empty xHashMap object with xString keys.
+ *
+ * @param valueSize Size of single value in bytes.
+ * @return xHashMap* Pointer to new xHashMap object or NULL on failure.
+ *
+ * @note
+ * Key arguments passed to functions of such map are pointers to xString objects (`const xString *`). Map keeps its own
+ * reference-counted copy of every inserted key, so caller is free to release its string after insertion.
+ */
+xHashMap *xHashMap_newStringKeyed(xSize valueSize);
+
+/**
+ * @brief
+ * Creates empty xHashMap object with xString keys which obtains its memory from given allocator.
+ *
+ * @param valueSize Size of single value in bytes.
+ * @param allocator Allocator used for map structure and its table (default allocator if NULL).
+ * @return xHashMap* Pointer to new xHashMap object or NULL on failure.
+ *
+ * @note
+ * Key copies kept by map share data with inserted strings, so they use allocators of those strings.
+ */
+xHashMap *xHashMap_newStringKeyedWithAllocator(xSize valueSize, const xAllocator *allocator);
+
+/**
+ * @brief
+ * Free xHashMap object and all of its entries from memory.
+ *
+ * @param map Pointer to xHashMap object to free.
+ *
+ * @warning
+ * User is responsible for freeing data referenced by stored values if they are dynamically allocated.
+ */
+void xHashMap_free(xHashMap *map);
+
+/**
+ * @brief
+ * Get number of entries stored in xHashMap object.
+ *
+ * @param map Pointer to xHashMap object.
+ * @return xSize Number of entries.
+ */
+extern xSize xHashMap_getSize(const xHashMap *map);
+
+/**
+ * @brief
+ * Get number of slots allocated by xHashMap object.
+ *
+ * @param map Pointer to xHashMap object.
+ * @return xSize Capacity of xHashMap object in number of slots.
+ *
+ * @note
+ * Table grows once it is 7/8 full, so capacity is always larger than number of stored entries.
+ */
+extern xSize xHashMap_getCapacity(const xHashMap *map);
+
+/**
+ * @brief
+ * Get size of single key in xHashMap object.
+ *
+ * @param map Pointer to xHashMap object.
+ * @return xSize Size of single key in bytes (size of pointer for xString keyed maps).
+ */
+extern xSize xHashMap_getKeySize(const xHashMap *map);
+
+/**
+ * @brief
+ * Get size of single value in xHashMap object.
+ *
+ * @param map Pointer to xHashMap object.
+ * @return xSize Size of single value in bytes.
+ */
+extern xSize xHashMap_getValueSize(const xHashMap *map);
+
+/**
+ * @brief
+ * Check if xHashMap object is valid.
+ *
+ * @param map Pointer to xHashMap object.
+ * @return xBool Non-zero if xHashMap object is valid, zero otherwise.
+ */
+extern xBool xHashMap_isValid(const xHashMap *map);
+
+/**
+ * @brief
+ * Ensure that xHashMap object can hold given number of entries without rehashing.
+ *
+ * @param map Pointer to xHashMap object.
+ * @param count Number of entries to reserve space for.
+ *
+ * @note
+ * If memory allocation fails, map is left unchanged.
+ */
+void xHashMap_reserve(xHashMap *map, xSize count);
+
+/**
+ * @brief
+ * Insert entry into xHashMap object or overwrite value of existing entry with the same key.
+ *
+ * @param map Pointer to xHashMap object.
+ * @param key Pointer to key (pointer to xString for xString keyed maps).
+ * @param value Pointer to value to copy into map.
+ * @return xBool true if entry was stored, false on invalid arguments or memory allocation failure.
+ */
+xBool xHashMap_put(xHashMap *map, const void *key, const void *value);
+
+/**
+ * @brief
+ * Get value stored under given key.
+ *
+ * @param map Pointer to xHashMap object.
+ * @param key Pointer to key (pointer to xString for xString keyed maps).
+ * @return void* Pointer to stored value or NULL if key is not present.
+ *
+ * @warning
+ * Returned pointer is owned by map and is invalidated by any following insertion, removal or clearing.
+ */
+void *xHashMap_get(const xHashMap *map, const void *key);
+
+/**
+ * @brief
+ * Check if xHashMap object contains given key.
+ *
+ * @param map Pointer to xHashMap object.
+ * @param key Pointer to key (pointer to xString for xString keyed maps).
+ * @return xBool true if key is present, false otherwise.
+ */
+xBool xHashMap_contains(const xHashMap *map, const void *key);
+
+/**
+ * @brief
+ * Remove entry with given key from xHashMap object.
+ *
+ * @param map Pointer to xHashMap object.
+ * @param key Pointer to key (pointer to xString for xString keyed maps).
+ * @return xBool true if entry was removed, false if key was not present.
+ */
+xBool xHashMap_remove(xHashMap *map, const void *key);
+
+/**
+ * @brief
+ * Remove all entries from xHashMap object.
+ *
+ * @param map Pointer to xHashMap object.
+ *
+ * @note
+ * Allocated capacity is kept for reuse.
+ */
+void xHashMap_clear(xHashMap *map);
+
+/**
+ * @brief
+ * Perform action on each entry in xHashMap object.
+ *
+ * @param map Pointer to xHashMap object.
+ * @param callback Function to call for each entry with pointers to its key and value.
+ *
+ * @note
+ * For xString keyed maps, key argument of callback is pointer to stored xString object.
+ *
+ * @note
+ * Entries are visited in unspecified order. Callback must not insert or remove entries of the same map.
+ *
+ * @note
+ * If callback function is NULL, function will do nothing.
+ */
+void xHashMap_foreach(const xHashMap *map, void (*callback)(const void *key, void *value));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // XSTRUCTURES_HASHMAP_H
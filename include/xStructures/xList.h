@@ -12,6 +12,7 @@
 #define XSTRUCTURES_LIST_H
 
 #include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -42,6 +43,20 @@ typedef struct xList_s xList;
  */
 xList *xList_new(xSize elemSize);
 
+/**
+ * @brief
+ * Creates empty xList object which obtains its descriptor and nodes from given allocator.
+ *
+ * @param elemSize Size of single element in bytes.
+ * @param allocator Allocator used for list structure and its nodes (default allocator if NULL).
+ * @return Pointer to xList object with no data.
+ *
+ * @note
+ * Element copies returned by removing and popping functions are still allocated with standard library and must be released
+ * with `free()`. Copies of list use the same allocator.
+ */
+xList *xList_newWithAllocator(xSize elemSize, const xAllocator *allocator);
+
 /**
  * @brief
  * Free xList object and its data from memory.
@@ -5,13 +5,15 @@
  * @version 0.10
  * @date 17.09.2024.
  *
- * Module declares dynamic queue structure along with funcitons for managing it. All functions have prefix `xQueue_`.
+ * Module declares dynamic queue structure along with funcitons for managing it. Queue elements are stored either in contiguous
+ * ring buffer (default) or in linked list, chosen at construction. All functions have prefix `xQueue_`.
  */
 
 #ifndef XSTRUCTURES_QUEUE_H
 #define XSTRUCTURES_QUEUE_H
 
 #include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -26,6 +28,15 @@ extern "C" {
  */
 typedef struct xQueue_s xQueue;
 
+/**
+ * @brief
+ * Underlying structures xQueue can store its elements in.
+ */
+typedef enum {
+    XQUEUE_BACKEND_RING = 0, /**< Contiguous power-of-two ring buffer with amortized growth (default). */
+    XQUEUE_BACKEND_LIST = 1, /**< Linked list with one node per element (no element moves on growth). */
+} xQueueBackend;
+
 /**
  * @brief
  * Create empty xQueue object.
@@ -39,6 +50,33 @@ typedef struct xQueue_s xQueue;
  */
 xQueue *xQueue_new(xSize elemSize);
 
+/**
+ * @brief
+ * Create empty xQueue object which obtains all of its memory from given allocator.
+ *
+ * @param elemSize Size of single element in bytes.
+ * @param allocator Allocator used for queue structure and its elements (default allocator if NULL).
+ * @return Pointer to xQueue object with no data.
+ *
+ * @note
+ * Elements returned by xQueue_dequeue() are still allocated with standard library and must be released with `free()`.
+ */
+xQueue *xQueue_newWithAllocator(xSize elemSize, const xAllocator *allocator);
+
+/**
+ * @brief
+ * Create empty xQueue object storing its elements in given underlying structure.
+ *
+ * @param elemSize Size of single element in bytes.
+ * @param backend Underlying structure of the queue.
+ * @param allocator Allocator used for queue structure and its elements (default allocator if NULL).
+ * @return Pointer to xQueue object with no data.
+ *
+ * @note
+ * If function fails to allocate memory, `elemSize` is zero or backend is unknown, NULL is returned.
+ */
+xQueue *xQueue_newWithBackend(xSize elemSize, xQueueBackend backend, const xAllocator *allocator);
+
 /**
  * @brief
  * Free xQueue object and its data from memory.
@@ -62,7 +100,14 @@ void xQueue_free(xQueue *queue);
  */
 extern xSize xQueue_getSize(const xQueue *queue);
 
-// extern xSize xQueue_getCapacity(const xQueue *queue);
+/**
+ * @brief
+ * Get number of elements queue can hold before it has to allocate more memory.
+ *
+ * @param queue Pointer to xQueue object.
+ * @return xSize Capacity of ring buffer (equal to number of elements for list backend).
+ */
+extern xSize xQueue_getCapacity(const xQueue *queue);
 
 /**
  * @brief
@@ -82,6 +127,15 @@ extern xSize xQueue_getElemSize(const xQueue *queue);
  */
 extern xBool xQueue_isValid(const xQueue *queue);
 
+/**
+ * @brief
+ * Get underlying structure of queue.
+ *
+ * @param queue Pointer to xQueue object.
+ * @return xQueueBackend Backend queue was created with (XQUEUE_BACKEND_RING if queue is NULL).
+ */
+extern xQueueBackend xQueue_getBackend(const xQueue *queue);
+
 /**
  * @brief
  * Enqueue data to the queue.
@@ -109,6 +163,19 @@ void xQueue_enqueue(xQueue *queue, const void *data);
  */
 void *xQueue_dequeue(xQueue *queue);
 
+/**
+ * @brief
+ * Dequeue data from the queue into caller provided memory.
+ *
+ * @param queue Pointer to the queue object.
+ * @param dest Pointer to memory of at least element size bytes receiving dequeued data.
+ * @return xBool true if element was dequeued, false if queue is invalid or empty, or dest is NULL.
+ *
+ * @note
+ * Unlike xQueue_dequeue(), this function does not allocate memory for returned element.
+ */
+xBool xQueue_dequeueInto(xQueue *queue, void *dest);
+
 /**
  * @brief
  * Peek data from the queue without removing it.
@@ -12,6 +12,7 @@
 #define XSTRUCTURES_STACK_H
 
 #include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -39,6 +40,20 @@ typedef struct xStack_s xStack;
  */
 xStack *xStack_new(xSize elemSize);
 
+/**
+ * @brief
+ * Create new xStack object which obtains its descriptor and data from given allocator.
+ *
+ * @param elemSize Size of single element in bytes.
+ * @param allocator Allocator used for stack structure and its data (default allocator if NULL).
+ * @return xStack* Pointer to new xStack object or NULL on failure.
+ *
+ * @note
+ * Elements returned by xStack_pop() are still allocated with standard library and must be released with `free()`. Copies of
+ * stack use the same allocator.
+ */
+xStack *xStack_newWithAllocator(xSize elemSize, const xAllocator *allocator);
+
 /**
  * @brief
  * Free xStack object and its data from memory.
@@ -0,0 +1,121 @@
+/**
+ * @file xThreadPool.h
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief Worker thread pool for data-parallel loops.
+ * @version 0.1
+ * @date 18.10.2026.
+ *
+ * Module declares pool of persistent worker threads which split index ranges into fixed chunks and process them in
+ * parallel. Library-wide shared pool is used by other modules (e.g. xMatrix) for operations on large data. All functions have
+ * prefix `xThreadPool_`.
+ */
+
+#ifndef XTHREAD_THREADPOOL_H
+#define XTHREAD_THREADPOOL_H
+
+#include "xBase/xTypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief
+ * Thread pool structure introduced by xcFramework.
+ *
+ * @note
+ * Do not access structure members directly. Use provided functions for managing xThreadPool object.
+ */
+typedef struct xThreadPool_s xThreadPool;
+
+/**
+ * @brief
+ * Function processing half-open range [begin, end) of parallel loop.
+ *
+ * @param context User pointer passed to xThreadPool_parallelFor().
+ * @param begin First index of range.
+ * @param end One past last index of range.
+ */
+typedef void (*xThreadPoolRangeFunc)(void *context, xSize begin, xSize end);
+
+/**
+ * @brief
+ * Create thread pool running loops on given number of threads.
+ *
+ * @param threadCount Number of threads working on each loop, including calling thread (number of online processors if 0).
+ * @return Pointer to xThreadPool object.
+ *
+ * @note
+ * Pool starts `threadCount - 1` workers, as thread calling xThreadPool_parallelFor() processes chunks as well. If function
+ * fails to allocate memory or start threads, NULL is returned.
+ */
+xThreadPool *xThreadPool_new(xSize threadCount);
+
+/**
+ * @brief
+ * Stop worker threads and free xThreadPool object from memory.
+ *
+ * @param pool Pointer to xThreadPool object to free.
+ *
+ * @warning
+ * Pool must not be running loop while it is freed.
+ */
+void xThreadPool_free(xThreadPool *pool);
+
+/**
+ * @brief
+ * Get number of threads working on loops of xThreadPool object.
+ *
+ * @param pool Pointer to xThreadPool object.
+ * @return xSize Number of threads including calling thread (1 if pool is NULL).
+ */
+extern xSize xThreadPool_getThreadCount(const xThreadPool *pool);
+
+/**
+ * @brief
+ * Run function over index range [0, count) split into chunks of `grain` indices.
+ *
+ * @param pool Pointer to xThreadPool object (loop runs on calling thread if NULL).
+ * @param count Number of indices.
+ * @param grain Number of indices in single chunk (at least 1).
+ * @param func Function called once per chunk.
+ * @param context User pointer passed to function.
+ * @return xBool true if loop was run, false if arguments are invalid.
+ *
+ * @note
+ * Function returns after all chunks are processed. Chunk boundaries depend only on `count` and `grain`, never on number of
+ * threads, so results computed per chunk (e.g. partial sums combined in chunk order) are the same for any thread count.
+ *
+ * @note
+ * Loops started from within running chunk and loops started while pool is busy with loop from other thread are run on
+ * calling thread alone, so nested parallelism can not deadlock pool.
+ */
+xBool xThreadPool_parallelFor(xThreadPool *pool, xSize count, xSize grain, xThreadPoolRangeFunc func, void *context);
+
+/**
+ * @brief
+ * Get library-wide shared thread pool, creating it on first use.
+ *
+ * @return Pointer to shared xThreadPool object (NULL if it could not be created, in which case loops run serially).
+ */
+xThreadPool *xThreadPool_getShared(void);
+
+/**
+ * @brief
+ * Set number of threads used by library-wide shared thread pool.
+ *
+ * @param threadCount Number of threads including calling thread (number of online processors if 0, 1 disables workers).
+ * @return xBool true on success, false if called from within running chunk or threads could not be started (shared pool then
+ * runs loops on calling threads alone).
+ *
+ * @note
+ * Shared pool object is never freed, so pointers returned by xThreadPool_getShared() stay valid. Its workers are replaced
+ * once loop currently running on it finishes, and loops started meanwhile from other threads run serially.
+ */
+xBool xThreadPool_setSharedThreadCount(xSize threadCount);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // XTHREAD_THREADPOOL_H
@@ -0,0 +1,59 @@
+#include "xBase/xCpu.h"
+#include "xBase/xTypes.h"
+
+// feature mask of the running processor (XCPU_FEATURES_UNKNOWN until first detection)
+#define XCPU_FEATURES_UNKNOWN 0x80000000U
+static volatile xUInt32 xCpu_features = XCPU_FEATURES_UNKNOWN;
+
+/**
+ * @brief
+ * Query processor for supported instruction set extensions.
+ *
+ * @return xUInt32 Bitwise OR of xCpuFeature values.
+ */
+static xUInt32 xCpu_detect(void)
+{
+    xUInt32 features = XCPU_FEATURE_NONE;
+
+#if defined(__x86_64__) || defined(__i386__)
+    // builtins check both CPUID bits and OS support for extended register state
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse2")) {
+        features |= XCPU_FEATURE_SSE2;
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+        features |= XCPU_FEATURE_SSE42;
+    }
+    if (__builtin_cpu_supports("avx")) {
+        features |= XCPU_FEATURE_AVX;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        features |= XCPU_FEATURE_AVX2;
+    }
+    if (__builtin_cpu_supports("fma")) {
+        features |= XCPU_FEATURE_FMA;
+    }
+#elif defined(__aarch64__) || defined(__ARM_NEON)
+    // Advanced SIMD is mandatory on AArch64 and known at compile time on 32-bit ARM
+    features |= XCPU_FEATURE_NEON;
+#endif
+
+    return features;
+}
+
+xUInt32 xCpu_getFeatures(void)
+{
+    // detection is idempotent, so concurrent first calls at worst detect twice
+    xUInt32 features = xCpu_features;
+    if (features == XCPU_FEATURES_UNKNOWN) {
+        features = xCpu_detect();
+        xCpu_features = features;
+    }
+
+    return features;
+}
+
+xBool xCpu_hasFeature(xCpuFeature feature)
+{
+    return (feature != XCPU_FEATURE_NONE && (xCpu_getFeatures() & (xUInt32)feature) == (xUInt32)feature) ? true : false;
+}
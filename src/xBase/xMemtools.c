@@ -1,6 +1,819 @@
 #include "xBase/xMemtools.h"
+#include "xBase/xCpu.h"    // runtime SIMD feature detection
 #include "xBase/xTypes.h"
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>  // SSE2 and AVX2 intrinsics (enabled per function through target attribute)
+#define XMEM_SIMD_X86
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>  // NEON intrinsics
+#define XMEM_SIMD_NEON
+#endif
+
+/**
+ * @brief
+ * Machine word type allowed to alias any object and to be accessed at any alignment.
+ */
+typedef xUInt64 __attribute__((may_alias, aligned(1))) xMemWord;
+typedef xUInt32 __attribute__((may_alias, aligned(1))) xMemHalfWord;
+
+/**
+ * @brief
+ * Set of memory kernels specialized for one instruction set.
+ *
+ * @note
+ * Forward kernels read every chunk before writing it, so they are also safe for overlapping blocks where destination precedes
+ * source. Backward kernels are their mirror image for destination following source.
+ */
+typedef struct xMemKernels_s {
+    void (*copyForward)(xUInt8 *dest, const xUInt8 *src, xSize size);
+    void (*copyBackward)(xUInt8 *dest, const xUInt8 *src, xSize size);
+    void (*set)(xUInt8 *dest, xUInt8 value, xSize size);
+    xSize (*mismatch)(const xUInt8 *block1, const xUInt8 *block2, xSize size);
+    xSize (*findByte)(const xUInt8 *block, xSize size, xUInt8 value);
+    xSize (*findPair)(const xUInt8 *block, xSize count, xUInt8 first, xUInt8 last, xSize gap);
+} xMemKernels;
+
+// blocks up to this size are handled inline without dispatching to kernels
+#define XMEM_SMALL_SIZE 16
+
+/**
+ * @brief
+ * Copy up to XMEM_SMALL_SIZE bytes using overlapping word accesses.
+ *
+ * @param dest Destination address.
+ * @param src Source address.
+ * @param size Number of bytes (at most XMEM_SMALL_SIZE).
+ *
+ * @note
+ * All loads are performed before any store, so overlapping blocks are handled correctly in both directions.
+ */
+static inline void xMem_copySmall(xUInt8 *dest, const xUInt8 *src, xSize size)
+{
+    if (size >= 8) {
+        xUInt64 head = *(const xMemWord *)src;
+        xUInt64 tail = *(const xMemWord *)(src + size - 8);
+        *(xMemWord *)dest = head;
+        *(xMemWord *)(dest + size - 8) = tail;
+    } else if (size >= 4) {
+        xUInt32 head = *(const xMemHalfWord *)src;
+        xUInt32 tail = *(const xMemHalfWord *)(src + size - 4);
+        *(xMemHalfWord *)dest = head;
+        *(xMemHalfWord *)(dest + size - 4) = tail;
+    } else if (size) {
+        xUInt8 first = src[0];
+        xUInt8 middle = src[size >> 1];
+        xUInt8 last = src[size - 1];
+        dest[0] = first;
+        dest[size >> 1] = middle;
+        dest[size - 1] = last;
+    }
+}
+
+/*
+ * Portable word-wide kernels
+ */
+
+static void xMem_copyForwardWord(xUInt8 *dest, const xUInt8 *src, xSize size)
+{
+    // copy head bytes until destination is word-aligned
+    while (size && ((xSize)dest & (sizeof(xUInt64) - 1))) {
+        *dest++ = *src++;
+        size--;
+    }
+
+    // copy body four words at a time
+    while (size >= 4 * sizeof(xUInt64)) {
+        xUInt64 w0 = ((const xMemWord *)src)[0];
+        xUInt64 w1 = ((const xMemWord *)src)[1];
+        xUInt64 w2 = ((const xMemWord *)src)[2];
+        xUInt64 w3 = ((const xMemWord *)src)[3];
+        ((xMemWord *)dest)[0] = w0;
+        ((xMemWord *)dest)[1] = w1;
+        ((xMemWord *)dest)[2] = w2;
+        ((xMemWord *)dest)[3] = w3;
+        dest += 4 * sizeof(xUInt64);
+        src += 4 * sizeof(xUInt64);
+        size -= 4 * sizeof(xUInt64);
+    }
+    while (size >= sizeof(xUInt64)) {
+        *(xMemWord *)dest = *(const xMemWord *)src;
+        dest += sizeof(xUInt64);
+        src += sizeof(xUInt64);
+        size -= sizeof(xUInt64);
+    }
+
+    // copy remaining tail bytes
+    while (size) {
+        *dest++ = *src++;
+        size--;
+    }
+}
+
+static void xMem_copyBackwardWord(xUInt8 *dest, const xUInt8 *src, xSize size)
+{
+    // start from the end of both blocks
+    dest += size;
+    src += size;
+
+    // copy tail bytes until end of destination is word-aligned
+    while (size && ((xSize)dest & (sizeof(xUInt64) - 1))) {
+        *--dest = *--src;
+        size--;
+    }
+
+    // copy body four words at a time
+    while (size >= 4 * sizeof(xUInt64)) {
+        dest -= 4 * sizeof(xUInt64);
+        src -= 4 * sizeof(xUInt64);
+        size -= 4 * sizeof(xUInt64);
+        xUInt64 w3 = ((const xMemWord *)src)[3];
+        xUInt64 w2 = ((const xMemWord *)src)[2];
+        xUInt64 w1 = ((const xMemWord *)src)[1];
+        xUInt64 w0 = ((const xMemWord *)src)[0];
+        ((xMemWord *)dest)[3] = w3;
+        ((xMemWord *)dest)[2] = w2;
+        ((xMemWord *)dest)[1] = w1;
+        ((xMemWord *)dest)[0] = w0;
+    }
+    while (size >= sizeof(xUInt64)) {
+        dest -= sizeof(xUInt64);
+        src -= sizeof(xUInt64);
+        size -= sizeof(xUInt64);
+        *(xMemWord *)dest = *(const xMemWord *)src;
+    }
+
+    // copy remaining head bytes
+    while (size) {
+        *--dest = *--src;
+        size--;
+    }
+}
+
+static void xMem_setWord(xUInt8 *dest, xUInt8 value, xSize size)
+{
+    xUInt64 word = XMEM_SPREAD_64(value);
+
+    // set head bytes until destination is word-aligned
+    while (size && ((xSize)dest & (sizeof(xUInt64) - 1))) {
+        *dest++ = value;
+        size--;
+    }
+
+    // set body four words at a time
+    while (size >= 4 * sizeof(xUInt64)) {
+        ((xMemWord *)dest)[0] = word;
+        ((xMemWord *)dest)[1] = word;
+        ((xMemWord *)dest)[2] = word;
+        ((xMemWord *)dest)[3] = word;
+        dest += 4 * sizeof(xUInt64);
+        size -= 4 * sizeof(xUInt64);
+    }
+    while (size >= sizeof(xUInt64)) {
+        *(xMemWord *)dest = word;
+        dest += sizeof(xUInt64);
+        size -= sizeof(xUInt64);
+    }
+
+    // set remaining tail bytes
+    while (size) {
+        *dest++ = value;
+        size--;
+    }
+}
+
+/**
+ * @brief
+ * Get index of first differing byte within two words loaded from memory.
+ *
+ * @param diff XOR of both words (must be non-zero).
+ * @return xSize Byte offset of first difference in memory order.
+ */
+static inline xSize xMem_wordMismatch(xUInt64 diff)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return (xSize)(__builtin_clzll(diff) >> 3);
+#else
+    return (xSize)(__builtin_ctzll(diff) >> 3);
+#endif
+}
+
+static xSize xMem_mismatchWord(const xUInt8 *block1, const xUInt8 *block2, xSize size)
+{
+    xSize i = 0;
+
+    // compare body word by word
+    for (; i + sizeof(xUInt64) <= size; i += sizeof(xUInt64)) {
+        xUInt64 diff = *(const xMemWord *)(block1 + i) ^ *(const xMemWord *)(block2 + i);
+        if (diff) {
+            return i + xMem_wordMismatch(diff);
+        }
+    }
+
+    // compare remaining tail bytes
+    for (; i < size; i++) {
+        if (block1[i] != block2[i]) {
+            return i;
+        }
+    }
+
+    return size;
+}
+
+static xSize xMem_findByteWord(const xUInt8 *block, xSize size, xUInt8 value)
+{
+    xSize i = 0;
+
+    // skip words without matching byte (matching bytes become zero after XOR, detected by borrow trick)
+    xUInt64 pattern = XMEM_SPREAD_64(value);
+    for (; i + sizeof(xUInt64) <= size; i += sizeof(xUInt64)) {
+        xUInt64 word = *(const xMemWord *)(block + i) ^ pattern;
+        if ((word - XMEM_SPREAD_64(0x01)) & ~word & XMEM_SPREAD_64(0x80)) {
+            break;
+        }
+    }
+
+    // locate byte within found word or remaining tail
+    for (; i < size; i++) {
+        if (block[i] == value) {
+            return i;
+        }
+    }
+
+    return size;
+}
+
+static xSize xMem_findPairWord(const xUInt8 *block, xSize count, xUInt8 first, xUInt8 last, xSize gap)
+{
+    for (xSize i = 0; i < count; i++) {
+        i += xMem_findByteWord(block + i, count - i, first);
+        if (i < count && block[i + gap] == last) {
+            return i;
+        }
+    }
+
+    return count;
+}
+
+static const xMemKernels xMem_kernelsWord = {xMem_copyForwardWord, xMem_copyBackwardWord, xMem_setWord,
+                                             xMem_mismatchWord,    xMem_findByteWord,     xMem_findPairWord};
+
+#if defined(XMEM_SIMD_X86)
+
+/*
+ * x86 SSE2 kernels (16-byte vectors)
+ */
+
+__attribute__((target("sse2"))) static void xMem_copyForwardSSE2(xUInt8 *dest, const xUInt8 *src, xSize size)
+{
+    // align destination to vector size using word kernel
+    xSize head = (0 - (xSize)dest) & 15;
+    if (head > size) {
+        head = size;
+    }
+    xMem_copyForwardWord(dest, src, head);
+    dest += head;
+    src += head;
+    size -= head;
+
+    // copy body with unaligned loads and aligned stores
+    while (size >= 64) {
+        __m128i v0 = _mm_loadu_si128((const __m128i *)(const void *)(src + 0));
+        __m128i v1 = _mm_loadu_si128((const __m128i *)(const void *)(src + 16));
+        __m128i v2 = _mm_loadu_si128((const __m128i *)(const void *)(src + 32));
+        __m128i v3 = _mm_loadu_si128((const __m128i *)(const void *)(src + 48));
+        _mm_store_si128((__m128i *)(void *)(dest + 0), v0);
+        _mm_store_si128((__m128i *)(void *)(dest + 16), v1);
+        _mm_store_si128((__m128i *)(void *)(dest + 32), v2);
+        _mm_store_si128((__m128i *)(void *)(dest + 48), v3);
+        dest += 64;
+        src += 64;
+        size -= 64;
+    }
+    while (size >= 16) {
+        _mm_store_si128((__m128i *)(void *)dest, _mm_loadu_si128((const __m128i *)(const void *)src));
+        dest += 16;
+        src += 16;
+        size -= 16;
+    }
+
+    // copy remaining tail
+    xMem_copyForwardWord(dest, src, size);
+}
+
+__attribute__((target("sse2"))) static void xMem_copyBackwardSSE2(xUInt8 *dest, const xUInt8 *src, xSize size)
+{
+    // align end of destination to vector size using word kernel
+    xSize tail = (xSize)(dest + size) & 15;
+    if (tail > size) {
+        tail = size;
+    }
+    size -= tail;
+    xMem_copyBackwardWord(dest + size, src + size, tail);
+
+    // copy body from the end with unaligned loads and aligned stores
+    while (size >= 64) {
+        size -= 64;
+        __m128i v3 = _mm_loadu_si128((const __m128i *)(const void *)(src + size + 48));
+        __m128i v2 = _mm_loadu_si128((const __m128i *)(const void *)(src + size + 32));
+        __m128i v1 = _mm_loadu_si128((const __m128i *)(const void *)(src + size + 16));
+        __m128i v0 = _mm_loadu_si128((const __m128i *)(const void *)(src + size + 0));
+        _mm_store_si128((__m128i *)(void *)(dest + size + 48), v3);
+        _mm_store_si128((__m128i *)(void *)(dest + size + 32), v2);
+        _mm_store_si128((__m128i *)(void *)(dest + size + 16), v1);
+        _mm_store_si128((__m128i *)(void *)(dest + size + 0), v0);
+    }
+    while (size >= 16) {
+        size -= 16;
+        _mm_store_si128((__m128i *)(void *)(dest + size), _mm_loadu_si128((const __m128i *)(const void *)(src + size)));
+    }
+
+    // copy remaining head
+    xMem_copyBackwardWord(dest, src, size);
+}
+
+__attribute__((target("sse2"))) static void xMem_setSSE2(xUInt8 *dest, xUInt8 value, xSize size)
+{
+    __m128i v = _mm_set1_epi8((char)value);
+
+    // first (possibly unaligned) vector covers the head
+    _mm_storeu_si128((__m128i *)(void *)dest, v);
+    xSize head = 16 - ((xSize)dest & 15);
+    dest += head;
+    size -= head;
+
+    // set body with aligned stores
+    while (size >= 64) {
+        _mm_store_si128((__m128i *)(void *)(dest + 0), v);
+        _mm_store_si128((__m128i *)(void *)(dest + 16), v);
+        _mm_store_si128((__m128i *)(void *)(dest + 32), v);
+        _mm_store_si128((__m128i *)(void *)(dest + 48), v);
+        dest += 64;
+        size -= 64;
+    }
+    while (size >= 16) {
+        _mm_store_si128((__m128i *)(void *)dest, v);
+        dest += 16;
+        size -= 16;
+    }
+
+    // last (possibly overlapping) vector covers the tail
+    if (size) {
+        _mm_storeu_si128((__m128i *)(void *)(dest + size - 16), v);
+    }
+}
+
+__attribute__((target("sse2"))) static xSize xMem_mismatchSSE2(const xUInt8 *block1, const xUInt8 *block2, xSize size)
+{
+    xSize i = 0;
+
+    // compare four vectors at a time, locate exact vector only once difference is found
+    for (; i + 64 <= size; i += 64) {
+        __m128i e0 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(const void *)(block1 + i + 0)),
+                                    _mm_loadu_si128((const __m128i *)(const void *)(block2 + i + 0)));
+        __m128i e1 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(const void *)(block1 + i + 16)),
+                                    _mm_loadu_si128((const __m128i *)(const void *)(block2 + i + 16)));
+        __m128i e2 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(const void *)(block1 + i + 32)),
+                                    _mm_loadu_si128((const __m128i *)(const void *)(block2 + i + 32)));
+        __m128i e3 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(const void *)(block1 + i + 48)),
+                                    _mm_loadu_si128((const __m128i *)(const void *)(block2 + i + 48)));
+        __m128i all = _mm_and_si128(_mm_and_si128(e0, e1), _mm_and_si128(e2, e3));
+        if (_mm_movemask_epi8(all) != 0xFFFF) {
+            break;
+        }
+    }
+    for (; i + 16 <= size; i += 16) {
+        __m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(const void *)(block1 + i)),
+                                    _mm_loadu_si128((const __m128i *)(const void *)(block2 + i)));
+        xUInt32 mask = (xUInt32)_mm_movemask_epi8(eq) ^ 0xFFFFU;
+        if (mask) {
+            return i + (xSize)__builtin_ctz(mask);
+        }
+    }
+
+    // compare remaining tail
+    return i + xMem_mismatchWord(block1 + i, block2 + i, size - i);
+}
+
+__attribute__((target("sse2"))) static xSize xMem_findByteSSE2(const xUInt8 *block, xSize size, xUInt8 value)
+{
+    __m128i v = _mm_set1_epi8((char)value);
+    xSize i = 0;
+
+    for (; i + 16 <= size; i += 16) {
+        __m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(const void *)(block + i)), v);
+        xUInt32 mask = (xUInt32)_mm_movemask_epi8(eq);
+        if (mask) {
+            return i + (xSize)__builtin_ctz(mask);
+        }
+    }
+
+    // search remaining tail
+    return i + xMem_findByteWord(block + i, size - i, value);
+}
+
+__attribute__((target("sse2"))) static xSize xMem_findPairSSE2(const xUInt8 *block, xSize count, xUInt8 first, xUInt8 last,
+                                                                xSize gap)
+{
+    __m128i vf = _mm_set1_epi8((char)first);
+    __m128i vl = _mm_set1_epi8((char)last);
+    xSize i = 0;
+
+    // candidate positions match first byte and byte at distance gap in the same vector lane
+    for (; i + 16 <= count; i += 16) {
+        __m128i ef = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(const void *)(block + i)), vf);
+        __m128i el = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(const void *)(block + i + gap)), vl);
+        xUInt32 mask = (xUInt32)_mm_movemask_epi8(_mm_and_si128(ef, el));
+        if (mask) {
+            return i + (xSize)__builtin_ctz(mask);
+        }
+    }
+
+    // search remaining tail
+    return i + xMem_findPairWord(block + i, count - i, first, last, gap);
+}
+
+static const xMemKernels xMem_kernelsSSE2 = {xMem_copyForwardSSE2, xMem_copyBackwardSSE2, xMem_setSSE2,
+                                             xMem_mismatchSSE2,    xMem_findByteSSE2,     xMem_findPairSSE2};
+
+/*
+ * x86 AVX2 kernels (32-byte vectors)
+ */
+
+__attribute__((target("avx2"))) static void xMem_copyForwardAVX2(xUInt8 *dest, const xUInt8 *src, xSize size)
+{
+    // align destination to vector size using word kernel
+    xSize head = (0 - (xSize)dest) & 31;
+    if (head > size) {
+        head = size;
+    }
+    xMem_copyForwardWord(dest, src, head);
+    dest += head;
+    src += head;
+    size -= head;
+
+    // copy body with unaligned loads and aligned stores
+    while (size >= 128) {
+        __m256i v0 = _mm256_loadu_si256((const __m256i *)(const void *)(src + 0));
+        __m256i v1 = _mm256_loadu_si256((const __m256i *)(const void *)(src + 32));
+        __m256i v2 = _mm256_loadu_si256((const __m256i *)(const void *)(src + 64));
+        __m256i v3 = _mm256_loadu_si256((const __m256i *)(const void *)(src + 96));
+        _mm256_store_si256((__m256i *)(void *)(dest + 0), v0);
+        _mm256_store_si256((__m256i *)(void *)(dest + 32), v1);
+        _mm256_store_si256((__m256i *)(void *)(dest + 64), v2);
+        _mm256_store_si256((__m256i *)(void *)(dest + 96), v3);
+        dest += 128;
+        src += 128;
+        size -= 128;
+    }
+    while (size >= 32) {
+        _mm256_store_si256((__m256i *)(void *)dest, _mm256_loadu_si256((const __m256i *)(const void *)src));
+        dest += 32;
+        src += 32;
+        size -= 32;
+    }
+
+    // copy remaining tail
+    xMem_copyForwardWord(dest, src, size);
+}
+
+__attribute__((target("avx2"))) static void xMem_copyBackwardAVX2(xUInt8 *dest, const xUInt8 *src, xSize size)
+{
+    // align end of destination to vector size using word kernel
+    xSize tail = (xSize)(dest + size) & 31;
+    if (tail > size) {
+        tail = size;
+    }
+    size -= tail;
+    xMem_copyBackwardWord(dest + size, src + size, tail);
+
+    // copy body from the end with unaligned loads and aligned stores
+    while (size >= 128) {
+        size -= 128;
+        __m256i v3 = _mm256_loadu_si256((const __m256i *)(const void *)(src + size + 96));
+        __m256i v2 = _mm256_loadu_si256((const __m256i *)(const void *)(src + size + 64));
+        __m256i v1 = _mm256_loadu_si256((const __m256i *)(const void *)(src + size + 32));
+        __m256i v0 = _mm256_loadu_si256((const __m256i *)(const void *)(src + size + 0));
+        _mm256_store_si256((__m256i *)(void *)(dest + size + 96), v3);
+        _mm256_store_si256((__m256i *)(void *)(dest + size + 64), v2);
+        _mm256_store_si256((__m256i *)(void *)(dest + size + 32), v1);
+        _mm256_store_si256((__m256i *)(void *)(dest + size + 0), v0);
+    }
+    while (size >= 32) {
+        size -= 32;
+        _mm256_store_si256((__m256i *)(void *)(dest + size), _mm256_loadu_si256((const __m256i *)(const void *)(src + size)));
+    }
+
+    // copy remaining head
+    xMem_copyBackwardWord(dest, src, size);
+}
+
+__attribute__((target("avx2"))) static void xMem_setAVX2(xUInt8 *dest, xUInt8 value, xSize size)
+{
+    if (size < 32) {
+        xMem_setSSE2(dest, value, size);
+        return;
+    }
+
+    __m256i v = _mm256_set1_epi8((char)value);
+
+    // first (possibly unaligned) vector covers the head
+    _mm256_storeu_si256((__m256i *)(void *)dest, v);
+    xSize head = 32 - ((xSize)dest & 31);
+    dest += head;
+    size -= head;
+
+    // set body with aligned stores
+    while (size >= 128) {
+        _mm256_store_si256((__m256i *)(void *)(dest + 0), v);
+        _mm256_store_si256((__m256i *)(void *)(dest + 32), v);
+        _mm256_store_si256((__m256i *)(void *)(dest + 64), v);
+        _mm256_store_si256((__m256i *)(void *)(dest + 96), v);
+        dest += 128;
+        size -= 128;
+    }
+    while (size >= 32) {
+        _mm256_store_si256((__m256i *)(void *)dest, v);
+        dest += 32;
+        size -= 32;
+    }
+
+    // last (possibly overlapping) vector covers the tail
+    if (size) {
+        _mm256_storeu_si256((__m256i *)(void *)(dest + size - 32), v);
+    }
+}
+
+__attribute__((target("avx2"))) static xSize xMem_mismatchAVX2(const xUInt8 *block1, const xUInt8 *block2, xSize size)
+{
+    xSize i = 0;
+
+    // compare two vectors at a time, locate exact vector only once difference is found
+    for (; i + 64 <= size; i += 64) {
+        __m256i e0 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(const void *)(block1 + i + 0)),
+                                       _mm256_loadu_si256((const __m256i *)(const void *)(block2 + i + 0)));
+        __m256i e1 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(const void *)(block1 + i + 32)),
+                                       _mm256_loadu_si256((const __m256i *)(const void *)(block2 + i + 32)));
+        if ((xUInt32)_mm256_movemask_epi8(_mm256_and_si256(e0, e1)) != 0xFFFFFFFFU) {
+            break;
+        }
+    }
+    for (; i + 32 <= size; i += 32) {
+        __m256i eq = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(const void *)(block1 + i)),
+                                       _mm256_loadu_si256((const __m256i *)(const void *)(block2 + i)));
+        xUInt32 mask = ~(xUInt32)_mm256_movemask_epi8(eq);
+        if (mask) {
+            return i + (xSize)__builtin_ctz(mask);
+        }
+    }
+
+    // compare remaining tail
+    return i + xMem_mismatchSSE2(block1 + i, block2 + i, size - i);
+}
+
+__attribute__((target("avx2"))) static xSize xMem_findByteAVX2(const xUInt8 *block, xSize size, xUInt8 value)
+{
+    __m256i v = _mm256_set1_epi8((char)value);
+    xSize i = 0;
+
+    for (; i + 32 <= size; i += 32) {
+        __m256i eq = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(const void *)(block + i)), v);
+        xUInt32 mask = (xUInt32)_mm256_movemask_epi8(eq);
+        if (mask) {
+            return i + (xSize)__builtin_ctz(mask);
+        }
+    }
+
+    // search remaining tail
+    return i + xMem_findByteSSE2(block + i, size - i, value);
+}
+
+__attribute__((target("avx2"))) static xSize xMem_findPairAVX2(const xUInt8 *block, xSize count, xUInt8 first, xUInt8 last,
+                                                                xSize gap)
+{
+    __m256i vf = _mm256_set1_epi8((char)first);
+    __m256i vl = _mm256_set1_epi8((char)last);
+    xSize i = 0;
+
+    // candidate positions match first byte and byte at distance gap in the same vector lane
+    for (; i + 32 <= count; i += 32) {
+        __m256i ef = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(const void *)(block + i)), vf);
+        __m256i el = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(const void *)(block + i + gap)), vl);
+        xUInt32 mask = (xUInt32)_mm256_movemask_epi8(_mm256_and_si256(ef, el));
+        if (mask) {
+            return i + (xSize)__builtin_ctz(mask);
+        }
+    }
+
+    // search remaining tail
+    return i + xMem_findPairSSE2(block + i, count - i, first, last, gap);
+}
+
+static const xMemKernels xMem_kernelsAVX2 = {xMem_copyForwardAVX2, xMem_copyBackwardAVX2, xMem_setAVX2,
+                                             xMem_mismatchAVX2,    xMem_findByteAVX2,     xMem_findPairAVX2};
+
+#elif defined(XMEM_SIMD_NEON)
+
+/*
+ * ARM NEON kernels (16-byte vectors)
+ */
+
+static void xMem_copyForwardNEON(xUInt8 *dest, const xUInt8 *src, xSize size)
+{
+    // align destination to vector size using word kernel
+    xSize head = (0 - (xSize)dest) & 15;
+    if (head > size) {
+        head = size;
+    }
+    xMem_copyForwardWord(dest, src, head);
+    dest += head;
+    src += head;
+    size -= head;
+
+    // copy body four vectors at a time
+    while (size >= 64) {
+        uint8x16_t v0 = vld1q_u8(src + 0);
+        uint8x16_t v1 = vld1q_u8(src + 16);
+        uint8x16_t v2 = vld1q_u8(src + 32);
+        uint8x16_t v3 = vld1q_u8(src + 48);
+        vst1q_u8(dest + 0, v0);
+        vst1q_u8(dest + 16, v1);
+        vst1q_u8(dest + 32, v2);
+        vst1q_u8(dest + 48, v3);
+        dest += 64;
+        src += 64;
+        size -= 64;
+    }
+    while (size >= 16) {
+        vst1q_u8(dest, vld1q_u8(src));
+        dest += 16;
+        src += 16;
+        size -= 16;
+    }
+
+    // copy remaining tail
+    xMem_copyForwardWord(dest, src, size);
+}
+
+static void xMem_copyBackwardNEON(xUInt8 *dest, const xUInt8 *src, xSize size)
+{
+    // align end of destination to vector size using word kernel
+    xSize tail = (xSize)(dest + size) & 15;
+    if (tail > size) {
+        tail = size;
+    }
+    size -= tail;
+    xMem_copyBackwardWord(dest + size, src + size, tail);
+
+    // copy body from the end four vectors at a time
+    while (size >= 64) {
+        size -= 64;
+        uint8x16_t v3 = vld1q_u8(src + size + 48);
+        uint8x16_t v2 = vld1q_u8(src + size + 32);
+        uint8x16_t v1 = vld1q_u8(src + size + 16);
+        uint8x16_t v0 = vld1q_u8(src + size + 0);
+        vst1q_u8(dest + size + 48, v3);
+        vst1q_u8(dest + size + 32, v2);
+        vst1q_u8(dest + size + 16, v1);
+        vst1q_u8(dest + size + 0, v0);
+    }
+    while (size >= 16) {
+        size -= 16;
+        vst1q_u8(dest + size, vld1q_u8(src + size));
+    }
+
+    // copy remaining head
+    xMem_copyBackwardWord(dest, src, size);
+}
+
+static void xMem_setNEON(xUInt8 *dest, xUInt8 value, xSize size)
+{
+    uint8x16_t v = vdupq_n_u8(value);
+
+    // first (possibly unaligned) vector covers the head
+    vst1q_u8(dest, v);
+    xSize head = 16 - ((xSize)dest & 15);
+    dest += head;
+    size -= head;
+
+    // set body four vectors at a time
+    while (size >= 64) {
+        vst1q_u8(dest + 0, v);
+        vst1q_u8(dest + 16, v);
+        vst1q_u8(dest + 32, v);
+        vst1q_u8(dest + 48, v);
+        dest += 64;
+        size -= 64;
+    }
+    while (size >= 16) {
+        vst1q_u8(dest, v);
+        dest += 16;
+        size -= 16;
+    }
+
+    // last (possibly overlapping) vector covers the tail
+    if (size) {
+        vst1q_u8(dest + size - 16, v);
+    }
+}
+
+static xSize xMem_mismatchNEON(const xUInt8 *block1, const xUInt8 *block2, xSize size)
+{
+    xSize i = 0;
+
+    for (; i + 16 <= size; i += 16) {
+        uint8x16_t eq = vceqq_u8(vld1q_u8(block1 + i), vld1q_u8(block2 + i));
+
+        // narrow comparison result to 4 bits per byte so it fits into single 64-bit mask
+        xUInt64 mask = ~vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+        if (mask) {
+            return i + (xSize)(__builtin_ctzll(mask) >> 2);
+        }
+    }
+
+    // compare remaining tail
+    return i + xMem_mismatchWord(block1 + i, block2 + i, size - i);
+}
+
+static xSize xMem_findByteNEON(const xUInt8 *block, xSize size, xUInt8 value)
+{
+    uint8x16_t v = vdupq_n_u8(value);
+    xSize i = 0;
+
+    for (; i + 16 <= size; i += 16) {
+        uint8x16_t eq = vceqq_u8(vld1q_u8(block + i), v);
+
+        // narrow comparison result to 4 bits per byte so it fits into single 64-bit mask
+        xUInt64 mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+        if (mask) {
+            return i + (xSize)(__builtin_ctzll(mask) >> 2);
+        }
+    }
+
+    // search remaining tail
+    return i + xMem_findByteWord(block + i, size - i, value);
+}
+
+static xSize xMem_findPairNEON(const xUInt8 *block, xSize count, xUInt8 first, xUInt8 last, xSize gap)
+{
+    uint8x16_t vf = vdupq_n_u8(first);
+    uint8x16_t vl = vdupq_n_u8(last);
+    xSize i = 0;
+
+    // candidate positions match first byte and byte at distance gap in the same vector lane
+    for (; i + 16 <= count; i += 16) {
+        uint8x16_t eq = vandq_u8(vceqq_u8(vld1q_u8(block + i), vf), vceqq_u8(vld1q_u8(block + i + gap), vl));
+        xUInt64 mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+        if (mask) {
+            return i + (xSize)(__builtin_ctzll(mask) >> 2);
+        }
+    }
+
+    // search remaining tail
+    return i + xMem_findPairWord(block + i, count - i, first, last, gap);
+}
+
+static const xMemKernels xMem_kernelsNEON = {xMem_copyForwardNEON, xMem_copyBackwardNEON, xMem_setNEON,
+                                             xMem_mismatchNEON,    xMem_findByteNEON,     xMem_findPairNEON};
+
+#endif
+
+/**
+ * @brief
+ * Get memory kernels best suited for the running processor.
+ *
+ * @return const xMemKernels* Pointer to selected kernel set.
+ *
+ * @note
+ * Selection is done once on first use and cached for the rest of program lifetime.
+ */
+static const xMemKernels *xMem_getKernels(void)
+{
+    static const xMemKernels *volatile selected = NULL;
+
+    const xMemKernels *kernels = selected;
+    if (kernels) {
+        return kernels;
+    }
+
+    // pick widest available implementation
+    kernels = &xMem_kernelsWord;
+#if defined(XMEM_SIMD_X86)
+    if (xCpu_hasFeature(XCPU_FEATURE_AVX2)) {
+        kernels = &xMem_kernelsAVX2;
+    } else if (xCpu_hasFeature(XCPU_FEATURE_SSE2)) {
+        kernels = &xMem_kernelsSSE2;
+    }
+#elif defined(XMEM_SIMD_NEON)
+    if (xCpu_hasFeature(XCPU_FEATURE_NEON)) {
+        kernels = &xMem_kernelsNEON;
+    }
+#endif
+
+    selected = kernels;
+    return kernels;
+}
+
 void xMemCopy(void *dest, const void *src, xSize size)
 {
     // check parameter validity
@@ -12,18 +825,22 @@ void xMemCopy(void *dest, const void *src, xSize size)
     xUInt8 *destP = (xUInt8 *)dest;
     const xUInt8 *srcP = (const xUInt8 *)src;
 
-    // TODO: copying in larger chunks
-
-    // copy memory block chunk by chunk
-    for (xSize i = 0; i < size; i++) {
-        destP[i] = srcP[i];
+    if (destP > srcP && destP < srcP + size) {
+        // destination overlaps source from behind, keep byte-by-byte forward semantics (source pattern gets repeated)
+        for (xSize i = 0; i < size; i++) {
+            destP[i] = srcP[i];
+        }
+    } else if (size <= XMEM_SMALL_SIZE) {
+        xMem_copySmall(destP, srcP, size);
+    } else {
+        xMem_getKernels()->copyForward(destP, srcP, size);
     }
 }
 
 void xMemMove(void *dest, const void *src, xSize size)
 {
     // check parameter validity
-    if (dest == NULL || src == NULL || size == 0) {
+    if (dest == NULL || src == NULL || size == 0 || dest == src) {
         return;
     }
 
@@ -31,17 +848,14 @@ void xMemMove(void *dest, const void *src, xSize size)
     xUInt8 *destP = (xUInt8 *)dest;
     const xUInt8 *srcP = (const xUInt8 *)src;
 
-    // TODO: moving in larger chunks
-
     // Check if source and destination memory blocks overlap
-    if (destP < srcP) {
-        for (xSize i = 0; i < size; i++) {
-            destP[i] = srcP[i];
-        }
+    if (size <= XMEM_SMALL_SIZE) {
+        // small blocks are fully loaded before being stored
+        xMem_copySmall(destP, srcP, size);
+    } else if (destP < srcP || destP >= srcP + size) {
+        xMem_getKernels()->copyForward(destP, srcP, size);
     } else {
-        for (xSize i = size; i > 0; i--) {
-            destP[i - 1] = srcP[i - 1];
-        }
+        xMem_getKernels()->copyBackward(destP, srcP, size);
     }
 }
 
@@ -55,11 +869,13 @@ void xMemSet(void *dest, xUInt8 value, xSize size)
     // cast memory to dereferencable byte array
     xUInt8 *destP = (xUInt8 *)dest;
 
-    // TODO: setting in larger chunks
-
-    // set memory block to the specified value
-    for (xSize i = 0; i < size; i++) {
-        destP[i] = value;
+    if (size < XMEM_SMALL_SIZE) {
+        // set short blocks byte by byte
+        for (xSize i = 0; i < size; i++) {
+            destP[i] = value;
+        }
+    } else {
+        xMem_getKernels()->set(destP, value, size);
     }
 }
 
@@ -70,53 +886,785 @@ xBool xMemCmp(const void *block1, const void *block2, xSize size)
         return (block2 == NULL) ? true : false;
     } else if (block2 == NULL) {
         return false;
-    } else if (size == 0) {
+    } else if (size == 0 || block1 == block2) {
         // if size is actually zero (there is nothing to compare), return true by default
         return true;
     }
 
+    // find first differing byte (if any)
+    return (xMem_getKernels()->mismatch((const xUInt8 *)block1, (const xUInt8 *)block2, size) == size) ? true : false;
+}
+
+int xMemCompare(const void *block1, const void *block2, xSize size, xSize *mismatch)
+{
+    // NULL block orders before any valid one
+    if (block1 == NULL || block2 == NULL || size == 0 || block1 == block2) {
+        if (mismatch) {
+            *mismatch = (block1 == block2 || size == 0) ? size : 0;
+        }
+        if (size == 0 || block1 == block2) {
+            return 0;
+        }
+        return (block1 == NULL) ? -1 : 1;
+    }
+
     // cast memory to dereferencable byte arrays
     const xUInt8 *block1P = (const xUInt8 *)block1;
     const xUInt8 *block2P = (const xUInt8 *)block2;
 
-    // TODO: comparing in larger chunks
+    // locate first differing byte and order blocks by it (bytes are compared as unsigned values)
+    xSize index = xMem_getKernels()->mismatch(block1P, block2P, size);
+    if (mismatch) {
+        *mismatch = index;
+    }
+
+    return (index == size) ? 0 : (int)block1P[index] - (int)block2P[index];
+}
+
+/*
+ * Substring search
+ *
+ * Candidate positions of needle are located by vectorized filter matching two of its bytes at once, and only candidates are
+ * verified. Inputs producing too many false candidates (e.g. "aaa...ab" in "aaa...a") switch the rest of the search to Two-Way
+ * algorithm (Crochemore-Perrin), which runs in linear time and constant memory, so no search allocates. One-shot searches
+ * filter on first and last needle byte and factorize needle only on fallback, while xMemFinder precomputes everything and
+ * filters on the two rarest needle bytes.
+ */
+
+// verified bytes of false candidates allowed above number of scanned bytes before switching to Two-Way search
+#define XMEM_FIND_SLACK 256
+
+// result of filtered search abandoned in favor of Two-Way search
+#define XMEM_FIND_FALLBACK (XSIZE_MAX - 1)
+
+/**
+ * @brief
+ * Get byte at given index of block read in forward or reversed order.
+ */
+static inline xUInt8 xMem_at(const xUInt8 *block, xSize size, xSize index, xBool reversed)
+{
+    return reversed ? block[size - 1 - index] : block[index];
+}
+
+/**
+ * @brief
+ * Compute critical factorization of finder needle (read in forward or reversed order) for Two-Way search.
+ *
+ * @param finder Pointer to finder with needle set, receiving factorization for given direction.
+ * @param reversed Whether needle is read from its end.
+ *
+ * @note
+ * Critical position is the later of maximal suffixes under both byte orderings. If left half does not repeat with period of
+ * right half, needle is not periodic and period is replaced by lower bound of needle period.
+ */
+static void xMem_factorize(xMemFinder *finder, xBool reversed)
+{
+    const xUInt8 *needle = finder->needle;
+    xSize size = finder->size;
+
+    xSize suffix[2] = {0, 0}, periods[2] = {1, 1};
+    for (int order = 0; order < 2 && size >= 3; order++) {
+        // indices wrap around from XSIZE_MAX on purpose (empty maximal suffix starts at -1)
+        xSize maxSuffix = XSIZE_MAX, j = 0, k = 1, p = 1;
+        while (j + k < size) {
+            xUInt8 a = xMem_at(needle, size, j + k, reversed);
+            xUInt8 b = xMem_at(needle, size, maxSuffix + k, reversed);
+            if (order ? (a > b) : (a < b)) {
+                j += k;
+                k = 1;
+                p = j - maxSuffix;
+            } else if (a == b) {
+                if (k != p) {
+                    k++;
+                } else {
+                    j += p;
+                    k = 1;
+                }
+            } else {
+                maxSuffix = j++;
+                k = p = 1;
+            }
+        }
+        suffix[order] = maxSuffix + 1;
+        periods[order] = p;
+    }
+    if (size < 3) {
+        suffix[0] = size ? size - 1 : 0;
+    }
+
+    int choice = (suffix[1] > suffix[0]) ? 1 : 0;
+    xSize critical = suffix[choice];
+    xSize period = periods[choice];
+    xBool periodic = (critical + period <= size);
+    for (xSize i = 0; i < critical && periodic; i++) {
+        periodic = xMem_at(needle, size, i, reversed) == xMem_at(needle, size, i + period, reversed);
+    }
+
+    finder->critical[reversed] = critical;
+    finder->period[reversed] = periodic ? period : ((critical > size - critical) ? critical : size - critical) + 1;
+    finder->periodic[reversed] = periodic;
+}
+
+/**
+ * @brief
+ * Two-Way search for finder needle in block, starting at given position.
+ *
+ * @param finder Pointer to finder with factorization for given direction.
+ * @param block Haystack bytes.
+ * @param size Length of haystack (at least needle length).
+ * @param start First candidate position.
+ * @param reversed Whether haystack and needle are read from their ends (position 0 is then last possible match).
+ * @param count Pointer to variable receiving number of matches (NULL to stop at first match).
+ * @param overlapping Whether counted matches may overlap.
+ * @return xSize Position of first match (in order of reading), XSIZE_MAX if not found or if matches are counted.
+ */
+static xSize xMem_twoWay(const xMemFinder *finder, const xUInt8 *block, xSize size, xSize start, xBool reversed, xSize *count,
+                         xBool overlapping)
+{
+    const xUInt8 *needle = finder->needle;
+    xSize needleSize = finder->size;
+    xSize suffix = finder->critical[reversed];
+    xSize period = finder->period[reversed];
+    xBool periodic = finder->periodic[reversed];
+
+    // memory holds length of needle prefix known to match after shift by period (periodic needles only)
+    xSize j = start, memory = 0;
+    while (j <= size - needleSize) {
+        // match right half from critical position
+        xSize i = (suffix > memory) ? suffix : memory;
+        while (i < needleSize && xMem_at(needle, needleSize, i, reversed) == xMem_at(block, size, i + j, reversed)) {
+            i++;
+        }
+        if (i < needleSize) {
+            j += i - suffix + 1;
+            memory = 0;
+            continue;
+        }
+
+        // match left half backwards
+        i = suffix;
+        while (i > memory && xMem_at(needle, needleSize, i - 1, reversed) == xMem_at(block, size, i - 1 + j, reversed)) {
+            i--;
+        }
+        if (i <= memory) {
+            if (!count) {
+                return j;
+            }
+            (*count)++;
+            if (!overlapping) {
+                j += needleSize;
+                memory = 0;
+                continue;
+            }
+        }
+        j += period;
+        memory = periodic ? needleSize - period : 0;
+    }
+
+    return XSIZE_MAX;
+}
+
+/**
+ * @brief
+ * Find finder needle (at least 2 bytes long) in block by filtering candidates on two needle bytes.
+ *
+ * @param kernels Memory kernels of running processor.
+ * @param finder Pointer to finder.
+ * @param block Haystack bytes.
+ * @param size Length of haystack (at least needle length).
+ * @param start Pointer to first candidate position (on fallback, receives position where Two-Way search should continue).
+ * @param wasted Pointer to number of bytes verified at false candidates (shared by consecutive calls).
+ * @return xSize Position of match, XSIZE_MAX if not found or XMEM_FIND_FALLBACK if there were too many false candidates.
+ */
+static xSize xMem_filterFind(const xMemKernels *kernels, const xMemFinder *finder, const xUInt8 *block, xSize size,
+                             xSize *start, xSize *wasted)
+{
+    const xUInt8 *needle = finder->needle;
+    xSize needleSize = finder->size;
+    xSize first = finder->rare[0], gap = finder->rare[1] - finder->rare[0];
+
+    xSize count = size - needleSize + 1;
+    for (xSize j = *start; j < count; j++) {
+        j += kernels->findPair(block + first + j, count - j, needle[first], needle[first + gap], gap);
+        if (j >= count) {
+            break;
+        }
+
+        // verify whole needle
+        xSize matched = kernels->mismatch(block + j, needle, needleSize);
+        if (matched == needleSize) {
+            return j;
+        }
+        *wasted += matched + 1;
+        if (*wasted > j + XMEM_FIND_SLACK) {
+            *start = j + 1;
+            return XMEM_FIND_FALLBACK;
+        }
+    }
+
+    return XSIZE_MAX;
+}
+
+/**
+ * @brief
+ * Find last occurrence of finder needle (at least 2 bytes long) by scanning candidates backwards.
+ *
+ * @param finder Pointer to finder (factorization for reversed direction is computed on fallback if `prepared` is false).
+ * @param block Haystack bytes.
+ * @param size Length of haystack (at least needle length).
+ * @param prepared Whether finder already holds factorization for reversed direction.
+ * @return xSize Position of last match, XSIZE_MAX if not found.
+ */
+static xSize xMem_filterFindLast(xMemFinder *finder, const xUInt8 *block, xSize size, xBool prepared)
+{
+    const xUInt8 *needle = finder->needle;
+    xSize needleSize = finder->size;
+    xSize first = finder->rare[0], second = finder->rare[1];
+
+    xSize wasted = 0;
+    for (xSize j = size - needleSize + 1; j-- > 0;) {
+        if (block[j + first] != needle[first] || block[j + second] != needle[second]) {
+            continue;
+        }
+        xSize matched = xMem_getKernels()->mismatch(block + j, needle, needleSize);
+        if (matched == needleSize) {
+            return j;
+        }
+
+        // too many false candidates, search rest of block by Two-Way algorithm reading it from the end
+        wasted += matched + 1;
+        if (wasted > size - j + XMEM_FIND_SLACK) {
+            if (!prepared) {
+                xMem_factorize(finder, true);
+            }
+            xSize index = xMem_twoWay(finder, block, size, size - needleSize - j + 1, true, NULL, false);
+            return (index == XSIZE_MAX) ? XSIZE_MAX : size - needleSize - index;
+        }
+    }
+
+    return XSIZE_MAX;
+}
+
+/**
+ * @brief
+ * Count occurrences of finder needle in block.
+ *
+ * @param finder Pointer to finder (factorization for forward direction is computed on fallback if `prepared` is false).
+ * @param block Haystack bytes.
+ * @param size Length of haystack (at least needle length).
+ * @param overlapping Whether occurrences may overlap.
+ * @param prepared Whether finder already holds factorization for forward direction.
+ * @return xSize Number of occurrences.
+ */
+static xSize xMem_filterCount(xMemFinder *finder, const xUInt8 *block, xSize size, xBool overlapping, xBool prepared)
+{
+    const xMemKernels *kernels = xMem_getKernels();
+    xSize needleSize = finder->size;
+
+    xSize count = 0;
+    if (needleSize == 1) {
+        // occurrences of single byte never overlap
+        for (xSize i = 0; i < size; i++, count++) {
+            i += kernels->findByte(block + i, size - i, finder->needle[0]);
+            if (i == size) {
+                break;
+            }
+        }
+        return count;
+    }
+
+    xSize start = 0, wasted = 0;
+    while (true) {
+        xSize index = xMem_filterFind(kernels, finder, block, size, &start, &wasted);
+        if (index == XSIZE_MAX) {
+            break;
+        } else if (index == XMEM_FIND_FALLBACK) {
+            if (!prepared) {
+                xMem_factorize(finder, false);
+            }
+            xMem_twoWay(finder, block, size, start, false, &count, overlapping);
+            break;
+        }
+
+        // verification of overlapping matches is wasted work as well (needle is then periodic)
+        count++;
+        start = index + (overlapping ? 1 : needleSize);
+        wasted += overlapping ? needleSize : 0;
+    }
+
+    return count;
+}
+
+/**
+ * @brief
+ * Set needle of finder and filter candidates on its first and last byte (no factorization is computed).
+ */
+static inline void xMem_finderQuick(xMemFinder *finder, const void *needle, xSize size)
+{
+    finder->needle = (const xUInt8 *)needle;
+    finder->size = size;
+    finder->rare[0] = 0;
+    finder->rare[1] = size - 1;
+}
+
+/**
+ * @brief
+ * Get approximate frequency rank of byte in text and binary data (higher is more frequent).
+ *
+ * @note
+ * Ranks follow byte frequencies of English text, source code and logs: space and lowercase letters first, then digits,
+ * punctuation, uppercase letters and control characters, with other bytes considered rare.
+ */
+static xUInt8 xMem_byteRank(xUInt8 value)
+{
+    static const char common[] = " etaoinsrhldcumfpgwybvkxjqz0123456789.,_-:/()=;\"'\n"
+                                 "ETAOINSRHLDCUMFPGWYBVKXJQZ[]{}<>*#+!?%&|\t\r\\@$^~`";
+    if (value == 0) {
+        // zero bytes are frequent in binary data
+        return 200;
+    }
+    for (xSize i = 0; i < sizeof(common) - 1; i++) {
+        if ((xUInt8)common[i] == value) {
+            return (xUInt8)(255 - i);
+        }
+    }
+    return 0;
+}
 
-    // compare memory blocks chunk by chunk
+void xMemFinderInit(xMemFinder *finder, const void *needle, xSize size)
+{
+    // check parameter validity (invalid finder never matches)
+    if (finder == NULL) {
+        return;
+    }
+    finder->needle = (const xUInt8 *)needle;
+    finder->size = (needle || !size) ? size : XSIZE_MAX;
+    finder->rare[0] = finder->rare[1] = 0;
+    if (needle == NULL || size == 0) {
+        return;
+    }
+
+    // pick two rarest bytes at different offsets (preferring different values) for candidate filter
+    const xUInt8 *needleP = (const xUInt8 *)needle;
+    xSize rare1 = 0, rare2 = size - 1;
+    for (xSize i = 1; i < size; i++) {
+        if (xMem_byteRank(needleP[i]) < xMem_byteRank(needleP[rare1])) {
+            rare1 = i;
+        }
+    }
+    rare2 = (rare1 == size - 1) ? 0 : size - 1;
     for (xSize i = 0; i < size; i++) {
-        if (block1P[i] != block2P[i]) {
-            return false;
+        if (i == rare1) {
+            continue;
+        }
+        xBool sameValue = (needleP[i] == needleP[rare1]), bestSame = (needleP[rare2] == needleP[rare1]);
+        if ((bestSame && !sameValue) ||
+            (sameValue == bestSame && xMem_byteRank(needleP[i]) < xMem_byteRank(needleP[rare2]))) {
+            rare2 = i;
         }
     }
+    finder->rare[0] = (rare1 < rare2) ? rare1 : rare2;
+    finder->rare[1] = (rare1 < rare2) ? rare2 : rare1;
 
-    return true;
+    // precompute Two-Way factorizations for both directions
+    xMem_factorize(finder, false);
+    xMem_factorize(finder, true);
 }
 
-xUInt64 xMemHash(const void *block, xSize size)
+xSize xMemFinderFind(const xMemFinder *finder, const void *block, xSize size)
 {
-    // FNV-1a hash algorithm (64-bit)
-    const xUInt64 FNV_OFFSET_BASIS = 14695981039346656037ULL;
-    const xUInt64 FNV_PRIME = 1099511628211ULL;
+    // check parameter validity
+    if (finder == NULL || finder->size == XSIZE_MAX) {
+        return XSIZE_MAX;
+    } else if (finder->size == 0) {
+        return (block || !size) ? 0 : XSIZE_MAX;
+    } else if (block == NULL || finder->size > size) {
+        return XSIZE_MAX;
+    } else if (finder->size == 1) {
+        return xMemFindByte(block, size, finder->needle[0]);
+    }
+
+    const xUInt8 *blockP = (const xUInt8 *)block;
+    xSize start = 0, wasted = 0;
+    xSize index = xMem_filterFind(xMem_getKernels(), finder, blockP, size, &start, &wasted);
+    if (index == XMEM_FIND_FALLBACK) {
+        index = xMem_twoWay(finder, blockP, size, start, false, NULL, false);
+    }
 
+    return index;
+}
+
+xSize xMemFinderFindLast(const xMemFinder *finder, const void *block, xSize size)
+{
     // check parameter validity
-    if (size == 0) {
-        // if size is actually zero (regardless of block address), return the basis offset
-        return FNV_OFFSET_BASIS;
-    } else if (block == NULL) {
-        // if block address is invalid (but size is not zero), return zero
+    if (finder == NULL || finder->size == XSIZE_MAX) {
+        return XSIZE_MAX;
+    } else if (finder->size == 0) {
+        return (block || !size) ? size : XSIZE_MAX;
+    } else if (block == NULL || finder->size > size) {
+        return XSIZE_MAX;
+    }
+
+    // search works on copy, so prepared factorization is never recomputed into const finder
+    xMemFinder copy = *finder;
+    return xMem_filterFindLast(&copy, (const xUInt8 *)block, size, true);
+}
+
+xSize xMemFinderCount(const xMemFinder *finder, const void *block, xSize size, xBool overlapping)
+{
+    // check parameter validity
+    if (finder == NULL || finder->size == XSIZE_MAX || finder->size == 0 || block == NULL || finder->size > size) {
         return 0;
     }
 
-    // cast memory block to byte array
+    xMemFinder copy = *finder;
+    return xMem_filterCount(&copy, (const xUInt8 *)block, size, overlapping, true);
+}
+
+xSize xMemFindByte(const void *block, xSize size, xUInt8 value)
+{
+    // check parameter validity
+    if (block == NULL || size == 0) {
+        return XSIZE_MAX;
+    }
+
+    xSize index = xMem_getKernels()->findByte((const xUInt8 *)block, size, value);
+    return (index == size) ? XSIZE_MAX : index;
+}
+
+xSize xMemFind(const void *block, xSize size, const void *needle, xSize needleSize)
+{
+    // check parameter validity
+    if (needleSize == 0) {
+        return (block || !size) ? 0 : XSIZE_MAX;
+    } else if (block == NULL || needle == NULL || needleSize > size) {
+        return XSIZE_MAX;
+    } else if (needleSize == 1) {
+        return xMemFindByte(block, size, *(const xUInt8 *)needle);
+    }
+
+    // factorization is computed only if search falls back to Two-Way algorithm
+    xMemFinder finder;
+    xMem_finderQuick(&finder, needle, needleSize);
     const xUInt8 *blockP = (const xUInt8 *)block;
-    xUInt64 hash = FNV_OFFSET_BASIS;
+    xSize start = 0, wasted = 0;
+    xSize index = xMem_filterFind(xMem_getKernels(), &finder, blockP, size, &start, &wasted);
+    if (index == XMEM_FIND_FALLBACK) {
+        xMem_factorize(&finder, false);
+        index = xMem_twoWay(&finder, blockP, size, start, false, NULL, false);
+    }
 
-    // perform hash calculation
-    for (xSize i = 0; i < size; i++) {
-        hash ^= blockP[i];
-        hash *= FNV_PRIME;
+    return index;
+}
+
+xSize xMemFindLast(const void *block, xSize size, const void *needle, xSize needleSize)
+{
+    // check parameter validity
+    if (needleSize == 0) {
+        return (block || !size) ? size : XSIZE_MAX;
+    } else if (block == NULL || needle == NULL || needleSize > size) {
+        return XSIZE_MAX;
+    }
+
+    xMemFinder finder;
+    xMem_finderQuick(&finder, needle, needleSize);
+    return xMem_filterFindLast(&finder, (const xUInt8 *)block, size, false);
+}
+
+xSize xMemCount(const void *block, xSize size, const void *needle, xSize needleSize, xBool overlapping)
+{
+    // check parameter validity
+    if (block == NULL || needle == NULL || needleSize == 0 || needleSize > size) {
+        return 0;
+    }
+
+    xMemFinder finder;
+    xMem_finderQuick(&finder, needle, needleSize);
+    return xMem_filterCount(&finder, (const xUInt8 *)block, size, overlapping, false);
+}
+
+/*
+ * Hash function (wyhash-style multiply-mix construction)
+ *
+ * Input is consumed in 48-byte stripes by three separate lanes, the rest in 16-byte steps, and the last 16 bytes of input are
+ * always mixed into the result (even if they overlap with already consumed data). Inputs up to 16 bytes take a branch-light path
+ * with overlapping reads. Streaming interface follows the exact same schedule, so chunked input hashes to the same value.
+ *
+ * Every multiplication takes input word combined with secret or lane value derived from seed. Input alone thus cannot zero either
+ * multiplicand (which would erase other input and seed from the product) unless the seed is known.
+ */
+
+// constants secrets are derived from (odd 64-bit constants with balanced bit counts)
+#define XMEM_HASH_P0 0xa0761d6478bd642fULL
+#define XMEM_HASH_P1 0xe7037ed1a0b428dbULL
+#define XMEM_HASH_P2 0x8ebc6af09c88c6e3ULL
+#define XMEM_HASH_P3 0x589965cc75374cc3ULL
+
+/**
+ * @brief
+ * Multiply two 64-bit values to 128-bit product and return its halves in place of inputs.
+ */
+static inline void xMem_hashMum(xUInt64 *a, xUInt64 *b)
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 xMemUInt128;
+    xMemUInt128 r = (xMemUInt128)*a * *b;
+    *a = (xUInt64)r;
+    *b = (xUInt64)(r >> 64);
+#else
+    // portable 64x64 -> 128 multiplication through 32-bit halves
+    xUInt64 ha = *a >> 32, hb = *b >> 32, la = (xUInt32)*a, lb = (xUInt32)*b;
+    xUInt64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32);
+    xUInt64 c = t < rl;
+    xUInt64 lo = t + (rm1 << 32);
+    c += lo < t;
+    *a = lo;
+    *b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+/**
+ * @brief
+ * Multiply two 64-bit values and fold 128-bit product into 64 bits.
+ */
+static inline xUInt64 xMem_hashMix(xUInt64 a, xUInt64 b)
+{
+    xMem_hashMum(&a, &b);
+    return a ^ b;
+}
+
+/**
+ * @brief
+ * Read little-endian 64-bit value from unaligned address.
+ */
+static inline xUInt64 xMem_hashRead64(const xUInt8 *p)
+{
+    xUInt64 v = *(const xMemWord *)p;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap64(v);
+#endif
+    return v;
+}
+
+/**
+ * @brief
+ * Read little-endian 32-bit value from unaligned address.
+ */
+static inline xUInt64 xMem_hashRead32(const xUInt8 *p)
+{
+    xUInt32 v = *(const xMemHalfWord *)p;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap32(v);
+#endif
+    return v;
+}
+
+/**
+ * @brief
+ * Derive initial lane value and per-lane secrets from user seed.
+ */
+static inline xUInt64 xMem_hashSeed(xUInt64 seed, xUInt64 secret[3])
+{
+    secret[0] = xMem_hashMix(seed ^ XMEM_HASH_P1, XMEM_HASH_P0);
+    secret[1] = xMem_hashMix(seed ^ XMEM_HASH_P2, XMEM_HASH_P0);
+    secret[2] = xMem_hashMix(seed ^ XMEM_HASH_P3, XMEM_HASH_P0);
+    return seed ^ xMem_hashMix(seed ^ XMEM_HASH_P0, XMEM_HASH_P1);
+}
+
+/**
+ * @brief
+ * Consume whole stripes while more than one stripe of input is left.
+ *
+ * @param lanes Three lane accumulators.
+ * @param secret Three secrets derived from seed.
+ * @param p Input address.
+ * @param size Input size in bytes.
+ * @return xSize Number of bytes consumed (multiple of stripe size, always leaving 1 to 48 bytes unconsumed).
+ */
+static xSize xMem_hashStripes(xUInt64 lanes[3], const xUInt64 secret[3], const xUInt8 *p, xSize size)
+{
+    xSize i = 0;
+    xUInt64 l0 = lanes[0], l1 = lanes[1], l2 = lanes[2];
+
+    for (; size - i > XMEM_HASH_STRIPE; i += XMEM_HASH_STRIPE) {
+        l0 = xMem_hashMix(xMem_hashRead64(p + i + 0) ^ secret[0], xMem_hashRead64(p + i + 8) ^ l0);
+        l1 = xMem_hashMix(xMem_hashRead64(p + i + 16) ^ secret[1], xMem_hashRead64(p + i + 24) ^ l1);
+        l2 = xMem_hashMix(xMem_hashRead64(p + i + 32) ^ secret[2], xMem_hashRead64(p + i + 40) ^ l2);
     }
 
-    return hash;
+    lanes[0] = l0;
+    lanes[1] = l1;
+    lanes[2] = l2;
+    return i;
+}
+
+/**
+ * @brief
+ * Finish hash calculation from lane state and last (at most one stripe) part of input.
+ *
+ * @param seed Combined lane state.
+ * @param secret Three secrets derived from seed.
+ * @param p Address of unconsumed input (for inputs longer than 16 bytes, 16 bytes before it must be readable).
+ * @param rest Number of unconsumed bytes.
+ * @param total Total input size in bytes.
+ * @param high Optional pointer to store second 64-bit half of the result (mixed from the same state as the first one).
+ * @return xUInt64 Hash value.
+ */
+static xUInt64 xMem_hashFinish(xUInt64 seed, const xUInt64 secret[3], const xUInt8 *p, xSize rest, xUInt64 total,
+                               xUInt64 *high)
+{
+    xUInt64 a, b;
+
+    if (total <= 16) {
+        // short input, overlapping reads cover every byte
+        if (rest >= 4) {
+            xSize shift = (rest >> 3) << 2;
+            a = (xMem_hashRead32(p) << 32) | xMem_hashRead32(p + shift);
+            b = (xMem_hashRead32(p + rest - 4) << 32) | xMem_hashRead32(p + rest - 4 - shift);
+        } else if (rest > 0) {
+            a = ((xUInt64)p[0] << 16) | ((xUInt64)p[rest >> 1] << 8) | p[rest - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        // consume 16-byte steps, then mix last 16 bytes of input
+        while (rest > 16) {
+            seed = xMem_hashMix(xMem_hashRead64(p) ^ secret[0], xMem_hashRead64(p + 8) ^ seed);
+            p += 16;
+            rest -= 16;
+        }
+        a = xMem_hashRead64(p + rest - 16);
+        b = xMem_hashRead64(p + rest - 8);
+    }
+
+    a ^= secret[0];
+    b ^= seed;
+    xMem_hashMum(&a, &b);
+
+    if (high) {
+        *high = xMem_hashMix(b ^ secret[1] ^ total, a ^ secret[2]);
+    }
+    return xMem_hashMix(a ^ XMEM_HASH_P0 ^ total, b ^ secret[0]);
+}
+
+/**
+ * @brief
+ * One-shot hash of memory block returning both 64-bit halves.
+ */
+static xUInt64 xMem_hash(const xUInt8 *p, xSize size, xUInt64 seed, xUInt64 *high)
+{
+    xUInt64 lanes[3], secret[3];
+    lanes[0] = lanes[1] = lanes[2] = xMem_hashSeed(seed, secret);
+
+    xSize consumed = 0;
+    if (size > XMEM_HASH_STRIPE) {
+        consumed = xMem_hashStripes(lanes, secret, p, size);
+        lanes[0] ^= lanes[1] ^ lanes[2];
+    }
+
+    return xMem_hashFinish(lanes[0], secret, p + consumed, size - consumed, size, high);
+}
+
+xUInt64 xMemHash(const void *block, xSize size) { return xMemHashSeeded(block, size, 0); }
+
+xUInt64 xMemHashSeeded(const void *block, xSize size, xUInt64 seed)
+{
+    // check parameter validity
+    if (block == NULL && size != 0) {
+        // if block address is invalid (but size is not zero), return zero
+        return 0;
+    }
+
+    return xMem_hash((const xUInt8 *)block, size, seed, NULL);
+}
+
+xHash128 xMemHash128(const void *block, xSize size, xUInt64 seed)
+{
+    xHash128 ret = {0, 0};
+
+    // check parameter validity
+    if (block == NULL && size != 0) {
+        return ret;
+    }
+
+    ret.low = xMem_hash((const xUInt8 *)block, size, seed, &ret.high);
+    return ret;
+}
+
+void xMemHashInit(xMemHashState *state, xUInt64 seed)
+{
+    // check parameter validity
+    if (!state) {
+        return;
+    }
+
+    state->lanes[0] = state->lanes[1] = state->lanes[2] = xMem_hashSeed(seed, state->secret);
+    state->total = 0;
+    state->buffered = 0;
+}
+
+void xMemHashUpdate(xMemHashState *state, const void *block, xSize size)
+{
+    // check parameter validity
+    if (!state || !block || size == 0) {
+        return;
+    }
+
+    const xUInt8 *p = (const xUInt8 *)block;
+    xUInt8 *pending = state->buffer + XMEM_HASH_HISTORY;  // unconsumed bytes follow history of last consumed bytes
+    state->total += size;
+
+    // top up pending stripe, it can be consumed only once more input is known to follow it
+    if (state->buffered + size <= XMEM_HASH_STRIPE) {
+        xMemCopy(pending + state->buffered, p, size);
+        state->buffered += size;
+        return;
+    }
+    if (state->buffered) {
+        xSize fill = XMEM_HASH_STRIPE - state->buffered;
+        xMemCopy(pending + state->buffered, p, fill);
+        xMem_hashStripes(state->lanes, state->secret, pending, XMEM_HASH_STRIPE + 1);
+        xMemCopy(state->buffer, pending + XMEM_HASH_STRIPE - XMEM_HASH_HISTORY, XMEM_HASH_HISTORY);
+        p += fill;
+        size -= fill;
+    }
+
+    // consume whole stripes directly from input, keep last (1 to 48) bytes pending along with history
+    xSize consumed = xMem_hashStripes(state->lanes, state->secret, p, size);
+    if (consumed) {
+        xMemCopy(state->buffer, p + consumed - XMEM_HASH_HISTORY, XMEM_HASH_HISTORY);
+    }
+    xMemCopy(pending, p + consumed, size - consumed);
+    state->buffered = size - consumed;
+}
+
+/**
+ * @brief
+ * Finish streaming hash calculation without modifying the state.
+ */
+static xUInt64 xMem_hashStateFinish(const xMemHashState *state, xUInt64 *high)
+{
+    const xUInt8 *pending = state->buffer + XMEM_HASH_HISTORY;
+
+    // lanes are combined only if at least one stripe has been consumed
+    xUInt64 seed = state->lanes[0];
+    if (state->total > XMEM_HASH_STRIPE) {
+        seed ^= state->lanes[1] ^ state->lanes[2];
+    }
+
+    return xMem_hashFinish(seed, state->secret, pending, state->buffered, state->total, high);
+}
+
+xUInt64 xMemHashFinal(const xMemHashState *state) { return state ? xMem_hashStateFinish(state, NULL) : 0; }
+
+xHash128 xMemHashFinal128(const xMemHashState *state)
+{
+    xHash128 ret = {0, 0};
+    if (state) {
+        ret.low = xMem_hashStateFinish(state, &ret.high);
+    }
+    return ret;
 }
 
 void xMemSwap(void *a, void *b, xSize size)
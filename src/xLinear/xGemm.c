@@ -0,0 +1,613 @@
+#include "xLinear/xGemm.h"
+#include <stdint.h>  // uintptr_t
+#include "xBase/xCpu.h"  // runtime SIMD feature detection
+#include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
+#include "xThread/xThreadPool.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>  // AVX2 and FMA intrinsics (enabled per function through target attribute)
+#define XGEMM_SIMD_X86
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>  // NEON intrinsics
+#define XGEMM_SIMD_NEON
+#endif
+
+// cache blocking: packed MC x KC block of A stays in L2, KC x NR sliver of B in L1, KC x NC panel of B in L3
+#define XGEMM_MC 120   // multiple of every micro-kernel MR
+#define XGEMM_KC 256
+#define XGEMM_NC 2048  // multiple of every micro-kernel NR
+
+// largest micro-kernel tile (size of scratch tile used for edges of C)
+#define XGEMM_MAX_MR 8
+#define XGEMM_MAX_NR 16
+
+// products with at most this many multiply-adds skip packing, as its overhead would dominate
+#define XGEMM_SMALL_WORK (32 * 32 * 32)
+
+// products with at least this many multiply-adds split row blocks between threads of shared pool
+#define XGEMM_PARALLEL_WORK (128 * 128 * 128)
+
+// alignment of packed panels
+#define XGEMM_PANEL_ALIGNMENT 64
+
+// select SIMD micro-kernel of target architecture (portable code only if none is available)
+#if defined(XGEMM_SIMD_X86)
+#define XGEMM_SIMD_KERNEL(x86, neon) (x86)
+#define XGEMM_SIMD_FEATURES(x86, neon) (x86)
+#elif defined(XGEMM_SIMD_NEON)
+#define XGEMM_SIMD_KERNEL(x86, neon) (neon)
+#define XGEMM_SIMD_FEATURES(x86, neon) (neon)
+#else
+#define XGEMM_SIMD_KERNEL(x86, neon) NULL
+#define XGEMM_SIMD_FEATURES(x86, neon) XCPU_FEATURE_NONE
+#endif
+
+/*
+ * Every element type T is described by:
+ *  - elem:   type of elements of A and B
+ *  - packed: type of elements of packed panels (int8 is widened to int16 for pairwise multiply-add instructions)
+ *  - acc:    type of elements of C, alpha and beta
+ *  - calc:   type of intermediate arithmetic (unsigned for integers, so overflow wraps around instead of being undefined)
+ *  - ks:     number of consecutive k indices interleaved in packed panels (products of ks elements are summed at once)
+ */
+
+/**
+ * @brief
+ * Define micro-kernel and kernel descriptor types of element type, together with portable 4 x 8 micro-kernel.
+ *
+ * @note
+ * Micro-kernel computes one MR x NR tile C = alpha * A * B + beta * C, where A is MR x kc sliver packed in column groups of ks
+ * and B is kc x NR sliver packed in row groups of ks (kc is multiple of ks). If beta is zero, C is not read. Inner loops of
+ * portable kernel are left to compiler auto-vectorization.
+ */
+#define XGEMM_DEFINE_KERNEL(T, packed, acc, calc, ks)                                                                    \
+    typedef void (*xGemmMicroKernel_##T)(xSize kc, const packed *a, const packed *b, acc *c, xSize ldc, acc alpha,        \
+                                         acc beta);                                                                      \
+                                                                                                                         \
+    typedef struct xGemmKernel_##T##_s {                                                                                 \
+        xSize mr;                      /* rows of C tile computed by micro-kernel */                                     \
+        xSize nr;                      /* columns of C tile computed by micro-kernel */                                  \
+        xGemmMicroKernel_##T micro;    /* micro-kernel itself */                                                         \
+    } xGemmKernel_##T;                                                                                                   \
+                                                                                                                         \
+    static void xGemm_microPortable_##T(xSize kc, const packed *a, const packed *b, acc *c, xSize ldc, acc alpha,        \
+                                        acc beta)                                                                        \
+    {                                                                                                                    \
+        calc sums[4][8] = {{0}};                                                                                         \
+        for (xSize p = 0; p < kc; p += (ks), a += 4 * (ks), b += 8 * (ks)) {                                             \
+            for (xSize i = 0; i < 4; i++) {                                                                              \
+                for (xSize j = 0; j < 8; j++) {                                                                          \
+                    for (xSize s = 0; s < (ks); s++) {                                                                   \
+                        sums[i][j] += (calc)a[i * (ks) + s] * (calc)b[j * (ks) + s];                                     \
+                    }                                                                                                    \
+                }                                                                                                        \
+            }                                                                                                            \
+        }                                                                                                                \
+                                                                                                                         \
+        for (xSize i = 0; i < 4; i++, c += ldc) {                                                                        \
+            for (xSize j = 0; j < 8; j++) {                                                                              \
+                c[j] = (acc)((beta != 0) ? (calc)alpha * sums[i][j] + (calc)beta * (calc)c[j] : (calc)alpha * sums[i][j]); \
+            }                                                                                                            \
+        }                                                                                                                \
+    }                                                                                                                    \
+                                                                                                                         \
+    static const xGemmKernel_##T xGemm_kernelPortable_##T = {4, 8, xGemm_microPortable_##T}
+
+XGEMM_DEFINE_KERNEL(f32, float, float, float, 1);
+XGEMM_DEFINE_KERNEL(f64, double, double, double, 1);
+XGEMM_DEFINE_KERNEL(i32, xInt32, xInt32, xUInt32, 1);
+XGEMM_DEFINE_KERNEL(i8, xInt16, xInt32, xUInt32, 2);
+
+#ifdef XGEMM_SIMD_X86
+
+/*
+ * x86 AVX2/FMA micro-kernels (6 rows of C tile in 12 accumulator registers)
+ */
+
+__attribute__((target("avx2,fma"))) static inline void xGemm_storeRowAVX2_f32(float *c, __m256 lo, __m256 hi, float alpha,
+                                                                              float beta)
+{
+    __m256 scale = _mm256_set1_ps(alpha);
+    lo = _mm256_mul_ps(lo, scale);
+    hi = _mm256_mul_ps(hi, scale);
+    if (beta != 0.0f) {
+        __m256 keep = _mm256_set1_ps(beta);
+        lo = _mm256_fmadd_ps(keep, _mm256_loadu_ps(c), lo);
+        hi = _mm256_fmadd_ps(keep, _mm256_loadu_ps(c + 8), hi);
+    }
+    _mm256_storeu_ps(c, lo);
+    _mm256_storeu_ps(c + 8, hi);
+}
+
+__attribute__((target("avx2,fma"))) static void xGemm_microAVX2_f32(xSize kc, const float *a, const float *b, float *c,
+                                                                    xSize ldc, float alpha, float beta)
+{
+    __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+    __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+    __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+    __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+    __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+    __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+
+    for (xSize p = 0; p < kc; p++, a += 6, b += 16) {
+        __m256 b0 = _mm256_load_ps(b);
+        __m256 b1 = _mm256_load_ps(b + 8);
+        __m256 ai = _mm256_broadcast_ss(a);
+        c00 = _mm256_fmadd_ps(ai, b0, c00);
+        c01 = _mm256_fmadd_ps(ai, b1, c01);
+        ai = _mm256_broadcast_ss(a + 1);
+        c10 = _mm256_fmadd_ps(ai, b0, c10);
+        c11 = _mm256_fmadd_ps(ai, b1, c11);
+        ai = _mm256_broadcast_ss(a + 2);
+        c20 = _mm256_fmadd_ps(ai, b0, c20);
+        c21 = _mm256_fmadd_ps(ai, b1, c21);
+        ai = _mm256_broadcast_ss(a + 3);
+        c30 = _mm256_fmadd_ps(ai, b0, c30);
+        c31 = _mm256_fmadd_ps(ai, b1, c31);
+        ai = _mm256_broadcast_ss(a + 4);
+        c40 = _mm256_fmadd_ps(ai, b0, c40);
+        c41 = _mm256_fmadd_ps(ai, b1, c41);
+        ai = _mm256_broadcast_ss(a + 5);
+        c50 = _mm256_fmadd_ps(ai, b0, c50);
+        c51 = _mm256_fmadd_ps(ai, b1, c51);
+    }
+
+    xGemm_storeRowAVX2_f32(c, c00, c01, alpha, beta);
+    xGemm_storeRowAVX2_f32(c + ldc, c10, c11, alpha, beta);
+    xGemm_storeRowAVX2_f32(c + 2 * ldc, c20, c21, alpha, beta);
+    xGemm_storeRowAVX2_f32(c + 3 * ldc, c30, c31, alpha, beta);
+    xGemm_storeRowAVX2_f32(c + 4 * ldc, c40, c41, alpha, beta);
+    xGemm_storeRowAVX2_f32(c + 5 * ldc, c50, c51, alpha, beta);
+}
+
+static const xGemmKernel_f32 xGemm_kernelAVX2_f32 = {6, 16, xGemm_microAVX2_f32};
+
+__attribute__((target("avx2,fma"))) static inline void xGemm_storeRowAVX2_f64(double *c, __m256d lo, __m256d hi, double alpha,
+                                                                              double beta)
+{
+    __m256d scale = _mm256_set1_pd(alpha);
+    lo = _mm256_mul_pd(lo, scale);
+    hi = _mm256_mul_pd(hi, scale);
+    if (beta != 0.0) {
+        __m256d keep = _mm256_set1_pd(beta);
+        lo = _mm256_fmadd_pd(keep, _mm256_loadu_pd(c), lo);
+        hi = _mm256_fmadd_pd(keep, _mm256_loadu_pd(c + 4), hi);
+    }
+    _mm256_storeu_pd(c, lo);
+    _mm256_storeu_pd(c + 4, hi);
+}
+
+__attribute__((target("avx2,fma"))) static void xGemm_microAVX2_f64(xSize kc, const double *a, const double *b, double *c,
+                                                                    xSize ldc, double alpha, double beta)
+{
+    __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+    __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+    __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+    __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+    __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+    __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+
+    for (xSize p = 0; p < kc; p++, a += 6, b += 8) {
+        __m256d b0 = _mm256_load_pd(b);
+        __m256d b1 = _mm256_load_pd(b + 4);
+        __m256d ai = _mm256_broadcast_sd(a);
+        c00 = _mm256_fmadd_pd(ai, b0, c00);
+        c01 = _mm256_fmadd_pd(ai, b1, c01);
+        ai = _mm256_broadcast_sd(a + 1);
+        c10 = _mm256_fmadd_pd(ai, b0, c10);
+        c11 = _mm256_fmadd_pd(ai, b1, c11);
+        ai = _mm256_broadcast_sd(a + 2);
+        c20 = _mm256_fmadd_pd(ai, b0, c20);
+        c21 = _mm256_fmadd_pd(ai, b1, c21);
+        ai = _mm256_broadcast_sd(a + 3);
+        c30 = _mm256_fmadd_pd(ai, b0, c30);
+        c31 = _mm256_fmadd_pd(ai, b1, c31);
+        ai = _mm256_broadcast_sd(a + 4);
+        c40 = _mm256_fmadd_pd(ai, b0, c40);
+        c41 = _mm256_fmadd_pd(ai, b1, c41);
+        ai = _mm256_broadcast_sd(a + 5);
+        c50 = _mm256_fmadd_pd(ai, b0, c50);
+        c51 = _mm256_fmadd_pd(ai, b1, c51);
+    }
+
+    xGemm_storeRowAVX2_f64(c, c00, c01, alpha, beta);
+    xGemm_storeRowAVX2_f64(c + ldc, c10, c11, alpha, beta);
+    xGemm_storeRowAVX2_f64(c + 2 * ldc, c20, c21, alpha, beta);
+    xGemm_storeRowAVX2_f64(c + 3 * ldc, c30, c31, alpha, beta);
+    xGemm_storeRowAVX2_f64(c + 4 * ldc, c40, c41, alpha, beta);
+    xGemm_storeRowAVX2_f64(c + 5 * ldc, c50, c51, alpha, beta);
+}
+
+static const xGemmKernel_f64 xGemm_kernelAVX2_f64 = {6, 8, xGemm_microAVX2_f64};
+
+__attribute__((target("avx2"))) static inline void xGemm_storeRowAVX2_i32(xInt32 *c, __m256i lo, __m256i hi, xInt32 alpha,
+                                                                          xInt32 beta)
+{
+    if (alpha != 1) {
+        __m256i scale = _mm256_set1_epi32(alpha);
+        lo = _mm256_mullo_epi32(lo, scale);
+        hi = _mm256_mullo_epi32(hi, scale);
+    }
+    if (beta != 0) {
+        __m256i keep = _mm256_set1_epi32(beta);
+        lo = _mm256_add_epi32(lo, _mm256_mullo_epi32(keep, _mm256_loadu_si256((const __m256i *)c)));
+        hi = _mm256_add_epi32(hi, _mm256_mullo_epi32(keep, _mm256_loadu_si256((const __m256i *)(c + 8))));
+    }
+    _mm256_storeu_si256((__m256i *)c, lo);
+    _mm256_storeu_si256((__m256i *)(c + 8), hi);
+}
+
+// multiply-add rows of B by broadcast element of A into accumulators of one row of C
+#define XGEMM_AVX2_ROW_I32(row)                                   \
+    ai = _mm256_set1_epi32(a[row]);                               \
+    c##row##0 = _mm256_add_epi32(c##row##0, _mm256_mullo_epi32(ai, b0)); \
+    c##row##1 = _mm256_add_epi32(c##row##1, _mm256_mullo_epi32(ai, b1))
+
+__attribute__((target("avx2"))) static void xGemm_microAVX2_i32(xSize kc, const xInt32 *a, const xInt32 *b, xInt32 *c,
+                                                                xSize ldc, xInt32 alpha, xInt32 beta)
+{
+    __m256i c00 = _mm256_setzero_si256(), c01 = _mm256_setzero_si256();
+    __m256i c10 = _mm256_setzero_si256(), c11 = _mm256_setzero_si256();
+    __m256i c20 = _mm256_setzero_si256(), c21 = _mm256_setzero_si256();
+    __m256i c30 = _mm256_setzero_si256(), c31 = _mm256_setzero_si256();
+    __m256i c40 = _mm256_setzero_si256(), c41 = _mm256_setzero_si256();
+    __m256i c50 = _mm256_setzero_si256(), c51 = _mm256_setzero_si256();
+
+    for (xSize p = 0; p < kc; p++, a += 6, b += 16) {
+        __m256i b0 = _mm256_load_si256((const __m256i *)b);
+        __m256i b1 = _mm256_load_si256((const __m256i *)(b + 8));
+        __m256i ai;
+        XGEMM_AVX2_ROW_I32(0);
+        XGEMM_AVX2_ROW_I32(1);
+        XGEMM_AVX2_ROW_I32(2);
+        XGEMM_AVX2_ROW_I32(3);
+        XGEMM_AVX2_ROW_I32(4);
+        XGEMM_AVX2_ROW_I32(5);
+    }
+
+    xGemm_storeRowAVX2_i32(c, c00, c01, alpha, beta);
+    xGemm_storeRowAVX2_i32(c + ldc, c10, c11, alpha, beta);
+    xGemm_storeRowAVX2_i32(c + 2 * ldc, c20, c21, alpha, beta);
+    xGemm_storeRowAVX2_i32(c + 3 * ldc, c30, c31, alpha, beta);
+    xGemm_storeRowAVX2_i32(c + 4 * ldc, c40, c41, alpha, beta);
+    xGemm_storeRowAVX2_i32(c + 5 * ldc, c50, c51, alpha, beta);
+}
+
+static const xGemmKernel_i32 xGemm_kernelAVX2_i32 = {6, 16, xGemm_microAVX2_i32};
+
+// multiply pair of k indices of B by broadcast pair of A and add both products into accumulators of one row of C
+#define XGEMM_AVX2_ROW_I8(row)                                                         \
+    ai = _mm256_set1_epi32(_mm_cvtsi128_si32(_mm_loadu_si32(a + 2 * (row))));           \
+    c##row##0 = _mm256_add_epi32(c##row##0, _mm256_madd_epi16(ai, b0));                \
+    c##row##1 = _mm256_add_epi32(c##row##1, _mm256_madd_epi16(ai, b1))
+
+__attribute__((target("avx2"))) static void xGemm_microAVX2_i8(xSize kc, const xInt16 *a, const xInt16 *b, xInt32 *c,
+                                                               xSize ldc, xInt32 alpha, xInt32 beta)
+{
+    __m256i c00 = _mm256_setzero_si256(), c01 = _mm256_setzero_si256();
+    __m256i c10 = _mm256_setzero_si256(), c11 = _mm256_setzero_si256();
+    __m256i c20 = _mm256_setzero_si256(), c21 = _mm256_setzero_si256();
+    __m256i c30 = _mm256_setzero_si256(), c31 = _mm256_setzero_si256();
+    __m256i c40 = _mm256_setzero_si256(), c41 = _mm256_setzero_si256();
+    __m256i c50 = _mm256_setzero_si256(), c51 = _mm256_setzero_si256();
+
+    // widened int8 products never saturate pairwise sums of 16-bit multiply-add
+    for (xSize p = 0; p < kc; p += 2, a += 12, b += 32) {
+        __m256i b0 = _mm256_load_si256((const __m256i *)b);
+        __m256i b1 = _mm256_load_si256((const __m256i *)(b + 16));
+        __m256i ai;
+        XGEMM_AVX2_ROW_I8(0);
+        XGEMM_AVX2_ROW_I8(1);
+        XGEMM_AVX2_ROW_I8(2);
+        XGEMM_AVX2_ROW_I8(3);
+        XGEMM_AVX2_ROW_I8(4);
+        XGEMM_AVX2_ROW_I8(5);
+    }
+
+    xGemm_storeRowAVX2_i32(c, c00, c01, alpha, beta);
+    xGemm_storeRowAVX2_i32(c + ldc, c10, c11, alpha, beta);
+    xGemm_storeRowAVX2_i32(c + 2 * ldc, c20, c21, alpha, beta);
+    xGemm_storeRowAVX2_i32(c + 3 * ldc, c30, c31, alpha, beta);
+    xGemm_storeRowAVX2_i32(c + 4 * ldc, c40, c41, alpha, beta);
+    xGemm_storeRowAVX2_i32(c + 5 * ldc, c50, c51, alpha, beta);
+}
+
+static const xGemmKernel_i8 xGemm_kernelAVX2_i8 = {6, 16, xGemm_microAVX2_i8};
+
+#endif  // XGEMM_SIMD_X86
+
+#ifdef XGEMM_SIMD_NEON
+
+/*
+ * ARM NEON micro-kernel (8 x 8 tile in 16 accumulator registers)
+ */
+
+static inline void xGemm_storeRowNEON_f32(float *c, float32x4_t lo, float32x4_t hi, float alpha, float beta)
+{
+    lo = vmulq_n_f32(lo, alpha);
+    hi = vmulq_n_f32(hi, alpha);
+    if (beta != 0.0f) {
+        lo = vfmaq_n_f32(lo, vld1q_f32(c), beta);
+        hi = vfmaq_n_f32(hi, vld1q_f32(c + 4), beta);
+    }
+    vst1q_f32(c, lo);
+    vst1q_f32(c + 4, hi);
+}
+
+// multiply-add row of B by lane of column of A into accumulators of one row of C
+#define XGEMM_NEON_ROW(row, column, lane)                    \
+    c##row##0 = vfmaq_laneq_f32(c##row##0, b0, column, lane); \
+    c##row##1 = vfmaq_laneq_f32(c##row##1, b1, column, lane)
+
+static void xGemm_microNEON_f32(xSize kc, const float *a, const float *b, float *c, xSize ldc, float alpha, float beta)
+{
+    float32x4_t c00 = vdupq_n_f32(0.0f), c01 = vdupq_n_f32(0.0f);
+    float32x4_t c10 = vdupq_n_f32(0.0f), c11 = vdupq_n_f32(0.0f);
+    float32x4_t c20 = vdupq_n_f32(0.0f), c21 = vdupq_n_f32(0.0f);
+    float32x4_t c30 = vdupq_n_f32(0.0f), c31 = vdupq_n_f32(0.0f);
+    float32x4_t c40 = vdupq_n_f32(0.0f), c41 = vdupq_n_f32(0.0f);
+    float32x4_t c50 = vdupq_n_f32(0.0f), c51 = vdupq_n_f32(0.0f);
+    float32x4_t c60 = vdupq_n_f32(0.0f), c61 = vdupq_n_f32(0.0f);
+    float32x4_t c70 = vdupq_n_f32(0.0f), c71 = vdupq_n_f32(0.0f);
+
+    for (xSize p = 0; p < kc; p++, a += 8, b += 8) {
+        float32x4_t b0 = vld1q_f32(b);
+        float32x4_t b1 = vld1q_f32(b + 4);
+        float32x4_t a0 = vld1q_f32(a);
+        float32x4_t a1 = vld1q_f32(a + 4);
+        XGEMM_NEON_ROW(0, a0, 0);
+        XGEMM_NEON_ROW(1, a0, 1);
+        XGEMM_NEON_ROW(2, a0, 2);
+        XGEMM_NEON_ROW(3, a0, 3);
+        XGEMM_NEON_ROW(4, a1, 0);
+        XGEMM_NEON_ROW(5, a1, 1);
+        XGEMM_NEON_ROW(6, a1, 2);
+        XGEMM_NEON_ROW(7, a1, 3);
+    }
+
+    xGemm_storeRowNEON_f32(c, c00, c01, alpha, beta);
+    xGemm_storeRowNEON_f32(c + ldc, c10, c11, alpha, beta);
+    xGemm_storeRowNEON_f32(c + 2 * ldc, c20, c21, alpha, beta);
+    xGemm_storeRowNEON_f32(c + 3 * ldc, c30, c31, alpha, beta);
+    xGemm_storeRowNEON_f32(c + 4 * ldc, c40, c41, alpha, beta);
+    xGemm_storeRowNEON_f32(c + 5 * ldc, c50, c51, alpha, beta);
+    xGemm_storeRowNEON_f32(c + 6 * ldc, c60, c61, alpha, beta);
+    xGemm_storeRowNEON_f32(c + 7 * ldc, c70, c71, alpha, beta);
+}
+
+static const xGemmKernel_f32 xGemm_kernelNEON_f32 = {8, 8, xGemm_microNEON_f32};
+
+#endif  // XGEMM_SIMD_NEON
+
+
+/**
+ * @brief
+ * Define packing routines, blocked driver and public GEMM function `xGemm_##name` of element type T.
+ *
+ * @note
+ * Driver packs MC x KC blocks of A and KC x NC panels of B (padding slivers with zeros up to MR rows, NR columns and multiple
+ * of ks in k) and multiplies them with micro-kernel selected for the running processor. Row blocks of large products are
+ * split into one contiguous part per thread of shared pool, and every part packs its blocks of A into its own MC x KC panel,
+ * so packing space stays bounded by thread count. Every block is computed the same way on any thread.
+ */
+#define XGEMM_DEFINE_DRIVER(T, name, elem, packed, acc, calc, ks, x86Kernel, x86Features, neonKernel)                      \
+    static const xGemmKernel_##T *xGemm_getKernel_##T(void)                                                               \
+    {                                                                                                                      \
+        /* selection is idempotent, so concurrent first calls at worst select twice */                                    \
+        static const xGemmKernel_##T *volatile selected = NULL;                                                           \
+                                                                                                                           \
+        const xGemmKernel_##T *kernel = selected;                                                                          \
+        if (kernel) {                                                                                                      \
+            return kernel;                                                                                                 \
+        }                                                                                                                  \
+                                                                                                                           \
+        const xGemmKernel_##T *simd = XGEMM_SIMD_KERNEL(x86Kernel, neonKernel);                                            \
+        xUInt32 features = (xUInt32)XGEMM_SIMD_FEATURES(x86Features, XCPU_FEATURE_NEON);                                   \
+        kernel = (simd && (xCpu_getFeatures() & features) == features) ? simd : &xGemm_kernelPortable_##T;                 \
+        selected = kernel;                                                                                                 \
+        return kernel;                                                                                                     \
+    }                                                                                                                      \
+                                                                                                                           \
+    static void xGemm_packA_##T(xSize mc, xSize kc, const elem *a, xSize lda, xSize mr, packed *dest)                      \
+    {                                                                                                                      \
+        for (xSize i = 0; i < mc; i += mr) {                                                                               \
+            xSize rows = (mc - i < mr) ? mc - i : mr;                                                                      \
+            const elem *sliver = a + i * lda;                                                                              \
+            for (xSize p = 0; p < kc; p += (ks), dest += mr * (ks)) {                                                      \
+                xSize r = 0;                                                                                               \
+                for (; r < rows; r++) {                                                                                    \
+                    for (xSize s = 0; s < (ks); s++) {                                                                     \
+                        dest[r * (ks) + s] = (p + s < kc) ? (packed)sliver[r * lda + p + s] : (packed)0;                   \
+                    }                                                                                                      \
+                }                                                                                                          \
+                for (; r < mr; r++) {                                                                                      \
+                    for (xSize s = 0; s < (ks); s++) {                                                                     \
+                        dest[r * (ks) + s] = (packed)0;                                                                    \
+                    }                                                                                                      \
+                }                                                                                                          \
+            }                                                                                                              \
+        }                                                                                                                  \
+    }                                                                                                                      \
+                                                                                                                           \
+    static void xGemm_packB_##T(xSize kc, xSize nc, const elem *b, xSize ldb, xSize nr, packed *dest)                      \
+    {                                                                                                                      \
+        for (xSize j = 0; j < nc; j += nr) {                                                                               \
+            xSize cols = (nc - j < nr) ? nc - j : nr;                                                                      \
+            for (xSize p = 0; p < kc; p += (ks), dest += nr * (ks)) {                                                      \
+                for (xSize s = 0; s < (ks); s++) {                                                                         \
+                    const elem *row = b + (p + s) * ldb + j;                                                               \
+                    xSize q = 0;                                                                                           \
+                    for (; q < cols && p + s < kc; q++) {                                                                  \
+                        dest[q * (ks) + s] = (packed)row[q];                                                               \
+                    }                                                                                                      \
+                    for (; q < nr; q++) {                                                                                  \
+                        dest[q * (ks) + s] = (packed)0;                                                                    \
+                    }                                                                                                      \
+                }                                                                                                          \
+            }                                                                                                              \
+        }                                                                                                                  \
+    }                                                                                                                      \
+                                                                                                                           \
+    /* compute C = beta * C (C is overwritten with zeros if beta is zero) */                                               \
+    static void xGemm_scale_##T(xSize m, xSize n, acc beta, acc *c, xSize ldc)                                             \
+    {                                                                                                                      \
+        for (xSize i = 0; i < m; i++, c += ldc) {                                                                          \
+            for (xSize j = 0; j < n; j++) {                                                                                \
+                c[j] = (beta != 0) ? (acc)((calc)beta * (calc)c[j]) : (acc)0;                                              \
+            }                                                                                                              \
+        }                                                                                                                  \
+    }                                                                                                                      \
+                                                                                                                           \
+    /* multiply small matrices directly, streaming rows of B into rows of C */                                             \
+    static void xGemm_small_##T(xSize m, xSize n, xSize k, acc alpha, const elem *a, xSize lda, const elem *b, xSize ldb, \
+                                acc beta, acc *c, xSize ldc)                                                               \
+    {                                                                                                                      \
+        xGemm_scale_##T(m, n, beta, c, ldc);                                                                               \
+        for (xSize i = 0; i < m; i++, a += lda, c += ldc) {                                                                \
+            for (xSize p = 0; p < k; p++) {                                                                                \
+                calc scale = (calc)alpha * (calc)a[p];                                                                     \
+                const elem *row = b + p * ldb;                                                                             \
+                for (xSize j = 0; j < n; j++) {                                                                            \
+                    c[j] = (acc)((calc)c[j] + scale * (calc)row[j]);                                                       \
+                }                                                                                                          \
+            }                                                                                                              \
+        }                                                                                                                  \
+    }                                                                                                                      \
+                                                                                                                           \
+    typedef struct xGemmBlockTask_##T##_s {                                                                                \
+        const xGemmKernel_##T *kernel; /* selected micro-kernel */                                                         \
+        const elem *a;                 /* first column of current k block of A */                                          \
+        xSize lda;                     /* distance between rows of A */                                                    \
+        acc *c;                        /* first column of current n block of C */                                          \
+        xSize ldc;                     /* distance between rows of C */                                                    \
+        const packed *packedB;         /* packed current block of B */                                                     \
+        packed *packedA;               /* packing space with own XGEMM_MC x kpMax panel for every part */                  \
+        xSize m;                       /* number of rows of A and C */                                                     \
+        xSize blockCount;              /* number of row blocks of A and C */                                               \
+        xSize parts;                   /* number of parts row blocks are split into */                                     \
+        xSize panelSize;               /* number of elements of packing space of one part */                               \
+        xSize nc;                      /* number of columns of current n block */                                          \
+        xSize kc;                      /* depth of current k block */                                                      \
+        xSize kp;                      /* depth of current k block in packed panels (kc rounded up to multiple of ks) */   \
+        acc alpha;                     /* scale of product */                                                              \
+        acc beta;                      /* scale of C for current k block */                                                \
+    } xGemmBlockTask_##T;                                                                                                  \
+                                                                                                                           \
+    /* pack row block of A into panel and multiply it by packed block of B */                                              \
+    static void xGemm_rowBlock_##T(const xGemmBlockTask_##T *task, xSize block, packed *packedA)                           \
+    {                                                                                                                      \
+        xSize mr = task->kernel->mr;                                                                                       \
+        xSize nr = task->kernel->nr;                                                                                       \
+        xSize kp = task->kp;                                                                                               \
+        acc edge[XGEMM_MAX_MR * XGEMM_MAX_NR];                                                                             \
+                                                                                                                           \
+        xSize ic = block * XGEMM_MC;                                                                                       \
+        xSize mc = (task->m - ic < XGEMM_MC) ? task->m - ic : XGEMM_MC;                                                    \
+        xGemm_packA_##T(mc, task->kc, task->a + ic * task->lda, task->lda, mr, packedA);                                   \
+                                                                                                                           \
+        /* sliver of B stays in L1 while it is multiplied by all slivers of A */                                           \
+        for (xSize jr = 0; jr < task->nc; jr += nr) {                                                                      \
+            xSize cols = (task->nc - jr < nr) ? task->nc - jr : nr;                                                        \
+            for (xSize ir = 0; ir < mc; ir += mr) {                                                                        \
+                xSize rows = (mc - ir < mr) ? mc - ir : mr;                                                                \
+                acc *tile = task->c + (ic + ir) * task->ldc + jr;                                                          \
+                if (rows == mr && cols == nr) {                                                                            \
+                    task->kernel->micro(kp, packedA + ir * kp, task->packedB + jr * kp, tile, task->ldc, task->alpha,      \
+                                        task->beta);                                                                       \
+                    continue;                                                                                              \
+                }                                                                                                          \
+                                                                                                                           \
+                /* partial tile is computed in scratch tile and merged into C */                                           \
+                task->kernel->micro(kp, packedA + ir * kp, task->packedB + jr * kp, edge, nr, task->alpha, (acc)0);        \
+                for (xSize i = 0; i < rows; i++) {                                                                         \
+                    for (xSize j = 0; j < cols; j++) {                                                                     \
+                        acc value = edge[i * nr + j];                                                                      \
+                        acc *dest = tile + i * task->ldc + j;                                                              \
+                        *dest = (task->beta != 0) ? (acc)((calc)value + (calc)task->beta * (calc)*dest) : value;           \
+                    }                                                                                                      \
+                }                                                                                                          \
+            }                                                                                                              \
+        }                                                                                                                  \
+    }                                                                                                                      \
+                                                                                                                           \
+    /* multiply row blocks of parts [begin, end), every part reusing its own panel of A (range function for xThreadPool) */\
+    static void xGemm_rowBlocks_##T(void *context, xSize begin, xSize end)                                                 \
+    {                                                                                                                      \
+        const xGemmBlockTask_##T *task = (const xGemmBlockTask_##T *)context;                                              \
+        for (xSize part = begin; part < end; part++) {                                                                     \
+            packed *packedA = task->packedA + part * task->panelSize;                                                      \
+            xSize last = (part + 1) * task->blockCount / task->parts;                                                      \
+            for (xSize block = part * task->blockCount / task->parts; block < last; block++) {                             \
+                xGemm_rowBlock_##T(task, block, packedA);                                                                  \
+            }                                                                                                              \
+        }                                                                                                                  \
+    }                                                                                                                      \
+                                                                                                                           \
+    xBool xGemm_##name(xSize m, xSize n, xSize k, acc alpha, const elem *a, xSize lda, const elem *b, xSize ldb, acc beta,  \
+                       acc *c, xSize ldc)                                                                                  \
+    {                                                                                                                      \
+        /* validate arguments */                                                                                           \
+        if (!m || !n) {                                                                                                    \
+            return true;                                                                                                   \
+        }                                                                                                                  \
+        if (!c || ldc < n || (k && (!a || !b || lda < k || ldb < n))) {                                                    \
+            return false;                                                                                                  \
+        }                                                                                                                  \
+                                                                                                                           \
+        /* product vanishes, only scale C */                                                                               \
+        if (!k || alpha == 0) {                                                                                            \
+            xGemm_scale_##T(m, n, beta, c, ldc);                                                                           \
+            return true;                                                                                                   \
+        }                                                                                                                  \
+                                                                                                                           \
+        if (m * n * k <= XGEMM_SMALL_WORK) {                                                                               \
+            xGemm_small_##T(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);                                                 \
+            return true;                                                                                                   \
+        }                                                                                                                  \
+                                                                                                                           \
+        /* allocate packing buffers for largest blocks actually needed (one panel of A per part of row blocks) */          \
+        const xGemmKernel_##T *kernel = xGemm_getKernel_##T();                                                             \
+        xSize nr = kernel->nr;                                                                                             \
+        xSize blockCount = (m + XGEMM_MC - 1) / XGEMM_MC;                                                                  \
+        xThreadPool *pool = (blockCount > 1 && m * n * k >= XGEMM_PARALLEL_WORK) ? xThreadPool_getShared() : NULL;         \
+        xSize parts = xThreadPool_getThreadCount(pool);                                                                    \
+        parts = (parts < blockCount) ? parts : blockCount;                                                                 \
+        xSize kpMax = ((((k < XGEMM_KC) ? k : XGEMM_KC) + (ks) - 1) / (ks)) * (ks);                                        \
+        xSize ncMax = ((((n < XGEMM_NC) ? n : XGEMM_NC) + nr - 1) / nr) * nr;                                              \
+        xSize bufferSize = (parts * XGEMM_MC + ncMax) * kpMax * sizeof(packed) + 2 * XGEMM_PANEL_ALIGNMENT;                \
+        xUInt8 *buffer = (xUInt8 *)xAllocator_alloc(NULL, bufferSize);                                                     \
+        if (!buffer) {                                                                                                     \
+            return false;                                                                                                  \
+        }                                                                                                                  \
+        uintptr_t address = ((uintptr_t)buffer + XGEMM_PANEL_ALIGNMENT - 1) & ~(uintptr_t)(XGEMM_PANEL_ALIGNMENT - 1);     \
+        packed *packedB = (packed *)address;                                                                               \
+        address = ((uintptr_t)(packedB + ncMax * kpMax) + XGEMM_PANEL_ALIGNMENT - 1) &                                     \
+                  ~(uintptr_t)(XGEMM_PANEL_ALIGNMENT - 1);                                                                 \
+                                                                                                                           \
+        xGemmBlockTask_##T task = {kernel, NULL, lda, NULL, ldc, packedB, (packed *)address, m, blockCount, parts,         \
+                                   XGEMM_MC * kpMax, 0, 0, 0, alpha, (acc)0};                                              \
+                                                                                                                           \
+        for (xSize jc = 0; jc < n; jc += XGEMM_NC) {                                                                       \
+            task.nc = (n - jc < XGEMM_NC) ? n - jc : XGEMM_NC;                                                             \
+            for (xSize pc = 0; pc < k; pc += XGEMM_KC) {                                                                   \
+                task.kc = (k - pc < XGEMM_KC) ? k - pc : XGEMM_KC;                                                         \
+                task.kp = ((task.kc + (ks) - 1) / (ks)) * (ks);                                                            \
+                task.beta = (pc == 0) ? beta : (acc)1; /* following blocks of k accumulate into C */                       \
+                task.a = a + pc;                                                                                           \
+                task.c = c + jc;                                                                                           \
+                xGemm_packB_##T(task.kc, task.nc, b + pc * ldb + jc, ldb, nr, packedB);                                    \
+                xThreadPool_parallelFor(pool, parts, 1, xGemm_rowBlocks_##T, &task);                                       \
+            }                                                                                                              \
+        }                                                                                                                  \
+                                                                                                                           \
+        xAllocator_free(NULL, buffer, bufferSize);                                                                         \
+        return true;                                                                                                       \
+    }
+
+XGEMM_DEFINE_DRIVER(f32, sgemm, float, float, float, float, 1, &xGemm_kernelAVX2_f32, XCPU_FEATURE_AVX2 | XCPU_FEATURE_FMA,
+                    &xGemm_kernelNEON_f32)
+XGEMM_DEFINE_DRIVER(f64, dgemm, double, double, double, double, 1, &xGemm_kernelAVX2_f64,
+                    XCPU_FEATURE_AVX2 | XCPU_FEATURE_FMA, NULL)
+XGEMM_DEFINE_DRIVER(i32, i32gemm, xInt32, xInt32, xInt32, xUInt32, 1, &xGemm_kernelAVX2_i32, XCPU_FEATURE_AVX2, NULL)
+XGEMM_DEFINE_DRIVER(i8, i8gemm, xInt8, xInt16, xInt32, xUInt32, 2, &xGemm_kernelAVX2_i8, XCPU_FEATURE_AVX2, NULL)
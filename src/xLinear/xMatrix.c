@@ -1,36 +1,354 @@
 #include "xLinear/xMatrix.h"
-#include <stdlib.h>  // standard library (for malloc, calloc, free)
+#include <fcntl.h>     // open (mapped matrix files)
+#include <stdint.h>    // uintptr_t
+#include <stdio.h>     // fopen, fread, fwrite (matrix files)
+#include <stdlib.h>    // malloc (for flattened arrays returned to caller), strtoull
+#include <string.h>    // strstr, strncmp (.npy header parsing)
+#include <sys/mman.h>  // mmap, munmap
+#include <sys/stat.h>  // fstat
+#include <unistd.h>    // close
+#include "xBase/xMemtools.h"
 #include "xBase/xTypes.h"
-
-// TODO: remove dependency on stdlib.h (custom memory allocation functions)
+#include "xLinear/xGemm.h"
+#include "xMemory/xAllocator.h"
+#include "xThread/xThreadPool.h"
+#include "xMatrixLayout.h"
 
 struct xMatrix_s {
-    float *data;  // contiguous array of all matrix elements
-    xSize rows;   // number of rows
-    xSize cols;   // number of columns
+    float *data;                  // first element of first row (aligned to XMATRIX_ALIGNMENT)
+    xSize rows;                   // number of rows
+    xSize cols;                   // number of columns
+    xSize stride;                 // distance between rows in elements (leading dimension)
+    xSize capacity;               // number of elements allocated for data
+    const xAllocator *allocator;  // allocator owning matrix memory
+    void *mapping;                // memory-mapped file holding data (NULL if data follows structure)
+    xSize mappingSize;            // length of mapping in bytes
 };
 
-xMatrix *xMatrix_new(xSize rows, xSize cols)
+// matrices with at least this many elements are processed in row blocks by shared thread pool
+#define XMATRIX_PARALLEL_THRESHOLD (1 << 16)
+
+// approximate number of elements in single row block
+#define XMATRIX_PARALLEL_GRAIN (1 << 14)
+
+// largest number of columns moved at once by column passes of in-place transpose of non-square matrices (visiting every
+// row once per 256 bytes keeps page walks rare)
+#define XMATRIX_TRANSPOSE_COLUMNS 64
+
+typedef enum {
+    XMATRIX_OP_COPY = 0,   /**< res = lhs */
+    XMATRIX_OP_ADD,        /**< res = lhs + rhs */
+    XMATRIX_OP_SUB,        /**< res = lhs - rhs */
+    XMATRIX_OP_DOTMUL,     /**< res = lhs * rhs */
+    XMATRIX_OP_SCALARADD,  /**< res = lhs + scalar */
+    XMATRIX_OP_SCALARSUB,  /**< res = lhs - scalar */
+    XMATRIX_OP_SCALARMUL,  /**< res = lhs * scalar */
+    XMATRIX_OP_SCALARDIV,  /**< res = lhs / scalar */
+    XMATRIX_OP_MAP,        /**< res = unary(lhs) */
+    XMATRIX_OP_MAP2,       /**< res = binary(lhs, rhs) */
+    XMATRIX_OP_MAPSCALAR   /**< res = binary(lhs, scalar) */
+} xMatrixOp;
+
+typedef struct xMatrixTask_s {
+    xMatrixOp op;                   // operation to perform
+    xMatrixView res;                // result
+    xMatrixView lhs;                // first operand
+    xMatrixView rhs;                // second operand (same as first operand for unary operations)
+    float scalar;                   // scalar operand
+    float (*unary)(float);          // user function of XMATRIX_OP_MAP
+    float (*binary)(float, float);  // user function of XMATRIX_OP_MAP2 and XMATRIX_OP_MAPSCALAR
+} xMatrixTask;
+
+// evaluate `expression` of lhs element `x` and rhs element `y` for all elements of rows [begin, end) of task
+#define XMATRIX_ELEMENTWISE(expression)                                                               \
+    for (xSize i = begin; i < end; i++) {                                                             \
+        float *r = task->res.data + i * task->res.rowStride;                                          \
+        const float *a = task->lhs.data + i * task->lhs.rowStride;                                    \
+        const float *b = task->rhs.data + i * task->rhs.rowStride;                                    \
+        if (dense) {                                                                                  \
+            for (xSize j = 0; j < cols; j++) {                                                        \
+                float x = a[j], y = b[j];                                                             \
+                (void)y;                                                                              \
+                r[j] = (expression);                                                                  \
+            }                                                                                         \
+        } else {                                                                                      \
+            for (xSize j = 0; j < cols; j++) {                                                        \
+                float x = a[j * task->lhs.colStride], y = b[j * task->rhs.colStride];                 \
+                (void)y;                                                                              \
+                r[j * task->res.colStride] = (expression);                                            \
+            }                                                                                         \
+        }                                                                                             \
+    }
+
+/**
+ * @brief
+ * Compute rows [begin, end) of operation result (range function for xThreadPool).
+ */
+static void xMatrix_taskRows(void *context, xSize begin, xSize end)
+{
+    const xMatrixTask *task = (const xMatrixTask *)context;
+    float scalar = task->scalar;
+    xSize cols = task->res.cols;
+    xBool dense = task->res.colStride == 1 && task->lhs.colStride == 1 && task->rhs.colStride == 1;
+
+    switch (task->op) {
+        case XMATRIX_OP_COPY:
+            if (task->lhs.colStride == 1) {
+                XMATRIX_ELEMENTWISE(x);
+                break;
+            }
+            // strided source (e.g. transposed view) is copied tile by tile, so both source and result stay in cache
+            for (xSize i0 = begin; i0 < end; i0 += XMATRIX_TRANSPOSE_TILE) {
+                xSize i1 = (end - i0 < XMATRIX_TRANSPOSE_TILE) ? end : i0 + XMATRIX_TRANSPOSE_TILE;
+                for (xSize j0 = 0; j0 < cols; j0 += XMATRIX_TRANSPOSE_TILE) {
+                    xSize j1 = (cols - j0 < XMATRIX_TRANSPOSE_TILE) ? cols : j0 + XMATRIX_TRANSPOSE_TILE;
+                    for (xSize i = i0; i < i1; i++) {
+                        float *r = task->res.data + i * task->res.rowStride;
+                        const float *a = task->lhs.data + i * task->lhs.rowStride;
+                        for (xSize j = j0; j < j1; j++) {
+                            r[j * task->res.colStride] = a[j * task->lhs.colStride];
+                        }
+                    }
+                }
+            }
+            break;
+        case XMATRIX_OP_ADD:
+            XMATRIX_ELEMENTWISE(x + y);
+            break;
+        case XMATRIX_OP_SUB:
+            XMATRIX_ELEMENTWISE(x - y);
+            break;
+        case XMATRIX_OP_DOTMUL:
+            XMATRIX_ELEMENTWISE(x * y);
+            break;
+        case XMATRIX_OP_SCALARADD:
+            XMATRIX_ELEMENTWISE(x + scalar);
+            break;
+        case XMATRIX_OP_SCALARSUB:
+            XMATRIX_ELEMENTWISE(x - scalar);
+            break;
+        case XMATRIX_OP_SCALARMUL:
+            XMATRIX_ELEMENTWISE(x * scalar);
+            break;
+        case XMATRIX_OP_SCALARDIV:
+            XMATRIX_ELEMENTWISE(x / scalar);
+            break;
+        case XMATRIX_OP_MAP:
+            XMATRIX_ELEMENTWISE(task->unary(x));
+            break;
+        case XMATRIX_OP_MAP2:
+            XMATRIX_ELEMENTWISE(task->binary(x, y));
+            break;
+        case XMATRIX_OP_MAPSCALAR:
+            XMATRIX_ELEMENTWISE(task->binary(x, scalar));
+            break;
+    }
+}
+
+/**
+ * @brief
+ * Validate views of operation and run it over all rows of result, splitting large results into row blocks processed by
+ * shared thread pool.
+ *
+ * @return xBool true if operation was run, false if views are invalid or have different dimensions.
+ *
+ * @note
+ * Every element is computed by same expression on any thread, so result does not depend on number of threads.
+ */
+static xBool xMatrix_runTask(const xMatrixTask *task)
+{
+    const xMatrixView *res = &task->res;
+    if (!xMatrixView_isValid(*res) || !xMatrixView_isValid(task->lhs) || !xMatrixView_isValid(task->rhs) ||
+        res->rows != task->lhs.rows || res->cols != task->lhs.cols || res->rows != task->rhs.rows ||
+        res->cols != task->rhs.cols) {
+        return false;
+    }
+
+    if (res->rows * res->cols < XMATRIX_PARALLEL_THRESHOLD) {
+        xMatrix_taskRows((void *)task, 0, res->rows);
+        return true;
+    }
+
+    xSize grain = (XMATRIX_PARALLEL_GRAIN + res->cols - 1) / res->cols;
+    if (task->op == XMATRIX_OP_COPY && task->lhs.colStride != 1) {
+        grain = (grain + XMATRIX_TRANSPOSE_TILE - 1) / XMATRIX_TRANSPOSE_TILE * XMATRIX_TRANSPOSE_TILE;
+    }
+    return xThreadPool_parallelFor(xThreadPool_getShared(), res->rows, grain, xMatrix_taskRows, (void *)task);
+}
+
+/**
+ * @brief
+ * Move rows of matrix data from one leading dimension to another in place.
+ */
+static void xMatrix_restride(float *data, xSize rows, xSize cols, xSize from, xSize to)
+{
+    if (to < from) {
+        // rows move towards start of data, so they are moved first to last
+        for (xSize i = 1; i < rows; i++) {
+            xMemMove(data + i * to, data + i * from, cols * sizeof(float));
+        }
+    } else if (to > from) {
+        for (xSize i = rows; i-- > 1;) {
+            xMemMove(data + i * to, data + i * from, cols * sizeof(float));
+        }
+    }
+}
+
+/**
+ * @brief
+ * Transpose rows of tiles [begin, end) of square matrix in place (range function for xThreadPool).
+ *
+ * @note
+ * Row of tiles swaps its tiles right of diagonal with matching tiles below diagonal, so different rows of tiles never touch
+ * same elements.
+ */
+static void xMatrix_swapTileRows(void *context, xSize begin, xSize end)
+{
+    xMatrix *matrix = (xMatrix *)context;
+    float *data = matrix->data;
+    xSize n = matrix->rows;
+    xSize stride = matrix->stride;
+
+    for (xSize tile = begin; tile < end; tile++) {
+        xSize i0 = tile * XMATRIX_TRANSPOSE_TILE;
+        xSize i1 = (n - i0 < XMATRIX_TRANSPOSE_TILE) ? n : i0 + XMATRIX_TRANSPOSE_TILE;
+        for (xSize j0 = i0; j0 < n; j0 += XMATRIX_TRANSPOSE_TILE) {
+            xSize j1 = (n - j0 < XMATRIX_TRANSPOSE_TILE) ? n : j0 + XMATRIX_TRANSPOSE_TILE;
+            for (xSize i = i0; i < i1; i++) {
+                for (xSize j = (j0 == i0) ? i + 1 : j0; j < j1; j++) {
+                    float value = data[i * stride + j];
+                    data[i * stride + j] = data[j * stride + i];
+                    data[j * stride + i] = value;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief
+ * Get number of columns moved at once by column passes of in-place transpose of packed matrix with n columns.
+ *
+ * @note
+ * Width is limited to eighth of row, so scratch block of m rows never exceeds eighth of matrix.
+ */
+static inline xSize xMatrix_transposeWidth(xSize n)
+{
+    xSize width = n / 8;
+    return (width < 1) ? 1 : (width > XMATRIX_TRANSPOSE_COLUMNS) ? XMATRIX_TRANSPOSE_COLUMNS : width;
+}
+
+/**
+ * @brief
+ * Transpose packed m x n matrix in place into packed n x m matrix.
+ *
+ * @param scratch Space for max(n, m * xMatrix_transposeWidth(n)) elements.
+ *
+ * @note
+ * Element (i, j) moves to position j * m + i. With c = gcd(m, n) and b = n / c, rotating every column j down by j / b rows
+ * makes targets of elements in every row distinct columns, after which targets of elements in every column are distinct
+ * rows (decomposition of Catanzaro, Keller and Garland). Rows are permuted through scratch row and columns in groups through
+ * scratch block, so memory is accessed in contiguous runs instead of following permutation cycles element by element.
+ */
+static void xMatrix_transposePacked(float *data, xSize m, xSize n, float *scratch)
+{
+    xSize c = m, b = n;
+    while (b) {
+        xSize rem = c % b;
+        c = b;
+        b = rem;
+    }
+    b = n / c;
+    xSize width = xMatrix_transposeWidth(n);
+
+    // rotate column j down by j / b rows (dimensions which are not coprime only)
+    for (xSize s0 = 0; c > 1 && s0 < n; s0 += width) {
+        xSize w = (n - s0 < width) ? n - s0 : width;
+        xSize shift[XMATRIX_TRANSPOSE_COLUMNS];
+        for (xSize t = 0; t < w; t++) {
+            shift[t] = (s0 + t) / b;
+        }
+        for (xSize r = 0; r < m; r++) {
+            xMemCopy(scratch + r * w, data + r * n + s0, w * sizeof(float));
+        }
+        for (xSize r = 0; r < m; r++) {
+            for (xSize t = 0; t < w; t++) {
+                xSize src = (r >= shift[t]) ? r - shift[t] : r + m - shift[t];
+                data[r * n + s0 + t] = scratch[src * w + t];
+            }
+        }
+    }
+
+    // element of row r in column j (coming from row i = r - j / b) moves to column (j * m + i) mod n
+    xSize step = m % n;
+    for (xSize r = 0; r < m; r++) {
+        float *row = data + r * n;
+        xSize target = 0;  // j * m mod n
+        for (xSize j = 0, k = 0; k < c; k++) {
+            xSize i = ((r >= k) ? r - k : r + m - k) % n;
+            for (xSize end = j + b; j < end; j++) {
+                scratch[(target + i >= n) ? target + i - n : target + i] = row[j];
+                target = (target + step >= n) ? target + step - n : target + step;
+            }
+        }
+        xMemCopy(row, scratch, n * sizeof(float));
+    }
+
+    // element ending in row r of column s is original (i, j) with j * m + i = r * n + s, now in row (i + j / b) mod m
+    for (xSize s0 = 0; s0 < n; s0 += width) {
+        xSize w = (n - s0 < width) ? n - s0 : width;
+        for (xSize r = 0; r < m; r++) {
+            xMemCopy(scratch + r * w, data + r * n + s0, w * sizeof(float));
+        }
+        for (xSize r = 0; r < m; r++) {
+            xSize q = r * n + s0;
+            xSize i = q % m, j = q / m;
+            xSize block = j / b, offset = j % b;
+            for (xSize t = 0; t < w; t++) {
+                xSize src = i + block;
+                data[r * n + s0 + t] = scratch[((src >= m) ? src - m : src) * w + t];
+                if (++i == m) {
+                    i = 0;
+                    if (++offset == b) {
+                        offset = 0;
+                        block++;
+                    }
+                }
+            }
+        }
+    }
+}
+
+xMatrix *xMatrix_new(xSize rows, xSize cols) { return xMatrix_newWithAllocator(rows, cols, NULL); }
+
+xMatrix *xMatrix_newWithAllocator(xSize rows, xSize cols, const xAllocator *allocator)
 {
     // validate arguments
     if (!rows || !cols) {
         return NULL;
     }
 
-    // create matrix object and allocate memory for data
-    xMatrix *mat = (xMatrix *)malloc(sizeof(xMatrix) + rows * cols * sizeof(float));
+    // create matrix object and allocate memory for aligned data following it
+    allocator = allocator ? allocator : xAllocator_getDefault();
+    xSize stride = xMatrix_strideFor(cols, sizeof(float));
+    xSize capacity = rows * stride;
+    xMatrix *mat = (xMatrix *)xAllocator_alloc(allocator, sizeof(xMatrix) + XMATRIX_ALIGNMENT - 1 + capacity * sizeof(float));
     if (!mat) {
         return NULL;
     }
 
-    mat->data = (float *)(mat + 1);
+    uintptr_t address = ((uintptr_t)(mat + 1) + XMATRIX_ALIGNMENT - 1) & ~(uintptr_t)(XMATRIX_ALIGNMENT - 1);
+    mat->data = (float *)address;
     mat->rows = rows;
     mat->cols = cols;
+    mat->stride = stride;
+    mat->capacity = capacity;
+    mat->allocator = allocator;
+    mat->mapping = NULL;
+    mat->mappingSize = 0;
 
-    // zero-initialize matrix data
-    for (xSize i = 0; i < rows * cols; i++) {
-        mat->data[i] = 0.0f;
-    }
+    // zero-initialize matrix data (including padding)
+    xMemSet(mat->data, 0, capacity * sizeof(float));
 
     return mat;
 }
@@ -42,18 +360,27 @@ void xMatrix_free(xMatrix *matrix)
         return;
     }
 
+    // unmap data of matrix loaded from file (only structure itself is allocated then)
+    xSize size = sizeof(xMatrix) + XMATRIX_ALIGNMENT - 1 + matrix->capacity * sizeof(float);
+    if (matrix->mapping) {
+        munmap(matrix->mapping, matrix->mappingSize);
+        size = sizeof(xMatrix);
+    }
+
     // set matrix attributes to zero (invalidate matrix)
     matrix->data = NULL;
     matrix->rows = 0;
     matrix->cols = 0;
 
-    free(matrix);
+    xAllocator_free(matrix->allocator, matrix, size);
 }
 
 inline xSize xMatrix_getRows(const xMatrix *matrix) { return (matrix) ? matrix->rows : 0; }
 
 inline xSize xMatrix_getCols(const xMatrix *matrix) { return (matrix) ? matrix->cols : 0; }
 
+inline xSize xMatrix_getStride(const xMatrix *matrix) { return (matrix) ? matrix->stride : 0; }
+
 inline xBool xMatrix_isValid(const xMatrix *matrix) { return (matrix) ? matrix->data && matrix->rows && matrix->cols : 0; }
 
 inline void xMatrix_set(xMatrix *matrix, xSize row, xSize col, float value)
@@ -64,7 +391,7 @@ inline void xMatrix_set(xMatrix *matrix, xSize row, xSize col, float value)
     }
 
     // set matrix element
-    matrix->data[row * matrix->cols + col] = value;
+    matrix->data[row * matrix->stride + col] = value;
 }
 
 inline float xMatrix_get(const xMatrix *matrix, xSize row, xSize col)
@@ -75,7 +402,7 @@ inline float xMatrix_get(const xMatrix *matrix, xSize row, xSize col)
     }
 
     // get matrix element
-    return matrix->data[row * matrix->cols + col];
+    return matrix->data[row * matrix->stride + col];
 }
 
 xMatrix *xMatrix_duplicate(const xMatrix *matrix)
@@ -86,16 +413,14 @@ xMatrix *xMatrix_duplicate(const xMatrix *matrix)
     }
 
     // create matrix object
-    xMatrix *mat = xMatrix_new(matrix->rows, matrix->cols);
+    xMatrix *mat = xMatrix_newWithAllocator(matrix->rows, matrix->cols, matrix->allocator);
     if (!xMatrix_isValid(mat)) {
         return NULL;
     }
 
-    // copy matrix data
+    // copy matrix data row by row (leading dimensions of matrices may differ)
     for (xSize i = 0; i < matrix->rows; i++) {
-        for (xSize j = 0; j < matrix->cols; j++) {
-            xMatrix_set(mat, i, j, xMatrix_get(matrix, i, j));
-        }
+        xMemCopy(mat->data + i * mat->stride, matrix->data + i * matrix->stride, matrix->cols * sizeof(float));
     }
 
     return mat;
@@ -145,17 +470,13 @@ xMatrix *xMatrix_transpose(const xMatrix *matrix)
     }
 
     // create transposed matrix
-    xMatrix *mat = xMatrix_new(matrix->cols, matrix->rows);
+    xMatrix *mat = xMatrix_newWithAllocator(matrix->cols, matrix->rows, matrix->allocator);
     if (!xMatrix_isValid(mat)) {
         return NULL;
     }
 
-    // transpose matrix
-    for (xSize i = 0; i < matrix->rows; i++) {
-        for (xSize j = 0; j < matrix->cols; j++) {
-            xMatrix_set(mat, j, i, xMatrix_get(matrix, i, j));
-        }
-    }
+    // copy transposed view of matrix
+    xMatrixView_copy(xMatrix_view(mat), xMatrixView_transpose(xMatrix_view(matrix)));
 
     return mat;
 }
@@ -170,28 +491,39 @@ xMatrix *xMatrix_transpose_inplace(xMatrix *matrix)
     // transpose matrix in-place
     xSize rows = matrix->rows;
     xSize cols = matrix->cols;
+    xSize count = rows * cols;
+
+    if (rows == cols) {
+        // square matrix swaps tiles across diagonal
+        xSize tiles = (rows + XMATRIX_TRANSPOSE_TILE - 1) / XMATRIX_TRANSPOSE_TILE;
+        xThreadPool *pool = (count >= XMATRIX_PARALLEL_THRESHOLD) ? xThreadPool_getShared() : NULL;
+        xThreadPool_parallelFor(pool, tiles, 1, xMatrix_swapTileRows, matrix);
+    } else {
+        // packed rows are permuted by row and column passes through scratch of O(max(rows, cols)) elements (vectors need
+        // no permutation); scratch is allocated before rows are packed, so failure leaves matrix untouched
+        xSize scratchSize = 0;
+        float *scratch = NULL;
+        if (rows > 1 && cols > 1) {
+            scratchSize = rows * xMatrix_transposeWidth(cols);
+            scratchSize = (scratchSize > cols) ? scratchSize : cols;
+            if (!(scratch = (float *)xAllocator_alloc(matrix->allocator, scratchSize * sizeof(float)))) {
+                return NULL;
+            }
+        }
+        xMatrix_restride(matrix->data, rows, cols, matrix->stride, cols);
 
-    // allocate a temporary array to store the transposed data
-    float *temp = (float *)malloc(rows * cols * sizeof(float));
-    if (!temp) {
-        return NULL;
-    }
-
-    // transpose the matrix into the temporary array
-    for (xSize i = 0; i < rows; i++) {
-        for (xSize j = 0; j < cols; j++) {
-            temp[j * rows + i] = matrix->data[i * cols + j];
+        if (scratch) {
+            xMatrix_transposePacked(matrix->data, rows, cols, scratch);
+            xAllocator_free(matrix->allocator, scratch, scratchSize * sizeof(float));
         }
-    }
 
-    // copy the transposed data back to the original matrix
-    for (xSize i = 0; i < rows * cols; i++) {
-        matrix->data[i] = temp[i];
+        // transposed rows are padded again if padded layout fits into allocated memory
+        xSize stride = xMatrix_strideFor(rows, sizeof(float));
+        stride = (cols * stride <= matrix->capacity) ? stride : rows;
+        xMatrix_restride(matrix->data, cols, rows, rows, stride);
+        matrix->stride = stride;
     }
 
-    // free the temporary array
-    free(temp);
-
     // swap the rows and columns
     matrix->rows = cols;
     matrix->cols = rows;
@@ -207,7 +539,7 @@ xMatrix *xMatrix_add(const xMatrix *lhs, const xMatrix *rhs)
     }
 
     // create matrix to store result and perform in-place operation
-    xMatrix *mat = xMatrix_new(lhs->rows, lhs->cols);
+    xMatrix *mat = xMatrix_newWithAllocator(lhs->rows, lhs->cols, lhs->allocator);
     if (!xMatrix_add_inplace(mat, lhs, rhs)) {
         // operation failed, free memory and return
         xMatrix_free(mat);
@@ -227,11 +559,7 @@ xMatrix *xMatrix_add_inplace(xMatrix *res, const xMatrix *lhs, const xMatrix *rh
     }
 
     // add matrices
-    for (xSize i = 0; i < lhs->rows; i++) {
-        for (xSize j = 0; j < lhs->cols; j++) {
-            xMatrix_set(res, i, j, xMatrix_get(lhs, i, j) + xMatrix_get(rhs, i, j));
-        }
-    }
+    xMatrixView_add(xMatrix_view(res), xMatrix_view(lhs), xMatrix_view(rhs));
 
     return res;
 }
@@ -244,7 +572,7 @@ xMatrix *xMatrix_sub(const xMatrix *lhs, const xMatrix *rhs)
     }
 
     // create matrix to store result and perform in-place operation
-    xMatrix *mat = xMatrix_new(lhs->rows, lhs->cols);
+    xMatrix *mat = xMatrix_newWithAllocator(lhs->rows, lhs->cols, lhs->allocator);
     if (!xMatrix_sub_inplace(mat, lhs, rhs)) {
         // operation failed, free memory and return
         xMatrix_free(mat);
@@ -264,11 +592,7 @@ xMatrix *xMatrix_sub_inplace(xMatrix *res, const xMatrix *lhs, const xMatrix *rh
     }
 
     // subtract matrices
-    for (xSize i = 0; i < lhs->rows; i++) {
-        for (xSize j = 0; j < lhs->cols; j++) {
-            xMatrix_set(res, i, j, xMatrix_get(lhs, i, j) - xMatrix_get(rhs, i, j));
-        }
-    }
+    xMatrixView_sub(xMatrix_view(res), xMatrix_view(lhs), xMatrix_view(rhs));
 
     return res;
 }
@@ -281,7 +605,7 @@ xMatrix *xMatrix_mul(const xMatrix *lhs, const xMatrix *rhs)
     }
 
     // create matrix to store result and perform in-place operation
-    xMatrix *mat = xMatrix_new(lhs->rows, rhs->cols);
+    xMatrix *mat = xMatrix_newWithAllocator(lhs->rows, rhs->cols, lhs->allocator);
     if (!xMatrix_mul_inplace(mat, lhs, rhs)) {
         // opeation failed, free memory and return
         xMatrix_free(mat);
@@ -299,18 +623,8 @@ xMatrix *xMatrix_mul_inplace(xMatrix *res, const xMatrix *lhs, const xMatrix *rh
         return NULL;
     }
 
-    // multiply matrices
-    for (xSize i = 0; i < lhs->rows; i++) {
-        for (xSize j = 0; j < rhs->cols; j++) {
-            float sum = 0.0f;
-            for (xSize k = 0; k < lhs->cols; k++) {
-                sum += xMatrix_get(lhs, i, k) * xMatrix_get(rhs, k, j);
-            }
-            xMatrix_set(res, i, j, sum);
-        }
-    }
-
-    return res;
+    // multiply matrices using cache-blocked kernel (result aliasing operand is handled by view multiplication)
+    return xMatrixView_mul(xMatrix_view(res), xMatrix_view(lhs), xMatrix_view(rhs)) ? res : NULL;
 }
 
 xMatrix *xMatrix_dotmul(const xMatrix *lhs, const xMatrix *rhs)
@@ -321,7 +635,7 @@ xMatrix *xMatrix_dotmul(const xMatrix *lhs, const xMatrix *rhs)
     }
 
     // create matrix to store result and perform in-place operation
-    xMatrix *mat = xMatrix_new(lhs->rows, lhs->cols);
+    xMatrix *mat = xMatrix_newWithAllocator(lhs->rows, lhs->cols, lhs->allocator);
     if (!xMatrix_dotmul_inplace(mat, lhs, rhs)) {
         // operation failed, free memory and return
         xMatrix_free(mat);
@@ -340,11 +654,7 @@ xMatrix *xMatrix_dotmul_inplace(xMatrix *res, const xMatrix *lhs, const xMatrix
     }
 
     // element-wise multiplication
-    for (xSize i = 0; i < lhs->rows; i++) {
-        for (xSize j = 0; j < lhs->cols; j++) {
-            xMatrix_set(res, i, j, xMatrix_get(lhs, i, j) * xMatrix_get(rhs, i, j));
-        }
-    }
+    xMatrixView_dotmul(xMatrix_view(res), xMatrix_view(lhs), xMatrix_view(rhs));
 
     return res;
 }
@@ -357,7 +667,7 @@ xMatrix *xMatrix_scalarAdd(const xMatrix *matrix, float scalar)
     }
 
     // create matrix to store result and perform in-place operation
-    xMatrix *mat = xMatrix_new(matrix->rows, matrix->cols);
+    xMatrix *mat = xMatrix_newWithAllocator(matrix->rows, matrix->cols, matrix->allocator);
     if (!xMatrix_scalarAdd_inplace(mat, matrix, scalar)) {
         // operation failed, free memory and return
         xMatrix_free(mat);
@@ -375,11 +685,7 @@ xMatrix *xMatrix_scalarAdd_inplace(xMatrix *res, const xMatrix *matrix, float sc
     }
 
     // add scalar to all matrix elements
-    for (xSize i = 0; i < matrix->rows; i++) {
-        for (xSize j = 0; j < matrix->cols; j++) {
-            xMatrix_set(res, i, j, xMatrix_get(matrix, i, j) + scalar);
-        }
-    }
+    xMatrixView_scalarAdd(xMatrix_view(res), xMatrix_view(matrix), scalar);
 
     return res;
 }
@@ -392,7 +698,7 @@ xMatrix *xMatrix_scalarSub(const xMatrix *matrix, float scalar)
     }
 
     // create matrix to store result and perform in-place operation on it
-    xMatrix *mat = xMatrix_new(matrix->rows, matrix->cols);
+    xMatrix *mat = xMatrix_newWithAllocator(matrix->rows, matrix->cols, matrix->allocator);
     if (!xMatrix_scalarSub_inplace(mat, matrix, scalar)) {
         // operation failed, free memory and return
         xMatrix_free(mat);
@@ -410,11 +716,7 @@ xMatrix *xMatrix_scalarSub_inplace(xMatrix *res, const xMatrix *matrix, float sc
     }
 
     // subtract scalar from all matrix elements
-    for (xSize i = 0; i < matrix->rows; i++) {
-        for (xSize j = 0; j < matrix->cols; j++) {
-            xMatrix_set(res, i, j, xMatrix_get(matrix, i, j) - scalar);
-        }
-    }
+    xMatrixView_scalarSub(xMatrix_view(res), xMatrix_view(matrix), scalar);
 
     return res;
 }
@@ -427,7 +729,7 @@ xMatrix *xMatrix_scalarMul(const xMatrix *matrix, float scalar)
     }
 
     // create matrix to store result and perform in-place operation on it
-    xMatrix *mat = xMatrix_new(matrix->rows, matrix->cols);
+    xMatrix *mat = xMatrix_newWithAllocator(matrix->rows, matrix->cols, matrix->allocator);
     if (!xMatrix_scalarMul_inplace(mat, matrix, scalar)) {
         // operation failed, free memory and return
         xMatrix_free(mat);
@@ -445,11 +747,7 @@ xMatrix *xMatrix_scalarMul_inplace(xMatrix *res, const xMatrix *matrix, float sc
     }
 
     // multiply matrix by scalar
-    for (xSize i = 0; i < matrix->rows; i++) {
-        for (xSize j = 0; j < matrix->cols; j++) {
-            xMatrix_set(res, i, j, xMatrix_get(matrix, i, j) * scalar);
-        }
-    }
+    xMatrixView_scalarMul(xMatrix_view(res), xMatrix_view(matrix), scalar);
 
     return res;
 }
@@ -462,7 +760,7 @@ xMatrix *xMatrix_scalarDiv(const xMatrix *matrix, float scalar)
     }
 
     // create matrix to store result and perform in-place operation on it
-    xMatrix *mat = xMatrix_new(matrix->rows, matrix->cols);
+    xMatrix *mat = xMatrix_newWithAllocator(matrix->rows, matrix->cols, matrix->allocator);
     if (!xMatrix_scalarDiv_inplace(mat, matrix, scalar)) {
         // operation failed, free memory and return
         xMatrix_free(mat);
@@ -480,11 +778,7 @@ xMatrix *xMatrix_scalarDiv_inplace(xMatrix *res, const xMatrix *matrix, float sc
     }
 
     // divide matrix by scalar
-    for (xSize i = 0; i < matrix->rows; i++) {
-        for (xSize j = 0; j < matrix->cols; j++) {
-            xMatrix_set(res, i, j, xMatrix_get(matrix, i, j) / scalar);
-        }
-    }
+    xMatrixView_scalarDiv(xMatrix_view(res), xMatrix_view(matrix), scalar);
 
     return res;
 }
@@ -497,17 +791,13 @@ xMatrix *xMatrix_submatrix(const xMatrix *matrix, xSize row1, xSize col1, xSize
     }
 
     // create matrix to store result
-    xMatrix *mat = xMatrix_new(row2 - row1, col2 - col1);
+    xMatrix *mat = xMatrix_newWithAllocator(row2 - row1, col2 - col1, matrix->allocator);
     if (!xMatrix_isValid(mat)) {
         return NULL;
     }
 
-    // copy values from original matrix
-    for (xSize i = row1; i < row2; i++) {
-        for (xSize j = col1; j < col2; j++) {
-            xMatrix_set(mat, i - row1, j - col1, xMatrix_get(matrix, i, j));
-        }
-    }
+    // copy values from view of original matrix
+    xMatrixView_copy(xMatrix_view(mat), xMatrix_viewBlock(matrix, row1, col1, row2 - row1, col2 - col1));
 
     return mat;
 }
@@ -520,25 +810,20 @@ xMatrix *xMatrix_minor(const xMatrix *matrix, xSize row, xSize col)
     }
 
     // create matrix to store result
-    xMatrix *mat = xMatrix_new(matrix->rows - 1, matrix->cols - 1);
+    xMatrix *mat = xMatrix_newWithAllocator(matrix->rows - 1, matrix->cols - 1, matrix->allocator);
     if (!xMatrix_isValid(mat)) {
         return NULL;
     }
 
-    // create minor matrix
-    for (xSize i = 0, k = 0; i < matrix->rows; i++) {
-        if (i == row) {
-            continue;
-        }
-        for (xSize j = 0, l = 0; j < matrix->cols; j++) {
-            if (j == col) {
-                continue;
-            }
-            xMatrix_set(mat, k, l, xMatrix_get(matrix, i, j));
-            l++;
-        }
-        k++;
-    }
+    // copy four blocks of original matrix around removed row and column (empty blocks are invalid views and skipped)
+    xMatrixView dest = xMatrix_view(mat);
+    xMatrixView src = xMatrix_view(matrix);
+    xSize below = matrix->rows - row - 1;
+    xSize right = matrix->cols - col - 1;
+    xMatrixView_copy(xMatrixView_block(dest, 0, 0, row, col), xMatrixView_block(src, 0, 0, row, col));
+    xMatrixView_copy(xMatrixView_block(dest, 0, col, row, right), xMatrixView_block(src, 0, col + 1, row, right));
+    xMatrixView_copy(xMatrixView_block(dest, row, 0, below, col), xMatrixView_block(src, row + 1, 0, below, col));
+    xMatrixView_copy(xMatrixView_block(dest, row, col, below, right), xMatrixView_block(src, row + 1, col + 1, below, right));
 
     return mat;
 }
@@ -551,17 +836,13 @@ xMatrix *xMatrix_map(const xMatrix *matrix, float (*func)(float))
     }
 
     // create matrix to store result
-    xMatrix *mat = xMatrix_new(matrix->rows, matrix->cols);
+    xMatrix *mat = xMatrix_newWithAllocator(matrix->rows, matrix->cols, matrix->allocator);
     if (!xMatrix_isValid(mat)) {
         return NULL;
     }
 
     // apply function to all matrix elements
-    for (xSize i = 0; i < matrix->rows; i++) {
-        for (xSize j = 0; j < matrix->cols; j++) {
-            xMatrix_set(mat, i, j, func(xMatrix_get(matrix, i, j)));
-        }
-    }
+    xMatrixView_map(xMatrix_view(mat), xMatrix_view(matrix), func);
 
     return mat;
 }
@@ -574,17 +855,13 @@ xMatrix *xMatrix_map2(const xMatrix *lhs, const xMatrix *rhs, float (*func)(floa
     }
 
     // create matrix to store result
-    xMatrix *mat = xMatrix_new(lhs->rows, lhs->cols);
+    xMatrix *mat = xMatrix_newWithAllocator(lhs->rows, lhs->cols, lhs->allocator);
     if (!xMatrix_isValid(mat)) {
         return NULL;
     }
 
     // apply function to all matrix elements
-    for (xSize i = 0; i < lhs->rows; i++) {
-        for (xSize j = 0; j < lhs->cols; j++) {
-            xMatrix_set(mat, i, j, func(xMatrix_get(lhs, i, j), xMatrix_get(rhs, i, j)));
-        }
-    }
+    xMatrixView_map2(xMatrix_view(mat), xMatrix_view(lhs), xMatrix_view(rhs), func);
 
     return mat;
 }
@@ -597,17 +874,13 @@ xMatrix *xMatrix_mapScalar(const xMatrix *matrix, float scalar, float (*func)(fl
     }
 
     // create matrix to store result
-    xMatrix *mat = xMatrix_new(matrix->rows, matrix->cols);
+    xMatrix *mat = xMatrix_newWithAllocator(matrix->rows, matrix->cols, matrix->allocator);
     if (!xMatrix_isValid(mat)) {
         return NULL;
     }
 
     // apply function to all matrix elements
-    for (xSize i = 0; i < matrix->rows; i++) {
-        for (xSize j = 0; j < matrix->cols; j++) {
-            xMatrix_set(mat, i, j, func(xMatrix_get(matrix, i, j), scalar));
-        }
-    }
+    xMatrixView_mapScalar(xMatrix_view(mat), xMatrix_view(matrix), scalar, func);
 
     return mat;
 }
@@ -625,11 +898,9 @@ float *xMatrix_flatten(const xMatrix *matrix)
         return NULL;
     }
 
-    // copy data
+    // copy data row by row (skipping padding)
     for (xSize i = 0; i < matrix->rows; i++) {
-        for (xSize j = 0; j < matrix->cols; j++) {
-            arr[i * matrix->cols + j] = xMatrix_get(matrix, i, j);
-        }
+        xMemCopy(arr + i * matrix->cols, matrix->data + i * matrix->stride, matrix->cols * sizeof(float));
     }
 
     return arr;
@@ -648,12 +919,447 @@ xMatrix *xMatrix_unflatten(const float *arr, xSize rows, xSize cols)
         return NULL;
     }
 
-    // copy data
+    // copy data row by row
     for (xSize i = 0; i < rows; i++) {
-        for (xSize j = 0; j < cols; j++) {
-            xMatrix_set(mat, i, j, arr[i * cols + j]);
+        xMemCopy(mat->data + i * mat->stride, arr + i * cols, cols * sizeof(float));
+    }
+
+    return mat;
+}
+
+// .npy file starts with magic string, two version bytes and little-endian header length (2 bytes in version 1.0, 4 bytes in
+// versions 2.0 and 3.0), followed by header dictionary and raw data
+#define XMATRIX_NPY_MAGIC "\x93NUMPY"
+#define XMATRIX_NPY_MAGIC_LENGTH 6
+
+// longest header dictionary accepted when loading
+#define XMATRIX_NPY_MAX_HEADER 4096
+
+// element type of native byte order float32 in header dictionary
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define XMATRIX_NPY_DESCR "'>f4'"
+#else
+#define XMATRIX_NPY_DESCR "'<f4'"
+#endif
+
+// skip spaces and given separator following key of header dictionary
+static const char *xMatrix_npyValue(const char *dict, const char *key)
+{
+    const char *p = strstr(dict, key);
+    if (!p) {
+        return NULL;
+    }
+    for (p += strlen(key); *p == ' ' || *p == ':'; p++) {
+    }
+    return p;
+}
+
+// parse beginning of .npy file, accepting C-ordered 1-D and 2-D arrays of native float32 elements
+static xBool xMatrix_parseNpy(const unsigned char *buffer, xSize length, xSize *rows, xSize *cols, xSize *offset)
+{
+    // read magic string, version and header length
+    if (length < 10 || strncmp((const char *)buffer, XMATRIX_NPY_MAGIC, XMATRIX_NPY_MAGIC_LENGTH) != 0) {
+        return false;
+    }
+    xSize start = (buffer[6] == 1) ? 10 : 12;
+    if (buffer[6] < 1 || buffer[6] > 3 || length < start) {
+        return false;
+    }
+    xSize headerLength = (xSize)buffer[8] | (xSize)buffer[9] << 8;
+    if (start == 12) {
+        headerLength |= (xSize)buffer[10] << 16 | (xSize)buffer[11] << 24;
+    }
+    if (headerLength > XMATRIX_NPY_MAX_HEADER || start + headerLength > length) {
+        return false;
+    }
+
+    // copy header dictionary into terminated string and check element type and order
+    char dict[XMATRIX_NPY_MAX_HEADER + 1];
+    xMemCopy(dict, buffer + start, headerLength);
+    dict[headerLength] = '\0';
+    const char *descr = xMatrix_npyValue(dict, "'descr'");
+    const char *order = xMatrix_npyValue(dict, "'fortran_order'");
+    const char *shape = xMatrix_npyValue(dict, "'shape'");
+    if (!descr || strncmp(descr, XMATRIX_NPY_DESCR, 5) != 0 || !order || strncmp(order, "False", 5) != 0 || !shape ||
+        *shape != '(') {
+        return false;
+    }
+
+    // parse shape tuple with one or two dimensions
+    xSize dims[2];
+    xSize count = 0;
+    for (const char *p = shape + 1; *p != ')'; p++) {
+        if (*p >= '0' && *p <= '9') {
+            if (count == 2) {
+                return false;
+            }
+            char *end;
+            dims[count++] = (xSize)strtoull(p, &end, 10);
+            p = end - 1;
+        } else if (*p != ' ' && *p != ',') {
+            return false;
         }
     }
+    if (count == 0) {
+        return false;
+    }
+    *rows = (count == 2) ? dims[0] : 1;
+    *cols = dims[count - 1];
+    *offset = start + headerLength;
+
+    // reject empty arrays and sizes overflowing address space
+    return *rows && *cols && *cols <= (xSize)-1 / sizeof(float) / *rows;
+}
+
+xBool xMatrix_save(const xMatrix *matrix, const char *path)
+{
+    // validate arguments
+    if (!xMatrix_isValid(matrix) || !path) {
+        return false;
+    }
+
+    // header dictionary is padded with spaces and terminated by newline so data starts at aligned offset
+    char header[4 * XMATRIX_ALIGNMENT];
+    int length = snprintf(header + 10, sizeof(header) - 10, "{'descr': %s, 'fortran_order': False, 'shape': (%llu, %llu), }",
+                          XMATRIX_NPY_DESCR, (unsigned long long)matrix->rows, (unsigned long long)matrix->cols);
+    xSize total = (10 + (xSize)length + 1 + XMATRIX_ALIGNMENT - 1) / XMATRIX_ALIGNMENT * XMATRIX_ALIGNMENT;
+    xMemCopy(header, XMATRIX_NPY_MAGIC "\x01\x00", XMATRIX_NPY_MAGIC_LENGTH + 2);
+    header[8] = (char)((total - 10) & 0xFF);
+    header[9] = (char)((total - 10) >> 8);
+    xMemSet(header + 10 + length, ' ', total - 11 - (xSize)length);
+    header[total - 1] = '\n';
+
+    // write header and rows without padding
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        return false;
+    }
+    xBool success = (fwrite(header, 1, total, file) == total);
+    for (xSize i = 0; success && i < matrix->rows; i++) {
+        success = (fwrite(matrix->data + i * matrix->stride, sizeof(float), matrix->cols, file) == matrix->cols);
+    }
+
+    return (fclose(file) == 0) && success;
+}
+
+xMatrix *xMatrix_load(const char *path)
+{
+    // validate arguments
+    if (!path) {
+        return NULL;
+    }
+
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        return NULL;
+    }
+
+    // parse header and read rows directly into padded matrix
+    unsigned char buffer[12 + XMATRIX_NPY_MAX_HEADER];
+    xSize length = fread(buffer, 1, sizeof(buffer), file);
+    xSize rows, cols, offset;
+    xMatrix *mat = NULL;
+    if (xMatrix_parseNpy(buffer, length, &rows, &cols, &offset) && fseek(file, (long)offset, SEEK_SET) == 0 &&
+        (mat = xMatrix_new(rows, cols))) {
+        for (xSize i = 0; i < rows; i++) {
+            if (fread(mat->data + i * mat->stride, sizeof(float), cols, file) != cols) {
+                // file is shorter than its header claims
+                xMatrix_free(mat);
+                mat = NULL;
+                break;
+            }
+        }
+    }
+
+    fclose(file);
+    return mat;
+}
+
+xMatrix *xMatrix_loadMapped(const char *path)
+{
+    // validate arguments
+    if (!path) {
+        return NULL;
+    }
+
+    // map whole file privately (mapping stays valid after descriptor is closed)
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    struct stat info;
+    void *mapping = MAP_FAILED;
+    xSize size = 0;
+    if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        size = (xSize)info.st_size;
+        mapping = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return NULL;
+    }
+
+    // check header and that file holds all elements
+    xSize rows, cols, offset;
+    if (!xMatrix_parseNpy((const unsigned char *)mapping, size, &rows, &cols, &offset) ||
+        (size - offset) / sizeof(float) / cols < rows) {
+        munmap(mapping, size);
+        return NULL;
+    }
+    if (offset % XMATRIX_ALIGNMENT) {
+        // data in file is not aligned, so it can not be used in place
+        munmap(mapping, size);
+        return xMatrix_load(path);
+    }
+
+    // create matrix structure referring to mapped data
+    const xAllocator *allocator = xAllocator_getDefault();
+    xMatrix *mat = (xMatrix *)xAllocator_alloc(allocator, sizeof(xMatrix));
+    if (!mat) {
+        munmap(mapping, size);
+        return NULL;
+    }
+    mat->data = (float *)((char *)mapping + offset);
+    mat->rows = rows;
+    mat->cols = cols;
+    mat->stride = cols;
+    mat->capacity = rows * cols;
+    mat->allocator = allocator;
+    mat->mapping = mapping;
+    mat->mappingSize = size;
 
     return mat;
 }
+
+// view referring to no elements
+static const xMatrixView xMatrix_invalidView = {NULL, 0, 0, 0, 0};
+
+xMatrixView xMatrix_view(const xMatrix *matrix)
+{
+    // validate arguments
+    if (!xMatrix_isValid(matrix)) {
+        return xMatrix_invalidView;
+    }
+
+    xMatrixView view = {matrix->data, matrix->rows, matrix->cols, matrix->stride, 1};
+    return view;
+}
+
+xMatrixView xMatrix_viewBlock(const xMatrix *matrix, xSize row, xSize col, xSize rows, xSize cols)
+{
+    return xMatrixView_block(xMatrix_view(matrix), row, col, rows, cols);
+}
+
+xMatrixView xMatrix_viewRow(const xMatrix *matrix, xSize row)
+{
+    return xMatrixView_block(xMatrix_view(matrix), row, 0, 1, xMatrix_getCols(matrix));
+}
+
+xMatrixView xMatrix_viewCol(const xMatrix *matrix, xSize col)
+{
+    return xMatrixView_block(xMatrix_view(matrix), 0, col, xMatrix_getRows(matrix), 1);
+}
+
+xMatrix *xMatrix_newFromView(xMatrixView view)
+{
+    // validate arguments
+    if (!xMatrixView_isValid(view)) {
+        return NULL;
+    }
+
+    // create matrix and copy viewed elements into it
+    xMatrix *mat = xMatrix_new(view.rows, view.cols);
+    if (!xMatrix_isValid(mat)) {
+        return NULL;
+    }
+    xMatrixView_copy(xMatrix_view(mat), view);
+
+    return mat;
+}
+
+inline xBool xMatrixView_isValid(xMatrixView view) { return view.data && view.rows && view.cols; }
+
+inline float xMatrixView_get(xMatrixView view, xSize row, xSize col)
+{
+    // validate arguments
+    if (!xMatrixView_isValid(view) || row >= view.rows || col >= view.cols) {
+        return 0.0f / 0.0f;  // NaN
+    }
+
+    return view.data[row * view.rowStride + col * view.colStride];
+}
+
+inline void xMatrixView_set(xMatrixView view, xSize row, xSize col, float value)
+{
+    // validate arguments
+    if (!xMatrixView_isValid(view) || row >= view.rows || col >= view.cols) {
+        return;
+    }
+
+    view.data[row * view.rowStride + col * view.colStride] = value;
+}
+
+xMatrixView xMatrixView_block(xMatrixView view, xSize row, xSize col, xSize rows, xSize cols)
+{
+    // validate arguments
+    if (!xMatrixView_isValid(view) || !rows || !cols || row >= view.rows || col >= view.cols || rows > view.rows - row ||
+        cols > view.cols - col) {
+        return xMatrix_invalidView;
+    }
+
+    xMatrixView block = {view.data + row * view.rowStride + col * view.colStride, rows, cols, view.rowStride, view.colStride};
+    return block;
+}
+
+xMatrixView xMatrixView_transpose(xMatrixView view)
+{
+    xMatrixView transposed = {view.data, view.cols, view.rows, view.colStride, view.rowStride};
+    return transposed;
+}
+
+xBool xMatrixView_copy(xMatrixView dest, xMatrixView src)
+{
+    xMatrixTask task = {XMATRIX_OP_COPY, dest, src, src, 0.0f, NULL, NULL};
+    return xMatrix_runTask(&task);
+}
+
+xBool xMatrixView_add(xMatrixView res, xMatrixView lhs, xMatrixView rhs)
+{
+    xMatrixTask task = {XMATRIX_OP_ADD, res, lhs, rhs, 0.0f, NULL, NULL};
+    return xMatrix_runTask(&task);
+}
+
+xBool xMatrixView_sub(xMatrixView res, xMatrixView lhs, xMatrixView rhs)
+{
+    xMatrixTask task = {XMATRIX_OP_SUB, res, lhs, rhs, 0.0f, NULL, NULL};
+    return xMatrix_runTask(&task);
+}
+
+xBool xMatrixView_dotmul(xMatrixView res, xMatrixView lhs, xMatrixView rhs)
+{
+    xMatrixTask task = {XMATRIX_OP_DOTMUL, res, lhs, rhs, 0.0f, NULL, NULL};
+    return xMatrix_runTask(&task);
+}
+
+xBool xMatrixView_scalarAdd(xMatrixView res, xMatrixView src, float scalar)
+{
+    xMatrixTask task = {XMATRIX_OP_SCALARADD, res, src, src, scalar, NULL, NULL};
+    return xMatrix_runTask(&task);
+}
+
+xBool xMatrixView_scalarSub(xMatrixView res, xMatrixView src, float scalar)
+{
+    xMatrixTask task = {XMATRIX_OP_SCALARSUB, res, src, src, scalar, NULL, NULL};
+    return xMatrix_runTask(&task);
+}
+
+xBool xMatrixView_scalarMul(xMatrixView res, xMatrixView src, float scalar)
+{
+    xMatrixTask task = {XMATRIX_OP_SCALARMUL, res, src, src, scalar, NULL, NULL};
+    return xMatrix_runTask(&task);
+}
+
+xBool xMatrixView_scalarDiv(xMatrixView res, xMatrixView src, float scalar)
+{
+    xMatrixTask task = {XMATRIX_OP_SCALARDIV, res, src, src, scalar, NULL, NULL};
+    return xMatrix_runTask(&task);
+}
+
+xBool xMatrixView_map(xMatrixView res, xMatrixView src, float (*func)(float))
+{
+    xMatrixTask task = {XMATRIX_OP_MAP, res, src, src, 0.0f, func, NULL};
+    return func ? xMatrix_runTask(&task) : false;
+}
+
+xBool xMatrixView_map2(xMatrixView res, xMatrixView lhs, xMatrixView rhs, float (*func)(float, float))
+{
+    xMatrixTask task = {XMATRIX_OP_MAP2, res, lhs, rhs, 0.0f, NULL, func};
+    return func ? xMatrix_runTask(&task) : false;
+}
+
+xBool xMatrixView_mapScalar(xMatrixView res, xMatrixView src, float scalar, float (*func)(float, float))
+{
+    xMatrixTask task = {XMATRIX_OP_MAPSCALAR, res, src, src, scalar, NULL, func};
+    return func ? xMatrix_runTask(&task) : false;
+}
+
+/**
+ * @brief
+ * Check if view can be passed to xGemm directly (unit column stride and row stride covering row).
+ */
+static inline xBool xMatrixView_isDense(xMatrixView view)
+{
+    return (view.colStride == 1 || view.cols == 1) && (view.rowStride >= view.cols || view.rows == 1);
+}
+
+/**
+ * @brief
+ * Check if memory spanned by two views overlaps.
+ */
+static xBool xMatrixView_overlaps(xMatrixView first, xMatrixView second)
+{
+    uintptr_t firstBegin = (uintptr_t)first.data;
+    uintptr_t secondBegin = (uintptr_t)second.data;
+    uintptr_t firstEnd = (uintptr_t)(first.data + (first.rows - 1) * first.rowStride + (first.cols - 1) * first.colStride + 1);
+    uintptr_t secondEnd =
+        (uintptr_t)(second.data + (second.rows - 1) * second.rowStride + (second.cols - 1) * second.colStride + 1);
+    return firstBegin < secondEnd && secondBegin < firstEnd;
+}
+
+/**
+ * @brief
+ * Get dense version of view for xGemm, copying it into newly allocated buffer if needed.
+ *
+ * @param view View to make dense.
+ * @param copy Whether view has to be copied even if it is dense.
+ * @param buffer Receives allocated buffer (NULL if view was used directly).
+ * @return xMatrixView Dense view (invalid view if allocation failed).
+ */
+static xMatrixView xMatrixView_dense(xMatrixView view, xBool copy, float **buffer)
+{
+    *buffer = NULL;
+    if (!copy && xMatrixView_isDense(view)) {
+        view.rowStride = (view.rowStride >= view.cols) ? view.rowStride : view.cols;
+        return view;
+    }
+
+    if (!(*buffer = (float *)xAllocator_alloc(NULL, view.rows * view.cols * sizeof(float)))) {
+        return xMatrix_invalidView;
+    }
+    xMatrixView dense = {*buffer, view.rows, view.cols, view.cols, 1};
+    return dense;
+}
+
+xBool xMatrixView_mul(xMatrixView res, xMatrixView lhs, xMatrixView rhs)
+{
+    // validate arguments
+    if (!xMatrixView_isValid(res) || !xMatrixView_isValid(lhs) || !xMatrixView_isValid(rhs) || res.rows != lhs.rows ||
+        res.cols != rhs.cols || lhs.cols != rhs.rows) {
+        return false;
+    }
+
+    // strided operands are copied into dense buffers, result overlapping operand is computed into buffer
+    float *lhsBuffer = NULL, *rhsBuffer = NULL, *resBuffer = NULL;
+    xMatrixView a = xMatrixView_dense(lhs, false, &lhsBuffer);
+    xMatrixView b = xMatrixView_dense(rhs, false, &rhsBuffer);
+    xMatrixView c = xMatrixView_dense(res, xMatrixView_overlaps(res, lhs) || xMatrixView_overlaps(res, rhs), &resBuffer);
+    xBool success = xMatrixView_isValid(a) && xMatrixView_isValid(b) && xMatrixView_isValid(c);
+    if (success) {
+        if (lhsBuffer) {
+            xMatrixView_copy(a, lhs);
+        }
+        if (rhsBuffer) {
+            xMatrixView_copy(b, rhs);
+        }
+        success = xGemm_sgemm(c.rows, c.cols, a.cols, 1.0f, a.data, a.rowStride, b.data, b.rowStride, 0.0f, c.data,
+                              c.rowStride);
+        if (success && resBuffer) {
+            xMatrixView_copy(res, c);
+        }
+    }
+
+    xAllocator_free(NULL, lhsBuffer, lhs.rows * lhs.cols * sizeof(float));
+    xAllocator_free(NULL, rhsBuffer, rhs.rows * rhs.cols * sizeof(float));
+    xAllocator_free(NULL, resBuffer, res.rows * res.cols * sizeof(float));
+    return success;
+}
@@ -0,0 +1,876 @@
+#include "xLinear/xMatrixDecomp.h"
+
+#include <math.h>  // fabsf, sqrtf, sqrt
+
+#include "xBase/xTypes.h"
+#include "xLinear/xGemm.h"
+#include "xLinear/xMatrix.h"
+#include "xMemory/xAllocator.h"
+
+// width of column panels factored without matrix multiplication (and of diagonal blocks of triangular solves)
+#define XMATRIXDECOMP_BLOCK 64
+
+struct xMatrixLU_s {
+    xMatrix *factors;  // L below diagonal (unit diagonal is implied) and U on and above diagonal
+    xSize *pivots;     // row exchanged with each row during elimination
+    xSize size;        // dimension of decomposed matrix
+    xSize swaps;       // number of exchanges of two different rows
+    xBool singular;    // some pivot is exactly zero
+};
+
+struct xMatrixCholesky_s {
+    xMatrix *lower;  // L
+    xMatrix *upper;  // L^T (both are kept so triangular solves read rows of factor contiguously)
+};
+
+struct xMatrixQR_s {
+    xMatrix *factors;  // R on and above diagonal and Householder vectors (without leading one) below diagonal
+    float *tau;        // scale of each reflection H = I - tau * v * v^T
+    xSize cols;        // number of columns of decomposed matrix (and reflections)
+};
+
+static inline xSize xMatrixDecomp_min(xSize a, xSize b) { return (a < b) ? a : b; }
+
+static void xMatrixDecomp_swapRows(float *x, float *y, xSize count)
+{
+    for (xSize i = 0; i < count; i++) {
+        float tmp = x[i];
+        x[i] = y[i];
+        y[i] = tmp;
+    }
+}
+
+// solve TX = B in place of B for n x n lower triangular T and n x nrhs B
+static xBool xMatrixDecomp_solveLower(const float *t, xSize ldt, float *b, xSize ldb, xSize n, xSize nrhs, xBool unit)
+{
+    for (xSize i0 = 0; i0 < n; i0 += XMATRIXDECOMP_BLOCK) {
+        xSize end = xMatrixDecomp_min(i0 + XMATRIXDECOMP_BLOCK, n);
+
+        // forward substitution inside diagonal block, combining whole rows of B
+        for (xSize i = i0; i < end; i++) {
+            float *row = b + i * ldb;
+            for (xSize r = i0; r < i; r++) {
+                float f = t[i * ldt + r];
+                const float *src = b + r * ldb;
+                for (xSize j = 0; j < nrhs; j++) {
+                    row[j] -= f * src[j];
+                }
+            }
+            if (!unit) {
+                float inv = 1.0f / t[i * ldt + i];
+                for (xSize j = 0; j < nrhs; j++) {
+                    row[j] *= inv;
+                }
+            }
+        }
+
+        // remove contribution of solved rows from rows below block
+        if (end < n && !xGemm_sgemm(n - end, nrhs, end - i0, -1.0f, t + end * ldt + i0, ldt, b + i0 * ldb, ldb, 1.0f,
+                                    b + end * ldb, ldb)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// solve TX = B in place of B for n x n upper triangular T and n x nrhs B
+static xBool xMatrixDecomp_solveUpper(const float *t, xSize ldt, float *b, xSize ldb, xSize n, xSize nrhs, xBool unit)
+{
+    for (xSize end = n; end > 0;) {
+        xSize i0 = (end - 1) / XMATRIXDECOMP_BLOCK * XMATRIXDECOMP_BLOCK;
+
+        // back substitution inside diagonal block, combining whole rows of B
+        for (xSize i = end; i-- > i0;) {
+            float *row = b + i * ldb;
+            for (xSize r = i + 1; r < end; r++) {
+                float f = t[i * ldt + r];
+                const float *src = b + r * ldb;
+                for (xSize j = 0; j < nrhs; j++) {
+                    row[j] -= f * src[j];
+                }
+            }
+            if (!unit) {
+                float inv = 1.0f / t[i * ldt + i];
+                for (xSize j = 0; j < nrhs; j++) {
+                    row[j] *= inv;
+                }
+            }
+        }
+
+        // remove contribution of solved rows from rows above block
+        if (i0 > 0 && !xGemm_sgemm(i0, nrhs, end - i0, -1.0f, t + i0, ldt, b + i0 * ldb, ldb, 1.0f, b, ldb)) {
+            return false;
+        }
+        end = i0;
+    }
+
+    return true;
+}
+
+static xBool xMatrixLU_factorize(xMatrixLU *lu)
+{
+    xMatrixView view = xMatrix_view(lu->factors);
+    float *a = view.data;
+    xSize lda = view.rowStride;
+    xSize n = lu->size;
+
+    for (xSize k0 = 0; k0 < n; k0 += XMATRIXDECOMP_BLOCK) {
+        xSize end = xMatrixDecomp_min(k0 + XMATRIXDECOMP_BLOCK, n);
+
+        // eliminate columns of panel one by one, exchanging whole rows so L and trailing matrix stay consistent
+        for (xSize j = k0; j < end; j++) {
+            xSize p = j;
+            float max = fabsf(a[j * lda + j]);
+            for (xSize i = j + 1; i < n; i++) {
+                if (fabsf(a[i * lda + j]) > max) {
+                    max = fabsf(a[i * lda + j]);
+                    p = i;
+                }
+            }
+            lu->pivots[j] = p;
+            if (p != j) {
+                xMatrixDecomp_swapRows(a + j * lda, a + p * lda, n);
+                lu->swaps++;
+            }
+
+            const float *pivotRow = a + j * lda;
+            if (pivotRow[j] == 0.0f) {
+                // column is already zero below diagonal, so there is nothing to eliminate
+                lu->singular = true;
+                continue;
+            }
+            float inv = 1.0f / pivotRow[j];
+            for (xSize i = j + 1; i < n; i++) {
+                float *row = a + i * lda;
+                row[j] *= inv;
+                for (xSize c = j + 1; c < end; c++) {
+                    row[c] -= row[j] * pivotRow[c];
+                }
+            }
+        }
+
+        // compute block row of U and update trailing matrix by matrix multiplication
+        if (end < n &&
+            (!xMatrixDecomp_solveLower(a + k0 * lda + k0, lda, a + k0 * lda + end, lda, end - k0, n - end, true) ||
+             !xGemm_sgemm(n - end, n - end, end - k0, -1.0f, a + end * lda + k0, lda, a + k0 * lda + end, lda, 1.0f,
+                          a + end * lda + end, lda))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// solve AX = B in place of B (both row exchanges and triangular solves)
+static xBool xMatrixLU_solveInPlace(const xMatrixLU *lu, xMatrix *matrix)
+{
+    xMatrixView x = xMatrix_view(matrix);
+    xMatrixView f = xMatrix_view(lu->factors);
+
+    for (xSize j = 0; j < lu->size; j++) {
+        if (lu->pivots[j] != j) {
+            xMatrixDecomp_swapRows(x.data + j * x.rowStride, x.data + lu->pivots[j] * x.rowStride, x.cols);
+        }
+    }
+
+    return xMatrixDecomp_solveLower(f.data, f.rowStride, x.data, x.rowStride, lu->size, x.cols, true) &&
+           xMatrixDecomp_solveUpper(f.data, f.rowStride, x.data, x.rowStride, lu->size, x.cols, false);
+}
+
+xMatrixLU *xMatrixLU_new(const xMatrix *matrix)
+{
+    // validate arguments
+    if (!xMatrix_isValid(matrix) || xMatrix_getRows(matrix) != xMatrix_getCols(matrix)) {
+        return NULL;
+    }
+
+    // pivots are stored right after structure
+    xSize n = xMatrix_getRows(matrix);
+    xMatrixLU *lu = (xMatrixLU *)xAllocator_alloc(NULL, sizeof(xMatrixLU) + n * sizeof(xSize));
+    if (!lu) {
+        return NULL;
+    }
+    lu->pivots = (xSize *)(lu + 1);
+    lu->size = n;
+    lu->swaps = 0;
+    lu->singular = false;
+
+    // decompose copy of matrix in place
+    if (!(lu->factors = xMatrix_duplicate(matrix)) || !xMatrixLU_factorize(lu)) {
+        xMatrixLU_free(lu);
+        return NULL;
+    }
+
+    return lu;
+}
+
+void xMatrixLU_free(xMatrixLU *lu)
+{
+    if (!lu) {
+        return;
+    }
+
+    xMatrix_free(lu->factors);
+    xAllocator_free(NULL, lu, sizeof(xMatrixLU) + lu->size * sizeof(xSize));
+}
+
+xBool xMatrixLU_isSingular(const xMatrixLU *lu) { return (lu) ? lu->singular : true; }
+
+xMatrix *xMatrixLU_getL(const xMatrixLU *lu)
+{
+    // validate arguments
+    if (!lu) {
+        return NULL;
+    }
+
+    xMatrix *mat = xMatrix_identity(lu->size);
+    if (!xMatrix_isValid(mat)) {
+        return NULL;
+    }
+
+    // copy part below diagonal
+    xMatrixView dest = xMatrix_view(mat);
+    xMatrixView src = xMatrix_view(lu->factors);
+    for (xSize i = 1; i < lu->size; i++) {
+        for (xSize j = 0; j < i; j++) {
+            dest.data[i * dest.rowStride + j] = src.data[i * src.rowStride + j];
+        }
+    }
+
+    return mat;
+}
+
+xMatrix *xMatrixLU_getU(const xMatrixLU *lu)
+{
+    // validate arguments
+    if (!lu) {
+        return NULL;
+    }
+
+    xMatrix *mat = xMatrix_new(lu->size, lu->size);
+    if (!xMatrix_isValid(mat)) {
+        return NULL;
+    }
+
+    // copy part on and above diagonal
+    xMatrixView dest = xMatrix_view(mat);
+    xMatrixView src = xMatrix_view(lu->factors);
+    for (xSize i = 0; i < lu->size; i++) {
+        for (xSize j = i; j < lu->size; j++) {
+            dest.data[i * dest.rowStride + j] = src.data[i * src.rowStride + j];
+        }
+    }
+
+    return mat;
+}
+
+xSize xMatrixLU_getPermutation(const xMatrixLU *lu, xSize row)
+{
+    // validate arguments
+    if (!lu || row >= lu->size) {
+        return 0;
+    }
+
+    // follow row backwards through exchanges done after it reached its final position
+    xSize current = row;
+    for (xSize j = lu->size; j-- > 0;) {
+        if (current == j) {
+            current = lu->pivots[j];
+        } else if (current == lu->pivots[j]) {
+            current = j;
+        }
+    }
+
+    return current;
+}
+
+float xMatrixLU_determinant(const xMatrixLU *lu)
+{
+    // validate arguments
+    if (!lu || lu->singular) {
+        return 0.0f;
+    }
+
+    xMatrixView view = xMatrix_view(lu->factors);
+    float det = (lu->swaps % 2) ? -1.0f : 1.0f;
+    for (xSize i = 0; i < lu->size; i++) {
+        det *= view.data[i * view.rowStride + i];
+    }
+
+    return det;
+}
+
+xMatrix *xMatrixLU_solve(const xMatrixLU *lu, const xMatrix *rhs)
+{
+    // validate arguments
+    if (!lu || lu->singular || !xMatrix_isValid(rhs) || xMatrix_getRows(rhs) != lu->size) {
+        return NULL;
+    }
+
+    // solve in copy of right-hand side
+    xMatrix *mat = xMatrix_duplicate(rhs);
+    if (!xMatrix_isValid(mat) || !xMatrixLU_solveInPlace(lu, mat)) {
+        xMatrix_free(mat);
+        return NULL;
+    }
+
+    return mat;
+}
+
+xMatrix *xMatrixLU_inverse(const xMatrixLU *lu)
+{
+    // validate arguments
+    if (!lu || lu->singular) {
+        return NULL;
+    }
+
+    // solve system with identity as right-hand side
+    xMatrix *mat = xMatrix_identity(lu->size);
+    if (!xMatrix_isValid(mat) || !xMatrixLU_solveInPlace(lu, mat)) {
+        xMatrix_free(mat);
+        return NULL;
+    }
+
+    return mat;
+}
+
+// compute upper factor U = L^T in place of upper triangle of a (scratch holds n * XMATRIXDECOMP_BLOCK elements)
+static xBool xMatrixCholesky_factorize(float *a, xSize lda, xSize n, float *scratch)
+{
+    for (xSize k0 = 0; k0 < n; k0 += XMATRIXDECOMP_BLOCK) {
+        xSize end = xMatrixDecomp_min(k0 + XMATRIXDECOMP_BLOCK, n);
+        xSize kb = end - k0;
+
+        // finish rows of block row one by one over whole width and subtract them from rows below them in block
+        for (xSize j = k0; j < end; j++) {
+            float *row = a + j * lda;
+            if (!(row[j] > 0.0f)) {
+                // matrix is not positive definite (or contains NaN)
+                return false;
+            }
+            row[j] = sqrtf(row[j]);
+            float inv = 1.0f / row[j];
+            for (xSize c = j + 1; c < n; c++) {
+                row[c] *= inv;
+            }
+            for (xSize i = j + 1; i < end; i++) {
+                float f = row[i];
+                float *dest = a + i * lda;
+                for (xSize c = i; c < n; c++) {
+                    dest[c] -= f * row[c];
+                }
+            }
+        }
+        if (end == n) {
+            break;
+        }
+
+        // subtract U12^T U12 from upper triangle of trailing matrix, one block row at a time (U12^T is copied to scratch)
+        xSize m = n - end;
+        for (xSize r = 0; r < kb; r++) {
+            const float *row = a + (k0 + r) * lda + end;
+            for (xSize i = 0; i < m; i++) {
+                scratch[i * kb + r] = row[i];
+            }
+        }
+        for (xSize r0 = 0; r0 < m; r0 += XMATRIXDECOMP_BLOCK) {
+            xSize rb = xMatrixDecomp_min(XMATRIXDECOMP_BLOCK, m - r0);
+            if (!xGemm_sgemm(rb, m - r0, kb, -1.0f, scratch + r0 * kb, kb, a + k0 * lda + end + r0, lda, 1.0f,
+                             a + (end + r0) * lda + end + r0, lda)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+xMatrixCholesky *xMatrixCholesky_new(const xMatrix *matrix)
+{
+    // validate arguments
+    if (!xMatrix_isValid(matrix) || xMatrix_getRows(matrix) != xMatrix_getCols(matrix)) {
+        return NULL;
+    }
+
+    xMatrixCholesky *cholesky = (xMatrixCholesky *)xAllocator_alloc(NULL, sizeof(xMatrixCholesky));
+    if (!cholesky) {
+        return NULL;
+    }
+    cholesky->lower = NULL;
+
+    // decompose copy of matrix in place
+    xSize n = xMatrix_getRows(matrix);
+    float *scratch = (float *)xAllocator_alloc(NULL, n * XMATRIXDECOMP_BLOCK * sizeof(float));
+    cholesky->upper = xMatrix_duplicate(matrix);
+    xMatrixView view = xMatrix_view(cholesky->upper);
+    xBool success = scratch && xMatrix_isValid(cholesky->upper) &&
+                    xMatrixCholesky_factorize(view.data, view.rowStride, n, scratch);
+    xAllocator_free(NULL, scratch, n * XMATRIXDECOMP_BLOCK * sizeof(float));
+
+    if (success) {
+        // clear original elements below diagonal and keep transposed copy for forward substitution
+        for (xSize i = 1; i < n; i++) {
+            for (xSize j = 0; j < i; j++) {
+                view.data[i * view.rowStride + j] = 0.0f;
+            }
+        }
+        success = ((cholesky->lower = xMatrix_transpose(cholesky->upper)) != NULL);
+    }
+    if (!success) {
+        xMatrixCholesky_free(cholesky);
+        return NULL;
+    }
+
+    return cholesky;
+}
+
+void xMatrixCholesky_free(xMatrixCholesky *cholesky)
+{
+    if (!cholesky) {
+        return;
+    }
+
+    xMatrix_free(cholesky->lower);
+    xMatrix_free(cholesky->upper);
+    xAllocator_free(NULL, cholesky, sizeof(xMatrixCholesky));
+}
+
+xMatrix *xMatrixCholesky_getL(const xMatrixCholesky *cholesky) { return (cholesky) ? xMatrix_duplicate(cholesky->lower) : NULL; }
+
+float xMatrixCholesky_determinant(const xMatrixCholesky *cholesky)
+{
+    // validate arguments
+    if (!cholesky) {
+        return 0.0f;
+    }
+
+    // determinant of A = LL^T is squared product of diagonal of L
+    xMatrixView view = xMatrix_view(cholesky->lower);
+    float det = 1.0f;
+    for (xSize i = 0; i < view.rows; i++) {
+        det *= view.data[i * view.rowStride + i] * view.data[i * view.rowStride + i];
+    }
+
+    return det;
+}
+
+xMatrix *xMatrixCholesky_solve(const xMatrixCholesky *cholesky, const xMatrix *rhs)
+{
+    // validate arguments
+    if (!cholesky || !xMatrix_isValid(rhs) || xMatrix_getRows(rhs) != xMatrix_getRows(cholesky->lower)) {
+        return NULL;
+    }
+
+    // solve LY = B and L^T X = Y in copy of right-hand side
+    xMatrix *mat = xMatrix_duplicate(rhs);
+    xMatrixView x = xMatrix_view(mat);
+    xMatrixView l = xMatrix_view(cholesky->lower);
+    xMatrixView u = xMatrix_view(cholesky->upper);
+    if (!xMatrix_isValid(mat) || !xMatrixDecomp_solveLower(l.data, l.rowStride, x.data, x.rowStride, x.rows, x.cols, false) ||
+        !xMatrixDecomp_solveUpper(u.data, u.rowStride, x.data, x.rowStride, x.rows, x.cols, false)) {
+        xMatrix_free(mat);
+        return NULL;
+    }
+
+    return mat;
+}
+
+// compute reflection zeroing column j of m-row matrix below diagonal, store it in place of column and return its tau
+static float xMatrixQR_reflect(float *a, xSize lda, xSize m, xSize j)
+{
+    // norm is accumulated in double precision so squares of large or small elements do not overflow or underflow
+    double sigma = 0.0;
+    for (xSize i = j + 1; i < m; i++) {
+        double x = a[i * lda + j];
+        sigma += x * x;
+    }
+    if (sigma == 0.0) {
+        // nothing to zero, reflection is identity
+        return 0.0f;
+    }
+
+    // reflect column onto -sign(alpha) * norm to avoid cancellation, scaling vector to have leading one
+    double alpha = a[j * lda + j];
+    double norm = sqrt(alpha * alpha + sigma);
+    double beta = (alpha >= 0.0) ? -norm : norm;
+    float scale = (float)(1.0 / (alpha - beta));
+    for (xSize i = j + 1; i < m; i++) {
+        a[i * lda + j] *= scale;
+    }
+    a[j * lda + j] = (float)beta;
+
+    return (float)((beta - alpha) / beta);
+}
+
+// factor columns k0 to end of m-row matrix by unblocked Householder reflections
+static void xMatrixQR_factorPanel(float *a, xSize lda, xSize m, xSize k0, xSize end, float *tau)
+{
+    float w[XMATRIXDECOMP_BLOCK];
+
+    for (xSize j = k0; j < end; j++) {
+        float t = tau[j] = xMatrixQR_reflect(a, lda, m, j);
+        if (t == 0.0f) {
+            continue;
+        }
+
+        // apply reflection to rest of panel: w = v^T A, A -= tau * v * w
+        float *head = a + j * lda;
+        for (xSize c = j + 1; c < end; c++) {
+            w[c - k0] = head[c];
+        }
+        for (xSize i = j + 1; i < m; i++) {
+            const float *row = a + i * lda;
+            for (xSize c = j + 1; c < end; c++) {
+                w[c - k0] += row[j] * row[c];
+            }
+        }
+        for (xSize c = j + 1; c < end; c++) {
+            head[c] -= t * w[c - k0];
+        }
+        for (xSize i = j + 1; i < m; i++) {
+            float *row = a + i * lda;
+            float f = t * row[j];
+            for (xSize c = j + 1; c < end; c++) {
+                row[c] -= f * w[c - k0];
+            }
+        }
+    }
+}
+
+// form V (unit lower trapezoidal, m - k0 x kb), its transpose and upper triangular T (kb x kb) of reflections k0 to
+// k0 + kb, so that their product H(k0) ... H(k0 + kb - 1) is I - V T V^T
+static void xMatrixQR_buildBlock(const float *a, xSize lda, xSize m, xSize k0, xSize kb, const float *tau, float *v, float *vt,
+                                 float *t)
+{
+    xSize mk = m - k0;
+    for (xSize i = 0; i < mk; i++) {
+        const float *row = a + (k0 + i) * lda + k0;
+        for (xSize r = 0; r < kb; r++) {
+            float x = (r < i) ? row[r] : (r == i) ? 1.0f : 0.0f;
+            v[i * kb + r] = x;
+            vt[r * mk + i] = x;
+        }
+    }
+
+    // column r of T is -tau_r * T(0:r, 0:r) * V(:, 0:r)^T * v_r (v_r is zero above row r)
+    float z[XMATRIXDECOMP_BLOCK];
+    for (xSize r = 0; r < kb; r++) {
+        const float *vr = vt + r * mk;
+        for (xSize q = 0; q < r; q++) {
+            const float *vq = vt + q * mk;
+            float dot = 0.0f;
+            for (xSize i = r; i < mk; i++) {
+                dot += vq[i] * vr[i];
+            }
+            z[q] = dot;
+        }
+        for (xSize q = 0; q < r; q++) {
+            float sum = 0.0f;
+            for (xSize p = q; p < r; p++) {
+                sum += t[q * kb + p] * z[p];
+            }
+            t[q * kb + r] = -tau[k0 + r] * sum;
+        }
+        t[r * kb + r] = tau[k0 + r];
+        for (xSize q = r + 1; q < kb; q++) {
+            t[q * kb + r] = 0.0f;
+        }
+    }
+}
+
+// compute C = (I - V T V^T) C, or C = (I - V T^T V^T) C (product of reflections transposed) if transpose is set, for
+// mk x nc matrix C (w holds kb * nc elements)
+static xBool xMatrixQR_applyBlock(const float *v, const float *vt, const float *t, xSize mk, xSize kb, float *c, xSize ldc,
+                                  xSize nc, xBool transpose, float *w)
+{
+    if (!xGemm_sgemm(kb, nc, mk, 1.0f, vt, mk, c, ldc, 0.0f, w, nc)) {
+        return false;
+    }
+
+    // multiply W by triangular T (or T^T) in place, ordering rows so each one is overwritten after its last use
+    if (transpose) {
+        for (xSize r = kb; r-- > 0;) {
+            float *row = w + r * nc;
+            for (xSize j = 0; j < nc; j++) {
+                row[j] *= t[r * kb + r];
+            }
+            for (xSize q = 0; q < r; q++) {
+                float f = t[q * kb + r];
+                const float *src = w + q * nc;
+                for (xSize j = 0; j < nc; j++) {
+                    row[j] += f * src[j];
+                }
+            }
+        }
+    } else {
+        for (xSize r = 0; r < kb; r++) {
+            float *row = w + r * nc;
+            for (xSize j = 0; j < nc; j++) {
+                row[j] *= t[r * kb + r];
+            }
+            for (xSize q = r + 1; q < kb; q++) {
+                float f = t[r * kb + q];
+                const float *src = w + q * nc;
+                for (xSize j = 0; j < nc; j++) {
+                    row[j] += f * src[j];
+                }
+            }
+        }
+    }
+
+    return xGemm_sgemm(mk, nc, kb, -1.0f, v, kb, w, nc, 1.0f, c, ldc);
+}
+
+// number of scratch elements needed to apply blocks of reflections of m-row matrix to nc columns
+static inline xSize xMatrixQR_scratchSize(xSize m, xSize nc)
+{
+    return (2 * m + XMATRIXDECOMP_BLOCK + nc) * XMATRIXDECOMP_BLOCK;
+}
+
+// multiply matrix with as many rows as decomposed matrix by Q^T (or by Q if transpose is not set) in place; if skipLeading is
+// set, columns before each block of reflections are skipped (they are unit vectors block does not change when forming Q)
+static xBool xMatrixQR_apply(const xMatrixQR *qr, xMatrix *matrix, xBool transpose, xBool skipLeading)
+{
+    xMatrixView f = xMatrix_view(qr->factors);
+    xMatrixView x = xMatrix_view(matrix);
+    float *scratch = (float *)xAllocator_alloc(NULL, xMatrixQR_scratchSize(f.rows, x.cols) * sizeof(float));
+    if (!scratch) {
+        return false;
+    }
+    float *v = scratch;
+    float *vt = v + f.rows * XMATRIXDECOMP_BLOCK;
+    float *t = vt + f.rows * XMATRIXDECOMP_BLOCK;
+    float *w = t + XMATRIXDECOMP_BLOCK * XMATRIXDECOMP_BLOCK;
+
+    // Q^T = H(n - 1) ... H(0) applies blocks first to last, Q applies them last to first
+    xSize blocks = (qr->cols + XMATRIXDECOMP_BLOCK - 1) / XMATRIXDECOMP_BLOCK;
+    xBool success = true;
+    for (xSize b = 0; success && b < blocks; b++) {
+        xSize k0 = (transpose ? b : blocks - 1 - b) * XMATRIXDECOMP_BLOCK;
+        xSize kb = xMatrixDecomp_min(XMATRIXDECOMP_BLOCK, qr->cols - k0);
+
+        xSize col = skipLeading ? k0 : 0;
+        xMatrixQR_buildBlock(f.data, f.rowStride, f.rows, k0, kb, qr->tau, v, vt, t);
+        success = xMatrixQR_applyBlock(v, vt, t, f.rows - k0, kb, x.data + k0 * x.rowStride + col, x.rowStride, x.cols - col,
+                                       transpose, w);
+    }
+
+    xAllocator_free(NULL, scratch, xMatrixQR_scratchSize(f.rows, x.cols) * sizeof(float));
+    return success;
+}
+
+static xBool xMatrixQR_factorize(xMatrixQR *qr)
+{
+    xMatrixView view = xMatrix_view(qr->factors);
+    float *a = view.data;
+    xSize lda = view.rowStride;
+    xSize m = view.rows;
+    xSize n = qr->cols;
+
+    float *scratch = (float *)xAllocator_alloc(NULL, xMatrixQR_scratchSize(m, n) * sizeof(float));
+    if (!scratch) {
+        return false;
+    }
+    float *v = scratch;
+    float *vt = v + m * XMATRIXDECOMP_BLOCK;
+    float *t = vt + m * XMATRIXDECOMP_BLOCK;
+    float *w = t + XMATRIXDECOMP_BLOCK * XMATRIXDECOMP_BLOCK;
+
+    // factor panel by unblocked reflections, then apply them to trailing columns at once as block reflector
+    xBool success = true;
+    for (xSize k0 = 0; success && k0 < n; k0 += XMATRIXDECOMP_BLOCK) {
+        xSize end = xMatrixDecomp_min(k0 + XMATRIXDECOMP_BLOCK, n);
+        xMatrixQR_factorPanel(a, lda, m, k0, end, qr->tau);
+        if (end < n) {
+            xMatrixQR_buildBlock(a, lda, m, k0, end - k0, qr->tau, v, vt, t);
+            success = xMatrixQR_applyBlock(v, vt, t, m - k0, end - k0, a + k0 * lda + end, lda, n - end, true, w);
+        }
+    }
+
+    xAllocator_free(NULL, scratch, xMatrixQR_scratchSize(m, n) * sizeof(float));
+    return success;
+}
+
+xMatrixQR *xMatrixQR_new(const xMatrix *matrix)
+{
+    // validate arguments
+    if (!xMatrix_isValid(matrix) || xMatrix_getRows(matrix) < xMatrix_getCols(matrix)) {
+        return NULL;
+    }
+
+    // scales of reflections are stored right after structure
+    xSize n = xMatrix_getCols(matrix);
+    xMatrixQR *qr = (xMatrixQR *)xAllocator_alloc(NULL, sizeof(xMatrixQR) + n * sizeof(float));
+    if (!qr) {
+        return NULL;
+    }
+    qr->tau = (float *)(qr + 1);
+    qr->cols = n;
+
+    // decompose copy of matrix in place
+    if (!(qr->factors = xMatrix_duplicate(matrix)) || !xMatrixQR_factorize(qr)) {
+        xMatrixQR_free(qr);
+        return NULL;
+    }
+
+    return qr;
+}
+
+void xMatrixQR_free(xMatrixQR *qr)
+{
+    if (!qr) {
+        return;
+    }
+
+    xMatrix_free(qr->factors);
+    xAllocator_free(NULL, qr, sizeof(xMatrixQR) + qr->cols * sizeof(float));
+}
+
+xBool xMatrixQR_isFullRank(const xMatrixQR *qr)
+{
+    // validate arguments
+    if (!qr) {
+        return false;
+    }
+
+    xMatrixView view = xMatrix_view(qr->factors);
+    for (xSize i = 0; i < qr->cols; i++) {
+        if (view.data[i * view.rowStride + i] == 0.0f) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+xMatrix *xMatrixQR_getQ(const xMatrixQR *qr)
+{
+    // validate arguments
+    if (!qr) {
+        return NULL;
+    }
+
+    // apply reflections to first columns of identity
+    xMatrix *mat = xMatrix_new(xMatrix_getRows(qr->factors), qr->cols);
+    if (!xMatrix_isValid(mat)) {
+        return NULL;
+    }
+    for (xSize i = 0; i < qr->cols; i++) {
+        xMatrix_set(mat, i, i, 1.0f);
+    }
+    if (!xMatrixQR_apply(qr, mat, false, true)) {
+        xMatrix_free(mat);
+        return NULL;
+    }
+
+    return mat;
+}
+
+xMatrix *xMatrixQR_getR(const xMatrixQR *qr)
+{
+    // validate arguments
+    if (!qr) {
+        return NULL;
+    }
+
+    xMatrix *mat = xMatrix_new(qr->cols, qr->cols);
+    if (!xMatrix_isValid(mat)) {
+        return NULL;
+    }
+
+    // copy part on and above diagonal
+    xMatrixView dest = xMatrix_view(mat);
+    xMatrixView src = xMatrix_view(qr->factors);
+    for (xSize i = 0; i < qr->cols; i++) {
+        for (xSize j = i; j < qr->cols; j++) {
+            dest.data[i * dest.rowStride + j] = src.data[i * src.rowStride + j];
+        }
+    }
+
+    return mat;
+}
+
+xMatrix *xMatrixQR_solve(const xMatrixQR *qr, const xMatrix *rhs)
+{
+    // validate arguments
+    if (!xMatrixQR_isFullRank(qr) || !xMatrix_isValid(rhs) || xMatrix_getRows(rhs) != xMatrix_getRows(qr->factors)) {
+        return NULL;
+    }
+
+    // compute Q^T B in copy of right-hand side and solve R X = (Q^T B)(0:n, :)
+    xMatrix *tmp = xMatrix_duplicate(rhs);
+    xMatrixView y = xMatrix_view(tmp);
+    xMatrixView r = xMatrix_view(qr->factors);
+    xMatrix *mat = NULL;
+    if (xMatrix_isValid(tmp) && xMatrixQR_apply(qr, tmp, true, false) &&
+        xMatrixDecomp_solveUpper(r.data, r.rowStride, y.data, y.rowStride, qr->cols, y.cols, false)) {
+        mat = xMatrix_newFromView(xMatrix_viewBlock(tmp, 0, 0, qr->cols, y.cols));
+    }
+    xMatrix_free(tmp);
+
+    return mat;
+}
+
+xMatrix *xMatrix_solveTriangular(const xMatrix *tri, const xMatrix *rhs, xBool lower, xBool unitDiagonal)
+{
+    // validate arguments
+    xSize n = xMatrix_getRows(tri);
+    if (!xMatrix_isValid(tri) || !xMatrix_isValid(rhs) || xMatrix_getCols(tri) != n || xMatrix_getRows(rhs) != n) {
+        return NULL;
+    }
+    xMatrixView t = xMatrix_view(tri);
+    for (xSize i = 0; !unitDiagonal && i < n; i++) {
+        if (t.data[i * t.rowStride + i] == 0.0f) {
+            return NULL;
+        }
+    }
+
+    // solve in copy of right-hand side
+    xMatrix *mat = xMatrix_duplicate(rhs);
+    xMatrixView x = xMatrix_view(mat);
+    if (!xMatrix_isValid(mat) ||
+        !(lower ? xMatrixDecomp_solveLower : xMatrixDecomp_solveUpper)(t.data, t.rowStride, x.data, x.rowStride, n, x.cols,
+                                                                         unitDiagonal)) {
+        xMatrix_free(mat);
+        return NULL;
+    }
+
+    return mat;
+}
+
+xMatrix *xMatrix_solve(const xMatrix *matrix, const xMatrix *rhs)
+{
+    xMatrixLU *lu = xMatrixLU_new(matrix);
+    xMatrix *mat = xMatrixLU_solve(lu, rhs);
+    xMatrixLU_free(lu);
+
+    return mat;
+}
+
+xMatrix *xMatrix_leastSquares(const xMatrix *matrix, const xMatrix *rhs)
+{
+    xMatrixQR *qr = xMatrixQR_new(matrix);
+    xMatrix *mat = xMatrixQR_solve(qr, rhs);
+    xMatrixQR_free(qr);
+
+    return mat;
+}
+
+xMatrix *xMatrix_inverse(const xMatrix *matrix)
+{
+    xMatrixLU *lu = xMatrixLU_new(matrix);
+    xMatrix *mat = xMatrixLU_inverse(lu);
+    xMatrixLU_free(lu);
+
+    return mat;
+}
+
+float xMatrix_determinant(const xMatrix *matrix)
+{
+    xMatrixLU *lu = xMatrixLU_new(matrix);
+    float det = xMatrixLU_determinant(lu);
+    xMatrixLU_free(lu);
+
+    return det;
+}
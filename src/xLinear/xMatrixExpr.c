@@ -0,0 +1,423 @@
+#include "xLinear/xMatrixExpr.h"
+#include "xBase/xTypes.h"
+#include "xLinear/xMatrix.h"
+#include "xMemory/xAllocator.h"
+#include "xThread/xThreadPool.h"
+
+// number of elements of row processed through all operations at once (strips of all live nodes fit in L1 cache)
+#define XMATRIXEXPR_STRIP 128
+
+// results with at least this many elements are evaluated in row blocks by shared thread pool
+#define XMATRIXEXPR_PARALLEL_THRESHOLD (1 << 16)
+
+// approximate number of elements in single row block
+#define XMATRIXEXPR_PARALLEL_GRAIN (1 << 14)
+
+// marks nodes which do not occupy scratch strip
+#define XMATRIXEXPR_NO_SLOT ((xUInt8)0xFF)
+
+typedef enum {
+    XMATRIXEXPR_OP_INPUT = 0, /**< elements of bound view */
+    XMATRIXEXPR_OP_CONSTANT,  /**< same value for every element */
+    XMATRIXEXPR_OP_ADD,       /**< lhs + rhs */
+    XMATRIXEXPR_OP_SUB,       /**< lhs - rhs */
+    XMATRIXEXPR_OP_MUL,       /**< lhs * rhs */
+    XMATRIXEXPR_OP_DIV,       /**< lhs / rhs */
+    XMATRIXEXPR_OP_MIN,       /**< smaller of lhs and rhs */
+    XMATRIXEXPR_OP_MAX,       /**< larger of lhs and rhs */
+    XMATRIXEXPR_OP_NEG,       /**< -lhs */
+    XMATRIXEXPR_OP_ABS,       /**< |lhs| */
+    XMATRIXEXPR_OP_MAP,       /**< unary(lhs) */
+    XMATRIXEXPR_OP_MAP2       /**< binary(lhs, rhs) */
+} xMatrixExprOp;
+
+typedef struct xMatrixExprNode_s {
+    xMatrixExprOp op;               // operation of node
+    xSize lhs;                      // first operand (operations only)
+    xSize rhs;                      // second operand (binary operations only)
+    xMatrixView view;               // bound view (input nodes only)
+    float value;                    // value (constant nodes only)
+    float (*unary)(float);          // user function (XMATRIXEXPR_OP_MAP only)
+    float (*binary)(float, float);  // user function (XMATRIXEXPR_OP_MAP2 only)
+} xMatrixExprNode;
+
+struct xMatrixExpr_s {
+    xMatrixExprNode nodes[XMATRIXEXPR_MAX_NODES];  // nodes in order of addition (operands precede their users)
+    xSize count;                                   // number of nodes
+};
+
+typedef struct xMatrixExprPlan_s {
+    const xMatrixExpr *expr;              // evaluated expression
+    xSize root;                           // evaluated node
+    xMatrixView res;                      // result view
+    xBool needed[XMATRIXEXPR_MAX_NODES];  // whether node contributes to root
+    xUInt8 slot[XMATRIXEXPR_MAX_NODES];   // scratch strip holding result of node (XMATRIXEXPR_NO_SLOT if none)
+} xMatrixExprPlan;
+
+xMatrixExpr *xMatrixExpr_new(void)
+{
+    xMatrixExpr *expr = (xMatrixExpr *)xAllocator_alloc(NULL, sizeof(xMatrixExpr));
+    if (!expr) {
+        return NULL;
+    }
+
+    expr->count = 0;
+    return expr;
+}
+
+void xMatrixExpr_free(xMatrixExpr *expr)
+{
+    // validate passed argument
+    if (!expr) {
+        return;
+    }
+
+    xAllocator_free(NULL, expr, sizeof(xMatrixExpr));
+}
+
+inline xSize xMatrixExpr_getNodeCount(const xMatrixExpr *expr) { return expr ? expr->count : 0; }
+
+/**
+ * @brief
+ * Append node to expression, checking that its operands already exist.
+ *
+ * @return xSize Handle of appended node (XMATRIXEXPR_INVALID on failure).
+ */
+static xSize xMatrixExpr_append(xMatrixExpr *expr, const xMatrixExprNode *node, xSize operands)
+{
+    // validate arguments
+    if (!expr || expr->count >= XMATRIXEXPR_MAX_NODES || (operands > 0 && node->lhs >= expr->count) ||
+        (operands > 1 && node->rhs >= expr->count)) {
+        return XMATRIXEXPR_INVALID;
+    }
+
+    expr->nodes[expr->count] = *node;
+    return expr->count++;
+}
+
+/**
+ * @brief
+ * Append operation node with given operands.
+ */
+static xSize xMatrixExpr_operation(xMatrixExpr *expr, xMatrixExprOp op, xSize lhs, xSize rhs, xSize operands)
+{
+    xMatrixExprNode node = {op, lhs, rhs, {NULL, 0, 0, 0, 0}, 0.0f, NULL, NULL};
+    return xMatrixExpr_append(expr, &node, operands);
+}
+
+xSize xMatrixExpr_input(xMatrixExpr *expr, xMatrixView view)
+{
+    // validate arguments
+    if (!xMatrixView_isValid(view)) {
+        return XMATRIXEXPR_INVALID;
+    }
+
+    xMatrixExprNode node = {XMATRIXEXPR_OP_INPUT, 0, 0, view, 0.0f, NULL, NULL};
+    return xMatrixExpr_append(expr, &node, 0);
+}
+
+xBool xMatrixExpr_bind(xMatrixExpr *expr, xSize input, xMatrixView view)
+{
+    // validate arguments
+    if (!expr || input >= expr->count || expr->nodes[input].op != XMATRIXEXPR_OP_INPUT || !xMatrixView_isValid(view)) {
+        return false;
+    }
+
+    expr->nodes[input].view = view;
+    return true;
+}
+
+xSize xMatrixExpr_constant(xMatrixExpr *expr, float value)
+{
+    xMatrixExprNode node = {XMATRIXEXPR_OP_CONSTANT, 0, 0, {NULL, 0, 0, 0, 0}, value, NULL, NULL};
+    return xMatrixExpr_append(expr, &node, 0);
+}
+
+xSize xMatrixExpr_add(xMatrixExpr *expr, xSize lhs, xSize rhs)
+{
+    return xMatrixExpr_operation(expr, XMATRIXEXPR_OP_ADD, lhs, rhs, 2);
+}
+
+xSize xMatrixExpr_sub(xMatrixExpr *expr, xSize lhs, xSize rhs)
+{
+    return xMatrixExpr_operation(expr, XMATRIXEXPR_OP_SUB, lhs, rhs, 2);
+}
+
+xSize xMatrixExpr_mul(xMatrixExpr *expr, xSize lhs, xSize rhs)
+{
+    return xMatrixExpr_operation(expr, XMATRIXEXPR_OP_MUL, lhs, rhs, 2);
+}
+
+xSize xMatrixExpr_div(xMatrixExpr *expr, xSize lhs, xSize rhs)
+{
+    return xMatrixExpr_operation(expr, XMATRIXEXPR_OP_DIV, lhs, rhs, 2);
+}
+
+xSize xMatrixExpr_min(xMatrixExpr *expr, xSize lhs, xSize rhs)
+{
+    return xMatrixExpr_operation(expr, XMATRIXEXPR_OP_MIN, lhs, rhs, 2);
+}
+
+xSize xMatrixExpr_max(xMatrixExpr *expr, xSize lhs, xSize rhs)
+{
+    return xMatrixExpr_operation(expr, XMATRIXEXPR_OP_MAX, lhs, rhs, 2);
+}
+
+xSize xMatrixExpr_neg(xMatrixExpr *expr, xSize operand)
+{
+    return xMatrixExpr_operation(expr, XMATRIXEXPR_OP_NEG, operand, 0, 1);
+}
+
+xSize xMatrixExpr_abs(xMatrixExpr *expr, xSize operand)
+{
+    return xMatrixExpr_operation(expr, XMATRIXEXPR_OP_ABS, operand, 0, 1);
+}
+
+xSize xMatrixExpr_map(xMatrixExpr *expr, xSize operand, float (*func)(float))
+{
+    // validate arguments
+    if (!func) {
+        return XMATRIXEXPR_INVALID;
+    }
+
+    xMatrixExprNode node = {XMATRIXEXPR_OP_MAP, operand, 0, {NULL, 0, 0, 0, 0}, 0.0f, func, NULL};
+    return xMatrixExpr_append(expr, &node, 1);
+}
+
+xSize xMatrixExpr_map2(xMatrixExpr *expr, xSize lhs, xSize rhs, float (*func)(float, float))
+{
+    // validate arguments
+    if (!func) {
+        return XMATRIXEXPR_INVALID;
+    }
+
+    xMatrixExprNode node = {XMATRIXEXPR_OP_MAP2, lhs, rhs, {NULL, 0, 0, 0, 0}, 0.0f, NULL, func};
+    return xMatrixExpr_append(expr, &node, 2);
+}
+
+/**
+ * @brief
+ * Get number of operands of node.
+ */
+static inline xSize xMatrixExpr_operandCount(const xMatrixExprNode *node)
+{
+    switch (node->op) {
+        case XMATRIXEXPR_OP_INPUT:
+        case XMATRIXEXPR_OP_CONSTANT:
+            return 0;
+        case XMATRIXEXPR_OP_NEG:
+        case XMATRIXEXPR_OP_ABS:
+        case XMATRIXEXPR_OP_MAP:
+            return 1;
+        default:
+            return 2;
+    }
+}
+
+/**
+ * @brief
+ * Evaluate all needed nodes for strip of row and store root strip into result.
+ *
+ * @param plan Evaluation plan.
+ * @param scratch Scratch strips, indexed by slots of plan.
+ * @param values Receives pointers to strip of each node.
+ * @param row Row of result.
+ * @param col First column of strip.
+ * @param width Number of elements in strip.
+ */
+static void xMatrixExpr_evalStrip(const xMatrixExprPlan *plan, float (*scratch)[XMATRIXEXPR_STRIP], const float **values,
+                                  xSize row, xSize col, xSize width)
+{
+    const xMatrixExprNode *nodes = plan->expr->nodes;
+    for (xSize n = 0; n <= plan->root; n++) {
+        if (!plan->needed[n]) {
+            continue;
+        }
+
+        const xMatrixExprNode *node = &nodes[n];
+        float *out = (plan->slot[n] != XMATRIXEXPR_NO_SLOT) ? scratch[plan->slot[n]] : NULL;
+        const float *a = (xMatrixExpr_operandCount(node) > 0) ? values[node->lhs] : NULL;
+        const float *b = (xMatrixExpr_operandCount(node) > 1) ? values[node->rhs] : NULL;
+        switch (node->op) {
+            case XMATRIXEXPR_OP_INPUT: {
+                const float *source = node->view.data + row * node->view.rowStride + col * node->view.colStride;
+                if (!out) {
+                    // contiguous rows are read in place
+                    values[n] = source;
+                    continue;
+                }
+                for (xSize j = 0; j < width; j++) {
+                    out[j] = source[j * node->view.colStride];
+                }
+                break;
+            }
+            case XMATRIXEXPR_OP_CONSTANT:
+                // constant strips are filled once per row block
+                continue;
+            case XMATRIXEXPR_OP_ADD:
+                for (xSize j = 0; j < width; j++) {
+                    out[j] = a[j] + b[j];
+                }
+                break;
+            case XMATRIXEXPR_OP_SUB:
+                for (xSize j = 0; j < width; j++) {
+                    out[j] = a[j] - b[j];
+                }
+                break;
+            case XMATRIXEXPR_OP_MUL:
+                for (xSize j = 0; j < width; j++) {
+                    out[j] = a[j] * b[j];
+                }
+                break;
+            case XMATRIXEXPR_OP_DIV:
+                for (xSize j = 0; j < width; j++) {
+                    out[j] = a[j] / b[j];
+                }
+                break;
+            case XMATRIXEXPR_OP_MIN:
+                for (xSize j = 0; j < width; j++) {
+                    out[j] = (b[j] < a[j]) ? b[j] : a[j];
+                }
+                break;
+            case XMATRIXEXPR_OP_MAX:
+                for (xSize j = 0; j < width; j++) {
+                    out[j] = (b[j] > a[j]) ? b[j] : a[j];
+                }
+                break;
+            case XMATRIXEXPR_OP_NEG:
+                for (xSize j = 0; j < width; j++) {
+                    out[j] = -a[j];
+                }
+                break;
+            case XMATRIXEXPR_OP_ABS:
+                for (xSize j = 0; j < width; j++) {
+                    out[j] = (a[j] < 0.0f) ? -a[j] : a[j];
+                }
+                break;
+            case XMATRIXEXPR_OP_MAP:
+                for (xSize j = 0; j < width; j++) {
+                    out[j] = node->unary(a[j]);
+                }
+                break;
+            case XMATRIXEXPR_OP_MAP2:
+                for (xSize j = 0; j < width; j++) {
+                    out[j] = node->binary(a[j], b[j]);
+                }
+                break;
+        }
+        values[n] = out;
+    }
+
+    // store strip of root into result
+    const float *result = values[plan->root];
+    float *dest = plan->res.data + row * plan->res.rowStride + col * plan->res.colStride;
+    for (xSize j = 0; j < width; j++) {
+        dest[j * plan->res.colStride] = result[j];
+    }
+}
+
+/**
+ * @brief
+ * Evaluate rows [begin, end) of result (range function for xThreadPool).
+ */
+static void xMatrixExpr_evalRows(void *context, xSize begin, xSize end)
+{
+    const xMatrixExprPlan *plan = (const xMatrixExprPlan *)context;
+    float scratch[XMATRIXEXPR_MAX_NODES][XMATRIXEXPR_STRIP];
+    const float *values[XMATRIXEXPR_MAX_NODES];
+
+    // constant nodes keep their strips for whole row block
+    for (xSize n = 0; n <= plan->root; n++) {
+        if (plan->needed[n] && plan->expr->nodes[n].op == XMATRIXEXPR_OP_CONSTANT) {
+            for (xSize j = 0; j < XMATRIXEXPR_STRIP; j++) {
+                scratch[plan->slot[n]][j] = plan->expr->nodes[n].value;
+            }
+            values[n] = scratch[plan->slot[n]];
+        }
+    }
+
+    for (xSize row = begin; row < end; row++) {
+        for (xSize col = 0; col < plan->res.cols; col += XMATRIXEXPR_STRIP) {
+            xSize width = (plan->res.cols - col < XMATRIXEXPR_STRIP) ? plan->res.cols - col : XMATRIXEXPR_STRIP;
+            xMatrixExpr_evalStrip(plan, scratch, values, row, col, width);
+        }
+    }
+}
+
+xBool xMatrixExpr_eval(const xMatrixExpr *expr, xSize node, xMatrixView res)
+{
+    // validate arguments
+    if (!expr || node >= expr->count || !xMatrixView_isValid(res)) {
+        return false;
+    }
+
+    xMatrixExprPlan plan;
+    plan.expr = expr;
+    plan.root = node;
+    plan.res = res;
+
+    // mark nodes root depends on (operands always precede their users, so one backward pass is enough)
+    xSize lastUse[XMATRIXEXPR_MAX_NODES];
+    for (xSize n = 0; n <= node; n++) {
+        plan.needed[n] = (n == node);
+        lastUse[n] = node;
+    }
+    for (xSize n = node + 1; n-- > 0;) {
+        const xMatrixExprNode *current = &expr->nodes[n];
+        if (!plan.needed[n]) {
+            continue;
+        }
+        if (current->op == XMATRIXEXPR_OP_INPUT &&
+            (current->view.rows != res.rows || current->view.cols != res.cols)) {
+            return false;
+        }
+        xSize operands = xMatrixExpr_operandCount(current);
+        if (operands > 0 && !plan.needed[current->lhs]) {
+            plan.needed[current->lhs] = true;
+            lastUse[current->lhs] = n;
+        }
+        if (operands > 1 && !plan.needed[current->rhs]) {
+            plan.needed[current->rhs] = true;
+            lastUse[current->rhs] = n;
+        }
+    }
+
+    // assign scratch strips, reusing strips of operands at their last use (operations are element by element, so result
+    // may overwrite its operand); contiguous inputs are read in place and constants keep their strips
+    xBool inUse[XMATRIXEXPR_MAX_NODES] = {false};
+    for (xSize n = 0; n <= node; n++) {
+        const xMatrixExprNode *current = &expr->nodes[n];
+        plan.slot[n] = XMATRIXEXPR_NO_SLOT;
+        if (!plan.needed[n]) {
+            continue;
+        }
+
+        xSize operands = xMatrixExpr_operandCount(current);
+        if (operands > 0 && lastUse[current->lhs] == n && plan.slot[current->lhs] != XMATRIXEXPR_NO_SLOT &&
+            expr->nodes[current->lhs].op != XMATRIXEXPR_OP_CONSTANT) {
+            inUse[plan.slot[current->lhs]] = false;
+        }
+        if (operands > 1 && lastUse[current->rhs] == n && plan.slot[current->rhs] != XMATRIXEXPR_NO_SLOT &&
+            expr->nodes[current->rhs].op != XMATRIXEXPR_OP_CONSTANT) {
+            inUse[plan.slot[current->rhs]] = false;
+        }
+        if (current->op == XMATRIXEXPR_OP_INPUT && (current->view.colStride == 1 || current->view.cols == 1)) {
+            continue;
+        }
+
+        xUInt8 slot = 0;
+        while (inUse[slot]) {
+            slot++;
+        }
+        inUse[slot] = true;
+        plan.slot[n] = slot;
+    }
+
+    if (res.rows * res.cols < XMATRIXEXPR_PARALLEL_THRESHOLD) {
+        xMatrixExpr_evalRows(&plan, 0, res.rows);
+        return true;
+    }
+
+    xSize grain = (XMATRIXEXPR_PARALLEL_GRAIN + res.cols - 1) / res.cols;
+    return xThreadPool_parallelFor(xThreadPool_getShared(), res.rows, grain, xMatrixExpr_evalRows, &plan);
+}
@@ -0,0 +1,47 @@
+/**
+ * @file xMatrixLayout.h
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief Memory layout rules shared by matrix modules (internal header).
+ * @version 0.1
+ * @date 18.10.2026.
+ *
+ * Header is private to xLinear sources. It keeps row padding and transpose tiling of xMatrix and typed matrices of
+ * xMatrixTyped in one place, so that matrices of every element type lay out their rows by the same rules.
+ */
+
+#ifndef XLINEAR_MATRIXLAYOUT_H
+#define XLINEAR_MATRIXLAYOUT_H
+
+#include "xBase/xTypes.h"
+#include "xLinear/xMatrix.h"  // XMATRIX_ALIGNMENT
+
+// row pitches which are multiple of this many bytes get one extra aligned block, so that elements of same column do not map
+// to same cache sets and loads do not falsely depend on stores to other rows (4K aliasing)
+#define XMATRIX_ALIASING_PERIOD 1024
+
+// side of square tiles in which matrices are transposed
+#define XMATRIX_TRANSPOSE_TILE 32
+
+/**
+ * @brief
+ * Get leading dimension of matrix rows with given number of elements of given size.
+ *
+ * @note
+ * Rows at least one aligned block wide are padded to whole aligned blocks (narrower rows stay packed, so vectors and small
+ * matrices do not waste most of their memory on padding).
+ */
+static inline xSize xMatrix_strideFor(xSize cols, xSize elementSize)
+{
+    xSize block = XMATRIX_ALIGNMENT / elementSize;
+    if (cols < block) {
+        return cols;
+    }
+
+    xSize stride = (cols + block - 1) / block * block;
+    if ((stride * elementSize) % XMATRIX_ALIASING_PERIOD == 0) {
+        stride += block;
+    }
+    return stride;
+}
+
+#endif  // XLINEAR_MATRIXLAYOUT_H
@@ -0,0 +1,348 @@
+#include "xLinear/xMatrixTyped.h"
+#include <stdint.h>  // uintptr_t
+#include <stdlib.h>  // malloc (for flattened arrays returned to caller)
+#include "xBase/xMemtools.h"
+#include "xBase/xTypes.h"
+#include "xLinear/xGemm.h"
+#include "xMemory/xAllocator.h"
+#include "xMatrixLayout.h"
+
+/*
+ * Matrix structure `Name` is described by:
+ *  - T:        type of elements
+ *  - calc:     type of element-wise arithmetic (unsigned or promoted for integers, so overflow wraps around)
+ *  - Product:  matrix structure of product
+ *  - ProductT: type of elements of product
+ *  - gemm:     xGemm routine computing product
+ */
+
+/**
+ * @brief
+ * Define all functions declared by XMATRIX_DECLARE_TYPED for matrix structure `Name`.
+ */
+#define XMATRIX_DEFINE_TYPED(Name, T, calc, Product, ProductT, gemm)                                                        \
+    struct Name##_s {                                                                                                       \
+        T *data;                     /* first element of first row (aligned to XMATRIX_ALIGNMENT) */                        \
+        xSize rows;                  /* number of rows */                                                                   \
+        xSize cols;                  /* number of columns */                                                                \
+        xSize stride;                /* distance between rows in elements (leading dimension) */                            \
+        const xAllocator *allocator; /* allocator owning matrix memory */                                                   \
+    };                                                                                                                      \
+                                                                                                                            \
+    Name *Name##_new(xSize rows, xSize cols) { return Name##_newWithAllocator(rows, cols, NULL); }                          \
+                                                                                                                            \
+    Name *Name##_newWithAllocator(xSize rows, xSize cols, const xAllocator *allocator)                                      \
+    {                                                                                                                       \
+        /* validate arguments */                                                                                            \
+        if (!rows || !cols) {                                                                                               \
+            return NULL;                                                                                                    \
+        }                                                                                                                   \
+                                                                                                                            \
+        /* create matrix object and allocate memory for aligned data following it */                                        \
+        allocator = allocator ? allocator : xAllocator_getDefault();                                                        \
+        xSize stride = xMatrix_strideFor(cols, sizeof(T));                                                                  \
+        Name *mat = (Name *)xAllocator_alloc(allocator, sizeof(Name) + XMATRIX_ALIGNMENT - 1 + rows * stride * sizeof(T));  \
+        if (!mat) {                                                                                                         \
+            return NULL;                                                                                                    \
+        }                                                                                                                   \
+                                                                                                                            \
+        uintptr_t address = ((uintptr_t)(mat + 1) + XMATRIX_ALIGNMENT - 1) & ~(uintptr_t)(XMATRIX_ALIGNMENT - 1);           \
+        mat->data = (T *)address;                                                                                           \
+        mat->rows = rows;                                                                                                   \
+        mat->cols = cols;                                                                                                   \
+        mat->stride = stride;                                                                                               \
+        mat->allocator = allocator;                                                                                         \
+                                                                                                                            \
+        /* zero-initialize matrix data (including padding) */                                                               \
+        xMemSet(mat->data, 0, rows * stride * sizeof(T));                                                                   \
+                                                                                                                            \
+        return mat;                                                                                                         \
+    }                                                                                                                       \
+                                                                                                                            \
+    void Name##_free(Name *matrix)                                                                                          \
+    {                                                                                                                       \
+        /* validate arguments */                                                                                            \
+        if (!matrix) {                                                                                                      \
+            return;                                                                                                         \
+        }                                                                                                                   \
+                                                                                                                            \
+        /* set matrix attributes to zero (invalidate matrix) */                                                             \
+        xSize size = sizeof(Name) + XMATRIX_ALIGNMENT - 1 + matrix->rows * matrix->stride * sizeof(T);                      \
+        matrix->data = NULL;                                                                                                \
+        matrix->rows = 0;                                                                                                   \
+        matrix->cols = 0;                                                                                                   \
+                                                                                                                            \
+        xAllocator_free(matrix->allocator, matrix, size);                                                                   \
+    }                                                                                                                       \
+                                                                                                                            \
+    inline xSize Name##_getRows(const Name *matrix) { return (matrix) ? matrix->rows : 0; }                                 \
+                                                                                                                            \
+    inline xSize Name##_getCols(const Name *matrix) { return (matrix) ? matrix->cols : 0; }                                 \
+                                                                                                                            \
+    inline xSize Name##_getStride(const Name *matrix) { return (matrix) ? matrix->stride : 0; }                             \
+                                                                                                                            \
+    inline xBool Name##_isValid(const Name *matrix) { return (matrix) ? matrix->data && matrix->rows && matrix->cols : 0; } \
+                                                                                                                            \
+    inline void Name##_set(Name *matrix, xSize row, xSize col, T value)                                                     \
+    {                                                                                                                       \
+        /* validate arguments */                                                                                            \
+        if (!Name##_isValid(matrix) || row >= matrix->rows || col >= matrix->cols) {                                        \
+            return;                                                                                                         \
+        }                                                                                                                   \
+                                                                                                                            \
+        matrix->data[row * matrix->stride + col] = value;                                                                   \
+    }                                                                                                                       \
+                                                                                                                            \
+    inline T Name##_get(const Name *matrix, xSize row, xSize col)                                                           \
+    {                                                                                                                       \
+        /* validate arguments */                                                                                            \
+        if (!Name##_isValid(matrix) || row >= matrix->rows || col >= matrix->cols) {                                        \
+            return (T)0;                                                                                                    \
+        }                                                                                                                   \
+                                                                                                                            \
+        return matrix->data[row * matrix->stride + col];                                                                    \
+    }                                                                                                                       \
+                                                                                                                            \
+    Name *Name##_duplicate(const Name *matrix)                                                                              \
+    {                                                                                                                       \
+        /* validate arguments */                                                                                            \
+        if (!Name##_isValid(matrix)) {                                                                                      \
+            return NULL;                                                                                                    \
+        }                                                                                                                   \
+                                                                                                                            \
+        Name *mat = Name##_newWithAllocator(matrix->rows, matrix->cols, matrix->allocator);                                 \
+        if (!Name##_isValid(mat)) {                                                                                         \
+            return NULL;                                                                                                    \
+        }                                                                                                                   \
+                                                                                                                            \
+        xMemCopy(mat->data, matrix->data, matrix->rows * matrix->stride * sizeof(T));                                       \
+        return mat;                                                                                                         \
+    }                                                                                                                       \
+                                                                                                                            \
+    void Name##_fill(Name *matrix, T value)                                                                                 \
+    {                                                                                                                       \
+        /* validate arguments */                                                                                            \
+        if (!Name##_isValid(matrix)) {                                                                                      \
+            return;                                                                                                         \
+        }                                                                                                                   \
+                                                                                                                            \
+        for (xSize i = 0; i < matrix->rows; i++) {                                                                          \
+            for (xSize j = 0; j < matrix->cols; j++) {                                                                      \
+                matrix->data[i * matrix->stride + j] = value;                                                               \
+            }                                                                                                               \
+        }                                                                                                                   \
+    }                                                                                                                       \
+                                                                                                                            \
+    Name *Name##_transpose(const Name *matrix)                                                                              \
+    {                                                                                                                       \
+        /* validate arguments */                                                                                            \
+        if (!Name##_isValid(matrix)) {                                                                                      \
+            return NULL;                                                                                                    \
+        }                                                                                                                   \
+                                                                                                                            \
+        Name *mat = Name##_newWithAllocator(matrix->cols, matrix->rows, matrix->allocator);                                 \
+        if (!Name##_isValid(mat)) {                                                                                         \
+            return NULL;                                                                                                    \
+        }                                                                                                                   \
+                                                                                                                            \
+        /* copy tile by tile, so both source and result stay in cache */                                                    \
+        xSize rows = matrix->rows, cols = matrix->cols;                                                                     \
+        for (xSize i0 = 0; i0 < rows; i0 += XMATRIX_TRANSPOSE_TILE) {                                                       \
+            xSize i1 = (rows - i0 < XMATRIX_TRANSPOSE_TILE) ? rows : i0 + XMATRIX_TRANSPOSE_TILE;                           \
+            for (xSize j0 = 0; j0 < cols; j0 += XMATRIX_TRANSPOSE_TILE) {                                                   \
+                xSize j1 = (cols - j0 < XMATRIX_TRANSPOSE_TILE) ? cols : j0 + XMATRIX_TRANSPOSE_TILE;                       \
+                for (xSize i = i0; i < i1; i++) {                                                                           \
+                    for (xSize j = j0; j < j1; j++) {                                                                       \
+                        mat->data[j * mat->stride + i] = matrix->data[i * matrix->stride + j];                              \
+                    }                                                                                                       \
+                }                                                                                                           \
+            }                                                                                                               \
+        }                                                                                                                   \
+                                                                                                                            \
+        return mat;                                                                                                         \
+    }                                                                                                                       \
+                                                                                                                            \
+    /* check that all three matrices are valid and have same dimensions */                                                  \
+    static inline xBool Name##_sameShape(const Name *res, const Name *lhs, const Name *rhs)                                 \
+    {                                                                                                                       \
+        return Name##_isValid(res) && Name##_isValid(lhs) && Name##_isValid(rhs) && res->rows == lhs->rows &&               \
+               lhs->rows == rhs->rows && res->cols == lhs->cols && lhs->cols == rhs->cols;                                  \
+    }                                                                                                                       \
+                                                                                                                            \
+    Name *Name##_add_inplace(Name *res, const Name *lhs, const Name *rhs)                                                   \
+    {                                                                                                                       \
+        /* validate arguments */                                                                                            \
+        if (!Name##_sameShape(res, lhs, rhs)) {                                                                             \
+            return NULL;                                                                                                    \
+        }                                                                                                                   \
+                                                                                                                            \
+        /* matrices of same shape have same leading dimension, so padding is processed along with rows */                   \
+        for (xSize i = 0; i < res->rows * res->stride; i++) {                                                               \
+            res->data[i] = (T)((calc)lhs->data[i] + (calc)rhs->data[i]);                                                    \
+        }                                                                                                                   \
+        return res;                                                                                                         \
+    }                                                                                                                       \
+                                                                                                                            \
+    Name *Name##_sub_inplace(Name *res, const Name *lhs, const Name *rhs)                                                   \
+    {                                                                                                                       \
+        /* validate arguments */                                                                                            \
+        if (!Name##_sameShape(res, lhs, rhs)) {                                                                             \
+            return NULL;                                                                                                    \
+        }                                                                                                                   \
+                                                                                                                            \
+        /* matrices of same shape have same leading dimension, so padding is processed along with rows */                   \
+        for (xSize i = 0; i < res->rows * res->stride; i++) {                                                               \
+            res->data[i] = (T)((calc)lhs->data[i] - (calc)rhs->data[i]);                                                    \
+        }                                                                                                                   \
+        return res;                                                                                                         \
+    }                                                                                                                       \
+                                                                                                                            \
+    Name *Name##_dotmul_inplace(Name *res, const Name *lhs, const Name *rhs)                                                \
+    {                                                                                                                       \
+        /* validate arguments */                                                                                            \
+        if (!Name##_sameShape(res, lhs, rhs)) {                                                                             \
+            return NULL;                                                                                                    \
+        }                                                                                                                   \
+                                                                                                                            \
+        /* matrices of same shape have same leading dimension, so padding is processed along with rows */                   \
+        for (xSize i = 0; i < res->rows * res->stride; i++) {                                                               \
+            res->data[i] = (T)((calc)lhs->data[i] * (calc)rhs->data[i]);                                                    \
+        }                                                                                                                   \
+        return res;                                                                                                         \
+    }                                                                                                                       \
+                                                                                                                            \
+    Name *Name##_scalarMul_inplace(Name *res, const Name *matrix, T scalar)                                                 \
+    {                                                                                                                       \
+        /* validate arguments */                                                                                            \
+        if (!Name##_sameShape(res, matrix, matrix)) {                                                                       \
+            return NULL;                                                                                                    \
+        }                                                                                                                   \
+                                                                                                                            \
+        /* matrices of same shape have same leading dimension, so padding is processed along with rows */                   \
+        for (xSize i = 0; i < res->rows * res->stride; i++) {                                                               \
+            res->data[i] = (T)((calc)matrix->data[i] * (calc)scalar);                                                       \
+        }                                                                                                                   \
+        return res;                                                                                                         \
+    }                                                                                                                       \
+                                                                                                                            \
+    Name *Name##_add(const Name *lhs, const Name *rhs)                                                                      \
+    {                                                                                                                       \
+        Name *mat = Name##_isValid(lhs) ? Name##_newWithAllocator(lhs->rows, lhs->cols, lhs->allocator) : NULL;             \
+        if (!Name##_add_inplace(mat, lhs, rhs)) {                                                                           \
+            Name##_free(mat);                                                                                               \
+            return NULL;                                                                                                    \
+        }                                                                                                                   \
+        return mat;                                                                                                         \
+    }                                                                                                                       \
+                                                                                                                            \
+    Name *Name##_sub(const Name *lhs, const Name *rhs)                                                                      \
+    {                                                                                                                       \
+        Name *mat = Name##_isValid(lhs) ? Name##_newWithAllocator(lhs->rows, lhs->cols, lhs->allocator) : NULL;             \
+        if (!Name##_sub_inplace(mat, lhs, rhs)) {                                                                           \
+            Name##_free(mat);                                                                                               \
+            return NULL;                                                                                                    \
+        }                                                                                                                   \
+        return mat;                                                                                                         \
+    }                                                                                                                       \
+                                                                                                                            \
+    Name *Name##_dotmul(const Name *lhs, const Name *rhs)                                                                   \
+    {                                                                                                                       \
+        Name *mat = Name##_isValid(lhs) ? Name##_newWithAllocator(lhs->rows, lhs->cols, lhs->allocator) : NULL;             \
+        if (!Name##_dotmul_inplace(mat, lhs, rhs)) {                                                                        \
+            Name##_free(mat);                                                                                               \
+            return NULL;                                                                                                    \
+        }                                                                                                                   \
+        return mat;                                                                                                         \
+    }                                                                                                                       \
+                                                                                                                            \
+    Name *Name##_scalarMul(const Name *matrix, T scalar)                                                                    \
+    {                                                                                                                       \
+        Name *mat = Name##_isValid(matrix) ? Name##_newWithAllocator(matrix->rows, matrix->cols, matrix->allocator) : NULL; \
+        if (!Name##_scalarMul_inplace(mat, matrix, scalar)) {                                                               \
+            Name##_free(mat);                                                                                               \
+            return NULL;                                                                                                    \
+        }                                                                                                                   \
+        return mat;                                                                                                         \
+    }                                                                                                                       \
+                                                                                                                            \
+    Product *Name##_mul_inplace(Product *res, const Name *lhs, const Name *rhs)                                             \
+    {                                                                                                                       \
+        /* validate arguments */                                                                                            \
+        if (!Product##_isValid(res) || !Name##_isValid(lhs) || !Name##_isValid(rhs) || res->rows != lhs->rows ||            \
+            res->cols != rhs->cols || lhs->cols != rhs->rows) {                                                             \
+            return NULL;                                                                                                    \
+        }                                                                                                                   \
+                                                                                                                            \
+        /* result aliasing operand is computed into temporary array first */                                                \
+        xSize size = res->rows * res->stride * sizeof(ProductT);                                                            \
+        xBool aliased = (const void *)res == (const void *)lhs || (const void *)res == (const void *)rhs;                   \
+        ProductT *dest = aliased ? (ProductT *)xAllocator_alloc(NULL, size) : res->data;                                    \
+        if (!dest) {                                                                                                        \
+            return NULL;                                                                                                    \
+        }                                                                                                                   \
+                                                                                                                            \
+        xBool ok = gemm(lhs->rows, rhs->cols, lhs->cols, (ProductT)1, lhs->data, lhs->stride, rhs->data, rhs->stride,       \
+                        (ProductT)0, dest, res->stride);                                                                    \
+        if (aliased) {                                                                                                      \
+            if (ok) {                                                                                                       \
+                xMemCopy(res->data, dest, size);                                                                            \
+            }                                                                                                               \
+            xAllocator_free(NULL, dest, size);                                                                              \
+        }                                                                                                                   \
+        return ok ? res : NULL;                                                                                             \
+    }                                                                                                                       \
+                                                                                                                            \
+    Product *Name##_mul(const Name *lhs, const Name *rhs)                                                                   \
+    {                                                                                                                       \
+        /* validate arguments */                                                                                            \
+        if (!Name##_isValid(lhs) || !Name##_isValid(rhs) || lhs->cols != rhs->rows) {                                       \
+            return NULL;                                                                                                    \
+        }                                                                                                                   \
+                                                                                                                            \
+        Product *mat = Product##_newWithAllocator(lhs->rows, rhs->cols, lhs->allocator);                                    \
+        if (!Name##_mul_inplace(mat, lhs, rhs)) {                                                                           \
+            Product##_free(mat);                                                                                            \
+            return NULL;                                                                                                    \
+        }                                                                                                                   \
+        return mat;                                                                                                         \
+    }                                                                                                                       \
+                                                                                                                            \
+    T *Name##_flatten(const Name *matrix)                                                                                   \
+    {                                                                                                                       \
+        /* validate arguments */                                                                                            \
+        if (!Name##_isValid(matrix)) {                                                                                      \
+            return NULL;                                                                                                    \
+        }                                                                                                                   \
+                                                                                                                            \
+        T *arr = (T *)malloc(matrix->rows * matrix->cols * sizeof(T));                                                      \
+        if (!arr) {                                                                                                         \
+            return NULL;                                                                                                    \
+        }                                                                                                                   \
+                                                                                                                            \
+        for (xSize i = 0; i < matrix->rows; i++) {                                                                          \
+            xMemCopy(arr + i * matrix->cols, matrix->data + i * matrix->stride, matrix->cols * sizeof(T));                  \
+        }                                                                                                                   \
+        return arr;                                                                                                         \
+    }                                                                                                                       \
+                                                                                                                            \
+    Name *Name##_unflatten(const T *arr, xSize rows, xSize cols)                                                            \
+    {                                                                                                                       \
+        /* validate arguments */                                                                                            \
+        if (!arr || !rows || !cols) {                                                                                       \
+            return NULL;                                                                                                    \
+        }                                                                                                                   \
+                                                                                                                            \
+        Name *mat = Name##_new(rows, cols);                                                                                 \
+        if (!Name##_isValid(mat)) {                                                                                         \
+            return NULL;                                                                                                    \
+        }                                                                                                                   \
+                                                                                                                            \
+        for (xSize i = 0; i < rows; i++) {                                                                                  \
+            xMemCopy(mat->data + i * mat->stride, arr + i * cols, cols * sizeof(T));                                        \
+        }                                                                                                                   \
+        return mat;                                                                                                         \
+    }
+
+XMATRIX_DEFINE_TYPED(xMatrixF64, xFloat64, xFloat64, xMatrixF64, xFloat64, xGemm_dgemm)
+XMATRIX_DEFINE_TYPED(xMatrixI32, xInt32, xUInt32, xMatrixI32, xInt32, xGemm_i32gemm)
+XMATRIX_DEFINE_TYPED(xMatrixI8, xInt8, xInt32, xMatrixI32, xInt32, xGemm_i8gemm)
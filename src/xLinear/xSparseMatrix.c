@@ -0,0 +1,573 @@
+#include "xLinear/xSparseMatrix.h"
+
+#include "xBase/xMemtools.h"
+#include "xBase/xTypes.h"
+#include "xLinear/xMatrix.h"
+#include "xMemory/xAllocator.h"
+#include "xThread/xThreadPool.h"
+
+// products with at least this many multiply-adds are computed by shared thread pool
+#define XSPARSEMATRIX_PARALLEL_THRESHOLD (1 << 16)
+
+// approximate number of multiply-adds in single part of parallel product
+#define XSPARSEMATRIX_PARALLEL_GRAIN (1 << 14)
+
+// number of result columns in single strip of product of CSC matrix
+#define XSPARSEMATRIX_STRIP 64
+
+struct xSparseMatrix_s {
+    xSize rows;                  // number of rows
+    xSize cols;                  // number of columns
+    xSize nnz;                   // number of stored elements
+    xSparseMatrixFormat format;  // grouping of elements (by rows or by columns)
+    xSize *pointers;             // start of each compressed row (column) in indices and values, followed by nnz
+    xSize *indices;              // column (CSR) or row (CSC) of each stored element
+    float *values;               // value of each stored element
+};
+
+// parallel product task (vector product is product with single column)
+typedef struct xSparseMatrixTask_s {
+    const xSparseMatrix *lhs;  // sparse operand
+    const float *b;            // dense operand
+    xSize ldb;                 // distance between rows of dense operand
+    float *c;                  // result
+    xSize ldc;                 // distance between rows of result
+    xSize width;               // number of columns of dense operand and result
+    xSize parts;               // number of parts product is split into
+    const xSize *rowStarts;    // start of each row among stored elements, followed by nnz (CSC matrix split by rows)
+} xSparseMatrixTask;
+
+// number of compressed rows (columns) of matrix with given format and dimensions
+static inline xSize xSparseMatrix_outerSize(xSparseMatrixFormat format, xSize rows, xSize cols)
+{
+    return (format == XSPARSEMATRIX_CSR) ? rows : cols;
+}
+
+static inline xSize xSparseMatrix_allocSize(xSize outer, xSize nnz)
+{
+    return sizeof(xSparseMatrix) + (outer + 1 + nnz) * sizeof(xSize) + nnz * sizeof(float);
+}
+
+// allocate matrix with arrays stored right after structure (pointers are left uninitialized)
+static xSparseMatrix *xSparseMatrix_alloc(xSize rows, xSize cols, xSize nnz, xSparseMatrixFormat format)
+{
+    xSize outer = xSparseMatrix_outerSize(format, rows, cols);
+    xSparseMatrix *mat = (xSparseMatrix *)xAllocator_alloc(NULL, xSparseMatrix_allocSize(outer, nnz));
+    if (!mat) {
+        return NULL;
+    }
+
+    mat->rows = rows;
+    mat->cols = cols;
+    mat->nnz = nnz;
+    mat->format = format;
+    mat->pointers = (xSize *)(mat + 1);
+    mat->indices = mat->pointers + outer + 1;
+    mat->values = (float *)(mat->indices + nnz);
+
+    return mat;
+}
+
+xSparseMatrix *xSparseMatrix_newFromCOO(xSize rows, xSize cols, xSize count, const xSize *rowIndices, const xSize *colIndices,
+                                        const float *values, xSparseMatrixFormat format)
+{
+    // validate arguments
+    if (!rows || !cols || (count && (!rowIndices || !colIndices || !values))) {
+        return NULL;
+    }
+    for (xSize k = 0; k < count; k++) {
+        if (rowIndices[k] >= rows || colIndices[k] >= cols) {
+            return NULL;
+        }
+    }
+
+    const xSize *outerIndices = (format == XSPARSEMATRIX_CSR) ? rowIndices : colIndices;
+    const xSize *innerIndices = (format == XSPARSEMATRIX_CSR) ? colIndices : rowIndices;
+    xSize outer = xSparseMatrix_outerSize(format, rows, cols);
+    xSize inner = (format == XSPARSEMATRIX_CSR) ? cols : rows;
+    xSize buckets = ((outer > inner) ? outer : inner) + 1;
+
+    // scratch holds bucket counters and two permutations of triplets
+    xSize scratchSize = (buckets + 2 * count) * sizeof(xSize);
+    xSize *counts = (xSize *)xAllocator_alloc(NULL, scratchSize);
+    if (!counts) {
+        return NULL;
+    }
+    xSize *byInner = counts + buckets;
+    xSize *sorted = byInner + count;
+
+    // sort triplets by inner index, then stably by outer index (two passes of counting sort)
+    xMemSet(counts, 0, (inner + 1) * sizeof(xSize));
+    for (xSize k = 0; k < count; k++) {
+        counts[innerIndices[k] + 1]++;
+    }
+    for (xSize i = 0; i < inner; i++) {
+        counts[i + 1] += counts[i];
+    }
+    for (xSize k = 0; k < count; k++) {
+        byInner[counts[innerIndices[k]]++] = k;
+    }
+    xMemSet(counts, 0, (outer + 1) * sizeof(xSize));
+    for (xSize k = 0; k < count; k++) {
+        counts[outerIndices[k] + 1]++;
+    }
+    for (xSize i = 0; i < outer; i++) {
+        counts[i + 1] += counts[i];
+    }
+    for (xSize k = 0; k < count; k++) {
+        xSize t = byInner[k];
+        sorted[counts[outerIndices[t]]++] = t;
+    }
+
+    // count distinct coordinates, which are now adjacent
+    xSize nnz = 0;
+    for (xSize k = 0; k < count; k++) {
+        xSize t = sorted[k];
+        if (k == 0 || outerIndices[t] != outerIndices[sorted[k - 1]] || innerIndices[t] != innerIndices[sorted[k - 1]]) {
+            nnz++;
+        }
+    }
+
+    // store elements, summing values of duplicate triplets
+    xSparseMatrix *mat = xSparseMatrix_alloc(rows, cols, nnz, format);
+    if (mat) {
+        xMemSet(mat->pointers, 0, (outer + 1) * sizeof(xSize));
+        xSize pos = 0;
+        for (xSize k = 0; k < count; k++) {
+            xSize t = sorted[k];
+            if (pos > 0 && outerIndices[t] == outerIndices[sorted[k - 1]] && innerIndices[t] == mat->indices[pos - 1]) {
+                mat->values[pos - 1] += values[t];
+                continue;
+            }
+            mat->pointers[outerIndices[t] + 1]++;
+            mat->indices[pos] = innerIndices[t];
+            mat->values[pos++] = values[t];
+        }
+        for (xSize i = 0; i < outer; i++) {
+            mat->pointers[i + 1] += mat->pointers[i];
+        }
+    }
+
+    xAllocator_free(NULL, counts, scratchSize);
+    return mat;
+}
+
+xSparseMatrix *xSparseMatrix_newFromCompressed(xSize rows, xSize cols, const xSize *pointers, const xSize *indices,
+                                               const float *values, xSparseMatrixFormat format)
+{
+    // validate arguments
+    xSize outer = xSparseMatrix_outerSize(format, rows, cols);
+    xSize inner = (format == XSPARSEMATRIX_CSR) ? cols : rows;
+    if (!rows || !cols || !pointers || pointers[0] != 0) {
+        return NULL;
+    }
+    xSize nnz = pointers[outer];
+    if (nnz && (!indices || !values)) {
+        return NULL;
+    }
+    for (xSize i = 0; i < outer; i++) {
+        if (pointers[i] > pointers[i + 1]) {
+            return NULL;
+        }
+        for (xSize k = pointers[i]; k < pointers[i + 1]; k++) {
+            if (indices[k] >= inner || (k > pointers[i] && indices[k] <= indices[k - 1])) {
+                return NULL;
+            }
+        }
+    }
+
+    // copy arrays
+    xSparseMatrix *mat = xSparseMatrix_alloc(rows, cols, nnz, format);
+    if (!mat) {
+        return NULL;
+    }
+    xMemCopy(mat->pointers, pointers, (outer + 1) * sizeof(xSize));
+    if (nnz) {
+        xMemCopy(mat->indices, indices, nnz * sizeof(xSize));
+        xMemCopy(mat->values, values, nnz * sizeof(float));
+    }
+
+    return mat;
+}
+
+xSparseMatrix *xSparseMatrix_newFromDense(const xMatrix *matrix, xSparseMatrixFormat format)
+{
+    // validate arguments
+    if (!xMatrix_isValid(matrix)) {
+        return NULL;
+    }
+
+    // count non-zero elements
+    xMatrixView view = xMatrix_view(matrix);
+    xSize nnz = 0;
+    for (xSize i = 0; i < view.rows; i++) {
+        for (xSize j = 0; j < view.cols; j++) {
+            nnz += (view.data[i * view.rowStride + j] != 0.0f);
+        }
+    }
+
+    xSparseMatrix *mat = xSparseMatrix_alloc(view.rows, view.cols, nnz, format);
+    if (!mat) {
+        return NULL;
+    }
+
+    // collect non-zero elements row by row (column by column), reading transposed view for CSC
+    if (format == XSPARSEMATRIX_CSC) {
+        view = xMatrixView_transpose(view);
+    }
+    xSize pos = 0;
+    for (xSize i = 0; i < view.rows; i++) {
+        mat->pointers[i] = pos;
+        for (xSize j = 0; j < view.cols; j++) {
+            float value = xMatrixView_get(view, i, j);
+            if (value != 0.0f) {
+                mat->indices[pos] = j;
+                mat->values[pos++] = value;
+            }
+        }
+    }
+    mat->pointers[view.rows] = pos;
+
+    return mat;
+}
+
+void xSparseMatrix_free(xSparseMatrix *matrix)
+{
+    if (!matrix) {
+        return;
+    }
+
+    xSize outer = xSparseMatrix_outerSize(matrix->format, matrix->rows, matrix->cols);
+    xAllocator_free(NULL, matrix, xSparseMatrix_allocSize(outer, matrix->nnz));
+}
+
+inline xSize xSparseMatrix_getRows(const xSparseMatrix *matrix) { return (matrix) ? matrix->rows : 0; }
+
+inline xSize xSparseMatrix_getCols(const xSparseMatrix *matrix) { return (matrix) ? matrix->cols : 0; }
+
+inline xSize xSparseMatrix_getNonZeroCount(const xSparseMatrix *matrix) { return (matrix) ? matrix->nnz : 0; }
+
+inline xSparseMatrixFormat xSparseMatrix_getFormat(const xSparseMatrix *matrix)
+{
+    return (matrix) ? matrix->format : XSPARSEMATRIX_CSR;
+}
+
+inline const xSize *xSparseMatrix_getPointers(const xSparseMatrix *matrix) { return (matrix) ? matrix->pointers : NULL; }
+
+inline const xSize *xSparseMatrix_getIndices(const xSparseMatrix *matrix) { return (matrix) ? matrix->indices : NULL; }
+
+inline const float *xSparseMatrix_getValues(const xSparseMatrix *matrix) { return (matrix) ? matrix->values : NULL; }
+
+float xSparseMatrix_get(const xSparseMatrix *matrix, xSize row, xSize col)
+{
+    // validate arguments
+    if (!matrix || row >= matrix->rows || col >= matrix->cols) {
+        return 0.0f;
+    }
+
+    // binary search for inner index in compressed row (column)
+    xSize outer = (matrix->format == XSPARSEMATRIX_CSR) ? row : col;
+    xSize target = (matrix->format == XSPARSEMATRIX_CSR) ? col : row;
+    xSize low = matrix->pointers[outer];
+    xSize high = matrix->pointers[outer + 1];
+    while (low < high) {
+        xSize mid = low + (high - low) / 2;
+        if (matrix->indices[mid] < target) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    return (low < matrix->pointers[outer + 1] && matrix->indices[low] == target) ? matrix->values[low] : 0.0f;
+}
+
+xSparseMatrix *xSparseMatrix_convert(const xSparseMatrix *matrix, xSparseMatrixFormat format)
+{
+    // validate arguments
+    if (!matrix) {
+        return NULL;
+    }
+
+    xSparseMatrix *mat = xSparseMatrix_alloc(matrix->rows, matrix->cols, matrix->nnz, format);
+    if (!mat) {
+        return NULL;
+    }
+    xSize outer = xSparseMatrix_outerSize(matrix->format, matrix->rows, matrix->cols);
+    xSize inner = xSparseMatrix_outerSize(format, matrix->rows, matrix->cols);
+
+    // same format is plain copy
+    if (format == matrix->format) {
+        xMemCopy(mat->pointers, matrix->pointers, (outer + 1) * sizeof(xSize));
+        if (matrix->nnz) {
+            xMemCopy(mat->indices, matrix->indices, matrix->nnz * sizeof(xSize));
+            xMemCopy(mat->values, matrix->values, matrix->nnz * sizeof(float));
+        }
+        return mat;
+    }
+
+    // count elements of each new compressed row (column) and turn counts into starting positions
+    xMemSet(mat->pointers, 0, (inner + 1) * sizeof(xSize));
+    for (xSize k = 0; k < matrix->nnz; k++) {
+        mat->pointers[matrix->indices[k] + 1]++;
+    }
+    for (xSize i = 0; i < inner; i++) {
+        mat->pointers[i + 1] += mat->pointers[i];
+    }
+
+    // scatter elements in order of old compressed rows, so new indices come out ascending (pointers are advanced to ends of
+    // rows and shifted back afterwards)
+    for (xSize i = 0; i < outer; i++) {
+        for (xSize k = matrix->pointers[i]; k < matrix->pointers[i + 1]; k++) {
+            xSize pos = mat->pointers[matrix->indices[k]]++;
+            mat->indices[pos] = i;
+            mat->values[pos] = matrix->values[k];
+        }
+    }
+    for (xSize i = inner; i > 0; i--) {
+        mat->pointers[i] = mat->pointers[i - 1];
+    }
+    mat->pointers[0] = 0;
+
+    return mat;
+}
+
+xSparseMatrix *xSparseMatrix_transpose(const xSparseMatrix *matrix)
+{
+    // validate arguments
+    if (!matrix) {
+        return NULL;
+    }
+
+    // arrays stay the same, only their meaning changes
+    xSparseMatrixFormat format = (matrix->format == XSPARSEMATRIX_CSR) ? XSPARSEMATRIX_CSC : XSPARSEMATRIX_CSR;
+    xSparseMatrix *mat = xSparseMatrix_alloc(matrix->cols, matrix->rows, matrix->nnz, format);
+    if (!mat) {
+        return NULL;
+    }
+    xSize outer = xSparseMatrix_outerSize(matrix->format, matrix->rows, matrix->cols);
+    xMemCopy(mat->pointers, matrix->pointers, (outer + 1) * sizeof(xSize));
+    if (matrix->nnz) {
+        xMemCopy(mat->indices, matrix->indices, matrix->nnz * sizeof(xSize));
+        xMemCopy(mat->values, matrix->values, matrix->nnz * sizeof(float));
+    }
+
+    return mat;
+}
+
+xMatrix *xSparseMatrix_toDense(const xSparseMatrix *matrix)
+{
+    // validate arguments
+    if (!matrix) {
+        return NULL;
+    }
+
+    xMatrix *mat = xMatrix_new(matrix->rows, matrix->cols);
+    if (!xMatrix_isValid(mat)) {
+        return NULL;
+    }
+
+    // scatter stored elements into zero-initialized matrix
+    xMatrixView view = xMatrix_view(mat);
+    if (matrix->format == XSPARSEMATRIX_CSC) {
+        view = xMatrixView_transpose(view);
+    }
+    for (xSize i = 0; i < view.rows; i++) {
+        for (xSize k = matrix->pointers[i]; k < matrix->pointers[i + 1]; k++) {
+            xMatrixView_set(view, i, matrix->indices[k], matrix->values[k]);
+        }
+    }
+
+    return mat;
+}
+
+// first of given rows whose elements start at or after given position
+static xSize xSparseMatrix_rowAt(const xSize *starts, xSize rows, xSize position)
+{
+    xSize low = 0;
+    xSize high = rows;
+    while (low < high) {
+        xSize mid = low + (high - low) / 2;
+        if (starts[mid] < position) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+// compute rows of CSR product in parts [begin, end), each covering rows with about nnz / parts stored elements
+static void xSparseMatrix_taskRows(void *context, xSize begin, xSize end)
+{
+    const xSparseMatrixTask *task = (const xSparseMatrixTask *)context;
+    const xSparseMatrix *lhs = task->lhs;
+    xSize first = (begin == 0) ? 0 : xSparseMatrix_rowAt(lhs->pointers, lhs->rows, lhs->nnz * begin / task->parts);
+    xSize last = (end == task->parts) ? lhs->rows : xSparseMatrix_rowAt(lhs->pointers, lhs->rows, lhs->nnz * end / task->parts);
+
+    for (xSize i = first; i < last; i++) {
+        float *dest = task->c + i * task->ldc;
+        if (task->width == 1) {
+            // dot product of row with vector
+            float sum = 0.0f;
+            for (xSize k = lhs->pointers[i]; k < lhs->pointers[i + 1]; k++) {
+                sum += lhs->values[k] * task->b[lhs->indices[k] * task->ldb];
+            }
+            *dest = sum;
+            continue;
+        }
+
+        // linear combination of rows of dense operand
+        xMemSet(dest, 0, task->width * sizeof(float));
+        for (xSize k = lhs->pointers[i]; k < lhs->pointers[i + 1]; k++) {
+            float value = lhs->values[k];
+            const float *src = task->b + lhs->indices[k] * task->ldb;
+            for (xSize j = 0; j < task->width; j++) {
+                dest[j] += value * src[j];
+            }
+        }
+    }
+}
+
+// compute strips [begin, end) of columns of CSC product by scattering columns of sparse operand
+static void xSparseMatrix_taskStrips(void *context, xSize begin, xSize end)
+{
+    const xSparseMatrixTask *task = (const xSparseMatrixTask *)context;
+    const xSparseMatrix *lhs = task->lhs;
+    xSize from = begin * XSPARSEMATRIX_STRIP;
+    xSize to = (end * XSPARSEMATRIX_STRIP < task->width) ? end * XSPARSEMATRIX_STRIP : task->width;
+
+    for (xSize i = 0; i < lhs->rows; i++) {
+        xMemSet(task->c + i * task->ldc + from, 0, (to - from) * sizeof(float));
+    }
+    for (xSize col = 0; col < lhs->cols; col++) {
+        const float *src = task->b + col * task->ldb;
+        for (xSize k = lhs->pointers[col]; k < lhs->pointers[col + 1]; k++) {
+            float value = lhs->values[k];
+            float *dest = task->c + lhs->indices[k] * task->ldc;
+            for (xSize j = from; j < to; j++) {
+                dest[j] += value * src[j];
+            }
+        }
+    }
+}
+
+// compute rows of CSC product in parts [begin, end), each covering rows with about nnz / parts stored elements, by scattering
+// segments of columns of sparse operand which fall into those rows
+static void xSparseMatrix_taskColumnRows(void *context, xSize begin, xSize end)
+{
+    const xSparseMatrixTask *task = (const xSparseMatrixTask *)context;
+    const xSparseMatrix *lhs = task->lhs;
+    xSize first = (begin == 0) ? 0 : xSparseMatrix_rowAt(task->rowStarts, lhs->rows, lhs->nnz * begin / task->parts);
+    xSize last = (end == task->parts) ? lhs->rows : xSparseMatrix_rowAt(task->rowStarts, lhs->rows, lhs->nnz * end / task->parts);
+
+    for (xSize i = first; i < last; i++) {
+        xMemSet(task->c + i * task->ldc, 0, task->width * sizeof(float));
+    }
+    for (xSize col = 0; col < lhs->cols; col++) {
+        // rows are ascending within column, so segment of part is found by binary search
+        xSize k = lhs->pointers[col];
+        xSize stop = lhs->pointers[col + 1];
+        for (xSize high = stop; first > 0 && k < high;) {
+            xSize mid = k + (high - k) / 2;
+            if (lhs->indices[mid] < first) {
+                k = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+
+        const float *src = task->b + col * task->ldb;
+        for (; k < stop && lhs->indices[k] < last; k++) {
+            float value = lhs->values[k];
+            float *dest = task->c + lhs->indices[k] * task->ldc;
+            for (xSize j = 0; j < task->width; j++) {
+                dest[j] += value * src[j];
+            }
+        }
+    }
+}
+
+// compute C = A * B for sparse A and dense B of given width
+static void xSparseMatrix_product(const xSparseMatrix *lhs, const float *b, xSize ldb, float *c, xSize ldc, xSize width)
+{
+    xSparseMatrixTask task = {lhs, b, ldb, c, ldc, width, 1, NULL};
+    xThreadPool *pool = (lhs->nnz * width >= XSPARSEMATRIX_PARALLEL_THRESHOLD) ? xThreadPool_getShared() : NULL;
+
+    if (lhs->format == XSPARSEMATRIX_CSR) {
+        // split rows into parts with similar number of stored elements, so dense rows of graphs do not stall single thread
+        task.parts = lhs->nnz * width / XSPARSEMATRIX_PARALLEL_GRAIN;
+        task.parts = (task.parts < 1) ? 1 : (task.parts > lhs->rows) ? lhs->rows : task.parts;
+        xThreadPool_parallelFor(pool, task.parts, 1, xSparseMatrix_taskRows, &task);
+        return;
+    }
+
+    // narrow products (SpMV) are single strip of columns, so their rows are split instead, into parts with similar number of
+    // stored elements found by counting elements of each row (every element of result is still summed over columns in order,
+    // so results do not depend on number of threads)
+    xSize size = (lhs->rows + 1) * sizeof(xSize);
+    xBool byRows = pool && width <= XSPARSEMATRIX_STRIP && xThreadPool_getThreadCount(pool) > 1;
+    xSize *rowStarts = byRows ? (xSize *)xAllocator_alloc(NULL, size) : NULL;
+    if (!rowStarts) {
+        xThreadPool_parallelFor(pool, (width + XSPARSEMATRIX_STRIP - 1) / XSPARSEMATRIX_STRIP, 1, xSparseMatrix_taskStrips,
+                                &task);
+        return;
+    }
+
+    xMemSet(rowStarts, 0, size);
+    for (xSize k = 0; k < lhs->nnz; k++) {
+        rowStarts[lhs->indices[k] + 1]++;
+    }
+    for (xSize i = 0; i < lhs->rows; i++) {
+        rowStarts[i + 1] += rowStarts[i];
+    }
+    task.rowStarts = rowStarts;
+    task.parts = lhs->nnz * width / XSPARSEMATRIX_PARALLEL_GRAIN;
+    task.parts = (task.parts < 1) ? 1 : (task.parts > lhs->rows) ? lhs->rows : task.parts;
+    xThreadPool_parallelFor(pool, task.parts, 1, xSparseMatrix_taskColumnRows, &task);
+    xAllocator_free(NULL, rowStarts, size);
+}
+
+xBool xSparseMatrix_mulVector(const xSparseMatrix *matrix, const float *x, float *y)
+{
+    // validate arguments
+    if (!matrix || !x || !y) {
+        return false;
+    }
+
+    xSparseMatrix_product(matrix, x, 1, y, 1, 1);
+    return true;
+}
+
+xMatrix *xSparseMatrix_mul(const xSparseMatrix *lhs, const xMatrix *rhs)
+{
+    // validate arguments
+    if (!lhs || !xMatrix_isValid(rhs) || lhs->cols != xMatrix_getRows(rhs)) {
+        return NULL;
+    }
+
+    // create matrix to store result and perform in-place operation
+    xMatrix *mat = xMatrix_new(lhs->rows, xMatrix_getCols(rhs));
+    if (!xSparseMatrix_mul_inplace(mat, lhs, rhs)) {
+        // operation failed, free memory and return
+        xMatrix_free(mat);
+        return NULL;
+    }
+
+    return mat;
+}
+
+xMatrix *xSparseMatrix_mul_inplace(xMatrix *res, const xSparseMatrix *lhs, const xMatrix *rhs)
+{
+    // validate arguments
+    if (!xMatrix_isValid(res) || !lhs || !xMatrix_isValid(rhs) || res == rhs || lhs->cols != xMatrix_getRows(rhs) ||
+        xMatrix_getRows(res) != lhs->rows || xMatrix_getCols(res) != xMatrix_getCols(rhs)) {
+        return NULL;
+    }
+
+    xMatrixView b = xMatrix_view(rhs);
+    xMatrixView c = xMatrix_view(res);
+    xSparseMatrix_product(lhs, b.data, b.rowStride, c.data, c.rowStride, b.cols);
+
+    return res;
+}
@@ -0,0 +1,65 @@
+#include "xMemory/xAllocator.h"
+#include <stdlib.h>  // malloc, realloc, free
+#include "xBase/xMemtools.h"
+#include "xBase/xTypes.h"
+
+static void *xAllocator_stdAlloc(void *ctx, xSize size)
+{
+    (void)ctx;
+    return malloc(size);
+}
+
+static void *xAllocator_stdRealloc(void *ctx, void *ptr, xSize oldSize, xSize newSize)
+{
+    (void)ctx;
+    (void)oldSize;
+    return realloc(ptr, newSize);
+}
+
+static void xAllocator_stdFree(void *ctx, void *ptr, xSize size)
+{
+    (void)ctx;
+    (void)size;
+    free(ptr);
+}
+
+static const xAllocator xAllocator_default = {xAllocator_stdAlloc, xAllocator_stdRealloc, xAllocator_stdFree, NULL};
+
+const xAllocator *xAllocator_getDefault(void) { return &xAllocator_default; }
+
+void *xAllocator_alloc(const xAllocator *allocator, xSize size)
+{
+    allocator = allocator ? allocator : &xAllocator_default;
+    return (size && allocator->alloc) ? allocator->alloc(allocator->ctx, size) : NULL;
+}
+
+void *xAllocator_realloc(const xAllocator *allocator, void *ptr, xSize oldSize, xSize newSize)
+{
+    allocator = allocator ? allocator : &xAllocator_default;
+    if (!ptr) {
+        return xAllocator_alloc(allocator, newSize);
+    } else if (!newSize) {
+        // shrinking to nothing is not supported, as NULL would be indistinguishable from failure
+        return NULL;
+    } else if (allocator->realloc) {
+        return allocator->realloc(allocator->ctx, ptr, oldSize, newSize);
+    }
+
+    // emulate reallocation for allocators without native support
+    void *block = xAllocator_alloc(allocator, newSize);
+    if (!block) {
+        return NULL;
+    }
+    xMemCopy(block, ptr, (oldSize < newSize) ? oldSize : newSize);
+    xAllocator_free(allocator, ptr, oldSize);
+
+    return block;
+}
+
+void xAllocator_free(const xAllocator *allocator, void *ptr, xSize size)
+{
+    allocator = allocator ? allocator : &xAllocator_default;
+    if (ptr && allocator->free) {
+        allocator->free(allocator->ctx, ptr, size);
+    }
+}
@@ -0,0 +1,257 @@
+#include "xMemory/xArena.h"
+#include <stdint.h>  // uintptr_t
+#include "xBase/xMemtools.h"
+#include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
+
+typedef struct xArenaBlock_s {
+    struct xArenaBlock_s *prev;  // previously used block (or next spare block when on spare list)
+    xSize size;                  // usable size of block in bytes
+    xSize used;                  // number of bytes allocated from block
+} xArenaBlock;
+
+struct xArena_s {
+    xArenaBlock *current;       // block allocations are currently served from (head of used chain)
+    xArenaBlock *first;         // oldest block of used chain
+    xArenaBlock *spare;         // released blocks kept for reuse
+    xSize blockSize;            // default size of new blocks
+    const xAllocator *backing;  // allocator providing blocks
+    xAllocator allocator;       // allocator interface serving memory from this arena
+};
+
+// usable memory of block starts right after its header, rounded up to default alignment
+#define XARENA_HEADER_SIZE ((sizeof(xArenaBlock) + XARENA_DEFAULT_ALIGNMENT - 1) & ~(xSize)(XARENA_DEFAULT_ALIGNMENT - 1))
+
+static inline xUInt8 *xArena_blockData(xArenaBlock *block) { return (xUInt8 *)block + XARENA_HEADER_SIZE; }
+
+/**
+ * @brief
+ * Get offset of next allocation inside block satisfying given alignment.
+ */
+static inline xSize xArena_alignedOffset(xArenaBlock *block, xSize alignment)
+{
+    uintptr_t address = (uintptr_t)(xArena_blockData(block) + block->used);
+    return block->used + (((alignment - (address & (alignment - 1))) & (alignment - 1)));
+}
+
+static void *xArena_allocatorAlloc(void *ctx, xSize size);
+static void *xArena_allocatorRealloc(void *ctx, void *ptr, xSize oldSize, xSize newSize);
+static void xArena_allocatorFree(void *ctx, void *ptr, xSize size);
+
+xArena *xArena_new(xSize blockSize) { return xArena_newWithAllocator(blockSize, NULL); }
+
+xArena *xArena_newWithAllocator(xSize blockSize, const xAllocator *allocator)
+{
+    allocator = allocator ? allocator : xAllocator_getDefault();
+
+    xArena *arena = NULL;
+    if (!(arena = (xArena *)xAllocator_alloc(allocator, sizeof(xArena)))) {
+        return NULL;
+    }
+
+    arena->current = NULL;
+    arena->first = NULL;
+    arena->spare = NULL;
+    arena->blockSize = blockSize ? blockSize : XARENA_DEFAULT_BLOCK_SIZE;
+    arena->backing = allocator;
+    arena->allocator.alloc = xArena_allocatorAlloc;
+    arena->allocator.realloc = xArena_allocatorRealloc;
+    arena->allocator.free = xArena_allocatorFree;
+    arena->allocator.ctx = (void *)arena;
+
+    return arena;
+}
+
+/**
+ * @brief
+ * Free every block in chain linked through `prev` pointers.
+ */
+static void xArena_freeChain(const xAllocator *allocator, xArenaBlock *block)
+{
+    while (block) {
+        xArenaBlock *prev = block->prev;
+        xAllocator_free(allocator, block, XARENA_HEADER_SIZE + block->size);
+        block = prev;
+    }
+}
+
+void xArena_free(xArena *arena)
+{
+    if (!arena) {
+        return;
+    }
+
+    xArena_freeChain(arena->backing, arena->current);
+    xArena_freeChain(arena->backing, arena->spare);
+    xAllocator_free(arena->backing, arena, sizeof(xArena));
+}
+
+const xAllocator *xArena_getAllocator(xArena *arena) { return (arena) ? &arena->allocator : NULL; }
+
+/**
+ * @brief
+ * Make new block with at least given usable size current block of arena.
+ *
+ * @return xBool true on success, false if memory allocation failed.
+ */
+static xBool xArena_grow(xArena *arena, xSize minSize)
+{
+    // reuse first spare block that is large enough
+    xArenaBlock **link = &arena->spare;
+    while (*link && (*link)->size < minSize) {
+        link = &(*link)->prev;
+    }
+
+    xArenaBlock *block = *link;
+    if (block) {
+        *link = block->prev;
+    } else {
+        xSize size = (minSize > arena->blockSize) ? minSize : arena->blockSize;
+        if (size > (xSize)-1 - XARENA_HEADER_SIZE ||
+            !(block = (xArenaBlock *)xAllocator_alloc(arena->backing, XARENA_HEADER_SIZE + size))) {
+            return false;
+        }
+        block->size = size;
+    }
+
+    block->used = 0;
+    block->prev = arena->current;
+    if (!arena->current) {
+        arena->first = block;
+    }
+    arena->current = block;
+
+    return true;
+}
+
+void *xArena_allocAligned(xArena *arena, xSize size, xSize alignment)
+{
+    // validate arguments
+    if (!arena || !size || !alignment || (alignment & (alignment - 1))) {
+        return NULL;
+    }
+
+    // bump pointer of current block if allocation fits
+    xArenaBlock *block = arena->current;
+    if (block) {
+        xSize offset = xArena_alignedOffset(block, alignment);
+        if (offset <= block->size && size <= block->size - offset) {
+            block->used = offset + size;
+            return xArena_blockData(block) + offset;
+        }
+    }
+
+    // otherwise continue in new block large enough for worst-case padding
+    if (size > (xSize)-1 - alignment || !xArena_grow(arena, size + alignment - 1)) {
+        return NULL;
+    }
+    block = arena->current;
+    xSize offset = xArena_alignedOffset(block, alignment);
+    block->used = offset + size;
+
+    return xArena_blockData(block) + offset;
+}
+
+void *xArena_alloc(xArena *arena, xSize size) { return xArena_allocAligned(arena, size, XARENA_DEFAULT_ALIGNMENT); }
+
+xSize xArena_getUsed(const xArena *arena)
+{
+    xSize used = 0;
+    for (xArenaBlock *block = arena ? arena->current : NULL; block; block = block->prev) {
+        used += block->used;
+    }
+    return used;
+}
+
+void xArena_reset(xArena *arena)
+{
+    if (!arena || !arena->current) {
+        return;
+    }
+
+    // splice whole used chain in front of spare list
+    arena->first->prev = arena->spare;
+    arena->spare = arena->current;
+    arena->current = NULL;
+    arena->first = NULL;
+}
+
+xArenaMark xArena_mark(xArena *arena)
+{
+    xArenaMark mark = {arena, NULL, 0};
+    if (arena && arena->current) {
+        mark.block = (void *)arena->current;
+        mark.used = arena->current->used;
+    }
+    return mark;
+}
+
+void xArena_rewind(const xArenaMark *mark)
+{
+    if (!mark || !mark->arena) {
+        return;
+    }
+
+    // mark taken on empty arena releases everything
+    xArena *arena = mark->arena;
+    if (!mark->block) {
+        xArena_reset(arena);
+        return;
+    }
+
+    // move blocks started after mark to spare list
+    while (arena->current && arena->current != (xArenaBlock *)mark->block) {
+        xArenaBlock *block = arena->current;
+        arena->current = block->prev;
+        block->prev = arena->spare;
+        arena->spare = block;
+    }
+
+    if (arena->current) {
+        arena->current->used = mark->used;
+    } else {
+        arena->first = NULL;
+    }
+}
+
+static void *xArena_allocatorAlloc(void *ctx, xSize size) { return xArena_alloc((xArena *)ctx, size); }
+
+/**
+ * @brief
+ * Check if memory block is most recent allocation of current arena block.
+ */
+static xBool xArena_isLast(const xArena *arena, const void *ptr, xSize size)
+{
+    xArenaBlock *block = arena->current;
+    return (block && (const xUInt8 *)ptr + size == xArena_blockData(block) + block->used) ? true : false;
+}
+
+static void *xArena_allocatorRealloc(void *ctx, void *ptr, xSize oldSize, xSize newSize)
+{
+    xArena *arena = (xArena *)ctx;
+
+    // most recent allocation can be resized in place if current block has enough room
+    if (xArena_isLast(arena, ptr, oldSize)) {
+        xArenaBlock *block = arena->current;
+        xSize offset = (xSize)((xUInt8 *)ptr - xArena_blockData(block));
+        if (newSize <= block->size - offset) {
+            block->used = offset + newSize;
+            return ptr;
+        }
+    }
+
+    void *moved = xArena_alloc(arena, newSize);
+    if (moved) {
+        xMemCopy(moved, ptr, (oldSize < newSize) ? oldSize : newSize);
+    }
+    return moved;
+}
+
+static void xArena_allocatorFree(void *ctx, void *ptr, xSize size)
+{
+    // only most recent allocation can be given back, everything else waits for reset or rewind
+    xArena *arena = (xArena *)ctx;
+    if (xArena_isLast(arena, ptr, size)) {
+        arena->current->used -= size;
+    }
+}
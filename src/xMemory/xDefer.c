@@ -1,9 +1,9 @@
 #include "xMemory/xDefer.h"
-#include <stdlib.h>  // malloc, realloc, free
+#include "xMemory/xAllocator.h"
 
-// TODO: remove dependency on stdlib.h (custom memory allocation functions)
+void xDefer_stackInit(DeferStack *stack) { xDefer_stackInitWithAllocator(stack, NULL); }
 
-void xDefer_stackInit(DeferStack *stack)
+void xDefer_stackInitWithAllocator(DeferStack *stack, const xAllocator *allocator)
 {
     // validate arguments
     if (!stack) {
@@ -11,7 +11,8 @@ void xDefer_stackInit(DeferStack *stack)
     }
 
     // allocate stack and set property values
-    stack->funcs = (DeferFunc *)malloc(DEFER_STACK_INIT_CAPACITY * sizeof(DeferFunc));
+    stack->allocator = allocator ? allocator : xAllocator_getDefault();
+    stack->funcs = (DeferFunc *)xAllocator_alloc(stack->allocator, DEFER_STACK_INIT_CAPACITY * sizeof(DeferFunc));
     stack->size = 0;
     stack->capacity = DEFER_STACK_INIT_CAPACITY;
 }
@@ -25,7 +26,8 @@ void xDefer_stackPush(DeferStack *stack, void (*func)(void *), void *arg)
 
     // if stack is at full capacity, reallocate to double the size
     if (stack->size == stack->capacity) {
-        DeferFunc *newFuncs = (DeferFunc *)realloc(stack->funcs, 2 * stack->capacity * sizeof(DeferFunc));
+        DeferFunc *newFuncs = (DeferFunc *)xAllocator_realloc(stack->allocator, stack->funcs, stack->capacity * sizeof(DeferFunc),
+                                                              2 * stack->capacity * sizeof(DeferFunc));
         if (newFuncs == NULL) {
             return;
         }
@@ -51,6 +53,6 @@ void xDefer_stackPopAll(DeferStack *stack)
         stack->size--;
         stack->funcs[stack->size].func(stack->funcs[stack->size].arg);
     }
-    free(stack->funcs);
+    xAllocator_free(stack->allocator, stack->funcs, stack->capacity * sizeof(DeferFunc));
     stack->funcs = NULL;
 }
@@ -0,0 +1,369 @@
+#include "xMemory/xPool.h"
+#include <stdatomic.h>  // atomic_flag
+#include "xBase/xMemtools.h"
+#include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
+
+#define XPOOL_CLASS_COUNT (XPOOL_MAX_OBJECT_SIZE / XPOOL_SIZE_CLASS_GRANULARITY)
+#define XPOOL_CACHE_CAPACITY 32                       // maximum number of objects per size class in thread cache
+#define XPOOL_CACHE_BATCH (XPOOL_CACHE_CAPACITY / 2)  // number of objects moved between thread cache and pool at once
+#define XPOOL_CACHE_SLOTS 4                           // number of pools cached per thread at once
+
+typedef struct xPoolObject_s {
+    struct xPoolObject_s *next;  // next free object of same size class
+} xPoolObject;
+
+typedef struct xPoolPage_s {
+    struct xPoolPage_s *next;  // next page owned by pool
+} xPoolPage;
+
+typedef struct xPoolClass_s {
+    xPoolObject *freeList;  // released objects of this size class
+    xUInt8 *carve;          // start of not yet used part of latest page of this size class
+    xUInt8 *carveEnd;       // end of latest page of this size class
+} xPoolClass;
+
+struct xPool_s {
+    xPoolClass classes[XPOOL_CLASS_COUNT];  // per-size-class free lists
+    xPoolPage *pages;                       // all pages owned by pool
+    xSize pageSize;                         // size of new pages
+    xSize pageCount;                        // number of pages owned by pool
+    const xAllocator *backing;              // allocator providing pages and large objects
+    xAllocator allocator;                   // allocator interface serving memory from this pool
+    xBool threadCache;                      // whether objects are cached per thread
+    atomic_flag lock;                       // guards classes and pages when thread caches are enabled
+    xUInt64 id;                             // unique identity of pool in thread caches
+    struct xPool_s *nextRegistered;         // next pool in registry of pools with thread caches
+};
+
+typedef struct xPoolCache_s {
+    xUInt64 poolId;                         // identity of pool cached objects belong to (0 if none)
+    xUInt64 lastUse;                        // value of thread use counter when cache was last used (for LRU eviction)
+    xPoolObject *heads[XPOOL_CLASS_COUNT];  // cached objects per size class
+    xUInt32 counts[XPOOL_CLASS_COUNT];      // number of cached objects per size class
+} xPoolCache;
+
+typedef struct xPoolThreadCache_s {
+    xPoolCache slots[XPOOL_CACHE_SLOTS];  // caches of most recently used pools
+    xUInt64 useCounter;                   // incremented on every switch between pools
+    xPoolCache *recent;                   // most recently used cache (checked first)
+} xPoolThreadCache;
+
+// registry of live pools with thread caches, so caches are only returned to pools which were not freed in meantime
+static atomic_flag xPool_registryLock = ATOMIC_FLAG_INIT;
+static xPool *xPool_registry = NULL;
+static xUInt64 xPool_nextId = 1;
+
+static _Thread_local xPoolThreadCache xPool_threadCache;
+
+// objects in pages start right after page header, rounded up to size class granularity
+#define XPOOL_PAGE_HEADER_SIZE \
+    ((sizeof(xPoolPage) + XPOOL_SIZE_CLASS_GRANULARITY - 1) & ~(xSize)(XPOOL_SIZE_CLASS_GRANULARITY - 1))
+
+static inline xSize xPool_classIndex(xSize size) { return (size - 1) / XPOOL_SIZE_CLASS_GRANULARITY; }
+static inline xSize xPool_classSize(xSize index) { return (index + 1) * XPOOL_SIZE_CLASS_GRANULARITY; }
+
+static inline void xPool_lock(atomic_flag *lock)
+{
+    while (atomic_flag_test_and_set_explicit(lock, memory_order_acquire)) {
+    }
+}
+
+static inline void xPool_unlock(atomic_flag *lock) { atomic_flag_clear_explicit(lock, memory_order_release); }
+
+static void *xPool_allocatorAlloc(void *ctx, xSize size);
+static void *xPool_allocatorRealloc(void *ctx, void *ptr, xSize oldSize, xSize newSize);
+static void xPool_allocatorFree(void *ctx, void *ptr, xSize size);
+
+xPool *xPool_new(xSize pageSize, xBool threadCache) { return xPool_newWithAllocator(pageSize, threadCache, NULL); }
+
+xPool *xPool_newWithAllocator(xSize pageSize, xBool threadCache, const xAllocator *allocator)
+{
+    allocator = allocator ? allocator : xAllocator_getDefault();
+
+    xPool *pool = NULL;
+    if (!(pool = (xPool *)xAllocator_alloc(allocator, sizeof(xPool)))) {
+        return NULL;
+    }
+
+    xMemSet(pool->classes, 0, sizeof(pool->classes));
+    pool->pages = NULL;
+    pool->pageSize = pageSize ? pageSize : XPOOL_DEFAULT_PAGE_SIZE;
+    if (pool->pageSize < XPOOL_PAGE_HEADER_SIZE + XPOOL_MAX_OBJECT_SIZE) {
+        pool->pageSize = XPOOL_PAGE_HEADER_SIZE + XPOOL_MAX_OBJECT_SIZE;
+    }
+    pool->pageCount = 0;
+    pool->backing = allocator;
+    pool->allocator.alloc = xPool_allocatorAlloc;
+    pool->allocator.realloc = xPool_allocatorRealloc;
+    pool->allocator.free = xPool_allocatorFree;
+    pool->allocator.ctx = (void *)pool;
+    pool->threadCache = threadCache;
+    atomic_flag_clear(&pool->lock);
+    pool->id = 0;
+    pool->nextRegistered = NULL;
+
+    if (threadCache) {
+        xPool_lock(&xPool_registryLock);
+        pool->id = xPool_nextId++;
+        pool->nextRegistered = xPool_registry;
+        xPool_registry = pool;
+        xPool_unlock(&xPool_registryLock);
+    }
+
+    return pool;
+}
+
+void xPool_free(xPool *pool)
+{
+    if (!pool) {
+        return;
+    }
+
+    // unregister pool so thread caches still holding its objects discard them instead of returning them
+    if (pool->threadCache) {
+        xPool_lock(&xPool_registryLock);
+        xPool **link = &xPool_registry;
+        while (*link && *link != pool) {
+            link = &(*link)->nextRegistered;
+        }
+        if (*link) {
+            *link = pool->nextRegistered;
+        }
+        xPool_unlock(&xPool_registryLock);
+
+        for (xSize i = 0; i < XPOOL_CACHE_SLOTS; i++) {
+            if (xPool_threadCache.slots[i].poolId == pool->id) {
+                xMemSet(&xPool_threadCache.slots[i], 0, sizeof(xPoolCache));
+            }
+        }
+    }
+
+    xPoolPage *page = pool->pages;
+    while (page) {
+        xPoolPage *next = page->next;
+        xAllocator_free(pool->backing, page, pool->pageSize);
+        page = next;
+    }
+    xAllocator_free(pool->backing, pool, sizeof(xPool));
+}
+
+/**
+ * @brief
+ * Take object of given size class from pool, carving new page if free list is empty.
+ *
+ * @note
+ * Caller has to hold pool lock if thread caches are enabled.
+ */
+static xPoolObject *xPool_takeObject(xPool *pool, xSize index)
+{
+    xPoolClass *cls = &pool->classes[index];
+    xPoolObject *object = cls->freeList;
+    if (object) {
+        cls->freeList = object->next;
+        return object;
+    }
+
+    // continue carving latest page of size class or start new one
+    xSize objectSize = xPool_classSize(index);
+    if ((xSize)(cls->carveEnd - cls->carve) < objectSize) {
+        xPoolPage *page = (xPoolPage *)xAllocator_alloc(pool->backing, pool->pageSize);
+        if (!page) {
+            return NULL;
+        }
+        page->next = pool->pages;
+        pool->pages = page;
+        pool->pageCount++;
+        cls->carve = (xUInt8 *)page + XPOOL_PAGE_HEADER_SIZE;
+        cls->carveEnd = (xUInt8 *)page + pool->pageSize;
+    }
+
+    object = (xPoolObject *)cls->carve;
+    cls->carve += objectSize;
+    return object;
+}
+
+/**
+ * @brief
+ * Return objects of single cache back to their pool and empty the cache.
+ */
+static void xPool_flushCache(xPoolCache *cache)
+{
+    if (!cache->poolId) {
+        return;
+    }
+
+    // return cached objects only if their pool is still alive, registry lock keeps it from being freed meanwhile
+    xPool_lock(&xPool_registryLock);
+    xPool *pool = xPool_registry;
+    while (pool && pool->id != cache->poolId) {
+        pool = pool->nextRegistered;
+    }
+    if (pool) {
+        xPool_lock(&pool->lock);
+        for (xSize i = 0; i < XPOOL_CLASS_COUNT; i++) {
+            xPoolObject *last = cache->heads[i];
+            if (!last) {
+                continue;
+            }
+            while (last->next) {
+                last = last->next;
+            }
+            last->next = pool->classes[i].freeList;
+            pool->classes[i].freeList = cache->heads[i];
+        }
+        xPool_unlock(&pool->lock);
+    }
+    xPool_unlock(&xPool_registryLock);
+
+    xMemSet(cache, 0, sizeof(xPoolCache));
+}
+
+void xPool_flushThreadCache(void)
+{
+    for (xSize i = 0; i < XPOOL_CACHE_SLOTS; i++) {
+        xPool_flushCache(&xPool_threadCache.slots[i]);
+    }
+    xPool_threadCache.recent = NULL;
+}
+
+/**
+ * @brief
+ * Get cache of calling thread bound to given pool, evicting least recently used cache if all slots are taken.
+ */
+static xPoolCache *xPool_bindCache(const xPool *pool)
+{
+    xPoolThreadCache *thread = &xPool_threadCache;
+    if (thread->recent && thread->recent->poolId == pool->id) {
+        return thread->recent;
+    }
+
+    xPoolCache *cache = &thread->slots[0];
+    for (xSize i = 0; i < XPOOL_CACHE_SLOTS; i++) {
+        if (thread->slots[i].poolId == pool->id) {
+            cache = &thread->slots[i];
+            break;
+        } else if (thread->slots[i].lastUse < cache->lastUse) {
+            cache = &thread->slots[i];  // empty slots have lastUse 0 and are taken first
+        }
+    }
+    if (cache->poolId != pool->id) {
+        xPool_flushCache(cache);
+        cache->poolId = pool->id;
+    }
+    cache->lastUse = ++thread->useCounter;
+    thread->recent = cache;
+    return cache;
+}
+
+void *xPool_alloc(xPool *pool, xSize size)
+{
+    // validate arguments
+    if (!pool || !size) {
+        return NULL;
+    }
+
+    // large objects are not pooled
+    if (size > XPOOL_MAX_OBJECT_SIZE) {
+        return xAllocator_alloc(pool->backing, size);
+    }
+
+    xSize index = xPool_classIndex(size);
+    if (!pool->threadCache) {
+        return (void *)xPool_takeObject(pool, index);
+    }
+
+    // refill empty thread cache with batch of objects
+    xPoolCache *cache = xPool_bindCache(pool);
+    if (!cache->heads[index]) {
+        xPool_lock(&pool->lock);
+        for (xSize i = 0; i < XPOOL_CACHE_BATCH; i++) {
+            xPoolObject *object = xPool_takeObject(pool, index);
+            if (!object) {
+                break;
+            }
+            object->next = cache->heads[index];
+            cache->heads[index] = object;
+            cache->counts[index]++;
+        }
+        xPool_unlock(&pool->lock);
+        if (!cache->heads[index]) {
+            return NULL;
+        }
+    }
+
+    xPoolObject *object = cache->heads[index];
+    cache->heads[index] = object->next;
+    cache->counts[index]--;
+    return (void *)object;
+}
+
+void xPool_release(xPool *pool, void *ptr, xSize size)
+{
+    // validate arguments
+    if (!pool || !ptr || !size) {
+        return;
+    }
+
+    if (size > XPOOL_MAX_OBJECT_SIZE) {
+        xAllocator_free(pool->backing, ptr, size);
+        return;
+    }
+
+    xSize index = xPool_classIndex(size);
+    xPoolObject *object = (xPoolObject *)ptr;
+    if (!pool->threadCache) {
+        object->next = pool->classes[index].freeList;
+        pool->classes[index].freeList = object;
+        return;
+    }
+
+    // move batch of objects from full thread cache back to pool
+    xPoolCache *cache = xPool_bindCache(pool);
+    if (cache->counts[index] >= XPOOL_CACHE_CAPACITY) {
+        xPoolObject *first = cache->heads[index];
+        xPoolObject *last = first;
+        for (xSize i = 1; i < XPOOL_CACHE_BATCH; i++) {
+            last = last->next;
+        }
+        cache->heads[index] = last->next;
+        cache->counts[index] -= XPOOL_CACHE_BATCH;
+
+        xPool_lock(&pool->lock);
+        last->next = pool->classes[index].freeList;
+        pool->classes[index].freeList = first;
+        xPool_unlock(&pool->lock);
+    }
+
+    object->next = cache->heads[index];
+    cache->heads[index] = object;
+    cache->counts[index]++;
+}
+
+const xAllocator *xPool_getAllocator(xPool *pool) { return (pool) ? &pool->allocator : NULL; }
+
+xSize xPool_getPageCount(const xPool *pool) { return (pool) ? pool->pageCount : 0; }
+
+static void *xPool_allocatorAlloc(void *ctx, xSize size) { return xPool_alloc((xPool *)ctx, size); }
+
+static void *xPool_allocatorRealloc(void *ctx, void *ptr, xSize oldSize, xSize newSize)
+{
+    xPool *pool = (xPool *)ctx;
+
+    // object stays in place as long as it remains in same size class
+    if (oldSize <= XPOOL_MAX_OBJECT_SIZE && newSize <= XPOOL_MAX_OBJECT_SIZE &&
+        xPool_classIndex(oldSize) == xPool_classIndex(newSize)) {
+        return ptr;
+    } else if (oldSize > XPOOL_MAX_OBJECT_SIZE && newSize > XPOOL_MAX_OBJECT_SIZE) {
+        return xAllocator_realloc(pool->backing, ptr, oldSize, newSize);
+    }
+
+    void *moved = xPool_alloc(pool, newSize);
+    if (moved) {
+        xMemCopy(moved, ptr, (oldSize < newSize) ? oldSize : newSize);
+        xPool_release(pool, ptr, oldSize);
+    }
+    return moved;
+}
+
+static void xPool_allocatorFree(void *ctx, void *ptr, xSize size) { xPool_release((xPool *)ctx, ptr, size); }
@@ -1,18 +1,178 @@
 #include "xString/xString.h"
-#include <stdlib.h>           // malloc, realloc, free
-#include "xBase/xMemtools.h"  // copy, set, compare and hash function
-#include "xBase/xTypes.h"     // xSize, xChar, XSIZE_MAX
+#include <stdatomic.h>           // atomic reference counter
+#include <stddef.h>              // offsetof
+#include <stdlib.h>              // malloc (for C strings returned to caller)
+#include "xBase/xMemtools.h"     // copy, set, compare and hash function
+#include "xBase/xTypes.h"        // xSize, xChar, XSIZE_MAX
+#include "xMemory/xAllocator.h"  // allocator interface
 
-// TODO: remove dependency on stdlib.h (custom memory allocation functions)
+#define XSTRING_INLINE_CAPACITY 23  // capacity of buffer inside string structure used for short strings
 
 struct xString_s {
-    xChar *data;         // pointer to beginning of string
-    xSize length;        // length of string from beginning address
-    xSize capacity;      // allocated memory size
-    xSize *refCount;     // reference counter (always should be allocated)
-    xChar *baseAddress;  // base address of data (for freeing memory if string is only a part of a larger memory block)
+    xChar *data;                  // pointer to beginning of string (inline buffer, heap block or NULL for blank string)
+    xSize length;                 // length of string from beginning address
+    const xAllocator *allocator;  // allocator owning string structure and heap block
+    union {
+        struct {
+            xSize capacity;      // allocated memory size (from data pointer to end of heap block, 0 for blank string)
+            xChar *baseAddress;  // first character of heap block if data starts inside it (substrings), NULL otherwise
+        };
+        struct {
+            xChar inlineData[XSTRING_INLINE_CAPACITY];  // data of short strings (never shared, copied instead)
+            xUInt8 inlineCapacity;                      // capacity of short strings (at most XSTRING_INLINE_CAPACITY)
+        };
+    };
 };
 
+// heap data starts with reference counter shared by all strings referring to it, so sharing data never allocates
+typedef struct xStringBlock_s {
+    atomic_size_t refCount;  // number of strings referring to block
+    xChar data[];            // characters of strings
+} xStringBlock;
+
+/**
+ * @brief
+ * Check whether string data is stored in buffer inside string structure.
+ */
+static inline xBool xString_isInline(const xString *str) { return str->data == str->inlineData; }
+
+/**
+ * @brief
+ * Check whether string data is stored in heap block.
+ */
+static inline xBool xString_isHeap(const xString *str) { return str->data && !xString_isInline(str); }
+
+/**
+ * @brief
+ * Get capacity of string regardless of where its data is stored.
+ */
+static inline xSize xString_capacityOf(const xString *str) { return xString_isInline(str) ? str->inlineCapacity : str->capacity; }
+
+/**
+ * @brief
+ * Set capacity of string whose data pointer already refers to its storage.
+ */
+static inline void xString_setCapacity(xString *str, xSize capacity)
+{
+    if (xString_isInline(str)) {
+        str->inlineCapacity = (xUInt8)capacity;
+    } else {
+        str->capacity = capacity;
+    }
+}
+
+/**
+ * @brief
+ * Get heap block string data belongs to.
+ */
+static inline xStringBlock *xString_block(const xString *str)
+{
+    xChar *base = str->baseAddress ? str->baseAddress : str->data;
+    return (xStringBlock *)(void *)(base - offsetof(xStringBlock, data));
+}
+
+/**
+ * @brief
+ * Get size in bytes of heap block holding given number of characters.
+ */
+static inline xSize xString_blockBytes(xSize capacity) { return offsetof(xStringBlock, data) + capacity; }
+
+/**
+ * @brief
+ * Get number of characters of heap block string data belongs to (data of substrings starts inside the block).
+ */
+static inline xSize xString_blockSize(const xString *str)
+{
+    return str->capacity + (str->baseAddress ? (xSize)(str->data - str->baseAddress) : 0);
+}
+
+/**
+ * @brief
+ * Check whether string data is referenced by other strings.
+ */
+static inline xBool xString_isShared(const xString *str)
+{
+    return xString_isHeap(str) && atomic_load(&xString_block(str)->refCount) > 1;
+}
+
+/**
+ * @brief
+ * Drop one reference to heap block, freeing it if it was the last one.
+ */
+static void xString_releaseBlock(const xAllocator *allocator, xStringBlock *block, xSize size)
+{
+    if (atomic_fetch_sub(&block->refCount, 1) == 1) {
+        xAllocator_free(allocator, block, size);
+    }
+}
+
+/**
+ * @brief
+ * Drop reference of string to its data (freeing heap block if it was the last one), leaving blank string.
+ */
+static void xString_release(xString *str)
+{
+    if (xString_isHeap(str)) {
+        xString_releaseBlock(str->allocator, xString_block(str), xString_blockBytes(xString_blockSize(str)));
+    }
+    str->data = NULL;
+    str->capacity = 0;
+    str->baseAddress = NULL;
+}
+
+/**
+ * @brief
+ * Allocate heap block of given capacity referenced once.
+ *
+ * @return Pointer to characters of block (NULL if allocation fails).
+ */
+static xChar *xString_allocData(const xAllocator *allocator, xSize capacity)
+{
+    xStringBlock *block = (xStringBlock *)xAllocator_alloc(allocator, xString_blockBytes(capacity));
+    if (!block) {
+        return NULL;
+    }
+    atomic_init(&block->refCount, 1);
+    return block->data;
+}
+
+/**
+ * @brief
+ * Move string data to new standalone storage of given capacity (inside string structure if it fits), padded with zeros.
+ *
+ * @return xBool true on success, false if allocation fails (string is left unchanged).
+ */
+static xBool xString_moveData(xString *str, xSize capacity)
+{
+    xChar *newData = str->inlineData;
+    if (capacity > XSTRING_INLINE_CAPACITY && !(newData = xString_allocData(str->allocator, capacity))) {
+        return false;
+    }
+
+    // inline string fitting its own buffer only changes capacity (old block is found before inline buffer overwrites it)
+    xSize length = (str->length < capacity) ? str->length : capacity;
+    if (newData != str->data) {
+        xBool heap = xString_isHeap(str);
+        xStringBlock *block = heap ? xString_block(str) : NULL;
+        xSize size = heap ? xString_blockBytes(xString_blockSize(str)) : 0;
+        if (length) {
+            xMemCopy(newData, str->data, length);
+        }
+        if (heap) {
+            xString_releaseBlock(str->allocator, block, size);
+        }
+        str->data = newData;
+        if (!xString_isInline(str)) {
+            str->baseAddress = NULL;
+        }
+    }
+    xMemSet(newData + length, 0, capacity - length);
+    str->length = length;
+    xString_setCapacity(str, capacity);
+
+    return true;
+}
+
 xSize cstrlen(const xChar *str)
 {
     // check validity of passed pointer
@@ -29,27 +189,23 @@ xSize cstrlen(const xChar *str)
     return len;
 }
 
-xString *xString_new(void)
+xString *xString_new(void) { return xString_newWithAllocator(NULL); }
+
+xString *xString_newWithAllocator(const xAllocator *allocator)
 {
     // allocate memory for the string struct
+    allocator = allocator ? allocator : xAllocator_getDefault();
     xString *ret = NULL;
-    if (!(ret = (xString *)malloc(sizeof(xString)))) {
+    if (!(ret = (xString *)xAllocator_alloc(allocator, sizeof(xString)))) {
         return NULL;
     }
 
-    // zero-initialize the struct
+    // zero-initialize the struct (data is allocated once string gets content)
     ret->data = NULL;
     ret->length = 0;
     ret->capacity = 0;
-    ret->refCount = NULL;
     ret->baseAddress = NULL;
-
-    // allocate reference counter
-    if (!(ret->refCount = (xSize *)malloc(sizeof(xSize)))) {
-        free(ret);
-        return NULL;
-    }
-    *ret->refCount = 1;
+    ret->allocator = allocator;
 
     return ret;
 }
@@ -62,33 +218,21 @@ void xString_free(xString *str)
     }
 
     // free memory if reference counter hits zero
-    if (--(*str->refCount) == 0) {
-        free(str->refCount);
-        str->refCount = NULL;
-        if (str->baseAddress) {
-            // string data is substring of larger block
-            free(str->baseAddress);
-            str->baseAddress = NULL;
-        } else if (str->data) {
-            // string data is standalone
-            free(str->data);
-        }
-        str->data = NULL;
-    }
+    xString_release(str);
 
     // free the string struct
-    free(str);
+    xAllocator_free(str->allocator, str, sizeof(xString));
 
     return;
 }
 
 inline xSize xString_getLength(const xString *str) { return xString_isValid(str) ? str->length : 0; }
 
-inline xSize xString_getCapacity(const xString *str) { return xString_isValid(str) ? str->capacity : 0; }
+inline xSize xString_getCapacity(const xString *str) { return xString_isValid(str) ? xString_capacityOf(str) : 0; }
 
 inline const xChar *xString_getData(const xString *str) { return xString_isValid(str) ? str->data : NULL; }
 
-inline xBool xString_isValid(const xString *str) { return (str && str->refCount) ? true : false; }
+inline xBool xString_isValid(const xString *str) { return (str && str->allocator) ? true : false; }
 
 void xString_optimize(xString *str)
 {
@@ -98,35 +242,17 @@ void xString_optimize(xString *str)
     }
 
     // reallocate memory to fit the string
-    if (*str->refCount > 1) {
-        // string is shared, create standalone copy
-        xChar *newData = (xChar *)malloc(str->length);
-        if (!newData) {
-            return;
-        }
-        xSize *newRefCount = (xSize *)malloc(sizeof(xSize));
-        if (!newRefCount) {
-            free(newData);
-            return;
-        }
-
-        for (xSize i = 0; i < str->length; i++) {
-            newData[i] = str->data[i];
-        }
-        *newRefCount = 1;
-
-        (*str->refCount)--;
-        str->data = newData;
-        str->baseAddress = NULL;
-        str->refCount = newRefCount;
-        str->capacity = str->length;
+    if (str->length <= XSTRING_INLINE_CAPACITY || xString_isShared(str) || str->baseAddress) {
+        // string is short enough for inline buffer, shared or part of larger block, create standalone copy
+        xString_moveData(str, str->length);
     } else {
         // string is standalone, reallocate memory
-        xChar *newData = (xChar *)realloc(str->data, str->length);
-        if (!newData) {
+        xStringBlock *block = (xStringBlock *)xAllocator_realloc(
+            str->allocator, xString_block(str), xString_blockBytes(str->capacity), xString_blockBytes(str->length));
+        if (!block) {
             return;
         }
-        str->data = newData;
+        str->data = block->data;
         str->capacity = str->length;
     }
 }
@@ -139,41 +265,28 @@ void xString_preallocate(xString *str, xSize size)
     }
 
     // add requested size to current capacity
-    if (*str->refCount > 1) {
-        // string is shared, create standalone copy
-        xChar *newData = (xChar *)malloc(str->length + size);
-        if (!newData) {
-            return;
-        }
-        xSize *newRefCount = (xSize *)malloc(sizeof(xSize));
-        if (!newRefCount) {
-            free(newData);
-            return;
-        }
-
-        for (xSize i = 0; i < str->length + size; i++) {
-            newData[i] = (i < str->length) ? str->data[i] : 0;
-        }
-        *newRefCount = 1;
-
-        (*str->refCount)--;
-        str->data = newData;
-        str->baseAddress = NULL;
-        str->refCount = newRefCount;
-        str->capacity += size;
+    xSize newCapacity = xString_capacityOf(str) + size;
+    if (newCapacity < size || newCapacity > XSIZE_MAX - offsetof(xStringBlock, data)) {
+        return;
+    }
+    if (!xString_isHeap(str) || xString_isShared(str) || str->baseAddress) {
+        // string is empty, inline, shared or part of larger block, move it to standalone storage
+        xString_moveData(str, newCapacity);
     } else {
         // string is standalone, reallocate memory
-        xChar *newData = (xChar *)realloc(str->data, str->length + size);
-        if (!newData) {
+        xStringBlock *block = (xStringBlock *)xAllocator_realloc(
+            str->allocator, xString_block(str), xString_blockBytes(str->capacity), xString_blockBytes(newCapacity));
+        if (!block) {
             return;
         }
+        xChar *newData = block->data;
 
-        for (xSize i = str->length; i < str->length + size; i++) {
+        for (xSize i = str->length; i < newCapacity; i++) {
             newData[i] = 0;
         }
 
         str->data = newData;
-        str->capacity += size;
+        str->capacity = newCapacity;
     }
 }
 
@@ -185,23 +298,11 @@ void xString_clear(xString *str)
     }
 
     // check if string is shared
-    if (*str->refCount > 1) {
-        // string is shared, create new blank string
-        xSize *newRefCount = (xSize *)malloc(sizeof(xSize));
-        if (!newRefCount) {
-            return;
-        }
-        *newRefCount = 1;
-
-        // decrement previous reference counter
-        (*str->refCount)--;
-
-        // clear string attributes
-        str->data = NULL;
-        str->baseAddress = NULL;
+    if (xString_isShared(str)) {
+        // string is shared, drop reference and become blank string
+        xString_release(str);
         str->length = 0;
         str->capacity = 0;
-        str->refCount = newRefCount;
     } else {
         // string is standalone, just reset length
         str->length = 0;
@@ -213,21 +314,25 @@ xString *xString_copy(const xString *str)
     // check validity of passed pointer
     if (!xString_isValid(str) || !str->data) {
         // create and return blank string if input is invalid
-        return xString_new();
+        return xString_newWithAllocator(xString_isValid(str) ? str->allocator : NULL);
     }
 
     // allocate struct for copy string
     xString *ret = NULL;
-    if (!(ret = (xString *)malloc(sizeof(xString)))) {
+    if (!(ret = (xString *)xAllocator_alloc(str->allocator, sizeof(xString)))) {
         // NULL because we already failed to allocate memory
         return NULL;
     }
 
-    // copy the string attributes
+    // short strings are copied, longer ones share data
     *ret = *str;
+    if (xString_isInline(str)) {
+        ret->data = ret->inlineData;
+        return ret;
+    }
 
-    // increment reference counter
-    (*ret->refCount)++;
+    // increment reference counter (stored in shared block, so source structure is not modified)
+    atomic_fetch_add(&xString_block(str)->refCount, 1);
 
     return ret;
 }
@@ -235,33 +340,32 @@ xString *xString_copy(const xString *str)
 xString *xString_copyDetached(const xString *str)
 {
     // check validity of passed pointer
-    if (!xString_isValid(str) || !str->data) {
-        return xString_new();
+    if (!xString_isValid(str) || !str->data || !str->length) {
+        return xString_newWithAllocator(xString_isValid(str) ? str->allocator : NULL);
     }
 
     // allocate struct for string copy
     xString *ret = NULL;
-    if (!(ret = (xString *)malloc(sizeof(xString)))) {
+    if (!(ret = (xString *)xAllocator_alloc(str->allocator, sizeof(xString)))) {
         // NULL because memory allocation already failed once
         return NULL;
     }
 
-    // allocate heap elements of string object (data and reference counter)
-    if (!(ret->data = (xChar *)malloc(str->length * sizeof(xChar)))) {
-        free(ret);
-        return NULL;
-    } else if (!(ret->refCount = (xSize *)malloc(sizeof(xSize)))) {
-        free(ret->data);
-        free(ret);
-        return NULL;
+    // allocate data of string object (short strings use inline buffer)
+    ret->allocator = str->allocator;
+    ret->data = ret->inlineData;
+    if (str->length > XSTRING_INLINE_CAPACITY) {
+        if (!(ret->data = xString_allocData(ret->allocator, str->length * sizeof(xChar)))) {
+            xAllocator_free(ret->allocator, ret, sizeof(xString));
+            return NULL;
+        }
+        ret->baseAddress = NULL;
     }
 
     // copy string data and initialize string attributes
     xMemCopy(ret->data, str->data, str->length);
     ret->length = str->length;
-    ret->capacity = str->length;
-    *ret->refCount = 1;
-    ret->baseAddress = NULL;
+    xString_setCapacity(ret, str->length);
 
     return ret;
 }
@@ -286,7 +390,7 @@ xString *xString_append(const xString *str, const xChar *data, xSize len)
 
     // expand string memory to fit new data
     xString_preallocate(ret, len);
-    if (ret->capacity < ret->length + len) {
+    if (xString_capacityOf(ret) < ret->length + len) {
         // failed to expand stirng
         return NULL;
     }
@@ -316,8 +420,18 @@ xString *xString_substring(const xString *str, xSize start, xSize end)
         return NULL;
     }
 
-    // update attribute values
-    ret->baseAddress = ret->data;  // base address is now used for freeing
+    // inline copy is shifted inside its own buffer
+    if (xString_isInline(ret)) {
+        xMemMove(ret->data, ret->data + start, end - start);
+        ret->length = end - start;
+        ret->inlineCapacity -= start;
+        return ret;
+    }
+
+    // update attribute values (substring of substring keeps base address of original block)
+    if (!ret->baseAddress) {
+        ret->baseAddress = ret->data;  // base address is now used for freeing
+    }
     ret->data += start;            // shift string start pointer
     ret->length = end - start;     // calculate string length
     ret->capacity -= start;        // reduce capacity by amount the data pointer is shifted
@@ -325,49 +439,6 @@ xString *xString_substring(const xString *str, xSize start, xSize end)
     return ret;
 }
 
-/**
- * @brief
- * Assisting function for xString pattern matching functions.
- *
- * @param pattern Pointer to the pattern string.
- * @param len Length of the pattern string.
- * @return int* Pointer to the LPS array.
- *
- * @note
- * The returned array should be freed after use.
- *
- * @note
- * Length of returned array is equal to the length of the pattern string.
- */
-static xSize *xString_LPS(const xChar *pattern, xSize len)
-{
-    if (!pattern || !len) {
-        return NULL;
-    }
-
-    xSize *lps = (xSize *)malloc(len * sizeof(xSize));
-    if (!lps) {
-        return NULL;
-    }
-
-    lps[0] = 0;
-    xSize j = 0;
-    for (xSize i = 1; i < len; i++) {
-        if (pattern[i] == pattern[j]) {
-            lps[i] = ++j;
-        } else {
-            if (j) {
-                j = lps[j - 1];
-                i--;
-            } else {
-                lps[i] = 0;
-            }
-        }
-    }
-
-    return lps;
-}
-
 /**
  * @brief
  * Assisting function for xString pattern matching functions. Finds first occurrence of the pattern in the string starting from the
@@ -378,219 +449,54 @@ static xSize *xString_LPS(const xChar *pattern, xSize len)
  * @param len Length of the pattern.
  * @param start Position in the string to start searching from.
  * @return xSize Position of the first occurrence of the pattern in the string, or XSIZE_MAX if the pattern is not found.
+ *
+ * @note
+ * Search is done by xMemFind() (vectorized candidate filter with Two-Way fallback), so no memory is allocated.
  */
 static xSize xString_findNext(const xString *str, const xChar *data, xSize len, xSize start)
 {
     // check validity of passed arguments
-    if (!xString_isValid(str) || !data || len > str->length - start || start >= str->length) {
-        return XSIZE_MAX;
-    }
-
-    // special case (short needles)
-    if (len == 0) {
-        // zero-length needle is always found at given index
-        return start;
-    } else if (len == 1) {
-        // single character search
-        for (xSize i = start; i < str->length; i++) {
-            if (str->data[i] == data[0]) {
-                return i;
-            }
-        }
+    if (!xString_isValid(str) || !data || start >= str->length || len > str->length - start) {
         return XSIZE_MAX;
     }
-    // TODO: add more short cases (2-char, 4-char)
 
-    // create LPS array for the pattern
-    xSize *lps = xString_LPS(data, len);
-    if (!lps) {
-        return XSIZE_MAX;
-    }
-
-    // search for the pattern in the string
-    xSize i = start, j = 0;
-    while (i < str->length) {
-        if (str->data[i] == data[j]) {
-            i++;
-            j++;
-        }
-
-        if (j == len) {
-            free(lps);
-            return i - j;
-        }
-
-        if (i < str->length && str->data[i] != data[j]) {
-            if (j) {
-                j = lps[j - 1];
-            } else {
-                i++;
-            }
-        }
-    }
-
-    free(lps);
-    return XSIZE_MAX;
+    xSize index = xMemFind(str->data + start, str->length - start, data, len);
+    return (index == XSIZE_MAX) ? XSIZE_MAX : start + index;
 }
 
-static xSize xString_findPrev(const xString *str, const xChar *data, xSize len, xSize start)
+xSize xString_find(const xString *str, const xChar *data, xSize len) { return xString_findNext(str, data, len, 0); }
+
+xSize xString_findLast(const xString *str, const xChar *data, xSize len)
 {
     // validate passed arguments
-    if (!xString_isValid(str) || !data || len > str->length) {
-        // invalid arguments, return XSIZE_MAX
-        return XSIZE_MAX;
-    }
-
-    // clamp start index to string length
-    start = (start + len >= str->length) ? str->length - 1 : start + len;
-
-    // special case (short needles)
-    if (len == 0) {
-        // zero-length needle is always found at given index
-        return start;
-    } else if (len == 1) {
-        // single character search
-        for (xSize i = start; i <= start; i--) {
-            if (str->data[i] == data[0]) {
-                return i;
-            }
-        }
-
+    if (!xString_isValid(str) || !data || !str->length || len > str->length) {
         return XSIZE_MAX;
+    } else if (len == 0) {
+        // zero-length needle is found at last index
+        return str->length - 1;
     }
-    // TODO: add more short cases (2-char, 4-char)
 
-    // create LPS array for the pattern
-    xSize *lps = xString_LPS(data, len);
-    if (!lps) {
-        return XSIZE_MAX;
-    }
-
-    // search for the pattern in the string
-    xSize i = 0, j = 0, ret = XSIZE_MAX;
-    while ((str->length - i) >= (len - j)) {
-        if (str->data[i] == data[j]) {
-            i++;
-            j++;
-        }
-        if (j == len) {
-            ret = i - j;
-            j = lps[j - 1];
-        } else if ((i < str->length) && (str->data[i] != data[j])) {
-            if (j) {
-                j = lps[j - 1];
-            } else {
-                i++;
-            }
-        }
-    }
-
-    free(lps);
-    return ret;
-}
-
-xSize xString_find(const xString *str, const xChar *data, xSize len) { return xString_findNext(str, data, len, 0); }
-
-xSize xString_findLast(const xString *str, const xChar *data, xSize len)
-{
-    return xString_findPrev(str, data, len, str->length - 1);
+    return xMemFindLast(str->data, str->length, data, len);
 }
 
 xSize xString_count(const xString *haystack, const xChar *needle, xSize len)
 {
     // check validity of passed arguments
-    if (!haystack || !haystack->refCount || !needle || !len || len > haystack->length) {
+    if (!xString_isValid(haystack) || !needle || !len || len > haystack->length) {
         return 0;
     }
 
-    if (len == 1) {
-        // single character search
-        xSize count = 0;
-        for (xSize i = 0; i < haystack->length; i++) {
-            if (haystack->data[i] == needle[0]) {
-                count++;
-            }
-        }
-        return count;
-    } else {
-        // multiple character pattern search
-        xSize count = 0;
-        xSize *lps = xString_LPS(needle, len);
-        if (!lps) {
-            return 0;
-        }
-
-        xSize i = 0, j = 0, k = XSIZE_MAX;
-        while (i < haystack->length) {
-            if (haystack->data[i] == needle[j]) {
-                i++;
-                j++;
-            }
-            if (j == len) {
-                if (k == XSIZE_MAX || i - j > k) {
-                    count++;
-                    k = i - j;
-                }
-                j = lps[j - 1];
-            } else if (i < haystack->length && haystack->data[i] != needle[j]) {
-                if (j) {
-                    j = lps[j - 1];
-                } else {
-                    i++;
-                }
-            }
-        }
-
-        free(lps);
-        return count;
-    }
+    return xMemCount(haystack->data, haystack->length, needle, len, false);
 }
 
 xSize xString_count_overlapping(const xString *haystack, const xChar *needle, xSize len)
 {
     // check validity of passed arguments
-    if (!haystack || !haystack->refCount || !needle || !len || len > haystack->length) {
+    if (!xString_isValid(haystack) || !needle || !len || len > haystack->length) {
         return 0;
     }
 
-    if (len == 1) {
-        // single character search
-        xSize count = 0;
-        for (xSize i = 0; i < haystack->length; i++) {
-            if (haystack->data[i] == needle[0]) {
-                count++;
-            }
-        }
-        return count;
-    } else {
-        // multiple character pattern search
-        xSize count = 0;
-        xSize *lps = xString_LPS(needle, len);
-        if (!lps) {
-            return 0;
-        }
-
-        xSize i = 0, j = 0;
-        while (i < haystack->length) {
-            if (haystack->data[i] == needle[j]) {
-                i++;
-                j++;
-            }
-            if (j == len) {
-                count++;
-                j = lps[j - 1];
-            } else if (i < haystack->length && haystack->data[i] != needle[j]) {
-                if (j) {
-                    j = lps[j - 1];
-                } else {
-                    i++;
-                }
-            }
-        }
-
-        free(lps);
-        return count;
-    }
+    return xMemCount(haystack->data, haystack->length, needle, len, true);
 }
 
 xString *xString_replaceFirst(const xString *str, const xChar *needle, xSize needleLen, const xChar *replacement,
@@ -629,7 +535,7 @@ xString *xString_replaceFirst(const xString *str, const xChar *needle, xSize nee
         xString_preallocate(ret, replacementLen - needleLen);
 
         // check if memory reallocation was successful
-        if (ret->capacity < ret->length + replacementLen - needleLen) {
+        if (xString_capacityOf(ret) < ret->length + replacementLen - needleLen) {
             xString_free(ret);
             return NULL;
         }
@@ -695,7 +601,7 @@ xString *xString_replaceLast(const xString *str, const xChar *needle, xSize need
         xString_preallocate(ret, replacementLen - needleLen);
 
         // check if memory reallocation was successful
-        if (ret->capacity < ret->length + replacementLen - needleLen) {
+        if (xString_capacityOf(ret) < ret->length + replacementLen - needleLen) {
             xString_free(ret);
             return xString_new();
         }
@@ -736,61 +642,43 @@ xString *xString_replaceAll(const xString *str, const xChar *needle, xSize needl
         return xString_copy(str);
     }
 
-    // create standalone copy of the string
-    xString *ret = xString_copyDetached(str);
-    if (!ret) {
-        return NULL;
-    }
+    replacementLen = replacement ? replacementLen : 0;
 
-    // get count of replacements to perform
-    xSize count = xString_count(str, needle, needleLen);
+    // get count of replacements to perform (needle is preprocessed once for all searches)
+    xMemFinder finder;
+    xMemFinderInit(&finder, needle, needleLen);
+    xSize count = xMemFinderCount(&finder, str->data, str->length, false);
     if (!count) {
-        return ret;
+        return xString_copy(str);
     }
 
-    // preallocate memory for the replacements (if larger than the needle)
+    // create standalone copy of the string with enough memory for the result
+    xString *ret = xString_copyDetached(str);
+    if (!ret) {
+        return NULL;
+    }
     if (needleLen < replacementLen) {
         xString_preallocate(ret, count * (replacementLen - needleLen));
 
         // check if memory reallocation was successful
-        if (ret->capacity < ret->length + count * (replacementLen - needleLen)) {
+        if (xString_capacityOf(ret) < ret->length + count * (replacementLen - needleLen)) {
             xString_free(ret);
             return xString_copy(str);
         }
     }
 
-    // replace all occurrences of the needle with the replacement
-    xSize pos = 0;
+    // build result in single pass, copying parts between matches from original string
+    xSize src = 0, dest = 0;
     for (xSize i = 0; i < count; i++) {
-        pos = xString_findNext(ret, needle, needleLen, pos);
-        if (pos == XSIZE_MAX) {
-            break;
-        }
-
-        // replace the needle with the replacement
-        if (needleLen < replacementLen) {
-            // shift the rest of the string to the right
-            for (xSize j = ret->length - 1; j >= pos + needleLen; j--) {
-                ret->data[j + replacementLen - needleLen] = ret->data[j];
-            }
-        } else if (needleLen > replacementLen) {
-            // shift the rest of the string to the left
-            for (xSize j = pos + needleLen; j < ret->length; j++) {
-                ret->data[j + replacementLen - needleLen] = ret->data[j];
-            }
-        }
-
-        // insert the replacement into the string
-        xMemCopy(ret->data + pos, replacement, replacementLen);
-        /*
-        for (xSize j = 0; j < replacementLen; j++) {
-            ret->data[pos + j] = replacement[j];
-        }
-        */
-
-        ret->length += replacementLen - needleLen;
-        pos += replacementLen;
+        xSize pos = src + xMemFinderFind(&finder, str->data + src, str->length - src);
+        xMemCopy(ret->data + dest, str->data + src, pos - src);
+        dest += pos - src;
+        xMemCopy(ret->data + dest, replacement, replacementLen);
+        dest += replacementLen;
+        src = pos + needleLen;
     }
+    xMemCopy(ret->data + dest, str->data + src, str->length - src);
+    ret->length = dest + str->length - src;
 
     return ret;
 }
@@ -840,7 +728,7 @@ xString *xString_insert(const xString *str, const xChar *data, xSize len, xSize
 
     // expand string to fit additional data
     xString_preallocate(ret, len);
-    if (ret->capacity < ret->length + len) {
+    if (xString_capacityOf(ret) < ret->length + len) {
         xString_free(ret);
         return NULL;
     }
@@ -862,7 +750,119 @@ xString *xString_insert(const xString *str, const xChar *data, xSize len, xSize
     return ret;
 }
 
-// xString *xString_split(const xString *str, const xChar *delimiter, xSize delimiterLen, xSize *count) {}
+xString **xString_split(const xString *str, const xChar *delimiter, xSize delimiterLen, xSize *count)
+{
+    // validate arguments
+    if (count) {
+        *count = 0;
+    }
+    if (!xString_isValid(str) || !delimiter || !delimiterLen || !count) {
+        return NULL;
+    }
+
+    // count parts (finder does not match inside empty string without data)
+    xMemFinder finder;
+    xMemFinderInit(&finder, delimiter, delimiterLen);
+    xSize parts = xMemFinderCount(&finder, str->data, str->length, false) + 1;
+
+    // array of pointers is followed by part structures in the same block
+    xSize partSize = sizeof(xString *) + sizeof(xString);
+    if (parts > XSIZE_MAX / partSize) {
+        return NULL;
+    }
+    xBool copied = !str->data || xString_isInline(str);
+    xString **ret = (xString **)xAllocator_alloc(str->allocator, parts * partSize);
+    if (!ret) {
+        return NULL;
+    }
+    xString *slices = (xString *)(void *)(ret + parts);
+
+    // every part is substring referencing data of original string (parts of short strings copy their characters)
+    xChar *base = str->baseAddress ? str->baseAddress : str->data;
+    xSize start = 0;
+    for (xSize i = 0; i < parts; i++) {
+        xSize end = (i + 1 < parts) ? start + xMemFinderFind(&finder, str->data + start, str->length - start) : str->length;
+        slices[i] = *str;
+        slices[i].length = end - start;
+        if (copied && str->data) {
+            slices[i].data = slices[i].inlineData;
+            xMemCopy(slices[i].data, str->data + start, end - start);
+            slices[i].inlineCapacity = (xUInt8)(end - start);
+        } else if (!copied) {
+            slices[i].baseAddress = base;
+            slices[i].data = str->data + start;
+            slices[i].capacity = str->capacity - start;
+        }
+        ret[i] = &slices[i];
+        start = end + delimiterLen;
+    }
+    if (!copied) {
+        atomic_fetch_add(&xString_block(str)->refCount, parts);
+    }
+
+    *count = parts;
+    return ret;
+}
+
+void xString_freeSplit(xString **parts, xSize count)
+{
+    // validate arguments
+    if (!parts || !count) {
+        return;
+    }
+
+    // drop references of parts (cleared parts may own separate data)
+    xString *slices = (xString *)(void *)(parts + count);
+    for (xSize i = 0; i < count; i++) {
+        if (xString_isValid(&slices[i])) {
+            xString_release(&slices[i]);
+        }
+    }
+
+    xAllocator_free(slices[0].allocator, parts, count * (sizeof(xString *) + sizeof(xString)));
+}
+
+void xString_splitBegin(xStringSplitIterator *iter, const xString *str, const xChar *delimiter, xSize delimiterLen)
+{
+    // validate arguments
+    if (!iter) {
+        return;
+    }
+    if (!xString_isValid(str) || !delimiter || !delimiterLen) {
+        iter->data = NULL;
+        iter->remaining = 0;
+        iter->finished = true;
+        xMemFinderInit(&iter->finder, NULL, 0);
+        return;
+    }
+
+    iter->data = str->data;
+    iter->remaining = str->length;
+    iter->finished = false;
+    xMemFinderInit(&iter->finder, delimiter, delimiterLen);
+}
+
+xBool xString_splitNext(xStringSplitIterator *iter, const xChar **part, xSize *len)
+{
+    // validate arguments
+    if (!iter || !part || !len || iter->finished) {
+        return false;
+    }
+
+    xSize index = xMemFinderFind(&iter->finder, iter->data, iter->remaining);
+    *part = iter->data;
+    if (index == XSIZE_MAX) {
+        // no more delimiters, rest of string is last part
+        *len = iter->remaining;
+        iter->finished = true;
+    } else {
+        *len = index;
+        iter->data += index + iter->finder.size;
+        iter->remaining -= index + iter->finder.size;
+    }
+
+    return true;
+}
 
 int xString_compare(const xString *str1, const xString *str2)
 {
@@ -877,16 +877,15 @@ int xString_compare(const xString *str1, const xString *str2)
         return 1;
     }
 
-    // compare the strings
-    xSize i = 0;
-    while (i < str1->length && i < str2->length) {
-        if (str1->data[i] != str2->data[i]) {
-            return str1->data[i] - str2->data[i];
-        }
-        i++;
+    // compare common prefix of the strings
+    xSize common = (str1->length < str2->length) ? str1->length : str2->length;
+    int order = xMemCompare((const void *)str1->data, (const void *)str2->data, common, NULL);
+    if (order) {
+        return order;
     }
 
-    return str1->length - str2->length;
+    // common prefix is equal, shorter string precedes longer one
+    return (str1->length < str2->length) ? -1 : (str1->length > str2->length) ? 1 : 0;
 }
 
 int xString_compareIgnoreCase(const xString *str1, const xString *str2)
@@ -1211,16 +1210,17 @@ xString *xString_fromCString(const xChar *cstr)
     }
 
     // allocate memory for the string data
-    ret->data = (xChar *)malloc(cstrlen(cstr) * sizeof(xChar));
-    if (!ret->data) {
+    xSize len = cstrlen(cstr);
+    xString_preallocate(ret, len);
+    if (xString_capacityOf(ret) < len) {
         // not enough memory can be allocated. return NULL
         xString_free(ret);
         return NULL;
     }
 
     // copy the data from the C string
-    ret->length = ret->capacity = cstrlen(cstr);
-    xMemCopy(ret->data, cstr, ret->length);
+    ret->length = len;
+    xMemCopy(ret->data, cstr, len);
 
     return ret;
 }
@@ -1241,15 +1241,15 @@ xString *xString_fromCStringS(const xChar *cstr, xSize len)
     }
 
     // allocate memory for the string data
-    ret->data = (xChar *)malloc(len);
-    if (!ret->data) {
+    xString_preallocate(ret, len);
+    if (xString_capacityOf(ret) < len) {
         // data allocation failed, clear object and return NULL
         xString_free(ret);
         return NULL;
     }
 
     // copy the data from the C string
-    ret->length = ret->capacity = len;
+    ret->length = len;
     xMemCopy(ret->data, cstr, len);
 
     return ret;
@@ -1283,7 +1283,7 @@ xString *xString_fromLong(long long value)
 
     // allocate memory for the string data
     xString_preallocate(ret, len + sign);
-    if (ret->capacity < len + sign) {
+    if (xString_capacityOf(ret) < len + sign) {
         // failed to allocate data block, return NULL
         xString_free(ret);
         return NULL;
@@ -1316,7 +1316,7 @@ xString *xString_fromFloat(float value)
 
     // create a new string
     xString *ret = xString_new();
-    if (!ret->refCount) {
+    if (!xString_isValid(ret)) {
         return ret;
     }
 
@@ -0,0 +1,368 @@
+#include "xString/xStringMatcher.h"
+
+#include "xBase/xLimits.h"
+#include "xBase/xMemtools.h"
+#include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
+#include "xString/xString.h"
+
+// marks missing output link (state has no shorter matching suffix)
+#define XSTRINGMATCHER_NONE XUINT32_MAX
+
+struct xStringMatcher_s {
+    xUInt32 *delta;               // DFA transitions (states x classes), targets premultiplied by number of classes
+    xUInt32 start;                // premultiplied start state
+    xUInt32 matchLimit;           // premultiplied states below this value have matches (output states are numbered first)
+    xSize classes;                // number of byte classes (columns of transition table)
+    xSize states;                 // number of states
+    xSize outputStates;           // number of states with matches
+    xSize patterns;               // number of patterns
+    xSize *lengths;               // length of each pattern
+    xSize *matchCount;            // number of matches ending in each output state (own and those of shorter suffixes)
+    xSize *outputStart;           // start of own patterns of each output state in outputs, followed by number of patterns
+    xSize *outputs;               // indices of patterns grouped by state they end in
+    xUInt32 *outputLink;          // nearest output state with own patterns among proper suffixes of each output state
+    xUInt16 classOf[256];         // byte class of each byte value (class 0 holds bytes not occurring in patterns)
+    const xAllocator *allocator;  // allocator owning matcher memory
+};
+
+/**
+ * @brief
+ * Free matcher arrays (any of them may be NULL after failed construction) and matcher itself.
+ */
+static void xStringMatcher_release(xStringMatcher *matcher)
+{
+    const xAllocator *allocator = matcher->allocator;
+    xAllocator_free(allocator, matcher->delta, matcher->states * matcher->classes * sizeof(xUInt32));
+    xAllocator_free(allocator, matcher->lengths, matcher->patterns * sizeof(xSize));
+    xAllocator_free(allocator, matcher->matchCount, matcher->outputStates * sizeof(xSize));
+    xAllocator_free(allocator, matcher->outputStart, (matcher->outputStates + 1) * sizeof(xSize));
+    xAllocator_free(allocator, matcher->outputs, matcher->patterns * sizeof(xSize));
+    xAllocator_free(allocator, matcher->outputLink, matcher->outputStates * sizeof(xUInt32));
+    xAllocator_free(allocator, matcher, sizeof(xStringMatcher));
+}
+
+/**
+ * @brief
+ * Build trie of patterns and complete it into DFA following failure links, then renumber states and fill output arrays.
+ *
+ * @param matcher Pointer to matcher with classes, patterns and lengths set.
+ * @param patterns Array of pointers to pattern characters.
+ * @param next Zeroed temporary transition table for (total length + 1) states.
+ * @param work Temporary array of 4 * (total length + 1) 32-bit values (queue, failure links, output links, new state ids).
+ * @param terminal Temporary array receiving state where each pattern ends.
+ * @param ownCount Zeroed temporary array of total length + 1 counters.
+ * @return xBool true on success, false if allocation of matcher arrays fails.
+ */
+static xBool xStringMatcher_build(xStringMatcher *matcher, const xChar *const *patterns, xUInt32 *next, xUInt32 *work,
+                                  xSize *terminal, xSize *ownCount)
+{
+    const xAllocator *allocator = matcher->allocator;
+    xSize classes = matcher->classes;
+
+    // insert patterns into trie (state 0 is root, so zero transition means no edge)
+    xSize states = 1;
+    for (xSize p = 0; p < matcher->patterns; p++) {
+        xSize s = 0;
+        for (xSize i = 0; i < matcher->lengths[p]; i++) {
+            xUInt32 *edge = &next[s * classes + matcher->classOf[(xUInt8)patterns[p][i]]];
+            if (!*edge) {
+                *edge = (xUInt32)states++;
+            }
+            s = *edge;
+        }
+        terminal[p] = s;
+        ownCount[s]++;
+    }
+    xUInt32 *queue = work, *fail = work + states, *link = work + 2 * states, *newId = work + 3 * states;
+
+    // visit states in breadth-first order, so failure target of every state is completed before the state itself
+    xSize head = 0, tail = 0;
+    fail[0] = 0;
+    link[0] = XSTRINGMATCHER_NONE;
+    queue[tail++] = 0;
+    while (head < tail) {
+        xUInt32 s = queue[head++];
+        for (xSize c = 0; c < classes; c++) {
+            xUInt32 t = next[s * classes + c];
+            if (t) {
+                fail[t] = s ? next[fail[s] * classes + c] : 0;
+                link[t] = ownCount[fail[t]] ? fail[t] : link[fail[t]];
+                queue[tail++] = t;
+            } else {
+                next[s * classes + c] = s ? next[fail[s] * classes + c] : 0;
+            }
+        }
+    }
+
+    // states with own patterns or with matching suffix are output states
+    xSize outputStates = 0;
+    for (xSize s = 0; s < states; s++) {
+        outputStates += (ownCount[s] || link[s] != XSTRINGMATCHER_NONE) ? 1 : 0;
+    }
+
+    // number output states first (in breadth-first order), so matches are detected by single comparison of premultiplied state
+    xUInt32 nextOutput = 0, nextOther = (xUInt32)outputStates;
+    for (xSize i = 0; i < states; i++) {
+        xUInt32 s = queue[i];
+        newId[s] = (ownCount[s] || link[s] != XSTRINGMATCHER_NONE) ? nextOutput++ : nextOther++;
+    }
+
+    // allocate final arrays
+    matcher->states = states;
+    matcher->outputStates = outputStates;
+    matcher->delta = (xUInt32 *)xAllocator_alloc(allocator, states * classes * sizeof(xUInt32));
+    matcher->matchCount = (xSize *)xAllocator_alloc(allocator, outputStates * sizeof(xSize));
+    matcher->outputStart = (xSize *)xAllocator_alloc(allocator, (outputStates + 1) * sizeof(xSize));
+    matcher->outputs = (xSize *)xAllocator_alloc(allocator, matcher->patterns * sizeof(xSize));
+    matcher->outputLink = (xUInt32 *)xAllocator_alloc(allocator, outputStates * sizeof(xUInt32));
+    if (!matcher->delta || !matcher->matchCount || !matcher->outputStart || !matcher->outputs || !matcher->outputLink) {
+        return false;
+    }
+
+    // copy transitions in new state order with premultiplied targets
+    for (xSize s = 0; s < states; s++) {
+        xUInt32 *row = matcher->delta + newId[s] * classes;
+        for (xSize c = 0; c < classes; c++) {
+            row[c] = newId[next[s * classes + c]] * (xUInt32)classes;
+        }
+    }
+    matcher->start = newId[0] * (xUInt32)classes;
+    matcher->matchLimit = (xUInt32)(outputStates * classes);
+
+    // fill output arrays (patterns of each state stay in ascending order), shorter suffixes are counted first
+    xSize offset = 0;
+    for (xSize i = 0; i < states; i++) {
+        xUInt32 s = queue[i];
+        if (newId[s] >= outputStates) {
+            continue;
+        }
+        matcher->outputStart[newId[s]] = offset;
+        offset += ownCount[s];
+    }
+    matcher->outputStart[outputStates] = offset;
+    for (xSize i = 0; i < states; i++) {
+        xUInt32 s = queue[i];
+        if (newId[s] < outputStates) {
+            xUInt32 l = link[s];
+            matcher->outputLink[newId[s]] = (l == XSTRINGMATCHER_NONE) ? XSTRINGMATCHER_NONE : newId[l];
+            matcher->matchCount[newId[s]] = ownCount[s] + ((l == XSTRINGMATCHER_NONE) ? 0 : matcher->matchCount[newId[l]]);
+        }
+    }
+    for (xSize p = 0; p < matcher->patterns; p++) {
+        xUInt32 s = newId[terminal[p]];
+        matcher->outputs[matcher->outputStart[s]++] = p;
+    }
+    for (xSize s = outputStates; s-- > 0;) {
+        // filling advanced starts to ends of own ranges, so shift them back
+        matcher->outputStart[s] = s ? matcher->outputStart[s - 1] : 0;
+    }
+
+    return true;
+}
+
+xStringMatcher *xStringMatcher_new(const xChar *const *patterns, const xSize *lengths, xSize count)
+{
+    return xStringMatcher_newWithAllocator(patterns, lengths, count, NULL);
+}
+
+xStringMatcher *xStringMatcher_newWithAllocator(const xChar *const *patterns, const xSize *lengths, xSize count,
+                                                const xAllocator *allocator)
+{
+    // validate arguments
+    if (!patterns || !lengths || !count) {
+        return NULL;
+    }
+    xSize total = 0;
+    for (xSize p = 0; p < count; p++) {
+        if (!patterns[p] || !lengths[p] || lengths[p] > XSIZE_MAX / 2 - total) {
+            return NULL;
+        }
+        total += lengths[p];
+    }
+
+    // create matcher structure
+    allocator = allocator ? allocator : xAllocator_getDefault();
+    xStringMatcher *matcher = (xStringMatcher *)xAllocator_alloc(allocator, sizeof(xStringMatcher));
+    if (!matcher) {
+        return NULL;
+    }
+    xMemSet(matcher, 0, sizeof(xStringMatcher));
+    matcher->allocator = allocator;
+
+    // bytes occurring in patterns get own classes, all other bytes share class 0
+    for (xSize p = 0; p < count; p++) {
+        for (xSize i = 0; i < lengths[p]; i++) {
+            matcher->classOf[(xUInt8)patterns[p][i]] = 1;
+        }
+    }
+    matcher->classes = 1;
+    for (xSize b = 0; b < 256; b++) {
+        matcher->classOf[b] = matcher->classOf[b] ? (xUInt16)matcher->classes++ : 0;
+    }
+
+    // premultiplied states must fit into 32 bits
+    xSize maxStates = total + 1;
+    if (maxStates > XUINT32_MAX / matcher->classes) {
+        xStringMatcher_release(matcher);
+        return NULL;
+    }
+    matcher->patterns = count;
+    matcher->lengths = (xSize *)xAllocator_alloc(allocator, count * sizeof(xSize));
+    if (!matcher->lengths) {
+        xStringMatcher_release(matcher);
+        return NULL;
+    }
+    xMemCopy(matcher->lengths, lengths, count * sizeof(xSize));
+
+    // allocate temporary construction arrays
+    xSize nextSize = maxStates * matcher->classes * sizeof(xUInt32);
+    xUInt32 *next = (xUInt32 *)xAllocator_alloc(allocator, nextSize);
+    xUInt32 *work = (xUInt32 *)xAllocator_alloc(allocator, 4 * maxStates * sizeof(xUInt32));
+    xSize *terminal = (xSize *)xAllocator_alloc(allocator, count * sizeof(xSize));
+    xSize *ownCount = (xSize *)xAllocator_alloc(allocator, maxStates * sizeof(xSize));
+    xBool built = false;
+    if (next && work && terminal && ownCount) {
+        xMemSet(next, 0, nextSize);
+        xMemSet(ownCount, 0, maxStates * sizeof(xSize));
+        built = xStringMatcher_build(matcher, patterns, next, work, terminal, ownCount);
+    }
+    xAllocator_free(allocator, next, nextSize);
+    xAllocator_free(allocator, work, 4 * maxStates * sizeof(xUInt32));
+    xAllocator_free(allocator, terminal, count * sizeof(xSize));
+    xAllocator_free(allocator, ownCount, maxStates * sizeof(xSize));
+
+    if (!built) {
+        xStringMatcher_release(matcher);
+        return NULL;
+    }
+
+    return matcher;
+}
+
+void xStringMatcher_free(xStringMatcher *matcher)
+{
+    // validate arguments
+    if (!matcher) {
+        return;
+    }
+
+    xStringMatcher_release(matcher);
+}
+
+inline xSize xStringMatcher_getPatternCount(const xStringMatcher *matcher) { return matcher ? matcher->patterns : 0; }
+
+inline xSize xStringMatcher_getStateCount(const xStringMatcher *matcher) { return matcher ? matcher->states : 0; }
+
+/**
+ * @brief
+ * Report all matches ending in output state at given index.
+ *
+ * @return xBool false if func requested to stop scanning.
+ */
+static xBool xStringMatcher_report(const xStringMatcher *matcher, xUInt32 state, xSize end, xStringMatcherFunc func,
+                                   void *context, xSize *reported)
+{
+    // walk own patterns of state, then those of its matching suffixes (from longest to shortest)
+    for (xUInt32 s = state; s != XSTRINGMATCHER_NONE; s = matcher->outputLink[s]) {
+        for (xSize i = matcher->outputStart[s]; i < matcher->outputStart[s + 1]; i++) {
+            xStringMatch match = {matcher->outputs[i], end - matcher->lengths[matcher->outputs[i]], end};
+            (*reported)++;
+            if (!func(context, &match)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+xSize xStringMatcher_scanIn(const xStringMatcher *matcher, const xChar *data, xSize len, xStringMatcherFunc func,
+                            void *context)
+{
+    // validate arguments
+    if (!matcher || !data || !func) {
+        return 0;
+    }
+
+    const xUInt32 *delta = matcher->delta;
+    const xUInt16 *classOf = matcher->classOf;
+    xUInt32 state = matcher->start, limit = matcher->matchLimit;
+    xSize reported = 0;
+    for (xSize i = 0; i < len; i++) {
+        state = delta[state + classOf[(xUInt8)data[i]]];
+        if (state < limit &&
+            !xStringMatcher_report(matcher, state / (xUInt32)matcher->classes, i + 1, func, context, &reported)) {
+            break;
+        }
+    }
+
+    return reported;
+}
+
+xSize xStringMatcher_scan(const xStringMatcher *matcher, const xString *str, xStringMatcherFunc func, void *context)
+{
+    return xStringMatcher_scanIn(matcher, xString_getData(str), xString_getLength(str), func, context);
+}
+
+xSize xStringMatcher_countIn(const xStringMatcher *matcher, const xChar *data, xSize len)
+{
+    // validate arguments
+    if (!matcher || !data) {
+        return 0;
+    }
+
+    // match counts include matching suffixes, so each byte costs single lookup
+    const xUInt32 *delta = matcher->delta;
+    const xUInt16 *classOf = matcher->classOf;
+    xUInt32 state = matcher->start, limit = matcher->matchLimit;
+    xSize count = 0;
+    for (xSize i = 0; i < len; i++) {
+        state = delta[state + classOf[(xUInt8)data[i]]];
+        if (state < limit) {
+            count += matcher->matchCount[state / (xUInt32)matcher->classes];
+        }
+    }
+
+    return count;
+}
+
+xSize xStringMatcher_count(const xStringMatcher *matcher, const xString *str)
+{
+    return xStringMatcher_countIn(matcher, xString_getData(str), xString_getLength(str));
+}
+
+xBool xStringMatcher_findFirstIn(const xStringMatcher *matcher, const xChar *data, xSize len, xStringMatch *match)
+{
+    // validate arguments
+    if (!matcher || !data) {
+        return false;
+    }
+
+    const xUInt32 *delta = matcher->delta;
+    const xUInt16 *classOf = matcher->classOf;
+    xUInt32 state = matcher->start, limit = matcher->matchLimit;
+    for (xSize i = 0; i < len; i++) {
+        state = delta[state + classOf[(xUInt8)data[i]]];
+        if (state < limit) {
+            // longest match is first own pattern of state or of its nearest matching suffix
+            xUInt32 s = state / (xUInt32)matcher->classes;
+            if (matcher->outputStart[s] == matcher->outputStart[s + 1]) {
+                s = matcher->outputLink[s];
+            }
+            if (match) {
+                match->pattern = matcher->outputs[matcher->outputStart[s]];
+                match->end = i + 1;
+                match->start = match->end - matcher->lengths[match->pattern];
+            }
+            return true;
+        }
+    }
+
+    return false;
+}
+
+xBool xStringMatcher_findFirst(const xStringMatcher *matcher, const xString *str, xStringMatch *match)
+{
+    return xStringMatcher_findFirstIn(matcher, xString_getData(str), xString_getLength(str), match);
+}
@@ -0,0 +1,112 @@
+#include "xString/xStringPattern.h"
+
+#include "xBase/xMemtools.h"
+#include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
+#include "xString/xString.h"
+
+struct xStringPattern_s {
+    xMemFinder finder;            // precomputed search state (refers to needle copy below)
+    const xAllocator *allocator;  // allocator owning pattern
+    xSize length;                 // length of needle
+    xChar needle[];               // copy of needle
+};
+
+xStringPattern *xStringPattern_new(const xChar *needle, xSize len)
+{
+    return xStringPattern_newWithAllocator(needle, len, NULL);
+}
+
+xStringPattern *xStringPattern_newWithAllocator(const xChar *needle, xSize len, const xAllocator *allocator)
+{
+    // validate arguments
+    if (!needle || len > XSIZE_MAX - sizeof(xStringPattern)) {
+        return NULL;
+    }
+
+    // allocate pattern together with needle copy
+    allocator = allocator ? allocator : xAllocator_getDefault();
+    xStringPattern *pattern = (xStringPattern *)xAllocator_alloc(allocator, sizeof(xStringPattern) + len);
+    if (!pattern) {
+        return NULL;
+    }
+    pattern->allocator = allocator;
+    pattern->length = len;
+    xMemCopy(pattern->needle, needle, len);
+
+    // compile search state once for all searches
+    xMemFinderInit(&pattern->finder, pattern->needle, len);
+
+    return pattern;
+}
+
+void xStringPattern_free(xStringPattern *pattern)
+{
+    // validate arguments
+    if (!pattern) {
+        return;
+    }
+
+    xAllocator_free(pattern->allocator, pattern, sizeof(xStringPattern) + pattern->length);
+}
+
+inline xSize xStringPattern_getLength(const xStringPattern *pattern) { return pattern ? pattern->length : 0; }
+
+inline const xChar *xStringPattern_getData(const xStringPattern *pattern) { return pattern ? pattern->needle : NULL; }
+
+xSize xStringPattern_find(const xStringPattern *pattern, const xString *str) { return xStringPattern_findFrom(pattern, str, 0); }
+
+xSize xStringPattern_findFrom(const xStringPattern *pattern, const xString *str, xSize start)
+{
+    // validate arguments (same rules as xString_find())
+    xSize length = xString_getLength(str);
+    if (!pattern || !xString_isValid(str) || start >= length || pattern->length > length - start) {
+        return XSIZE_MAX;
+    }
+
+    xSize index = xMemFinderFind(&pattern->finder, xString_getData(str) + start, length - start);
+    return (index == XSIZE_MAX) ? XSIZE_MAX : start + index;
+}
+
+xSize xStringPattern_findLast(const xStringPattern *pattern, const xString *str)
+{
+    // validate arguments (same rules as xString_findLast())
+    xSize length = xString_getLength(str);
+    if (!pattern || !xString_isValid(str) || !length || pattern->length > length) {
+        return XSIZE_MAX;
+    } else if (pattern->length == 0) {
+        return length - 1;
+    }
+
+    return xMemFinderFindLast(&pattern->finder, xString_getData(str), length);
+}
+
+xSize xStringPattern_findIn(const xStringPattern *pattern, const xChar *data, xSize len)
+{
+    // validate arguments
+    if (!pattern || !data) {
+        return XSIZE_MAX;
+    }
+
+    return xMemFinderFind(&pattern->finder, data, len);
+}
+
+xSize xStringPattern_count(const xStringPattern *pattern, const xString *str)
+{
+    // validate arguments
+    if (!pattern || !xString_isValid(str)) {
+        return 0;
+    }
+
+    return xMemFinderCount(&pattern->finder, xString_getData(str), xString_getLength(str), false);
+}
+
+xSize xStringPattern_count_overlapping(const xStringPattern *pattern, const xString *str)
+{
+    // validate arguments
+    if (!pattern || !xString_isValid(str)) {
+        return 0;
+    }
+
+    return xMemFinderCount(&pattern->finder, xString_getData(str), xString_getLength(str), true);
+}
@@ -1,18 +1,19 @@
 #include "xStructures/xArray.h"
-#include <stdlib.h>  // standard library (for malloc, free)
 #include "xBase/xMemtools.h"
 #include "xBase/xTypes.h"
-
-// TODO: remove dependency on stdlib.h (custom memory allocation functions)
+#include "xMemory/xAllocator.h"
 
 struct xArray_s {
     void *data;
     xSize elemSize;
     xSize arrSize;
     xSize arrCapacity;
+    const xAllocator *allocator;
 };
 
-xArray *xArray_new(xSize elemSize)
+xArray *xArray_new(xSize elemSize) { return xArray_newWithAllocator(elemSize, NULL); }
+
+xArray *xArray_newWithAllocator(xSize elemSize, const xAllocator *allocator)
 {
     // validate passed argument
     if (elemSize == 0) {
@@ -20,8 +21,9 @@ xArray *xArray_new(xSize elemSize)
     }
 
     // allocate array base struct
+    allocator = allocator ? allocator : xAllocator_getDefault();
     xArray *arr = NULL;
-    if (!(arr = (xArray *)malloc(sizeof(xArray)))) {
+    if (!(arr = (xArray *)xAllocator_alloc(allocator, sizeof(xArray)))) {
         return NULL;
     }
 
@@ -30,6 +32,7 @@ xArray *xArray_new(xSize elemSize)
     arr->elemSize = elemSize;
     arr->arrSize = 0;
     arr->arrCapacity = 0;
+    arr->allocator = allocator;
 
     return arr;
 }
@@ -40,8 +43,8 @@ void xArray_free(xArray *arr)
         return;
     }
 
-    free(arr->data);
-    free(arr);
+    xAllocator_free(arr->allocator, arr->data, arr->arrCapacity * arr->elemSize);
+    xAllocator_free(arr->allocator, arr, sizeof(xArray));
 }
 
 inline xSize xArray_getSize(const xArray *arr) { return (arr) ? arr->arrSize : 0; }
@@ -74,7 +77,8 @@ void xArray_resize(xArray *arr, xSize newSize)
     }
 
     // reallocate memory block of the array
-    void *newData = (void *)realloc(arr->data, newCapacity * arr->elemSize);
+    void *newData =
+        xAllocator_realloc(arr->allocator, arr->data, arr->arrCapacity * arr->elemSize, newCapacity * arr->elemSize);
     if (!newData) {
         return;
     }
@@ -269,7 +273,7 @@ xArray *xArray_copy(const xArray *arr)
     }
 
     // create new array object and return if source array is empty
-    xArray *copy = xArray_new(arr->elemSize);
+    xArray *copy = xArray_newWithAllocator(arr->elemSize, arr->allocator);
     if (!arr->data || arr->arrSize == 0) {
         return copy;
     }
@@ -315,11 +319,11 @@ xArray *xArray_filter(const xArray *arr, xBool (*predicate)(const void *))
         return NULL;
     } else if (!arr->data || arr->arrSize == 0) {
         // return empty array if the source array is empty
-        return xArray_new(arr->elemSize);
+        return xArray_newWithAllocator(arr->elemSize, arr->allocator);
     }
 
     // create new array object
-    xArray *filtered = xArray_new(arr->elemSize);
+    xArray *filtered = xArray_newWithAllocator(arr->elemSize, arr->allocator);
     if (!xArray_isValid(filtered)) {
         return NULL;
     }
@@ -342,11 +346,11 @@ xArray *xArray_map(const xArray *arr, void *(*mapper)(const void *))
         return NULL;
     } else if (!arr->data || arr->arrSize == 0) {
         // return empty array if the source one is empty
-        return xArray_new(arr->elemSize);
+        return xArray_newWithAllocator(arr->elemSize, arr->allocator);
     }
 
     // create new array object
-    xArray *mapped = xArray_new(arr->elemSize);
+    xArray *mapped = xArray_newWithAllocator(arr->elemSize, arr->allocator);
     if (!xArray_isValid(mapped)) {
         return NULL;
     }
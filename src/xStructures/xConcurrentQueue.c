@@ -0,0 +1,304 @@
+#include "xStructures/xConcurrentQueue.h"
+#include <stdatomic.h>  // atomic_size_t
+#include <stdint.h>     // intptr_t
+#include "xBase/xCpu.h"
+#include "xBase/xMemtools.h"
+#include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
+
+struct xConcurrentQueue_s {
+    // read-only after construction
+    xUInt8 *slots;                // slot array (each MPMC slot starts with its sequence number)
+    xSize slotSize;               // distance between slots in bytes
+    xSize mask;                   // capacity - 1
+    xSize elemSize;               // size of single element in bytes
+    xConcurrentQueueMode mode;    // thread access pattern
+    const xAllocator *allocator;  // allocator of structure and slots
+    xUInt8 pad0[XCPU_CACHELINE_SIZE];
+
+    // producer side
+    atomic_size_t tail;  // position of next element to be enqueued
+    xSize cachedHead;    // last head seen by SPSC producer
+    xUInt8 pad1[XCPU_CACHELINE_SIZE - sizeof(atomic_size_t) - sizeof(xSize)];
+
+    // consumer side
+    atomic_size_t head;  // position of next element to be dequeued
+    xSize cachedTail;    // last tail seen by SPSC consumer
+    xUInt8 pad2[XCPU_CACHELINE_SIZE - sizeof(atomic_size_t) - sizeof(xSize)];
+};
+
+// element data of MPMC slot follows its sequence number
+#define XCONCURRENTQUEUE_SEQUENCE_SIZE sizeof(atomic_size_t)
+
+static inline xUInt8 *xConcurrentQueue_slot(const xConcurrentQueue *queue, xSize position)
+{
+    return queue->slots + (position & queue->mask) * queue->slotSize;
+}
+
+static inline atomic_size_t *xConcurrentQueue_sequence(const xConcurrentQueue *queue, xSize position)
+{
+    return (atomic_size_t *)xConcurrentQueue_slot(queue, position);
+}
+
+xConcurrentQueue *xConcurrentQueue_new(xSize elemSize, xSize capacity, xConcurrentQueueMode mode)
+{
+    return xConcurrentQueue_newWithAllocator(elemSize, capacity, mode, NULL);
+}
+
+xConcurrentQueue *xConcurrentQueue_newWithAllocator(xSize elemSize, xSize capacity, xConcurrentQueueMode mode,
+                                                    const xAllocator *allocator)
+{
+    // validate passed arguments
+    if (!elemSize || !capacity || capacity > ((xSize)-1 >> 1) + 1 ||
+        (mode != XCONCURRENTQUEUE_SPSC && mode != XCONCURRENTQUEUE_MPMC)) {
+        return NULL;
+    }
+
+    // round capacity up to power of 2 so positions map to slots with mask
+    xSize slots = 1;
+    while (slots < capacity) {
+        slots <<= 1;
+    }
+    xSize slotSize = elemSize;
+    if (mode == XCONCURRENTQUEUE_MPMC) {
+        slotSize = (XCONCURRENTQUEUE_SEQUENCE_SIZE + elemSize + sizeof(atomic_size_t) - 1) & ~(sizeof(atomic_size_t) - 1);
+        if (slotSize < elemSize) {
+            return NULL;
+        }
+    }
+    if (slotSize > (xSize)-1 / slots) {
+        return NULL;
+    }
+
+    // allocate queue structure and its slots
+    allocator = allocator ? allocator : xAllocator_getDefault();
+    xConcurrentQueue *queue = (xConcurrentQueue *)xAllocator_alloc(allocator, sizeof(xConcurrentQueue));
+    if (!queue) {
+        return NULL;
+    }
+    if (!(queue->slots = (xUInt8 *)xAllocator_alloc(allocator, slots * slotSize))) {
+        xAllocator_free(allocator, queue, sizeof(xConcurrentQueue));
+        return NULL;
+    }
+
+    queue->slotSize = slotSize;
+    queue->mask = slots - 1;
+    queue->elemSize = elemSize;
+    queue->mode = mode;
+    queue->allocator = allocator;
+    atomic_init(&queue->tail, 0);
+    atomic_init(&queue->head, 0);
+    queue->cachedHead = 0;
+    queue->cachedTail = 0;
+
+    // every MPMC slot starts free for producer reaching its position in first lap
+    if (mode == XCONCURRENTQUEUE_MPMC) {
+        for (xSize i = 0; i < slots; i++) {
+            atomic_init(xConcurrentQueue_sequence(queue, i), i);
+        }
+    }
+
+    return queue;
+}
+
+void xConcurrentQueue_free(xConcurrentQueue *queue)
+{
+    // validate passed argument
+    if (!queue) {
+        return;
+    }
+
+    xAllocator_free(queue->allocator, queue->slots, (queue->mask + 1) * queue->slotSize);
+    xAllocator_free(queue->allocator, queue, sizeof(xConcurrentQueue));
+}
+
+xSize xConcurrentQueue_getSize(const xConcurrentQueue *queue)
+{
+    if (!queue) {
+        return 0;
+    }
+
+    // head is read first, so tail read afterwards can only be further ahead
+    xSize head = atomic_load_explicit(&((xConcurrentQueue *)queue)->head, memory_order_acquire);
+    xSize tail = atomic_load_explicit(&((xConcurrentQueue *)queue)->tail, memory_order_acquire);
+    xSize size = (tail > head) ? tail - head : 0;
+    return (size > queue->mask + 1) ? queue->mask + 1 : size;
+}
+
+inline xSize xConcurrentQueue_getCapacity(const xConcurrentQueue *queue) { return (queue) ? queue->mask + 1 : 0; }
+
+inline xSize xConcurrentQueue_getElemSize(const xConcurrentQueue *queue) { return (queue) ? queue->elemSize : 0; }
+
+inline xConcurrentQueueMode xConcurrentQueue_getMode(const xConcurrentQueue *queue)
+{
+    return (queue) ? queue->mode : XCONCURRENTQUEUE_SPSC;
+}
+
+inline xBool xConcurrentQueue_isValid(const xConcurrentQueue *queue)
+{
+    return (queue && queue->slots && queue->elemSize) ? true : false;
+}
+
+/**
+ * @brief
+ * Copy elements between array and consecutive ring slots starting at given position, wrapping around end of slot array.
+ */
+static void xConcurrentQueue_copyIn(xConcurrentQueue *queue, xSize position, const xUInt8 *data, xSize count)
+{
+    xSize index = position & queue->mask;
+    xSize first = queue->mask + 1 - index;
+    first = (first < count) ? first : count;
+    xMemCopy(queue->slots + index * queue->elemSize, data, first * queue->elemSize);
+    if (count > first) {
+        xMemCopy(queue->slots, data + first * queue->elemSize, (count - first) * queue->elemSize);
+    }
+}
+
+static void xConcurrentQueue_copyOut(const xConcurrentQueue *queue, xSize position, xUInt8 *dest, xSize count)
+{
+    xSize index = position & queue->mask;
+    xSize first = queue->mask + 1 - index;
+    first = (first < count) ? first : count;
+    xMemCopy(dest, queue->slots + index * queue->elemSize, first * queue->elemSize);
+    if (count > first) {
+        xMemCopy(dest + first * queue->elemSize, queue->slots, (count - first) * queue->elemSize);
+    }
+}
+
+static xSize xConcurrentQueue_spscEnqueue(xConcurrentQueue *queue, const xUInt8 *data, xSize count)
+{
+    // only producer writes tail, consumer head is reloaded only when cached value shows too little room
+    xSize tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    xSize capacity = queue->mask + 1;
+    if (capacity - (tail - queue->cachedHead) < count) {
+        queue->cachedHead = atomic_load_explicit(&queue->head, memory_order_acquire);
+    }
+    xSize room = capacity - (tail - queue->cachedHead);
+    count = (count < room) ? count : room;
+    if (!count) {
+        return 0;
+    }
+
+    xConcurrentQueue_copyIn(queue, tail, data, count);
+    atomic_store_explicit(&queue->tail, tail + count, memory_order_release);
+    return count;
+}
+
+static xSize xConcurrentQueue_spscDequeue(xConcurrentQueue *queue, xUInt8 *dest, xSize count)
+{
+    // only consumer writes head, producer tail is reloaded only when cached value shows too few elements
+    xSize head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    if (queue->cachedTail - head < count) {
+        queue->cachedTail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    }
+    xSize available = queue->cachedTail - head;
+    count = (count < available) ? count : available;
+    if (!count) {
+        return 0;
+    }
+
+    xConcurrentQueue_copyOut(queue, head, dest, count);
+    atomic_store_explicit(&queue->head, head + count, memory_order_release);
+    return count;
+}
+
+/**
+ * @brief
+ * Claim up to count consecutive positions on given end of MPMC queue.
+ *
+ * @param end Position counter to advance (tail for producers, head for consumers).
+ * @param lap Difference between position and slot sequence number when slot is ready (0 for producers, 1 for consumers).
+ * @param position Receives first claimed position.
+ * @return xSize Number of claimed positions (0 if queue is full for producers or empty for consumers).
+ */
+static xSize xConcurrentQueue_mpmcClaim(xConcurrentQueue *queue, atomic_size_t *end, xSize lap, xSize count, xSize *position)
+{
+    xSize pos = atomic_load_explicit(end, memory_order_relaxed);
+    for (;;) {
+        xSize seq = atomic_load_explicit(xConcurrentQueue_sequence(queue, pos), memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + lap);
+        if (diff < 0) {
+            // slot still holds element from previous lap (full) or was not written yet (empty)
+            return 0;
+        } else if (diff > 0) {
+            // other thread already claimed this position
+            pos = atomic_load_explicit(end, memory_order_relaxed);
+            continue;
+        }
+
+        // ready slots stay ready until their position is claimed, so whole run can be taken at once
+        xSize ready = 1;
+        while (ready < count &&
+               atomic_load_explicit(xConcurrentQueue_sequence(queue, pos + ready), memory_order_acquire) == pos + ready + lap) {
+            ready++;
+        }
+        if (atomic_compare_exchange_weak_explicit(end, &pos, pos + ready, memory_order_relaxed, memory_order_relaxed)) {
+            *position = pos;
+            return ready;
+        }
+    }
+}
+
+static xSize xConcurrentQueue_mpmcEnqueue(xConcurrentQueue *queue, const xUInt8 *data, xSize count)
+{
+    xSize pos = 0;
+    count = xConcurrentQueue_mpmcClaim(queue, &queue->tail, 0, count, &pos);
+
+    // publish every element to consumers by advancing its sequence number
+    for (xSize i = 0; i < count; i++) {
+        xUInt8 *slot = xConcurrentQueue_slot(queue, pos + i);
+        xMemCopy(slot + XCONCURRENTQUEUE_SEQUENCE_SIZE, data + i * queue->elemSize, queue->elemSize);
+        atomic_store_explicit((atomic_size_t *)slot, pos + i + 1, memory_order_release);
+    }
+    return count;
+}
+
+static xSize xConcurrentQueue_mpmcDequeue(xConcurrentQueue *queue, xUInt8 *dest, xSize count)
+{
+    xSize pos = 0;
+    count = xConcurrentQueue_mpmcClaim(queue, &queue->head, 1, count, &pos);
+
+    // release every slot to producer of next lap
+    for (xSize i = 0; i < count; i++) {
+        xUInt8 *slot = xConcurrentQueue_slot(queue, pos + i);
+        xMemCopy(dest + i * queue->elemSize, slot + XCONCURRENTQUEUE_SEQUENCE_SIZE, queue->elemSize);
+        atomic_store_explicit((atomic_size_t *)slot, pos + i + queue->mask + 1, memory_order_release);
+    }
+    return count;
+}
+
+xSize xConcurrentQueue_tryEnqueueBatch(xConcurrentQueue *queue, const void *data, xSize count)
+{
+    // validate passed arguments
+    if (!xConcurrentQueue_isValid(queue) || !data || !count) {
+        return 0;
+    }
+
+    if (queue->mode == XCONCURRENTQUEUE_SPSC) {
+        return xConcurrentQueue_spscEnqueue(queue, (const xUInt8 *)data, count);
+    }
+    return xConcurrentQueue_mpmcEnqueue(queue, (const xUInt8 *)data, count);
+}
+
+xSize xConcurrentQueue_tryDequeueBatch(xConcurrentQueue *queue, void *dest, xSize maxCount)
+{
+    // validate passed arguments
+    if (!xConcurrentQueue_isValid(queue) || !dest || !maxCount) {
+        return 0;
+    }
+
+    if (queue->mode == XCONCURRENTQUEUE_SPSC) {
+        return xConcurrentQueue_spscDequeue(queue, (xUInt8 *)dest, maxCount);
+    }
+    return xConcurrentQueue_mpmcDequeue(queue, (xUInt8 *)dest, maxCount);
+}
+
+xBool xConcurrentQueue_tryEnqueue(xConcurrentQueue *queue, const void *data)
+{
+    return (xConcurrentQueue_tryEnqueueBatch(queue, data, 1) == 1) ? true : false;
+}
+
+xBool xConcurrentQueue_tryDequeue(xConcurrentQueue *queue, void *dest)
+{
+    return (xConcurrentQueue_tryDequeueBatch(queue, dest, 1) == 1) ? true : false;
+}
@@ -0,0 +1,377 @@
+#include "xStructures/xConcurrentStack.h"
+#include <stdatomic.h>  // atomic_uint_least64_t
+#include <stdlib.h>     // malloc (for element copies returned to caller)
+#include "xBase/xCpu.h"
+#include "xBase/xMemtools.h"
+#include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
+
+#define XCONCURRENTSTACK_CHUNK_BASE 64         // number of nodes in first chunk, every following chunk is twice as large
+#define XCONCURRENTSTACK_CHUNK_COUNT 26        // chunks needed to address every 32-bit node index
+#define XCONCURRENTSTACK_ELIMINATION_SLOTS 8   // number of slots where pushes wait for concurrent pops
+#define XCONCURRENTSTACK_ELIMINATION_SPINS 64  // number of checks before waiting push withdraws its offer
+
+// list heads and elimination slots hold `index + 1` of node in low half (0 for none) and modification tag in high half
+#define XCONCURRENTSTACK_PACK(ref, tag) (((xUInt64)(tag) << 32) | (xUInt64)(ref))
+#define XCONCURRENTSTACK_REF(value) ((xUInt32)((value) & 0xFFFFFFFF))
+#define XCONCURRENTSTACK_TAG(value) ((xUInt32)((value) >> 32))
+
+typedef struct xConcurrentStackSlot_s {
+    atomic_uint_least64_t offer;  // node offered by waiting push (0 if slot is free)
+    xUInt8 pad[XCPU_CACHELINE_SIZE - sizeof(atomic_uint_least64_t)];
+} xConcurrentStackSlot;
+
+struct xConcurrentStack_s {
+    // read-only after construction
+    xSize elemSize;                                          // size of single element in bytes
+    xSize nodeSize;                                          // distance between nodes in chunk
+    const xAllocator *allocator;                             // allocator of structure and node chunks
+    _Atomic(xUInt8 *) chunks[XCONCURRENTSTACK_CHUNK_COUNT];  // node storage (allocated on demand)
+    xUInt8 pad0[XCPU_CACHELINE_SIZE];
+
+    atomic_uint_least64_t top;  // tagged reference to top node of stack
+    xUInt8 pad1[XCPU_CACHELINE_SIZE - sizeof(atomic_uint_least64_t)];
+
+    atomic_uint_least64_t spare;      // tagged reference to first node of recycled node list
+    atomic_uint_least32_t nodeCount;  // number of nodes handed out from chunks
+    atomic_uint_least32_t ticket;     // source of elimination offer tags
+    atomic_size_t size;               // number of elements in stack
+    xUInt8 pad2[XCPU_CACHELINE_SIZE];
+
+    xConcurrentStackSlot elimination[XCONCURRENTSTACK_ELIMINATION_SLOTS];
+};
+
+// node starts with reference to next node, followed by element data
+#define XCONCURRENTSTACK_NEXT_SIZE sizeof(xUInt64)
+
+static _Thread_local xUInt32 xConcurrentStack_seed;
+
+static inline xSize xConcurrentStack_chunkSize(xSize chunk) { return (xSize)XCONCURRENTSTACK_CHUNK_BASE << chunk; }
+
+/**
+ * @brief
+ * Get chunk holding node with given index and position of node inside it.
+ */
+static inline xSize xConcurrentStack_locate(xUInt32 index, xSize *offset)
+{
+    xUInt64 units = (xUInt64)index / XCONCURRENTSTACK_CHUNK_BASE + 1;
+    xSize chunk = (xSize)(63 - __builtin_clzll(units));
+    *offset = index - XCONCURRENTSTACK_CHUNK_BASE * (((xSize)1 << chunk) - 1);
+    return chunk;
+}
+
+static inline xUInt8 *xConcurrentStack_node(xConcurrentStack *stack, xUInt32 index)
+{
+    xSize offset = 0;
+    xSize chunk = xConcurrentStack_locate(index, &offset);
+    return atomic_load_explicit(&stack->chunks[chunk], memory_order_acquire) + offset * stack->nodeSize;
+}
+
+static inline atomic_uint_least32_t *xConcurrentStack_next(xConcurrentStack *stack, xUInt32 index)
+{
+    return (atomic_uint_least32_t *)xConcurrentStack_node(stack, index);
+}
+
+static inline xUInt8 *xConcurrentStack_data(xConcurrentStack *stack, xUInt32 index)
+{
+    return xConcurrentStack_node(stack, index) + XCONCURRENTSTACK_NEXT_SIZE;
+}
+
+xConcurrentStack *xConcurrentStack_new(xSize elemSize) { return xConcurrentStack_newWithAllocator(elemSize, NULL); }
+
+xConcurrentStack *xConcurrentStack_newWithAllocator(xSize elemSize, const xAllocator *allocator)
+{
+    // validate passed argument
+    if (!elemSize || elemSize > (xSize)-1 / 2 - XCONCURRENTSTACK_NEXT_SIZE) {
+        return NULL;
+    }
+
+    // allocate stack structure, nodes are allocated on demand
+    allocator = allocator ? allocator : xAllocator_getDefault();
+    xConcurrentStack *stack = (xConcurrentStack *)xAllocator_alloc(allocator, sizeof(xConcurrentStack));
+    if (!stack) {
+        return NULL;
+    }
+
+    stack->elemSize = elemSize;
+    stack->nodeSize =
+        (XCONCURRENTSTACK_NEXT_SIZE + elemSize + XCONCURRENTSTACK_NEXT_SIZE - 1) & ~(XCONCURRENTSTACK_NEXT_SIZE - 1);
+    stack->allocator = allocator;
+    for (xSize i = 0; i < XCONCURRENTSTACK_CHUNK_COUNT; i++) {
+        atomic_init(&stack->chunks[i], NULL);
+    }
+    atomic_init(&stack->top, 0);
+    atomic_init(&stack->spare, 0);
+    atomic_init(&stack->nodeCount, 0);
+    atomic_init(&stack->ticket, 0);
+    atomic_init(&stack->size, 0);
+    for (xSize i = 0; i < XCONCURRENTSTACK_ELIMINATION_SLOTS; i++) {
+        atomic_init(&stack->elimination[i].offer, 0);
+    }
+
+    return stack;
+}
+
+void xConcurrentStack_free(xConcurrentStack *stack)
+{
+    // validate passed argument
+    if (!stack) {
+        return;
+    }
+
+    for (xSize i = 0; i < XCONCURRENTSTACK_CHUNK_COUNT; i++) {
+        xUInt8 *chunk = atomic_load_explicit(&stack->chunks[i], memory_order_relaxed);
+        xAllocator_free(stack->allocator, chunk, xConcurrentStack_chunkSize(i) * stack->nodeSize);
+    }
+    xAllocator_free(stack->allocator, stack, sizeof(xConcurrentStack));
+}
+
+xSize xConcurrentStack_getSize(const xConcurrentStack *stack)
+{
+    return (stack) ? atomic_load_explicit(&((xConcurrentStack *)stack)->size, memory_order_relaxed) : 0;
+}
+
+xSize xConcurrentStack_getCapacity(const xConcurrentStack *stack)
+{
+    return (stack) ? atomic_load_explicit(&((xConcurrentStack *)stack)->nodeCount, memory_order_relaxed) : 0;
+}
+
+inline xSize xConcurrentStack_getElemSize(const xConcurrentStack *stack) { return (stack) ? stack->elemSize : 0; }
+
+inline xBool xConcurrentStack_isValid(const xConcurrentStack *stack) { return (stack && stack->elemSize) ? true : false; }
+
+/**
+ * @brief
+ * Push chain of nodes linked through their next references to list with given head.
+ */
+static void xConcurrentStack_pushList(xConcurrentStack *stack, atomic_uint_least64_t *head, xUInt32 first, xUInt32 last)
+{
+    xUInt64 old = atomic_load_explicit(head, memory_order_relaxed);
+    xUInt64 desired = 0;
+    do {
+        atomic_store_explicit(xConcurrentStack_next(stack, last), XCONCURRENTSTACK_REF(old), memory_order_relaxed);
+        desired = XCONCURRENTSTACK_PACK(first + 1, XCONCURRENTSTACK_TAG(old) + 1);
+    } while (!atomic_compare_exchange_weak_explicit(head, &old, desired, memory_order_release, memory_order_relaxed));
+}
+
+/**
+ * @brief
+ * Try to pop first node of list with given head once.
+ *
+ * @return xBool true if node was popped (its index is stored to `index`) or list is empty (`index` is left untouched), false
+ * if other thread modified list in meantime.
+ */
+static xBool xConcurrentStack_tryPopList(xConcurrentStack *stack, atomic_uint_least64_t *head, xUInt32 *index)
+{
+    xUInt64 old = atomic_load_explicit(head, memory_order_acquire);
+    xUInt32 ref = XCONCURRENTSTACK_REF(old);
+    if (!ref) {
+        return true;
+    }
+
+    // node memory is never released while stack exists, so its next reference can be read even if node was popped meanwhile,
+    // in which case tag of head has changed and exchange fails
+    xUInt32 next = atomic_load_explicit(xConcurrentStack_next(stack, ref - 1), memory_order_relaxed);
+    xUInt64 desired = XCONCURRENTSTACK_PACK(next, XCONCURRENTSTACK_TAG(old) + 1);
+    if (!atomic_compare_exchange_strong_explicit(head, &old, desired, memory_order_acquire, memory_order_relaxed)) {
+        return false;
+    }
+    *index = ref - 1;
+    return true;
+}
+
+/**
+ * @brief
+ * Get unused node, either recycled one or new one from chunks.
+ *
+ * @return xBool true on success, false if memory allocation failed or node indices are exhausted.
+ */
+static xBool xConcurrentStack_acquireNode(xConcurrentStack *stack, xUInt32 *index)
+{
+    xUInt32 recycled = (xUInt32)-1;
+    while (!xConcurrentStack_tryPopList(stack, &stack->spare, &recycled)) {
+    }
+    if (recycled != (xUInt32)-1) {
+        *index = recycled;
+        return true;
+    }
+
+    // hand out new node, allocating its chunk if this is first node of it
+    xUInt32 fresh = atomic_fetch_add_explicit(&stack->nodeCount, 1, memory_order_relaxed);
+    xSize offset = 0;
+    xSize chunk = xConcurrentStack_locate(fresh, &offset);
+    if (fresh >= (xUInt32)-1 - 1 || chunk >= XCONCURRENTSTACK_CHUNK_COUNT) {
+        atomic_fetch_sub_explicit(&stack->nodeCount, 1, memory_order_relaxed);
+        return false;
+    }
+    if (!atomic_load_explicit(&stack->chunks[chunk], memory_order_acquire)) {
+        xSize bytes = xConcurrentStack_chunkSize(chunk) * stack->nodeSize;
+        xUInt8 *memory = (xUInt8 *)xAllocator_alloc(stack->allocator, bytes);
+        if (!memory) {
+            // node index is lost, but chunk will be retried by next thread reaching it
+            return false;
+        }
+        xUInt8 *expected = NULL;
+        if (!atomic_compare_exchange_strong_explicit(&stack->chunks[chunk], &expected, memory, memory_order_acq_rel,
+                                                     memory_order_acquire)) {
+            xAllocator_free(stack->allocator, memory, bytes);
+        }
+    }
+
+    *index = fresh;
+    return true;
+}
+
+static inline xSize xConcurrentStack_randomSlot(void)
+{
+    // xorshift generator seeded with address of thread-local state, so threads start at different slots
+    xUInt32 x = xConcurrentStack_seed;
+    if (!x) {
+        x = (xUInt32)(xSize)&xConcurrentStack_seed | 1;
+    }
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    xConcurrentStack_seed = x;
+    return x % XCONCURRENTSTACK_ELIMINATION_SLOTS;
+}
+
+/**
+ * @brief
+ * Offer node to concurrent pop through elimination array for short time.
+ *
+ * @return xBool true if node was taken by pop, false if offer was withdrawn.
+ */
+static xBool xConcurrentStack_eliminatePush(xConcurrentStack *stack, xUInt32 index)
+{
+    atomic_uint_least64_t *offer = &stack->elimination[xConcurrentStack_randomSlot()].offer;
+    xUInt32 ticket = atomic_fetch_add_explicit(&stack->ticket, 1, memory_order_relaxed);
+    xUInt64 value = XCONCURRENTSTACK_PACK(index + 1, ticket);
+    xUInt64 expected = 0;
+    if (!atomic_compare_exchange_strong_explicit(offer, &expected, value, memory_order_release, memory_order_relaxed)) {
+        return false;
+    }
+
+    for (xSize i = 0; i < XCONCURRENTSTACK_ELIMINATION_SPINS; i++) {
+        if (atomic_load_explicit(offer, memory_order_relaxed) != value) {
+            return true;
+        }
+    }
+    return atomic_compare_exchange_strong_explicit(offer, &value, 0, memory_order_relaxed, memory_order_relaxed) ? false : true;
+}
+
+/**
+ * @brief
+ * Take node offered by concurrent push through elimination array.
+ *
+ * @return xBool true if node was taken (its index is stored to `index`), false otherwise.
+ */
+static xBool xConcurrentStack_eliminatePop(xConcurrentStack *stack, xUInt32 *index)
+{
+    atomic_uint_least64_t *offer = &stack->elimination[xConcurrentStack_randomSlot()].offer;
+    xUInt64 value = atomic_load_explicit(offer, memory_order_relaxed);
+    if (!value || !atomic_compare_exchange_strong_explicit(offer, &value, 0, memory_order_acquire, memory_order_relaxed)) {
+        return false;
+    }
+    *index = XCONCURRENTSTACK_REF(value) - 1;
+    return true;
+}
+
+xBool xConcurrentStack_push(xConcurrentStack *stack, const void *data)
+{
+    // validate passed arguments
+    if (!xConcurrentStack_isValid(stack) || !data) {
+        return false;
+    }
+
+    xUInt32 index = 0;
+    if (!xConcurrentStack_acquireNode(stack, &index)) {
+        return false;
+    }
+    xMemCopy(xConcurrentStack_data(stack, index), data, stack->elemSize);
+    atomic_fetch_add_explicit(&stack->size, 1, memory_order_relaxed);
+
+    // on contention hand element directly to concurrent pop instead of retrying on top of stack
+    xUInt64 old = atomic_load_explicit(&stack->top, memory_order_relaxed);
+    for (;;) {
+        atomic_store_explicit(xConcurrentStack_next(stack, index), XCONCURRENTSTACK_REF(old), memory_order_relaxed);
+        xUInt64 desired = XCONCURRENTSTACK_PACK(index + 1, XCONCURRENTSTACK_TAG(old) + 1);
+        if (atomic_compare_exchange_strong_explicit(&stack->top, &old, desired, memory_order_release, memory_order_relaxed) ||
+            xConcurrentStack_eliminatePush(stack, index)) {
+            return true;
+        }
+        old = atomic_load_explicit(&stack->top, memory_order_relaxed);
+    }
+}
+
+xBool xConcurrentStack_popInto(xConcurrentStack *stack, void *dest)
+{
+    // validate passed arguments
+    if (!xConcurrentStack_isValid(stack) || !dest) {
+        return false;
+    }
+
+    // on contention take element from concurrent push instead of retrying on top of stack
+    xUInt32 index = (xUInt32)-1;
+    while (!xConcurrentStack_tryPopList(stack, &stack->top, &index) && !xConcurrentStack_eliminatePop(stack, &index)) {
+    }
+    if (index == (xUInt32)-1 && !xConcurrentStack_eliminatePop(stack, &index)) {
+        return false;
+    }
+
+    // popped node is owned by this thread until it is recycled
+    xMemCopy(dest, xConcurrentStack_data(stack, index), stack->elemSize);
+    xConcurrentStack_pushList(stack, &stack->spare, index, index);
+    atomic_fetch_sub_explicit(&stack->size, 1, memory_order_relaxed);
+
+    return true;
+}
+
+void *xConcurrentStack_pop(xConcurrentStack *stack)
+{
+    // validate passed argument
+    if (!xConcurrentStack_isValid(stack)) {
+        return NULL;
+    }
+
+    void *data = malloc(stack->elemSize);
+    if (!data) {
+        return NULL;
+    }
+    if (!xConcurrentStack_popInto(stack, data)) {
+        free(data);
+        return NULL;
+    }
+
+    return data;
+}
+
+void xConcurrentStack_clear(xConcurrentStack *stack)
+{
+    // validate passed argument
+    if (!xConcurrentStack_isValid(stack)) {
+        return;
+    }
+
+    // detach whole stack at once, detached chain is owned by this thread
+    xUInt64 old = atomic_load_explicit(&stack->top, memory_order_relaxed);
+    while (XCONCURRENTSTACK_REF(old) &&
+           !atomic_compare_exchange_weak_explicit(&stack->top, &old, XCONCURRENTSTACK_PACK(0, XCONCURRENTSTACK_TAG(old) + 1),
+                                                  memory_order_acquire, memory_order_relaxed)) {
+    }
+    if (!XCONCURRENTSTACK_REF(old)) {
+        return;
+    }
+
+    // recycle detached chain of nodes
+    xUInt32 first = XCONCURRENTSTACK_REF(old) - 1;
+    xUInt32 last = first;
+    xSize count = 1;
+    xUInt32 next = 0;
+    while ((next = atomic_load_explicit(xConcurrentStack_next(stack, last), memory_order_relaxed))) {
+        last = next - 1;
+        count++;
+    }
+    xConcurrentStack_pushList(stack, &stack->spare, first, last);
+    atomic_fetch_sub_explicit(&stack->size, count, memory_order_relaxed);
+}
@@ -0,0 +1,555 @@
+#include "xStructures/xHashMap.h"
+#include <stdatomic.h>   // atomic_uint_fast64_t (process-wide hash secret)
+#include <stdint.h>      // uintptr_t
+#include <sys/random.h>  // getentropy
+#include <time.h>        // clock_gettime (fallback entropy)
+#include "xBase/xMemtools.h"
+#include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
+#include "xString/xString.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// control byte values (full slots store lower 7 bits of key hash, so their top bit is always clear)
+#define XHASHMAP_CTRL_EMPTY 0x80
+#define XHASHMAP_CTRL_DELETED 0xFE
+
+// number of slots whose control bytes are matched at once (table capacity is always multiple of it)
+#define XHASHMAP_GROUP_WIDTH 16
+
+// marker for "slot not found"
+#define XHASHMAP_NO_SLOT ((xSize)-1)
+
+struct xHashMap_s {
+    xUInt8 *ctrl;                 // control byte for each slot (start of single allocation holding whole table)
+    xUInt8 *keys;                 // key storage (keySize bytes per slot)
+    xUInt8 *values;               // value storage (valueSize bytes per slot)
+    xSize keySize;                // size of single key in bytes
+    xSize valueSize;              // size of single value in bytes
+    xSize size;                   // number of stored entries
+    xSize capacity;               // number of slots (0 or power of 2 not smaller than group width)
+    xSize growthLeft;             // number of empty slots that can still be filled before table has to be rehashed
+    xBool stringKeys;             // keys are xString pointers owned by map
+    xUInt64 seed;                 // random seed of key hashes (differs between maps, so collisions cannot be prepared)
+    const xAllocator *allocator;  // allocator owning map structure and table
+};
+
+/**
+ * @brief
+ * Bit mask with one bit for each slot of 16-slot group.
+ */
+typedef xUInt32 xHashMapMask;
+
+#if defined(__SSE2__)
+
+// SSE2 is part of x86-64 baseline, so group matching needs no runtime dispatch
+static inline xHashMapMask xHashMap_groupMatch(const xUInt8 *group, xUInt8 tag)
+{
+    __m128i ctrl = _mm_loadu_si128((const __m128i *)group);
+    return (xHashMapMask)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)tag)));
+}
+
+static inline xHashMapMask xHashMap_groupMatchFree(const xUInt8 *group)
+{
+    // empty and deleted control bytes are only ones with top bit set
+    return (xHashMapMask)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)group));
+}
+
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+
+/**
+ * @brief
+ * Compress byte lanes that are either 0x00 or 0xFF into 16-bit mask.
+ */
+static inline xHashMapMask xHashMap_neonMask(uint8x16_t lanes)
+{
+    static const xUInt8 weights[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+    uint8x16_t bits = vandq_u8(lanes, vld1q_u8(weights));
+    return (xHashMapMask)vaddv_u8(vget_low_u8(bits)) | ((xHashMapMask)vaddv_u8(vget_high_u8(bits)) << 8);
+}
+
+static inline xHashMapMask xHashMap_groupMatch(const xUInt8 *group, xUInt8 tag)
+{
+    return xHashMap_neonMask(vceqq_u8(vld1q_u8(group), vdupq_n_u8(tag)));
+}
+
+static inline xHashMapMask xHashMap_groupMatchFree(const xUInt8 *group)
+{
+    return xHashMap_neonMask(vcltq_s8(vreinterpretq_s8_u8(vld1q_u8(group)), vdupq_n_s8(0)));
+}
+
+#else
+
+static inline xHashMapMask xHashMap_groupMatch(const xUInt8 *group, xUInt8 tag)
+{
+    xHashMapMask mask = 0;
+    for (xSize i = 0; i < XHASHMAP_GROUP_WIDTH; i++) {
+        mask |= (xHashMapMask)(group[i] == tag) << i;
+    }
+    return mask;
+}
+
+static inline xHashMapMask xHashMap_groupMatchFree(const xUInt8 *group)
+{
+    xHashMapMask mask = 0;
+    for (xSize i = 0; i < XHASHMAP_GROUP_WIDTH; i++) {
+        mask |= (xHashMapMask)(group[i] >> 7) << i;
+    }
+    return mask;
+}
+
+#endif
+
+static inline xHashMapMask xHashMap_groupMatchEmpty(const xUInt8 *group)
+{
+    return xHashMap_groupMatch(group, XHASHMAP_CTRL_EMPTY);
+}
+
+/**
+ * @brief
+ * Get index of lowest set bit in non-zero mask.
+ */
+static inline xSize xHashMap_lowestBit(xHashMapMask mask) { return (xSize)__builtin_ctz(mask); }
+
+/**
+ * @brief
+ * Get number of entries table of given capacity can hold before it has to grow (7/8 load factor).
+ */
+static inline xSize xHashMap_maxLoad(xSize capacity) { return capacity - capacity / 8; }
+
+/**
+ * @brief
+ * Round size up to multiple of 16 bytes so that key and value arrays start aligned.
+ */
+static inline xSize xHashMap_alignUp(xSize size) { return (size + 15) & ~(xSize)15; }
+
+/**
+ * @brief
+ * Get random hash seed for new map.
+ *
+ * @note
+ * Secret is read from operating system only once per process. Every map then gets its own seed by hashing count of seeds
+ * handed out so far with that secret, so creating maps does not cost system call.
+ */
+static xUInt64 xHashMap_newSeed(void)
+{
+    static atomic_uint_fast64_t secret = 0;
+    static atomic_uint_fast64_t counter = 0;
+
+    xUInt64 key = atomic_load_explicit(&secret, memory_order_relaxed);
+    if (!key) {
+        if (getentropy(&key, sizeof(key)) != 0) {
+            // no entropy source, fall back to time and stack address
+            struct timespec now;
+            clock_gettime(CLOCK_REALTIME, &now);
+            key = ((xUInt64)now.tv_sec << 32) ^ (xUInt64)now.tv_nsec ^ (xUInt64)(uintptr_t)&now;
+        }
+        key |= 1;  // zero marks secret not read yet
+
+        // first thread to read secret wins, so all maps derive their seeds from same secret
+        uint_fast64_t expected = 0;
+        if (!atomic_compare_exchange_strong(&secret, &expected, key)) {
+            key = expected;
+        }
+    }
+
+    xUInt64 index = atomic_fetch_add_explicit(&counter, 1, memory_order_relaxed);
+    return xMemHashSeeded(&index, sizeof(index), key);
+}
+
+/**
+ * @brief
+ * Hash key according to key type of map.
+ */
+static inline xUInt64 xHashMap_hashKey(const xHashMap *map, const void *key)
+{
+    if (map->stringKeys) {
+        const xString *str = (const xString *)key;
+        return xMemHashSeeded(xString_getData(str), xString_getLength(str), map->seed);
+    }
+    return xMemHashSeeded(key, map->keySize, map->seed);
+}
+
+/**
+ * @brief
+ * Get pointer to key stored in given slot.
+ */
+static inline void *xHashMap_slotKey(const xHashMap *map, xSize slot) { return (void *)(map->keys + slot * map->keySize); }
+
+/**
+ * @brief
+ * Get pointer to value stored in given slot.
+ */
+static inline void *xHashMap_slotValue(const xHashMap *map, xSize slot) { return (void *)(map->values + slot * map->valueSize); }
+
+/**
+ * @brief
+ * Check if key stored in given slot is equal to provided key.
+ */
+static inline xBool xHashMap_keyEquals(const xHashMap *map, xSize slot, const void *key)
+{
+    if (!map->stringKeys) {
+        return xMemCmp(xHashMap_slotKey(map, slot), key, map->keySize);
+    }
+
+    const xString *stored = *(xString *const *)xHashMap_slotKey(map, slot);
+    const xString *other = (const xString *)key;
+    xSize length = xString_getLength(stored);
+    return (length == xString_getLength(other) &&
+            (length == 0 || xMemCmp(xString_getData(stored), xString_getData(other), length)))
+               ? true
+               : false;
+}
+
+/**
+ * @brief
+ * Find slot holding given key.
+ *
+ * @return xSize Index of slot or XHASHMAP_NO_SLOT if key is not present.
+ *
+ * @note
+ * Groups are probed in triangular sequence, which visits every group of power-of-2 sized table exactly once. Probing stops at
+ * first group that has an empty slot, since insertion would have used that slot before moving on.
+ */
+static xSize xHashMap_findSlot(const xHashMap *map, const void *key, xUInt64 hash)
+{
+    if (!map->capacity) {
+        return XHASHMAP_NO_SLOT;
+    }
+
+    xSize groupMask = map->capacity / XHASHMAP_GROUP_WIDTH - 1;
+    xSize group = (xSize)(hash >> 7) & groupMask;
+    xUInt8 tag = (xUInt8)(hash & 0x7F);
+
+    for (xSize step = 1;; step++) {
+        const xUInt8 *ctrl = map->ctrl + group * XHASHMAP_GROUP_WIDTH;
+        for (xHashMapMask match = xHashMap_groupMatch(ctrl, tag); match; match &= match - 1) {
+            xSize slot = group * XHASHMAP_GROUP_WIDTH + xHashMap_lowestBit(match);
+            if (xHashMap_keyEquals(map, slot, key)) {
+                return slot;
+            }
+        }
+        if (xHashMap_groupMatchEmpty(ctrl) || step > groupMask) {
+            return XHASHMAP_NO_SLOT;
+        }
+        group = (group + step) & groupMask;
+    }
+}
+
+/**
+ * @brief
+ * Find first empty or deleted slot in probe sequence of given hash.
+ *
+ * @note
+ * Table always keeps at least 1/8 of its slots empty, so search cannot fail.
+ */
+static xSize xHashMap_findFreeSlot(const xHashMap *map, xUInt64 hash)
+{
+    xSize groupMask = map->capacity / XHASHMAP_GROUP_WIDTH - 1;
+    xSize group = (xSize)(hash >> 7) & groupMask;
+
+    for (xSize step = 1;; step++) {
+        xHashMapMask free = xHashMap_groupMatchFree(map->ctrl + group * XHASHMAP_GROUP_WIDTH);
+        if (free) {
+            return group * XHASHMAP_GROUP_WIDTH + xHashMap_lowestBit(free);
+        }
+        group = (group + step) & groupMask;
+    }
+}
+
+/**
+ * @brief
+ * Get offset of value array inside table allocation of given capacity.
+ */
+static inline xSize xHashMap_valuesOffset(const xHashMap *map, xSize capacity)
+{
+    return xHashMap_alignUp(capacity) + xHashMap_alignUp(capacity * map->keySize);
+}
+
+/**
+ * @brief
+ * Get size of table allocation of given capacity (control bytes, keys and values share single block).
+ */
+static inline xSize xHashMap_tableSize(const xHashMap *map, xSize capacity)
+{
+    return xHashMap_valuesOffset(map, capacity) + capacity * map->valueSize;
+}
+
+/**
+ * @brief
+ * Move all entries into newly allocated table with given capacity.
+ *
+ * @return xBool true on success, false if memory allocation failed (map is left unchanged).
+ */
+static xBool xHashMap_rehash(xHashMap *map, xSize newCapacity)
+{
+    xSize keysOffset = xHashMap_alignUp(newCapacity);
+    xSize valuesOffset = xHashMap_valuesOffset(map, newCapacity);
+    xUInt8 *block = (xUInt8 *)xAllocator_alloc(map->allocator, xHashMap_tableSize(map, newCapacity));
+    if (!block) {
+        return false;
+    }
+
+    xHashMap old = *map;
+    map->ctrl = block;
+    map->keys = block + keysOffset;
+    map->values = block + valuesOffset;
+    map->capacity = newCapacity;
+    map->growthLeft = xHashMap_maxLoad(newCapacity) - map->size;
+    xMemSet(map->ctrl, XHASHMAP_CTRL_EMPTY, newCapacity);
+
+    // reinsert entries (keys are known to be unique, so no equality checks are needed)
+    for (xSize i = 0; i < old.capacity; i++) {
+        if (old.ctrl[i] & 0x80) {
+            continue;
+        }
+        const void *key = xHashMap_slotKey(&old, i);
+        xUInt64 hash = xHashMap_hashKey(map, map->stringKeys ? *(xString *const *)key : key);
+        xSize slot = xHashMap_findFreeSlot(map, hash);
+        map->ctrl[slot] = old.ctrl[i];
+        xMemCopy(xHashMap_slotKey(map, slot), key, map->keySize);
+        xMemCopy(xHashMap_slotValue(map, slot), xHashMap_slotValue(&old, i), map->valueSize);
+    }
+
+    xAllocator_free(map->allocator, old.ctrl, xHashMap_tableSize(&old, old.capacity));
+    return true;
+}
+
+/**
+ * @brief
+ * Get smallest valid capacity that holds given number of entries.
+ */
+static xSize xHashMap_capacityFor(xSize count)
+{
+    xSize capacity = XHASHMAP_GROUP_WIDTH;
+    while (xHashMap_maxLoad(capacity) < count) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+/**
+ * @brief
+ * Allocate empty map structure.
+ */
+static xHashMap *xHashMap_create(xSize keySize, xSize valueSize, xBool stringKeys, const xAllocator *allocator)
+{
+    allocator = allocator ? allocator : xAllocator_getDefault();
+    xHashMap *map = NULL;
+    if (!(map = (xHashMap *)xAllocator_alloc(allocator, sizeof(xHashMap)))) {
+        return NULL;
+    }
+
+    // table itself is allocated lazily on first insertion
+    map->ctrl = NULL;
+    map->keys = NULL;
+    map->values = NULL;
+    map->keySize = keySize;
+    map->valueSize = valueSize;
+    map->size = 0;
+    map->capacity = 0;
+    map->growthLeft = 0;
+    map->stringKeys = stringKeys;
+    map->seed = xHashMap_newSeed();
+    map->allocator = allocator;
+
+    return map;
+}
+
+xHashMap *xHashMap_new(xSize keySize, xSize valueSize) { return xHashMap_newWithAllocator(keySize, valueSize, NULL); }
+
+xHashMap *xHashMap_newWithAllocator(xSize keySize, xSize valueSize, const xAllocator *allocator)
+{
+    // validate passed arguments
+    if (keySize == 0 || valueSize == 0) {
+        return NULL;
+    }
+
+    return xHashMap_create(keySize, valueSize, false, allocator);
+}
+
+xHashMap *xHashMap_newStringKeyed(xSize valueSize) { return xHashMap_newStringKeyedWithAllocator(valueSize, NULL); }
+
+xHashMap *xHashMap_newStringKeyedWithAllocator(xSize valueSize, const xAllocator *allocator)
+{
+    // validate passed argument
+    if (valueSize == 0) {
+        return NULL;
+    }
+
+    return xHashMap_create(sizeof(xString *), valueSize, true, allocator);
+}
+
+/**
+ * @brief
+ * Release keys owned by map (xString copies of string keyed maps).
+ */
+static void xHashMap_releaseKeys(xHashMap *map)
+{
+    if (!map->stringKeys) {
+        return;
+    }
+
+    for (xSize i = 0; i < map->capacity; i++) {
+        if (!(map->ctrl[i] & 0x80)) {
+            xString_free(*(xString **)xHashMap_slotKey(map, i));
+        }
+    }
+}
+
+void xHashMap_free(xHashMap *map)
+{
+    if (!map) {
+        return;
+    }
+
+    xHashMap_releaseKeys(map);
+    xAllocator_free(map->allocator, map->ctrl, xHashMap_tableSize(map, map->capacity));
+    xAllocator_free(map->allocator, map, sizeof(xHashMap));
+}
+
+inline xSize xHashMap_getSize(const xHashMap *map) { return (map) ? map->size : 0; }
+
+inline xSize xHashMap_getCapacity(const xHashMap *map) { return (map) ? map->capacity : 0; }
+
+inline xSize xHashMap_getKeySize(const xHashMap *map) { return (map) ? map->keySize : 0; }
+
+inline xSize xHashMap_getValueSize(const xHashMap *map) { return (map) ? map->valueSize : 0; }
+
+inline xBool xHashMap_isValid(const xHashMap *map) { return (map && map->keySize && map->valueSize) ? true : false; }
+
+void xHashMap_reserve(xHashMap *map, xSize count)
+{
+    // validate arguments
+    if (!xHashMap_isValid(map) || count <= xHashMap_maxLoad(map->capacity)) {
+        return;
+    }
+
+    xHashMap_rehash(map, xHashMap_capacityFor(count));
+}
+
+xBool xHashMap_put(xHashMap *map, const void *key, const void *value)
+{
+    // validate arguments
+    if (!xHashMap_isValid(map) || !key || !value || (map->stringKeys && !xString_isValid((const xString *)key))) {
+        return false;
+    }
+
+    // overwrite value of existing entry
+    xUInt64 hash = xHashMap_hashKey(map, key);
+    xSize slot = xHashMap_findSlot(map, key, hash);
+    if (slot != XHASHMAP_NO_SLOT) {
+        xMemCopy(xHashMap_slotValue(map, slot), value, map->valueSize);
+        return true;
+    }
+
+    // reusing deleted slot does not consume growth budget, filling empty one does
+    slot = map->capacity ? xHashMap_findFreeSlot(map, hash) : XHASHMAP_NO_SLOT;
+    if (slot == XHASHMAP_NO_SLOT || (map->growthLeft == 0 && map->ctrl[slot] == XHASHMAP_CTRL_EMPTY)) {
+        // grow table if it is mostly full, otherwise rehash in place to purge deleted slots
+        xSize newCapacity = xHashMap_capacityFor(map->size + 1);
+        if (newCapacity <= map->capacity && map->size >= xHashMap_maxLoad(map->capacity) / 2) {
+            newCapacity = map->capacity * 2;
+        } else if (newCapacity < map->capacity) {
+            newCapacity = map->capacity;
+        }
+        if (!xHashMap_rehash(map, newCapacity)) {
+            return false;
+        }
+        slot = xHashMap_findFreeSlot(map, hash);
+    }
+
+    // take ownership of key
+    if (map->stringKeys) {
+        xString *copy = xString_copy((const xString *)key);
+        if (!copy) {
+            return false;
+        }
+        xMemCopy(xHashMap_slotKey(map, slot), &copy, sizeof(xString *));
+    } else {
+        xMemCopy(xHashMap_slotKey(map, slot), key, map->keySize);
+    }
+    xMemCopy(xHashMap_slotValue(map, slot), value, map->valueSize);
+
+    if (map->ctrl[slot] == XHASHMAP_CTRL_EMPTY) {
+        map->growthLeft--;
+    }
+    map->ctrl[slot] = (xUInt8)(hash & 0x7F);
+    map->size++;
+
+    return true;
+}
+
+void *xHashMap_get(const xHashMap *map, const void *key)
+{
+    // validate arguments
+    if (!xHashMap_isValid(map) || !key || !map->size) {
+        return NULL;
+    }
+
+    xSize slot = xHashMap_findSlot(map, key, xHashMap_hashKey(map, key));
+    return (slot != XHASHMAP_NO_SLOT) ? xHashMap_slotValue(map, slot) : NULL;
+}
+
+xBool xHashMap_contains(const xHashMap *map, const void *key) { return xHashMap_get(map, key) ? true : false; }
+
+xBool xHashMap_remove(xHashMap *map, const void *key)
+{
+    // validate arguments
+    if (!xHashMap_isValid(map) || !key || !map->size) {
+        return false;
+    }
+
+    xSize slot = xHashMap_findSlot(map, key, xHashMap_hashKey(map, key));
+    if (slot == XHASHMAP_NO_SLOT) {
+        return false;
+    }
+
+    if (map->stringKeys) {
+        xString_free(*(xString **)xHashMap_slotKey(map, slot));
+    }
+
+    // probe sequences never continue past group with empty slot, so such group needs no tombstone
+    const xUInt8 *group = map->ctrl + (slot & ~(xSize)(XHASHMAP_GROUP_WIDTH - 1));
+    if (xHashMap_groupMatchEmpty(group)) {
+        map->ctrl[slot] = XHASHMAP_CTRL_EMPTY;
+        map->growthLeft++;
+    } else {
+        map->ctrl[slot] = XHASHMAP_CTRL_DELETED;
+    }
+    map->size--;
+
+    return true;
+}
+
+void xHashMap_clear(xHashMap *map)
+{
+    // validate arguments
+    if (!xHashMap_isValid(map) || !map->capacity) {
+        return;
+    }
+
+    xHashMap_releaseKeys(map);
+    xMemSet(map->ctrl, XHASHMAP_CTRL_EMPTY, map->capacity);
+    map->size = 0;
+    map->growthLeft = xHashMap_maxLoad(map->capacity);
+}
+
+void xHashMap_foreach(const xHashMap *map, void (*callback)(const void *key, void *value))
+{
+    if (!xHashMap_isValid(map) || !callback) {
+        return;
+    }
+
+    for (xSize i = 0; i < map->capacity; i++) {
+        if (map->ctrl[i] & 0x80) {
+            continue;
+        }
+        const void *key = xHashMap_slotKey(map, i);
+        callback(map->stringKeys ? (const void *)*(xString *const *)key : key, xHashMap_slotValue(map, i));
+    }
+}
@@ -1,9 +1,8 @@
 #include "xStructures/xList.h"
-#include <stdlib.h>  // standard library (for malloc, free)
+#include <stdlib.h>  // malloc (for element copies returned to caller)
 #include "xBase/xMemtools.h"
 #include "xBase/xTypes.h"
-
-// TODO: remove dependency on stdlib.h (custom memory allocation functions)
+#include "xMemory/xAllocator.h"
 
 typedef struct xListNode_s {
     void *data;
@@ -16,9 +15,12 @@ struct xList_s {
     xListNode *tail;
     xSize elemSize;
     xSize listSize;
+    const xAllocator *allocator;
 };
 
-xList *xList_new(xSize elemSize)
+xList *xList_new(xSize elemSize) { return xList_newWithAllocator(elemSize, NULL); }
+
+xList *xList_newWithAllocator(xSize elemSize, const xAllocator *allocator)
 {
     // validate arguments
     if (elemSize == 0) {
@@ -26,7 +28,8 @@ xList *xList_new(xSize elemSize)
     }
 
     // allocate memory for the list
-    xList *list = (xList *)malloc(sizeof(xList));
+    allocator = allocator ? allocator : xAllocator_getDefault();
+    xList *list = (xList *)xAllocator_alloc(allocator, sizeof(xList));
     if (!list) {
         return NULL;
     }
@@ -36,9 +39,28 @@ xList *xList_new(xSize elemSize)
     list->listSize = 0;
     list->head = NULL;
     list->tail = NULL;
+    list->allocator = allocator;
     return list;
 }
 
+/**
+ * @brief
+ * Allocate list node with room for element data right after the descriptor (for slightly better cache locality).
+ */
+static xListNode *xList_allocNode(const xList *list)
+{
+    xListNode *node = (xListNode *)xAllocator_alloc(list->allocator, sizeof(xListNode) + list->elemSize);
+    if (node) {
+        node->data = (void *)((char *)node + sizeof(xListNode));
+    }
+    return node;
+}
+
+static inline void xList_freeNode(const xList *list, xListNode *node)
+{
+    xAllocator_free(list->allocator, node, sizeof(xListNode) + list->elemSize);
+}
+
 void xList_free(xList *list)
 {
     // validate arguments
@@ -50,7 +72,7 @@ void xList_free(xList *list)
     xListNode *current = list->head;
     while (current) {
         xListNode *next = current->next;
-        free(current);
+        xList_freeNode(list, current);
         current = next;
     }
 
@@ -58,7 +80,7 @@ void xList_free(xList *list)
     list->head = NULL;
     list->tail = NULL;
 
-    free(list);
+    xAllocator_free(list->allocator, list, sizeof(xList));
 }
 
 inline xSize xList_getSize(const xList *list) { return (list) ? list->listSize : 0; }
@@ -85,14 +107,13 @@ void xList_insert(xList *list, const void *data, xSize index)
         return;
     }
 
-    // allocate memory for new node (data is right after the descriptor for slightly better cache locality)
-    xListNode *newNode = (xListNode *)malloc(sizeof(xListNode) + list->elemSize);
+    // allocate memory for new node
+    xListNode *newNode = xList_allocNode(list);
     if (!newNode) {
         return;
     }
 
     // copy data to the new node
-    newNode->data = (void *)((char *)newNode + sizeof(xListNode));  // node data is right after its descriptor
     xMemCopy(newNode->data, data, list->elemSize);
 
     // target node is somewhere in the middle of the list
@@ -160,7 +181,7 @@ void *xList_remove(xList *list, xSize index)
     // create a copy of the data, free memory and return the data
     void *data = (void *)malloc(list->elemSize);
     xMemCopy(data, current->data, list->elemSize);
-    free(current);
+    xList_freeNode(list, current);
     list->listSize--;
 
     return data;
@@ -174,13 +195,12 @@ void xList_pushFront(xList *list, const void *data)
     }
 
     // allocate memory for new node
-    xListNode *newNode = (xListNode *)malloc(sizeof(xListNode) + list->elemSize);
+    xListNode *newNode = xList_allocNode(list);
     if (!newNode) {
         return;
     }
 
     // copy data to the new node
-    newNode->data = (void *)((char *)newNode + sizeof(xListNode));  // node data is right after its descriptor
     xMemCopy(newNode->data, data, list->elemSize);
 
     // insert node into the list
@@ -203,13 +223,12 @@ void xList_pushBack(xList *list, const void *data)
     }
 
     // allocate memory for new node
-    xListNode *newNode = (xListNode *)malloc(sizeof(xListNode) + list->elemSize);
+    xListNode *newNode = xList_allocNode(list);
     if (!newNode) {
         return;
     }
 
     // copy data to the new node
-    newNode->data = (void *)((char *)newNode + sizeof(xListNode));  // node data is right after its descriptor
     xMemCopy(newNode->data, data, list->elemSize);
 
     // insert node into the list
@@ -243,7 +262,7 @@ void *xList_popFront(xList *list)
     // create a copy of the data, free memory and return the data
     void *data = (void *)malloc(list->elemSize);
     xMemCopy(data, current->data, list->elemSize);
-    free(current);
+    xList_freeNode(list, current);
     list->listSize--;
 
     return data;
@@ -268,7 +287,7 @@ void *xList_popBack(xList *list)
     // create a copy of the data, free memory and return the data
     void *data = (void *)malloc(list->elemSize);
     xMemCopy(data, current->data, list->elemSize);
-    free(current);
+    xList_freeNode(list, current);
     list->listSize--;
 
     return data;
@@ -303,7 +322,7 @@ void xList_clear(xList *list)
     xListNode *current = list->head;
     while (current) {
         xListNode *next = current->next;
-        free(current);
+        xList_freeNode(list, current);
         current = next;
     }
 
@@ -320,7 +339,7 @@ xList *xList_copy(const xList *list)
     }
 
     // create new list and copy all elements
-    xList *newList = xList_new(list->elemSize);
+    xList *newList = xList_newWithAllocator(list->elemSize, list->allocator);
     if (!newList) {
         return NULL;
     }
@@ -1,32 +1,70 @@
 #include "xStructures/xQueue.h"
-#include <stdlib.h>  // malloc, realloc, free
+#include <stdlib.h>  // malloc, free (for element copies returned to caller)
+#include "xBase/xMemtools.h"
 #include "xBase/xTypes.h"
-#include "xStructures/xList.h"  // under the hood, queue is implemented using linked list
+#include "xMemory/xAllocator.h"
+#include "xStructures/xList.h"  // list backend of the queue
 
-// TODO: remove dependency on stdlib.h (custom memory allocation functions)
+#define XQUEUE_INITIAL_CAPACITY 16  // ring buffer capacity allocated on first enqueue (power of 2)
 
 struct xQueue_s {
-    xList *internalList;
+    xList *internalList;  // elements of list backend
+    xUInt8 *buffer;       // elements of ring backend
+    xSize capacity;       // number of slots in ring buffer (0 or power of 2)
+    xSize head;           // slot of front element in ring buffer
+    xSize size;           // number of elements in ring buffer
+    xSize elemSize;
+    xQueueBackend backend;
+    const xAllocator *allocator;
 };
 
-xQueue *xQueue_new(xSize elemSize)
+/**
+ * @brief
+ * Get pointer to ring buffer slot of element at given distance from front of the queue.
+ */
+static inline xUInt8 *xQueue_slot(const xQueue *queue, xSize index)
 {
-    // validate passed argument
-    if (elemSize == 0) {
+    return queue->buffer + ((queue->head + index) & (queue->capacity - 1)) * queue->elemSize;
+}
+
+xQueue *xQueue_new(xSize elemSize) { return xQueue_newWithBackend(elemSize, XQUEUE_BACKEND_RING, NULL); }
+
+xQueue *xQueue_newWithAllocator(xSize elemSize, const xAllocator *allocator)
+{
+    return xQueue_newWithBackend(elemSize, XQUEUE_BACKEND_RING, allocator);
+}
+
+xQueue *xQueue_newWithBackend(xSize elemSize, xQueueBackend backend, const xAllocator *allocator)
+{
+    // validate passed arguments
+    if (elemSize == 0 || (backend != XQUEUE_BACKEND_RING && backend != XQUEUE_BACKEND_LIST)) {
         return NULL;
     }
 
     // allocate memory for the queue
-    xQueue *queue = (xQueue *)malloc(sizeof(xQueue));
+    allocator = allocator ? allocator : xAllocator_getDefault();
+    xQueue *queue = (xQueue *)xAllocator_alloc(allocator, sizeof(xQueue));
     if (!queue) {
         return NULL;
     }
 
+    // ring buffer is allocated lazily on first enqueue
+    queue->internalList = NULL;
+    queue->buffer = NULL;
+    queue->capacity = 0;
+    queue->head = 0;
+    queue->size = 0;
+    queue->elemSize = elemSize;
+    queue->backend = backend;
+    queue->allocator = allocator;
+
     // allocate memory for the internal list structure
-    queue->internalList = xList_new(elemSize);
-    if (!xQueue_isValid(queue)) {
-        free(queue);
-        return NULL;
+    if (backend == XQUEUE_BACKEND_LIST) {
+        queue->internalList = xList_newWithAllocator(elemSize, allocator);
+        if (!xQueue_isValid(queue)) {
+            xAllocator_free(allocator, queue, sizeof(xQueue));
+            return NULL;
+        }
     }
 
     return queue;
@@ -39,20 +77,76 @@ void xQueue_free(xQueue *queue)
         return;
     }
 
-    // free the internal list and queue itself
-    if (xQueue_isValid(queue)) {
+    // free the underlying structure and queue itself
+    if (queue->backend == XQUEUE_BACKEND_LIST) {
         xList_free(queue->internalList);
+    } else {
+        xAllocator_free(queue->allocator, queue->buffer, queue->capacity * queue->elemSize);
     }
 
     queue->internalList = NULL;
-    free(queue);
+    queue->buffer = NULL;
+    xAllocator_free(queue->allocator, queue, sizeof(xQueue));
 }
 
-inline xSize xQueue_getSize(const xQueue *queue) { return (queue) ? xList_getSize(queue->internalList) : 0; }
+inline xSize xQueue_getSize(const xQueue *queue)
+{
+    if (!queue) {
+        return 0;
+    }
+    return (queue->backend == XQUEUE_BACKEND_LIST) ? xList_getSize(queue->internalList) : queue->size;
+}
+
+inline xSize xQueue_getCapacity(const xQueue *queue)
+{
+    if (!queue) {
+        return 0;
+    }
+    return (queue->backend == XQUEUE_BACKEND_LIST) ? xList_getSize(queue->internalList) : queue->capacity;
+}
+
+inline xSize xQueue_getElemSize(const xQueue *queue) { return (queue) ? queue->elemSize : 0; }
+
+inline xBool xQueue_isValid(const xQueue *queue)
+{
+    if (!queue || !queue->elemSize) {
+        return false;
+    }
+    return (queue->backend == XQUEUE_BACKEND_RING || xList_isValid(queue->internalList)) ? true : false;
+}
+
+inline xQueueBackend xQueue_getBackend(const xQueue *queue) { return (queue) ? queue->backend : XQUEUE_BACKEND_RING; }
+
+/**
+ * @brief
+ * Double capacity of ring buffer, keeping elements in their order.
+ *
+ * @return xBool true on success, false if memory allocation failed.
+ */
+static xBool xQueue_grow(xQueue *queue)
+{
+    xSize oldCapacity = queue->capacity;
+    xSize newCapacity = oldCapacity ? oldCapacity * 2 : XQUEUE_INITIAL_CAPACITY;
+    if (newCapacity < oldCapacity || newCapacity > (xSize)-1 / queue->elemSize) {
+        return false;
+    }
+
+    xUInt8 *buffer = (xUInt8 *)xAllocator_realloc(queue->allocator, queue->buffer, oldCapacity * queue->elemSize,
+                                                  newCapacity * queue->elemSize);
+    if (!buffer) {
+        return false;
+    }
 
-inline xSize xQueue_getElemSize(const xQueue *queue) { return (queue) ? xList_getElemSize(queue->internalList) : 0; }
+    // elements wrapped around end of old buffer continue right after it, where doubled buffer has free room for them
+    if (queue->head + queue->size > oldCapacity) {
+        xSize wrapped = queue->head + queue->size - oldCapacity;
+        xMemCopy(buffer + oldCapacity * queue->elemSize, buffer, wrapped * queue->elemSize);
+    }
 
-inline xBool xQueue_isValid(const xQueue *queue) { return (queue && xList_isValid(queue->internalList)) ? true : false; }
+    queue->buffer = buffer;
+    queue->capacity = newCapacity;
+    return true;
+}
 
 void xQueue_enqueue(xQueue *queue, const void *data)
 {
@@ -62,7 +156,17 @@ void xQueue_enqueue(xQueue *queue, const void *data)
     }
 
     // push the data to the back of the internal list
-    xList_pushBack(queue->internalList, data);
+    if (queue->backend == XQUEUE_BACKEND_LIST) {
+        xList_pushBack(queue->internalList, data);
+        return;
+    }
+
+    // store the data in first free slot after back of the ring buffer
+    if (queue->size == queue->capacity && !xQueue_grow(queue)) {
+        return;
+    }
+    xMemCopy(xQueue_slot(queue, queue->size), data, queue->elemSize);
+    queue->size++;
 }
 
 void *xQueue_dequeue(xQueue *queue)
@@ -73,7 +177,46 @@ void *xQueue_dequeue(xQueue *queue)
     }
 
     // pop the front element from the internal list and return it
-    return xList_popFront(queue->internalList);
+    if (queue->backend == XQUEUE_BACKEND_LIST) {
+        return xList_popFront(queue->internalList);
+    }
+
+    // copy the front element of the ring buffer and return it
+    if (!queue->size) {
+        return NULL;
+    }
+    void *data = malloc(queue->elemSize);
+    if (!data) {
+        return NULL;
+    }
+    xQueue_dequeueInto(queue, data);
+
+    return data;
+}
+
+xBool xQueue_dequeueInto(xQueue *queue, void *dest)
+{
+    // validate passed arguments
+    if (!xQueue_isValid(queue) || !dest || !xQueue_getSize(queue)) {
+        return false;
+    }
+
+    // list backend has no way to drop front node without copying it
+    if (queue->backend == XQUEUE_BACKEND_LIST) {
+        void *data = xList_popFront(queue->internalList);
+        if (!data) {
+            return false;
+        }
+        xMemCopy(dest, data, queue->elemSize);
+        free(data);
+        return true;
+    }
+
+    xMemCopy(dest, xQueue_slot(queue, 0), queue->elemSize);
+    queue->head = (queue->head + 1) & (queue->capacity - 1);
+    queue->size--;
+
+    return true;
 }
 
 const void *xQueue_peek(const xQueue *queue)
@@ -83,8 +226,11 @@ const void *xQueue_peek(const xQueue *queue)
         return NULL;
     }
 
-    // return the front element of the internal list without removing it
-    return (const void *)xList_peekFront(queue->internalList);
+    // return the front element of the underlying structure without removing it
+    if (queue->backend == XQUEUE_BACKEND_LIST) {
+        return (const void *)xList_peekFront(queue->internalList);
+    }
+    return (queue->size) ? (const void *)xQueue_slot(queue, 0) : NULL;
 }
 
 void xQueue_clear(xQueue *queue)
@@ -94,8 +240,13 @@ void xQueue_clear(xQueue *queue)
         return;
     }
 
-    // clear the internal list
-    xList_clear(queue->internalList);
+    // clear the internal list, ring buffer is kept for following elements
+    if (queue->backend == XQUEUE_BACKEND_LIST) {
+        xList_clear(queue->internalList);
+    } else {
+        queue->head = 0;
+        queue->size = 0;
+    }
 }
 
 xQueue *xQueue_copy(const xQueue *queue)
@@ -105,16 +256,37 @@ xQueue *xQueue_copy(const xQueue *queue)
         return NULL;
     }
 
-    // create a new queue and copy the internal list
-    xQueue *newQueue = (xQueue *)malloc(sizeof(xQueue));
+    // create a new queue with same backend
+    xQueue *newQueue = (xQueue *)xAllocator_alloc(queue->allocator, sizeof(xQueue));
     if (!newQueue) {
         return NULL;
     }
-    newQueue->internalList = xList_copy(queue->internalList);
-    if (!xQueue_isValid(newQueue)) {
-        free(newQueue);
+    *newQueue = *queue;
+
+    // copy the internal list
+    if (queue->backend == XQUEUE_BACKEND_LIST) {
+        newQueue->internalList = xList_copy(queue->internalList);
+        if (!xQueue_isValid(newQueue)) {
+            xAllocator_free(queue->allocator, newQueue, sizeof(xQueue));
+            return NULL;
+        }
+        return newQueue;
+    }
+
+    // copy elements of the ring buffer so that front element lands in first slot
+    newQueue->head = 0;
+    if (!queue->capacity) {
+        return newQueue;
+    }
+    newQueue->buffer = (xUInt8 *)xAllocator_alloc(queue->allocator, queue->capacity * queue->elemSize);
+    if (!newQueue->buffer) {
+        xAllocator_free(queue->allocator, newQueue, sizeof(xQueue));
         return NULL;
     }
+    xSize first = queue->capacity - queue->head;
+    first = (first < queue->size) ? first : queue->size;
+    xMemCopy(newQueue->buffer, xQueue_slot(queue, 0), first * queue->elemSize);
+    xMemCopy(newQueue->buffer + first * queue->elemSize, queue->buffer, (queue->size - first) * queue->elemSize);
 
     return newQueue;
 }
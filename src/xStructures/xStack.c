@@ -1,9 +1,8 @@
 #include "xStructures/xStack.h"
-#include <stdlib.h>  // malloc, free, realloc
+#include <stdlib.h>  // malloc (for element copies returned to caller)
 #include "xBase/xMemtools.h"
 #include "xBase/xTypes.h"
-
-// TODO: remove dependency on stdlib.h (custom memory allocation functions)
+#include "xMemory/xAllocator.h"
 
 // TODO: implement ability to change underlying data structure (e.g. array, linked list)
 struct xStack_s {
@@ -11,9 +10,12 @@ struct xStack_s {
     xSize elemSize;
     xSize stackSize;
     xSize stackCapacity;
+    const xAllocator *allocator;
 };
 
-xStack *xStack_new(xSize elemSize)
+xStack *xStack_new(xSize elemSize) { return xStack_newWithAllocator(elemSize, NULL); }
+
+xStack *xStack_newWithAllocator(xSize elemSize, const xAllocator *allocator)
 {
     // validate arguments
     if (elemSize == 0) {
@@ -21,7 +23,8 @@ xStack *xStack_new(xSize elemSize)
     }
 
     // allocate memory for stack
-    xStack *stack = (xStack *)malloc(sizeof(xStack));
+    allocator = allocator ? allocator : xAllocator_getDefault();
+    xStack *stack = (xStack *)xAllocator_alloc(allocator, sizeof(xStack));
     if (!stack) {
         return NULL;
     }
@@ -31,6 +34,7 @@ xStack *xStack_new(xSize elemSize)
     stack->stackSize = 0;
     stack->stackCapacity = 0;
     stack->data = NULL;
+    stack->allocator = allocator;
     return stack;
 }
 
@@ -43,7 +47,7 @@ void xStack_free(xStack *stack)
 
     // free data of stack if allocated
     if (stack->data) {
-        free(stack->data);
+        xAllocator_free(stack->allocator, stack->data, stack->stackCapacity * stack->elemSize);
     }
 
     // reset attributes and free stack
@@ -51,7 +55,7 @@ void xStack_free(xStack *stack)
     stack->stackSize = 0;
     stack->stackCapacity = 0;
     stack->elemSize = 0;
-    free(stack);
+    xAllocator_free(stack->allocator, stack, sizeof(xStack));
 }
 
 inline xSize xStack_getSize(const xStack *stack) { return (stack) ? stack->stackSize : 0; }
@@ -71,13 +75,14 @@ void xStack_push(xStack *stack, const void *data)
 
     // reallocate memory if stack is full
     if (stack->stackCapacity < stack->stackSize + 1) {
-        void *newData =
-            (void *)realloc(stack->data, ((stack->stackCapacity == 0) ? 1 : stack->stackCapacity * 2) * stack->elemSize);
+        xSize newCapacity = (stack->stackCapacity == 0) ? 1 : stack->stackCapacity * 2;
+        void *newData = xAllocator_realloc(stack->allocator, stack->data, stack->stackCapacity * stack->elemSize,
+                                           newCapacity * stack->elemSize);
         if (!newData) {
             return;
         }
         stack->data = newData;
-        stack->stackCapacity = (stack->stackCapacity == 0) ? 1 : stack->stackCapacity * 2;
+        stack->stackCapacity = newCapacity;
     }
 
     // copy data to stack and increment stack size
@@ -136,12 +141,14 @@ xStack *xStack_copy(const xStack *stack)
     }
 
     // allocate new stack, copy data from source stack and return
-    xStack *newStack = xStack_new(stack->elemSize);
+    xStack *newStack = xStack_newWithAllocator(stack->elemSize, stack->allocator);
     if (!xStack_isValid(newStack)) {
         return NULL;
+    } else if (stack->stackSize == 0) {
+        return newStack;
     }
 
-    newStack->data = (void *)malloc(stack->stackSize * stack->elemSize);
+    newStack->data = xAllocator_alloc(newStack->allocator, stack->stackSize * stack->elemSize);
     if (!newStack->data) {
         xStack_free(newStack);
         return NULL;
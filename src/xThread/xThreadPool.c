@@ -0,0 +1,299 @@
+#include "xThread/xThreadPool.h"
+#include <pthread.h>    // pthread_create, pthread_mutex_t, pthread_cond_t
+#include <stdatomic.h>  // atomic_size_t
+#include <unistd.h>     // sysconf
+#include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
+
+struct xThreadPool_s {
+    pthread_t *workers;          // worker threads (thread count - 1)
+    atomic_size_t threadCount;   // number of threads working on loop, including calling thread (changed under submitLock)
+    pthread_mutex_t lock;        // guards loop description, generation, active and shutdown
+    pthread_cond_t wake;         // signalled when new loop is posted or pool shuts down
+    pthread_cond_t idle;         // signalled when last active worker leaves loop
+    pthread_mutex_t submitLock;  // held by thread running loop on pool
+    xThreadPoolRangeFunc func;   // function of current loop
+    void *context;               // user pointer of current loop
+    xSize count;                 // number of indices of current loop
+    xSize grain;                 // number of indices per chunk of current loop
+    atomic_size_t nextChunk;     // next unclaimed chunk of current loop
+    xUInt64 generation;          // incremented whenever new loop is posted
+    xSize active;                // number of workers currently claiming chunks
+    xBool shutdown;              // whether workers should exit
+};
+
+// set on threads currently processing chunks, so nested loops run serially instead of waiting on busy pool
+static _Thread_local xBool xThreadPool_insideLoop = false;
+
+// library-wide shared pool
+static pthread_mutex_t xThreadPool_sharedLock = PTHREAD_MUTEX_INITIALIZER;
+static xThreadPool *xThreadPool_shared = NULL;
+static xSize xThreadPool_sharedThreadCount = 0;  // requested thread count of shared pool (0 for processor count)
+static xBool xThreadPool_sharedFailed = false;   // whether creating shared pool failed (not retried on every loop)
+
+/**
+ * @brief
+ * Claim and process chunks of current loop until none are left.
+ */
+static void xThreadPool_runChunks(xThreadPool *pool)
+{
+    xSize chunkCount = (pool->count + pool->grain - 1) / pool->grain;
+    xSize chunk = 0;
+    while ((chunk = atomic_fetch_add_explicit(&pool->nextChunk, 1, memory_order_relaxed)) < chunkCount) {
+        xSize begin = chunk * pool->grain;
+        xSize end = (pool->count - begin < pool->grain) ? pool->count : begin + pool->grain;
+        pool->func(pool->context, begin, end);
+    }
+}
+
+static void *xThreadPool_worker(void *arg)
+{
+    xThreadPool *pool = (xThreadPool *)arg;
+    xThreadPool_insideLoop = true;
+
+    pthread_mutex_lock(&pool->lock);
+    xUInt64 seen = pool->generation;
+    while (true) {
+        while (!pool->shutdown && pool->generation == seen) {
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        }
+        if (pool->shutdown) {
+            break;
+        }
+
+        // loop description stays unchanged while any worker is active
+        seen = pool->generation;
+        pool->active++;
+        pthread_mutex_unlock(&pool->lock);
+
+        xThreadPool_runChunks(pool);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->active == 0) {
+            pthread_cond_signal(&pool->idle);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+/**
+ * @brief
+ * Get number of processors currently online.
+ */
+static xSize xThreadPool_processorCount(void)
+{
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return (count > 0) ? (xSize)count : 1;
+}
+
+/**
+ * @brief
+ * Stop and join first `started` workers of pool.
+ */
+static void xThreadPool_stopWorkers(xThreadPool *pool, xSize started)
+{
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = true;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (xSize i = 0; i < started; i++) {
+        pthread_join(pool->workers[i], NULL);
+    }
+}
+
+/**
+ * @brief
+ * Replace workers of pool by workers for given thread count.
+ *
+ * @return xBool true on success, false if workers could not be allocated (pool is unchanged) or started (pool is left
+ * without workers).
+ *
+ * @note
+ * Caller has to hold submit lock of pool (or be its only user), so no loop is running while workers are replaced.
+ */
+static xBool xThreadPool_restart(xThreadPool *pool, xSize threadCount)
+{
+    pthread_t *workers = NULL;
+    if (threadCount > 1 && !(workers = (pthread_t *)xAllocator_alloc(NULL, (threadCount - 1) * sizeof(pthread_t)))) {
+        return false;
+    }
+
+    // stop previous workers
+    xSize previous = pool->threadCount;
+    if (previous > 1) {
+        xThreadPool_stopWorkers(pool, previous - 1);
+        xAllocator_free(NULL, pool->workers, (previous - 1) * sizeof(pthread_t));
+    }
+    pool->workers = workers;
+    pool->threadCount = 1;
+    pool->shutdown = false;
+
+    // start workers, rolling back already started ones on failure
+    for (xSize i = 0; i + 1 < threadCount; i++) {
+        if (pthread_create(&pool->workers[i], NULL, xThreadPool_worker, pool) != 0) {
+            xThreadPool_stopWorkers(pool, i);
+            xAllocator_free(NULL, pool->workers, (threadCount - 1) * sizeof(pthread_t));
+            pool->workers = NULL;
+            pool->shutdown = false;
+            return false;
+        }
+    }
+    pool->threadCount = threadCount;
+
+    return true;
+}
+
+xThreadPool *xThreadPool_new(xSize threadCount)
+{
+    threadCount = threadCount ? threadCount : xThreadPool_processorCount();
+
+    xThreadPool *pool = (xThreadPool *)xAllocator_alloc(NULL, sizeof(xThreadPool));
+    if (!pool) {
+        return NULL;
+    }
+
+    pool->workers = NULL;
+    atomic_init(&pool->threadCount, 1);
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->idle, NULL);
+    pthread_mutex_init(&pool->submitLock, NULL);
+    pool->func = NULL;
+    pool->context = NULL;
+    pool->count = 0;
+    pool->grain = 1;
+    atomic_init(&pool->nextChunk, 0);
+    pool->generation = 0;
+    pool->active = 0;
+    pool->shutdown = false;
+
+    if (!xThreadPool_restart(pool, threadCount)) {
+        xThreadPool_free(pool);
+        return NULL;
+    }
+
+    return pool;
+}
+
+void xThreadPool_free(xThreadPool *pool)
+{
+    // validate passed argument
+    if (!pool) {
+        return;
+    }
+
+    xSize threadCount = pool->threadCount;
+    if (threadCount > 1) {
+        xThreadPool_stopWorkers(pool, threadCount - 1);
+        xAllocator_free(NULL, pool->workers, (threadCount - 1) * sizeof(pthread_t));
+    }
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->wake);
+    pthread_cond_destroy(&pool->idle);
+    pthread_mutex_destroy(&pool->submitLock);
+    xAllocator_free(NULL, pool, sizeof(xThreadPool));
+}
+
+inline xSize xThreadPool_getThreadCount(const xThreadPool *pool) { return pool ? pool->threadCount : 1; }
+
+xBool xThreadPool_parallelFor(xThreadPool *pool, xSize count, xSize grain, xThreadPoolRangeFunc func, void *context)
+{
+    // validate arguments
+    if (!func || !grain) {
+        return false;
+    }
+    if (!count) {
+        return true;
+    }
+
+    // run serially if there is nothing to share, pool is busy or this is nested loop (thread count is checked under submit
+    // lock, as workers of shared pool may be replaced meanwhile)
+    xBool serial = !pool || count <= grain || xThreadPool_insideLoop || pthread_mutex_trylock(&pool->submitLock) != 0;
+    if (!serial && pool->threadCount < 2) {
+        pthread_mutex_unlock(&pool->submitLock);
+        serial = true;
+    }
+    if (serial) {
+        for (xSize begin = 0; begin < count; begin += grain) {
+            func(context, begin, (count - begin < grain) ? count : begin + grain);
+        }
+        return true;
+    }
+
+    // wait for workers late to leave previous loop, then post new one
+    pthread_mutex_lock(&pool->lock);
+    while (pool->active) {
+        pthread_cond_wait(&pool->idle, &pool->lock);
+    }
+    pool->func = func;
+    pool->context = context;
+    pool->count = count;
+    pool->grain = grain;
+    atomic_store_explicit(&pool->nextChunk, 0, memory_order_relaxed);
+    pool->generation++;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    // calling thread works too, then waits until chunks claimed by workers are done
+    xThreadPool_insideLoop = true;
+    xThreadPool_runChunks(pool);
+    xThreadPool_insideLoop = false;
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->active) {
+        pthread_cond_wait(&pool->idle, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    pthread_mutex_unlock(&pool->submitLock);
+    return true;
+}
+
+xThreadPool *xThreadPool_getShared(void)
+{
+    pthread_mutex_lock(&xThreadPool_sharedLock);
+    if (!xThreadPool_shared && !xThreadPool_sharedFailed) {
+        xThreadPool_shared = xThreadPool_new(xThreadPool_sharedThreadCount);
+        xThreadPool_sharedFailed = xThreadPool_shared ? false : true;
+    }
+    xThreadPool *pool = xThreadPool_shared;
+    pthread_mutex_unlock(&xThreadPool_sharedLock);
+
+    return pool;
+}
+
+xBool xThreadPool_setSharedThreadCount(xSize threadCount)
+{
+    // chunk waiting for its own loop to finish would never return
+    if (xThreadPool_insideLoop) {
+        return false;
+    }
+
+    // create shared pool if it does not exist yet
+    pthread_mutex_lock(&xThreadPool_sharedLock);
+    xThreadPool *pool = xThreadPool_shared;
+    if (!pool) {
+        xThreadPool_shared = xThreadPool_new(threadCount);
+        xThreadPool_sharedThreadCount = threadCount;
+        xThreadPool_sharedFailed = xThreadPool_shared ? false : true;
+        pthread_mutex_unlock(&xThreadPool_sharedLock);
+        return xThreadPool_shared ? true : false;
+    }
+    pthread_mutex_unlock(&xThreadPool_sharedLock);
+
+    // shared pool is never freed, only its workers are replaced once loop running on it finishes (shared lock is not held
+    // meanwhile, as chunks of that loop may fetch shared pool)
+    pthread_mutex_lock(&pool->submitLock);
+    xBool restarted = xThreadPool_restart(pool, threadCount ? threadCount : xThreadPool_processorCount());
+    if (restarted) {
+        pthread_mutex_lock(&xThreadPool_sharedLock);
+        xThreadPool_sharedThreadCount = threadCount;
+        pthread_mutex_unlock(&xThreadPool_sharedLock);
+    }
+    pthread_mutex_unlock(&pool->submitLock);
+
+    return restarted;
+}
@@ -0,0 +1,296 @@
+/**
+ * @file xAllocator_test.c
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief CUnit test for xAllocator module and allocator support of containers.
+ * @version 0.1
+ * @date 18.10.2026.
+ */
+
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <CUnit/TestDB.h>
+#include <malloc.h>
+#include "xBase/xMemtools.h"
+#include "xBase/xTypes.h"
+#include "xLinear/xMatrix.h"
+#include "xMemory/xAllocator.h"
+#include "xMemory/xArena.h"
+#include "xMemory/xDefer.h"
+#include "xString/xString.h"
+#include "xStructures/xArray.h"
+#include "xStructures/xHashMap.h"
+#include "xStructures/xList.h"
+#include "xStructures/xQueue.h"
+#include "xStructures/xStack.h"
+
+// tracking allocator storing size of every block in front of it to verify sizes reported by containers
+typedef struct TrackingStats_s {
+    xSize allocations;
+    xSize frees;
+    xSize liveBytes;
+    xSize sizeMismatches;
+} TrackingStats;
+
+#define TRACKING_HEADER 16
+
+static void *trackingAlloc(void *ctx, xSize size)
+{
+    TrackingStats *stats = (TrackingStats *)ctx;
+    xUInt8 *block = (xUInt8 *)malloc(TRACKING_HEADER + size);
+    if (!block) {
+        return NULL;
+    }
+    *(xSize *)block = size;
+    stats->allocations++;
+    stats->liveBytes += size;
+    return block + TRACKING_HEADER;
+}
+
+static void trackingFree(void *ctx, void *ptr, xSize size)
+{
+    TrackingStats *stats = (TrackingStats *)ctx;
+    xUInt8 *block = (xUInt8 *)ptr - TRACKING_HEADER;
+    if (*(xSize *)block != size) {
+        stats->sizeMismatches++;
+    }
+    stats->frees++;
+    stats->liveBytes -= *(xSize *)block;
+    free(block);
+}
+
+static void *trackingRealloc(void *ctx, void *ptr, xSize oldSize, xSize newSize)
+{
+    TrackingStats *stats = (TrackingStats *)ctx;
+    xUInt8 *block = (xUInt8 *)ptr - TRACKING_HEADER;
+    if (*(xSize *)block != oldSize) {
+        stats->sizeMismatches++;
+    }
+    xUInt8 *newBlock = (xUInt8 *)realloc(block, TRACKING_HEADER + newSize);
+    if (!newBlock) {
+        return NULL;
+    }
+    *(xSize *)newBlock = newSize;
+    stats->liveBytes += newSize - oldSize;
+    return newBlock + TRACKING_HEADER;
+}
+
+void test_xAllocator_default(void)
+{
+    // Test case 1: Default allocator is always available
+    const xAllocator *allocator = xAllocator_getDefault();
+    CU_ASSERT_PTR_NOT_NULL(allocator);
+    CU_ASSERT_PTR_NOT_NULL(allocator->alloc);
+
+    // Test case 2: Allocation, reallocation and release through default allocator
+    xUInt8 *block = (xUInt8 *)xAllocator_alloc(NULL, 16);
+    CU_ASSERT_PTR_NOT_NULL(block);
+    xMemSet(block, 0xAB, 16);
+    block = (xUInt8 *)xAllocator_realloc(NULL, block, 16, 64);
+    CU_ASSERT_PTR_NOT_NULL(block);
+    CU_ASSERT_EQUAL(block[15], 0xAB);
+    xAllocator_free(NULL, block, 64);
+
+    // Test case 3: Zero-sized allocation and NULL release
+    CU_ASSERT_PTR_NULL(xAllocator_alloc(allocator, 0));
+    xAllocator_free(allocator, NULL, 0);  // should not crash
+}
+
+void test_xAllocator_emulatedRealloc(void)
+{
+    TrackingStats stats = {0, 0, 0, 0};
+    xAllocator allocator = {trackingAlloc, NULL, trackingFree, &stats};
+
+    // Test case 1: Reallocation without native support preserves data
+    xUInt32 *block = (xUInt32 *)xAllocator_alloc(&allocator, 4 * sizeof(xUInt32));
+    for (xUInt32 i = 0; i < 4; i++) {
+        block[i] = i + 1;
+    }
+    block = (xUInt32 *)xAllocator_realloc(&allocator, block, 4 * sizeof(xUInt32), 8 * sizeof(xUInt32));
+    CU_ASSERT_PTR_NOT_NULL(block);
+    CU_ASSERT_TRUE(block && block[0] == 1 && block[3] == 4);
+    xAllocator_free(&allocator, block, 8 * sizeof(xUInt32));
+    CU_ASSERT_EQUAL(stats.allocations, 2);
+    CU_ASSERT_EQUAL(stats.frees, 2);
+    CU_ASSERT_EQUAL(stats.liveBytes, 0);
+    CU_ASSERT_EQUAL(stats.sizeMismatches, 0);
+}
+
+static void collectionsWorkload(const xAllocator *allocator)
+{
+    XDEFER_SCOPE_WITH_ALLOCATOR(allocator)
+
+    xArray *arr = xArray_newWithAllocator(sizeof(xUInt32), allocator);
+    xStack *stack = xStack_newWithAllocator(sizeof(xUInt32), allocator);
+    xList *list = xList_newWithAllocator(sizeof(xUInt32), allocator);
+    xQueue *queue = xQueue_newWithAllocator(sizeof(xUInt32), allocator);
+    xHashMap *map = xHashMap_newWithAllocator(sizeof(xUInt32), sizeof(xUInt32), allocator);
+    DEFER(xArray_free, arr);
+    DEFER(xStack_free, stack);
+    DEFER(xList_free, list);
+    DEFER(xQueue_free, queue);
+    DEFER(xHashMap_free, map);
+
+    for (xUInt32 i = 0; i < 100; i++) {
+        xArray_push(arr, &i);
+        xStack_push(stack, &i);
+        xList_pushBack(list, &i);
+        xQueue_enqueue(queue, &i);
+        xHashMap_put(map, &i, &i);
+    }
+    free(xStack_pop(stack));
+    free(xList_popFront(list));
+    free(xQueue_dequeue(queue));
+    xUInt32 key = 50;
+    xHashMap_remove(map, &key);
+
+    xArray *arrCopy = xArray_copy(arr);
+    xStack *stackCopy = xStack_copy(stack);
+    xList *listCopy = xList_copy(list);
+    xQueue *queueCopy = xQueue_copy(queue);
+    DEFER(xArray_free, arrCopy);
+    DEFER(xStack_free, stackCopy);
+    DEFER(xList_free, listCopy);
+    DEFER(xQueue_free, queueCopy);
+    CU_ASSERT_EQUAL(xArray_getSize(arrCopy), 100);
+    CU_ASSERT_EQUAL(xStack_getSize(stackCopy), 99);
+    CU_ASSERT_EQUAL(xList_getSize(listCopy), 99);
+    CU_ASSERT_EQUAL(xQueue_getSize(queueCopy), 99);
+    CU_ASSERT_EQUAL(xHashMap_getSize(map), 99);
+}
+
+static void stringWorkload(const xAllocator *allocator)
+{
+    XDEFER_SCOPE
+
+    xString *str = xString_newWithAllocator(allocator);
+    DEFER(xString_free, str);
+    xString *hello = xString_append(str, "Hello, World!", 13);
+    DEFER(xString_free, hello);
+    xString *sub = xString_substring(hello, 7, 12);
+    DEFER(xString_free, sub);
+    xString *subsub = xString_substring(sub, 1, 3);
+    DEFER(xString_free, subsub);
+    xString *replaced = xString_replaceAll(hello, "o", 1, "0000", 4);
+    DEFER(xString_free, replaced);
+    xString *inserted = xString_insert(hello, "Oh, ", 4, 0);
+    DEFER(xString_free, inserted);
+    xString *copy = xString_copy(sub);
+    DEFER(xString_free, copy);
+    xString_optimize(copy);
+    xString_preallocate(sub, 16);
+
+    CU_ASSERT_TRUE(xMemCmp(xString_getData(subsub), "or", 2));
+    CU_ASSERT_EQUAL(xString_getLength(replaced), 13 + 2 * 3);
+    CU_ASSERT_EQUAL(xString_find(inserted, "World", 5), 11);
+    CU_ASSERT_TRUE(xMemCmp(xString_getData(copy), "World", 5));
+}
+
+static void matrixWorkload(const xAllocator *allocator)
+{
+    xMatrix *mat = xMatrix_newWithAllocator(3, 4, allocator);
+    xMatrix_fill(mat, 2.0f);
+    xMatrix *transposed = xMatrix_transpose(mat);
+    xMatrix *product = xMatrix_mul(mat, transposed);
+    xMatrix_transpose_inplace(mat);
+    CU_ASSERT_EQUAL(xMatrix_get(product, 1, 2), 16.0f);
+    CU_ASSERT_EQUAL(xMatrix_getRows(mat), 4);
+    xMatrix_free(product);
+    xMatrix_free(transposed);
+    xMatrix_free(mat);
+}
+
+void test_xAllocator_containers(void)
+{
+    TrackingStats stats = {0, 0, 0, 0};
+    xAllocator allocator = {trackingAlloc, trackingRealloc, trackingFree, &stats};
+
+    // Test case 1: Structures route all memory through allocator and release it with correct sizes
+    collectionsWorkload(&allocator);
+    CU_ASSERT_TRUE(stats.allocations > 0);
+    CU_ASSERT_EQUAL(stats.allocations, stats.frees);
+    CU_ASSERT_EQUAL(stats.liveBytes, 0);
+    CU_ASSERT_EQUAL(stats.sizeMismatches, 0);
+
+    // Test case 2: Strings and strings derived from them
+    stats.allocations = stats.frees = 0;
+    stringWorkload(&allocator);
+    CU_ASSERT_TRUE(stats.allocations > 0);
+    CU_ASSERT_EQUAL(stats.allocations, stats.frees);
+    CU_ASSERT_EQUAL(stats.liveBytes, 0);
+    CU_ASSERT_EQUAL(stats.sizeMismatches, 0);
+
+    // Test case 3: Matrices and results of operations on them
+    stats.allocations = stats.frees = 0;
+    matrixWorkload(&allocator);
+    CU_ASSERT_EQUAL(stats.allocations, 4);
+    CU_ASSERT_EQUAL(stats.allocations, stats.frees);
+    CU_ASSERT_EQUAL(stats.liveBytes, 0);
+    CU_ASSERT_EQUAL(stats.sizeMismatches, 0);
+}
+
+void test_xAllocator_arena(void)
+{
+    TrackingStats stats = {0, 0, 0, 0};
+    xAllocator backing = {trackingAlloc, trackingRealloc, trackingFree, &stats};
+    xArena *arena = xArena_newWithAllocator(4096, &backing);
+    const xAllocator *allocator = xArena_getAllocator(arena);
+    CU_ASSERT_PTR_NOT_NULL(allocator);
+
+    // Test case 1: Containers allocated from arena
+    xArenaMark mark = xArena_mark(arena);
+    xList *list = xList_newWithAllocator(sizeof(xUInt64), allocator);
+    xArray *arr = xArray_newWithAllocator(sizeof(xUInt64), allocator);
+    for (xUInt64 i = 0; i < 1000; i++) {
+        xList_pushBack(list, &i);
+        xArray_push(arr, &i);
+    }
+    CU_ASSERT_EQUAL(xList_getSize(list), 1000);
+    CU_ASSERT_EQUAL(*(xUInt64 *)xArray_get(arr, 999), 999);
+    CU_ASSERT_EQUAL(*(xUInt64 *)xList_peekBack(list), 999);
+    CU_ASSERT_TRUE(xArena_getUsed(arena) > 1000 * sizeof(xUInt64));
+
+    // Test case 2: Whole object graph released by single rewind
+    xArena_rewind(&mark);
+    CU_ASSERT_EQUAL(xArena_getUsed(arena), 0);
+
+    // Test case 3: Arena blocks come from backing allocator
+    xSize blocks = stats.allocations;
+    CU_ASSERT_TRUE(blocks > 1);
+    xArena_free(arena);
+    CU_ASSERT_EQUAL(stats.frees, blocks);
+    CU_ASSERT_EQUAL(stats.liveBytes, 0);
+    CU_ASSERT_EQUAL(stats.sizeMismatches, 0);
+}
+
+int main(void)
+{
+    CU_pSuite pSuite = NULL;
+
+    // initialize CUnit test registry
+    if (CU_initialize_registry() != CUE_SUCCESS) {
+        return CU_get_error();
+    }
+
+    // add a suite to the registry
+    pSuite = CU_add_suite("xAllocator_test", NULL, NULL);
+    if (pSuite == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // add the tests to the suite
+    if (CU_add_test(pSuite, "xAllocator_default", test_xAllocator_default) == NULL ||
+        CU_add_test(pSuite, "xAllocator_emulatedRealloc", test_xAllocator_emulatedRealloc) == NULL ||
+        CU_add_test(pSuite, "xAllocator_containers", test_xAllocator_containers) == NULL ||
+        CU_add_test(pSuite, "xAllocator_arena", test_xAllocator_arena) == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // run all tests using the CUnit Basic interface
+    CU_basic_set_mode(CU_BRM_VERBOSE);
+    CU_basic_run_tests();
+    CU_cleanup_registry();
+
+    return CU_get_error();
+}
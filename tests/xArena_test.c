@@ -0,0 +1,217 @@
+/**
+ * @file xArena_test.c
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief CUnit test for xArena module.
+ * @version 0.1
+ * @date 18.10.2026.
+ */
+
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <CUnit/TestDB.h>
+#include <malloc.h>
+#include <stdint.h>
+#include "xBase/xMemtools.h"
+#include "xBase/xTypes.h"
+#include "xMemory/xArena.h"
+#include "xMemory/xDefer.h"
+
+void test_xArena_new(void)
+{
+    // Test case 1: Arena with default block size
+    xArena *arena = xArena_new(0);
+    CU_ASSERT_PTR_NOT_NULL(arena);
+    CU_ASSERT_EQUAL(xArena_getUsed(arena), 0);
+    xArena_free(arena);
+
+    // Test case 2: Arena with custom block size
+    arena = xArena_new(128);
+    CU_ASSERT_PTR_NOT_NULL(arena);
+    xArena_free(arena);
+
+    // Test case 3: Free NULL arena
+    xArena_free(NULL);  // should not crash
+}
+
+void test_xArena_alloc(void)
+{
+    xArena *arena = xArena_new(256);
+
+    // Test case 1: Allocations are distinct, aligned and writable
+    xUInt8 *a = (xUInt8 *)xArena_alloc(arena, 10);
+    xUInt8 *b = (xUInt8 *)xArena_alloc(arena, 10);
+    CU_ASSERT_PTR_NOT_NULL(a);
+    CU_ASSERT_PTR_NOT_NULL(b);
+    CU_ASSERT_TRUE(b >= a + 10);
+    CU_ASSERT_EQUAL((uintptr_t)a % XARENA_DEFAULT_ALIGNMENT, 0);
+    CU_ASSERT_EQUAL((uintptr_t)b % XARENA_DEFAULT_ALIGNMENT, 0);
+    xMemSet(a, 0xAA, 10);
+    xMemSet(b, 0xBB, 10);
+    CU_ASSERT_EQUAL(a[9], 0xAA);
+
+    // Test case 2: Custom alignment
+    void *c = xArena_allocAligned(arena, 1, 1);
+    void *d = xArena_allocAligned(arena, 8, 64);
+    CU_ASSERT_PTR_NOT_NULL(c);
+    CU_ASSERT_PTR_NOT_NULL(d);
+    CU_ASSERT_EQUAL((uintptr_t)d % 64, 0);
+
+    // Test case 3: Allocation spanning multiple blocks and larger than block size
+    xBool valid = true;
+    for (int i = 0; i < 100; i++) {
+        xUInt32 *p = (xUInt32 *)xArena_alloc(arena, 40);
+        if (!p || (uintptr_t)p % XARENA_DEFAULT_ALIGNMENT) {
+            valid = false;
+        } else {
+            *p = (xUInt32)i;
+        }
+    }
+    CU_ASSERT_TRUE(valid);
+    xUInt8 *large = (xUInt8 *)xArena_alloc(arena, 4096);
+    CU_ASSERT_PTR_NOT_NULL(large);
+    xMemSet(large, 0, 4096);
+    CU_ASSERT_EQUAL(a[0], 0xAA);
+    CU_ASSERT_EQUAL(b[0], 0xBB);
+    CU_ASSERT_TRUE(xArena_getUsed(arena) >= 4096 + 100 * 40);
+
+    // Test case 4: Invalid arguments
+    CU_ASSERT_PTR_NULL(xArena_alloc(NULL, 10));
+    CU_ASSERT_PTR_NULL(xArena_alloc(arena, 0));
+    CU_ASSERT_PTR_NULL(xArena_allocAligned(arena, 10, 0));
+    CU_ASSERT_PTR_NULL(xArena_allocAligned(arena, 10, 24));
+
+    xArena_free(arena);
+}
+
+void test_xArena_reset(void)
+{
+    xArena *arena = xArena_new(1024);
+
+    // Test case 1: Reset releases all allocations
+    for (int i = 0; i < 50; i++) {
+        xArena_alloc(arena, 100);
+    }
+    xArena_reset(arena);
+    CU_ASSERT_EQUAL(xArena_getUsed(arena), 0);
+    void *again = xArena_alloc(arena, 100);
+    CU_ASSERT_PTR_NOT_NULL(again);
+    CU_ASSERT_EQUAL(xArena_getUsed(arena), 100);
+
+    // Test case 2: Repeated fill/reset cycles keep working
+    xBool valid = true;
+    for (int cycle = 0; cycle < 10; cycle++) {
+        for (int i = 0; i < 50; i++) {
+            if (!xArena_alloc(arena, 100)) {
+                valid = false;
+            }
+        }
+        xArena_reset(arena);
+    }
+    CU_ASSERT_TRUE(valid);
+
+    // Test case 3: Reset NULL or empty arena
+    xArena_reset(NULL);   // should not crash
+    xArena_reset(arena);  // already empty
+
+    xArena_free(arena);
+}
+
+void test_xArena_rewind(void)
+{
+    xArena *arena = xArena_new(256);
+
+    // Test case 1: Rewind within single block
+    xArena_alloc(arena, 32);
+    xArenaMark mark = xArena_mark(arena);
+    void *p = xArena_alloc(arena, 32);
+    CU_ASSERT_EQUAL(xArena_getUsed(arena), 64);
+    xArena_rewind(&mark);
+    CU_ASSERT_EQUAL(xArena_getUsed(arena), 32);
+    CU_ASSERT_PTR_EQUAL(xArena_alloc(arena, 32), p);
+
+    // Test case 2: Rewind across multiple blocks
+    mark = xArena_mark(arena);
+    for (int i = 0; i < 100; i++) {
+        xArena_alloc(arena, 64);
+    }
+    xArena_rewind(&mark);
+    CU_ASSERT_EQUAL(xArena_getUsed(arena), 64);
+
+    // Test case 3: Mark of empty arena rewinds everything
+    xArena_reset(arena);
+    mark = xArena_mark(arena);
+    xArena_alloc(arena, 16);
+    xArena_rewind(&mark);
+    CU_ASSERT_EQUAL(xArena_getUsed(arena), 0);
+
+    // Test case 4: NULL mark
+    xArena_rewind(NULL);  // should not crash
+
+    xArena_free(arena);
+}
+
+static void scopedAllocations(xArena *arena)
+{
+    XDEFER_SCOPE
+    XARENA_DEFER_REWIND(arena);
+    for (int i = 0; i < 100; i++) {
+        xArena_alloc(arena, 48);
+    }
+}
+
+void test_xArena_deferRewind(void)
+{
+    xArena *arena = xArena_new(512);
+
+    // Test case 1: Arena is rewound when defer scope exits
+    xArena_alloc(arena, 16);
+    scopedAllocations(arena);
+    CU_ASSERT_EQUAL(xArena_getUsed(arena), 16);
+
+    // Test case 2: Nested rewinds in the same scope
+    {
+        XDEFER_SCOPE
+        XARENA_DEFER_REWIND(arena);
+        xArena_alloc(arena, 16);
+        XARENA_DEFER_REWIND(arena);
+        xArena_alloc(arena, 16);
+        CU_ASSERT_EQUAL(xArena_getUsed(arena), 48);
+    }
+    CU_ASSERT_EQUAL(xArena_getUsed(arena), 16);
+
+    xArena_free(arena);
+}
+
+int main(void)
+{
+    CU_pSuite pSuite = NULL;
+
+    // initialize CUnit test registry
+    if (CU_initialize_registry() != CUE_SUCCESS) {
+        return CU_get_error();
+    }
+
+    // add a suite to the registry
+    pSuite = CU_add_suite("xArena_test", NULL, NULL);
+    if (pSuite == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // add the tests to the suite
+    if (CU_add_test(pSuite, "xArena_new", test_xArena_new) == NULL ||
+        CU_add_test(pSuite, "xArena_alloc", test_xArena_alloc) == NULL ||
+        CU_add_test(pSuite, "xArena_reset", test_xArena_reset) == NULL ||
+        CU_add_test(pSuite, "xArena_rewind", test_xArena_rewind) == NULL ||
+        CU_add_test(pSuite, "xArena_deferRewind", test_xArena_deferRewind) == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // run all tests using the CUnit Basic interface
+    CU_basic_set_mode(CU_BRM_VERBOSE);
+    CU_basic_run_tests();
+    CU_cleanup_registry();
+
+    return CU_get_error();
+}
@@ -0,0 +1,236 @@
+/**
+ * @file xConcurrentQueue_test.c
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief CUnit test for xConcurrentQueue module.
+ * @version 0.1
+ * @date 18.10.2026.
+ */
+
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <CUnit/TestDB.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include "xBase/xTypes.h"
+#include "xStructures/xConcurrentQueue.h"
+
+#define ITEMS_PER_PRODUCER 100000
+
+void test_xConcurrentQueue_new(void)
+{
+    // Test case 1: Capacity is rounded up to power of 2
+    xConcurrentQueue *queue = xConcurrentQueue_new(sizeof(xUInt32), 100, XCONCURRENTQUEUE_SPSC);
+    CU_ASSERT_PTR_NOT_NULL(queue);
+    CU_ASSERT_TRUE(xConcurrentQueue_isValid(queue));
+    CU_ASSERT_EQUAL(xConcurrentQueue_getCapacity(queue), 128);
+    CU_ASSERT_EQUAL(xConcurrentQueue_getElemSize(queue), sizeof(xUInt32));
+    CU_ASSERT_EQUAL(xConcurrentQueue_getMode(queue), XCONCURRENTQUEUE_SPSC);
+    CU_ASSERT_EQUAL(xConcurrentQueue_getSize(queue), 0);
+    xConcurrentQueue_free(queue);
+
+    // Test case 2: MPMC queue
+    queue = xConcurrentQueue_new(3, 64, XCONCURRENTQUEUE_MPMC);
+    CU_ASSERT_PTR_NOT_NULL(queue);
+    CU_ASSERT_EQUAL(xConcurrentQueue_getCapacity(queue), 64);
+    CU_ASSERT_EQUAL(xConcurrentQueue_getMode(queue), XCONCURRENTQUEUE_MPMC);
+    xConcurrentQueue_free(queue);
+
+    // Test case 3: Invalid arguments
+    CU_ASSERT_PTR_NULL(xConcurrentQueue_new(0, 16, XCONCURRENTQUEUE_SPSC));
+    CU_ASSERT_PTR_NULL(xConcurrentQueue_new(sizeof(xUInt32), 0, XCONCURRENTQUEUE_MPMC));
+    CU_ASSERT_PTR_NULL(xConcurrentQueue_new(sizeof(xUInt32), 16, (xConcurrentQueueMode)7));
+    CU_ASSERT_FALSE(xConcurrentQueue_isValid(NULL));
+    xConcurrentQueue_free(NULL);  // should not crash
+}
+
+static void singleThreaded(xConcurrentQueueMode mode)
+{
+    xConcurrentQueue *queue = xConcurrentQueue_new(sizeof(xUInt32), 8, mode);
+    xUInt32 value = 0;
+
+    // Test case 1: Empty queue
+    CU_ASSERT_FALSE(xConcurrentQueue_tryDequeue(queue, &value));
+
+    // Test case 2: Fill queue until it is full
+    for (xUInt32 i = 0; i < 8; i++) {
+        CU_ASSERT_TRUE(xConcurrentQueue_tryEnqueue(queue, &i));
+    }
+    CU_ASSERT_FALSE(xConcurrentQueue_tryEnqueue(queue, &value));
+    CU_ASSERT_EQUAL(xConcurrentQueue_getSize(queue), 8);
+
+    // Test case 3: Elements come out in order, also after wrapping around
+    xBool ordered = true;
+    xUInt32 next = 8, expected = 0;
+    for (xUInt32 i = 0; i < 100; i++, next++, expected++) {
+        ordered = (xConcurrentQueue_tryDequeue(queue, &value) && value == expected) ? ordered : false;
+        ordered = xConcurrentQueue_tryEnqueue(queue, &next) ? ordered : false;
+    }
+    CU_ASSERT_TRUE(ordered);
+
+    // Test case 4: Batch operations are limited by free room and available elements
+    xUInt32 batch[12];
+    CU_ASSERT_EQUAL(xConcurrentQueue_tryDequeueBatch(queue, batch, 5), 5);
+    CU_ASSERT_EQUAL(batch[0], expected);
+    CU_ASSERT_EQUAL(batch[4], expected + 4);
+    for (xUInt32 i = 0; i < 12; i++) {
+        batch[i] = next + i;
+    }
+    CU_ASSERT_EQUAL(xConcurrentQueue_tryEnqueueBatch(queue, batch, 12), 5);
+    CU_ASSERT_EQUAL(xConcurrentQueue_tryDequeueBatch(queue, batch, 12), 8);
+    CU_ASSERT_EQUAL(batch[0], expected + 5);
+    CU_ASSERT_EQUAL(batch[7], next + 4);
+    CU_ASSERT_EQUAL(xConcurrentQueue_getSize(queue), 0);
+
+    // Test case 5: Invalid arguments
+    CU_ASSERT_FALSE(xConcurrentQueue_tryEnqueue(NULL, &value));
+    CU_ASSERT_FALSE(xConcurrentQueue_tryEnqueue(queue, NULL));
+    CU_ASSERT_FALSE(xConcurrentQueue_tryDequeue(queue, NULL));
+    CU_ASSERT_EQUAL(xConcurrentQueue_tryEnqueueBatch(queue, batch, 0), 0);
+
+    xConcurrentQueue_free(queue);
+}
+
+void test_xConcurrentQueue_spsc(void) { singleThreaded(XCONCURRENTQUEUE_SPSC); }
+
+void test_xConcurrentQueue_mpmc(void) { singleThreaded(XCONCURRENTQUEUE_MPMC); }
+
+typedef struct WorkerArgs_s {
+    xConcurrentQueue *queue;
+    xUInt32 id;
+    xSize batch;
+    atomic_size_t *consumed;
+    xSize total;
+    xUInt64 sum;
+    xBool ordered;
+} WorkerArgs;
+
+static void *producer(void *arg)
+{
+    WorkerArgs *args = (WorkerArgs *)arg;
+    xUInt64 items[16];
+    xUInt64 next = 0;
+    while (next < ITEMS_PER_PRODUCER) {
+        xSize count = 0;
+        for (; count < args->batch && next + count < ITEMS_PER_PRODUCER; count++) {
+            items[count] = ((xUInt64)args->id << 32) | (next + count);
+        }
+        xSize enqueued = xConcurrentQueue_tryEnqueueBatch(args->queue, items, count);
+        if (!enqueued) {
+            sched_yield();  // let consumers run when there are fewer cores than threads
+        }
+        next += enqueued;
+    }
+    return NULL;
+}
+
+static void *consumer(void *arg)
+{
+    WorkerArgs *args = (WorkerArgs *)arg;
+    xUInt64 items[16];
+    xUInt64 last[8] = {0};
+    args->sum = 0;
+    args->ordered = true;
+    while (atomic_load(args->consumed) < args->total) {
+        xSize count = xConcurrentQueue_tryDequeueBatch(args->queue, items, args->batch);
+        if (!count) {
+            sched_yield();
+        }
+        for (xSize i = 0; i < count; i++) {
+            xUInt32 id = (xUInt32)(items[i] >> 32);
+            xUInt64 value = items[i] & 0xFFFFFFFF;
+            // elements of each producer have to arrive in order they were produced
+            if (value + 1 <= last[id]) {
+                args->ordered = false;
+            }
+            last[id] = value + 1;
+            args->sum += value;
+        }
+        atomic_fetch_add(args->consumed, count);
+    }
+    return NULL;
+}
+
+static void multiThreaded(xConcurrentQueueMode mode, xSize producers, xSize consumers, xSize batch)
+{
+    xConcurrentQueue *queue = xConcurrentQueue_new(sizeof(xUInt64), 256, mode);
+    atomic_size_t consumed;
+    atomic_init(&consumed, 0);
+    pthread_t threads[8];
+    WorkerArgs args[8];
+
+    for (xSize i = 0; i < producers + consumers; i++) {
+        args[i].queue = queue;
+        args[i].id = (xUInt32)i;
+        args[i].batch = batch;
+        args[i].consumed = &consumed;
+        args[i].total = producers * ITEMS_PER_PRODUCER;
+        pthread_create(&threads[i], NULL, (i < producers) ? producer : consumer, &args[i]);
+    }
+
+    xUInt64 sum = 0;
+    xBool ordered = true;
+    for (xSize i = 0; i < producers + consumers; i++) {
+        pthread_join(threads[i], NULL);
+        if (i >= producers) {
+            sum += args[i].sum;
+            ordered = args[i].ordered ? ordered : false;
+        }
+    }
+
+    // every element was received exactly once and in order of its producer
+    CU_ASSERT_EQUAL(atomic_load(&consumed), producers * ITEMS_PER_PRODUCER);
+    CU_ASSERT_EQUAL(sum, (xUInt64)producers * ITEMS_PER_PRODUCER * (ITEMS_PER_PRODUCER - 1) / 2);
+    CU_ASSERT_TRUE(ordered);
+    CU_ASSERT_EQUAL(xConcurrentQueue_getSize(queue), 0);
+
+    xConcurrentQueue_free(queue);
+}
+
+void test_xConcurrentQueue_threads(void)
+{
+    // Test case 1: Single producer and consumer
+    multiThreaded(XCONCURRENTQUEUE_SPSC, 1, 1, 1);
+
+    // Test case 2: Single producer and consumer with batches
+    multiThreaded(XCONCURRENTQUEUE_SPSC, 1, 1, 16);
+
+    // Test case 3: Multiple producers and consumers
+    multiThreaded(XCONCURRENTQUEUE_MPMC, 4, 4, 1);
+
+    // Test case 4: Multiple producers and consumers with batches
+    multiThreaded(XCONCURRENTQUEUE_MPMC, 3, 2, 7);
+}
+
+int main(void)
+{
+    CU_pSuite pSuite = NULL;
+
+    // initialize CUnit test registry
+    if (CU_initialize_registry() != CUE_SUCCESS) {
+        return CU_get_error();
+    }
+
+    // add a suite to the registry
+    pSuite = CU_add_suite("xConcurrentQueue_test", NULL, NULL);
+    if (pSuite == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // add the tests to the suite
+    if (CU_add_test(pSuite, "xConcurrentQueue_new", test_xConcurrentQueue_new) == NULL ||
+        CU_add_test(pSuite, "xConcurrentQueue_spsc", test_xConcurrentQueue_spsc) == NULL ||
+        CU_add_test(pSuite, "xConcurrentQueue_mpmc", test_xConcurrentQueue_mpmc) == NULL ||
+        CU_add_test(pSuite, "xConcurrentQueue_threads", test_xConcurrentQueue_threads) == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // run all tests using the CUnit Basic interface
+    CU_basic_set_mode(CU_BRM_VERBOSE);
+    CU_basic_run_tests();
+    CU_cleanup_registry();
+
+    return CU_get_error();
+}
@@ -0,0 +1,192 @@
+/**
+ * @file xConcurrentStack_test.c
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief CUnit test for xConcurrentStack module.
+ * @version 0.1
+ * @date 18.10.2026.
+ */
+
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <CUnit/TestDB.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "xBase/xTypes.h"
+#include "xStructures/xConcurrentStack.h"
+
+#define FREE_LIST_SIZE 64
+#define ROUNDS_PER_THREAD 50000
+
+void test_xConcurrentStack_new(void)
+{
+    // Test case 1: Valid element size
+    xConcurrentStack *stack = xConcurrentStack_new(sizeof(xUInt32));
+    CU_ASSERT_PTR_NOT_NULL(stack);
+    CU_ASSERT_TRUE(xConcurrentStack_isValid(stack));
+    CU_ASSERT_EQUAL(xConcurrentStack_getSize(stack), 0);
+    CU_ASSERT_EQUAL(xConcurrentStack_getCapacity(stack), 0);
+    CU_ASSERT_EQUAL(xConcurrentStack_getElemSize(stack), sizeof(xUInt32));
+    xConcurrentStack_free(stack);
+
+    // Test case 2: Invalid element size
+    CU_ASSERT_PTR_NULL(xConcurrentStack_new(0));
+
+    // Test case 3: NULL stack
+    CU_ASSERT_FALSE(xConcurrentStack_isValid(NULL));
+    CU_ASSERT_EQUAL(xConcurrentStack_getSize(NULL), 0);
+    xConcurrentStack_free(NULL);  // should not crash
+}
+
+void test_xConcurrentStack_pushPop(void)
+{
+    xConcurrentStack *stack = xConcurrentStack_new(sizeof(xUInt64));
+    xUInt64 value = 0;
+
+    // Test case 1: Pop from empty stack
+    CU_ASSERT_PTR_NULL(xConcurrentStack_pop(stack));
+    CU_ASSERT_FALSE(xConcurrentStack_popInto(stack, &value));
+
+    // Test case 2: Elements come out in reverse order, also across node chunks
+    for (xUInt64 i = 0; i < 1000; i++) {
+        CU_ASSERT_TRUE(xConcurrentStack_push(stack, &i));
+    }
+    CU_ASSERT_EQUAL(xConcurrentStack_getSize(stack), 1000);
+    xUInt64 *top = (xUInt64 *)xConcurrentStack_pop(stack);
+    CU_ASSERT_TRUE(top && *top == 999);
+    free(top);
+    xBool ordered = true;
+    for (xUInt64 i = 999; i-- > 500;) {
+        ordered = (xConcurrentStack_popInto(stack, &value) && value == i) ? ordered : false;
+    }
+    CU_ASSERT_TRUE(ordered);
+    CU_ASSERT_EQUAL(xConcurrentStack_getSize(stack), 500);
+
+    // Test case 3: Popped nodes are recycled
+    xSize capacity = xConcurrentStack_getCapacity(stack);
+    CU_ASSERT_TRUE(capacity >= 1000);
+    for (xUInt64 i = 0; i < 500; i++) {
+        xConcurrentStack_push(stack, &i);
+    }
+    CU_ASSERT_EQUAL(xConcurrentStack_getCapacity(stack), capacity);
+
+    // Test case 4: Clear stack
+    xConcurrentStack_clear(stack);
+    CU_ASSERT_EQUAL(xConcurrentStack_getSize(stack), 0);
+    CU_ASSERT_FALSE(xConcurrentStack_popInto(stack, &value));
+    value = 42;
+    xConcurrentStack_push(stack, &value);
+    value = 0;
+    CU_ASSERT_TRUE(xConcurrentStack_popInto(stack, &value));
+    CU_ASSERT_EQUAL(value, 42);
+    CU_ASSERT_EQUAL(xConcurrentStack_getCapacity(stack), capacity);
+
+    // Test case 5: Invalid arguments
+    CU_ASSERT_FALSE(xConcurrentStack_push(NULL, &value));
+    CU_ASSERT_FALSE(xConcurrentStack_push(stack, NULL));
+    CU_ASSERT_FALSE(xConcurrentStack_popInto(stack, NULL));
+    xConcurrentStack_clear(NULL);  // should not crash
+
+    xConcurrentStack_free(stack);
+}
+
+typedef struct WorkerArgs_s {
+    xConcurrentStack *stack;
+    atomic_bool *owned;
+    xBool valid;
+} WorkerArgs;
+
+static void *freeListWorker(void *arg)
+{
+    WorkerArgs *args = (WorkerArgs *)arg;
+    args->valid = true;
+    for (xSize i = 0; i < ROUNDS_PER_THREAD; i++) {
+        xUInt32 id = 0;
+        if (!xConcurrentStack_popInto(args->stack, &id)) {
+            continue;
+        }
+        // same entry of free list must never be handed to two threads at once
+        if (id >= FREE_LIST_SIZE || atomic_exchange(&args->owned[id], true)) {
+            args->valid = false;
+            continue;
+        }
+        atomic_store(&args->owned[id], false);
+        xConcurrentStack_push(args->stack, &id);
+    }
+    return NULL;
+}
+
+void test_xConcurrentStack_threads(void)
+{
+    xConcurrentStack *stack = xConcurrentStack_new(sizeof(xUInt32));
+    atomic_bool owned[FREE_LIST_SIZE];
+    for (xUInt32 i = 0; i < FREE_LIST_SIZE; i++) {
+        atomic_init(&owned[i], false);
+        xConcurrentStack_push(stack, &i);
+    }
+
+    // Test case 1: Stack used as free list shared between threads
+    pthread_t threads[4];
+    WorkerArgs args[4];
+    for (xSize i = 0; i < 4; i++) {
+        args[i].stack = stack;
+        args[i].owned = owned;
+        pthread_create(&threads[i], NULL, freeListWorker, &args[i]);
+    }
+    for (xSize i = 0; i < 4; i++) {
+        pthread_join(threads[i], NULL);
+        CU_ASSERT_TRUE(args[i].valid);
+    }
+
+    // Test case 2: Every entry is back in stack exactly once
+    xUInt32 seen[FREE_LIST_SIZE] = {0};
+    xUInt32 id = 0;
+    xSize count = 0;
+    while (xConcurrentStack_popInto(stack, &id)) {
+        if (id < FREE_LIST_SIZE) {
+            seen[id]++;
+        }
+        count++;
+    }
+    xBool unique = true;
+    for (xSize i = 0; i < FREE_LIST_SIZE; i++) {
+        unique = (seen[i] == 1) ? unique : false;
+    }
+    CU_ASSERT_EQUAL(count, FREE_LIST_SIZE);
+    CU_ASSERT_TRUE(unique);
+    CU_ASSERT_EQUAL(xConcurrentStack_getSize(stack), 0);
+
+    xConcurrentStack_free(stack);
+}
+
+int main(void)
+{
+    CU_pSuite pSuite = NULL;
+
+    // initialize CUnit test registry
+    if (CU_initialize_registry() != CUE_SUCCESS) {
+        return CU_get_error();
+    }
+
+    // add a suite to the registry
+    pSuite = CU_add_suite("xConcurrentStack_test", NULL, NULL);
+    if (pSuite == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // add the tests to the suite
+    if (CU_add_test(pSuite, "xConcurrentStack_new", test_xConcurrentStack_new) == NULL ||
+        CU_add_test(pSuite, "xConcurrentStack_pushPop", test_xConcurrentStack_pushPop) == NULL ||
+        CU_add_test(pSuite, "xConcurrentStack_threads", test_xConcurrentStack_threads) == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // run all tests using the CUnit Basic interface
+    CU_basic_set_mode(CU_BRM_VERBOSE);
+    CU_basic_run_tests();
+    CU_cleanup_registry();
+
+    return CU_get_error();
+}
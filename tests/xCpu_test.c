@@ -0,0 +1,82 @@
+/**
+ * @file xCpu_test.c
+ * @author 0xDontCare (https://www.github.com/0xDontCare)
+ * @brief CUnit test for all functions within xCpu module.
+ * @version 0.1
+ * @date 18.10.2026.
+ */
+
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <CUnit/TestDB.h>
+#include "xBase/xCpu.h"
+#include "xBase/xTypes.h"
+
+void test_xCpu_getFeatures(void)
+{
+    // Test case 1: Repeated detection returns the same mask
+    xUInt32 features = xCpu_getFeatures();
+    CU_ASSERT_EQUAL(xCpu_getFeatures(), features);
+
+    // Test case 2: Only known feature bits are reported
+    xUInt32 known = XCPU_FEATURE_SSE2 | XCPU_FEATURE_SSE42 | XCPU_FEATURE_AVX | XCPU_FEATURE_AVX2 | XCPU_FEATURE_FMA |
+                    XCPU_FEATURE_NEON;
+    CU_ASSERT_EQUAL(features & ~known, 0);
+
+#if defined(__x86_64__)
+    // Test case 3: SSE2 is part of x86-64 baseline
+    CU_ASSERT_TRUE(features & XCPU_FEATURE_SSE2);
+#elif defined(__aarch64__)
+    // Test case 3: NEON is part of AArch64 baseline
+    CU_ASSERT_TRUE(features & XCPU_FEATURE_NEON);
+#endif
+}
+
+void test_xCpu_hasFeature(void)
+{
+    xUInt32 features = xCpu_getFeatures();
+
+    // Test case 1: Empty feature is never reported as available
+    CU_ASSERT_FALSE(xCpu_hasFeature(XCPU_FEATURE_NONE));
+
+    // Test case 2: Result matches feature mask
+    CU_ASSERT_EQUAL(xCpu_hasFeature(XCPU_FEATURE_AVX2), (features & XCPU_FEATURE_AVX2) ? true : false);
+    CU_ASSERT_EQUAL(xCpu_hasFeature(XCPU_FEATURE_NEON), (features & XCPU_FEATURE_NEON) ? true : false);
+
+    // Test case 3: AVX2 implies AVX and SSE2
+    if (xCpu_hasFeature(XCPU_FEATURE_AVX2)) {
+        CU_ASSERT_TRUE(xCpu_hasFeature(XCPU_FEATURE_AVX));
+        CU_ASSERT_TRUE(xCpu_hasFeature(XCPU_FEATURE_SSE2));
+    }
+}
+
+int main(void)
+{
+    CU_pSuite pSuite = NULL;
+
+    // initialize the CUnit test registry
+    if (CU_initialize_registry() != CUE_SUCCESS) {
+        return CU_get_error();
+    }
+
+    // add a suite to the registry
+    pSuite = CU_add_suite("xCpu_test", NULL, NULL);
+    if (pSuite == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // add the tests to the suite
+    if (CU_add_test(pSuite, "xCpu_getFeatures", test_xCpu_getFeatures) == NULL ||
+        CU_add_test(pSuite, "xCpu_hasFeature", test_xCpu_hasFeature) == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // run all tests using the CUnit Basic interface
+    CU_basic_set_mode(CU_BRM_VERBOSE);
+    CU_basic_run_tests();
+    CU_cleanup_registry();
+
+    return CU_get_error();
+}
@@ -0,0 +1,358 @@
+/**
+ * @file xGemm_test.c
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief CUnit test for xGemm module.
+ * @version 0.1
+ * @date 18.10.2026.
+ */
+
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <CUnit/TestDB.h>
+#include <malloc.h>
+#include <math.h>
+#include "xBase/xTypes.h"
+#include "xLinear/xGemm.h"
+#include "xLinear/xMatrix.h"
+#include "xThread/xThreadPool.h"
+
+// fill array with deterministic values in range [-1, 1]
+static void fillArray(float *data, xSize count, xUInt32 seed)
+{
+    for (xSize i = 0; i < count; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        data[i] = (float)(seed >> 8) / (float)(1u << 23) - 1.0f;
+    }
+}
+
+// compare C against double precision reference of alpha * A * B + beta * C0
+static xBool checkProduct(xSize m, xSize n, xSize k, float alpha, const float *a, xSize lda, const float *b, xSize ldb,
+                          float beta, const float *c0, const float *c, xSize ldc)
+{
+    for (xSize i = 0; i < m; i++) {
+        for (xSize j = 0; j < n; j++) {
+            double sum = 0.0;
+            for (xSize p = 0; p < k; p++) {
+                sum += (double)a[i * lda + p] * (double)b[p * ldb + j];
+            }
+            double expected = alpha * sum + (beta != 0.0f ? beta * (double)c0[i * ldc + j] : 0.0);
+            if (fabs(expected - (double)c[i * ldc + j]) > 1e-4 * (double)(k + 1)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// run one product with given shape and strides, returning whether result matches reference
+static xBool runProduct(xSize m, xSize n, xSize k, xSize pad, float alpha, float beta)
+{
+    xSize lda = k + pad, ldb = n + pad, ldc = n + pad;
+    float *a = (float *)malloc(m * lda * sizeof(float));
+    float *b = (float *)malloc(k * ldb * sizeof(float));
+    float *c = (float *)malloc(m * ldc * sizeof(float));
+    float *c0 = (float *)malloc(m * ldc * sizeof(float));
+    fillArray(a, m * lda, 1);
+    fillArray(b, k * ldb, 2);
+    fillArray(c0, m * ldc, 3);
+    for (xSize i = 0; i < m * ldc; i++) {
+        c[i] = c0[i];
+    }
+
+    xBool valid = xGemm_sgemm(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc) &&
+                  checkProduct(m, n, k, alpha, a, lda, b, ldb, beta, c0, c, ldc);
+
+    // padding between rows of C must stay untouched
+    for (xSize i = 0; i < m; i++) {
+        for (xSize j = n; j < ldc; j++) {
+            valid = (c[i * ldc + j] == c0[i * ldc + j]) ? valid : false;
+        }
+    }
+
+    free(a);
+    free(b);
+    free(c);
+    free(c0);
+    return valid;
+}
+
+// run double precision product with given shape, returning whether result matches long double reference
+static xBool runProductF64(xSize m, xSize n, xSize k, double alpha, double beta)
+{
+    double *a = (double *)malloc(m * k * sizeof(double));
+    double *b = (double *)malloc(k * n * sizeof(double));
+    double *c = (double *)malloc(m * n * sizeof(double));
+    xUInt32 seed = 21;
+    for (xSize i = 0; i < m * k + k * n + m * n; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        double value = (double)(seed >> 8) / (double)(1u << 23) - 1.0;
+        if (i < m * k) {
+            a[i] = value;
+        } else if (i < m * k + k * n) {
+            b[i - m * k] = value;
+        } else {
+            c[i - m * k - k * n] = value;
+        }
+    }
+
+    xBool valid = true;
+    long double *expected = (long double *)malloc(m * n * sizeof(long double));
+    for (xSize i = 0; i < m; i++) {
+        for (xSize j = 0; j < n; j++) {
+            long double sum = 0.0L;
+            for (xSize p = 0; p < k; p++) {
+                sum += (long double)a[i * k + p] * (long double)b[p * n + j];
+            }
+            expected[i * n + j] = alpha * sum + beta * (long double)c[i * n + j];
+        }
+    }
+    valid = xGemm_dgemm(m, n, k, alpha, a, k, b, n, beta, c, n);
+    for (xSize i = 0; i < m * n; i++) {
+        // double accumulation is far more accurate than single precision tolerance of sgemm tests
+        valid = (fabsl(expected[i] - (long double)c[i]) <= 1e-12L * (long double)(k + 1)) ? valid : false;
+    }
+
+    free(a);
+    free(b);
+    free(c);
+    free(expected);
+    return valid;
+}
+
+// run integer products with given shape, returning whether results match exact reference (wrapping modulo 2^32)
+static xBool runProductInt(xSize m, xSize n, xSize k, xInt32 alpha, xInt32 beta)
+{
+    xInt8 *a8 = (xInt8 *)malloc(m * k);
+    xInt8 *b8 = (xInt8 *)malloc(k * n);
+    xInt32 *a32 = (xInt32 *)malloc(m * k * sizeof(xInt32));
+    xInt32 *b32 = (xInt32 *)malloc(k * n * sizeof(xInt32));
+    xInt32 *c8 = (xInt32 *)malloc(m * n * sizeof(xInt32));
+    xInt32 *c32 = (xInt32 *)malloc(m * n * sizeof(xInt32));
+    xUInt32 seed = 5;
+    for (xSize i = 0; i < m * k; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        a8[i] = (xInt8)(seed >> 24);  // full range including -128
+        a32[i] = (xInt32)(seed >> 8);
+    }
+    for (xSize i = 0; i < k * n; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        b8[i] = (xInt8)(seed >> 24);
+        b32[i] = (xInt32)(seed >> 4);
+    }
+    for (xSize i = 0; i < m * n; i++) {
+        c8[i] = (xInt32)i - 7;
+        c32[i] = (xInt32)i * 3;
+    }
+
+    xBool valid = true;
+    for (xSize i = 0; i < m; i++) {
+        for (xSize j = 0; j < n; j++) {
+            xUInt32 sum8 = 0, sum32 = 0;
+            for (xSize p = 0; p < k; p++) {
+                sum8 += (xUInt32)a8[i * k + p] * (xUInt32)b8[p * n + j];
+                sum32 += (xUInt32)a32[i * k + p] * (xUInt32)b32[p * n + j];
+            }
+            // references overwrite inputs of C only after all of them are read
+            c8[i * n + j] = (xInt32)((xUInt32)alpha * sum8 + (xUInt32)beta * (xUInt32)c8[i * n + j]);
+            c32[i * n + j] = (xInt32)((xUInt32)alpha * sum32 + (xUInt32)beta * (xUInt32)c32[i * n + j]);
+        }
+    }
+    xInt32 *r8 = (xInt32 *)malloc(m * n * sizeof(xInt32));
+    xInt32 *r32 = (xInt32 *)malloc(m * n * sizeof(xInt32));
+    for (xSize i = 0; i < m * n; i++) {
+        r8[i] = (xInt32)i - 7;
+        r32[i] = (xInt32)i * 3;
+    }
+    valid = xGemm_i8gemm(m, n, k, alpha, a8, k, b8, n, beta, r8, n) &&
+            xGemm_i32gemm(m, n, k, alpha, a32, k, b32, n, beta, r32, n);
+    for (xSize i = 0; i < m * n; i++) {
+        valid = (r8[i] == c8[i] && r32[i] == c32[i]) ? valid : false;
+    }
+
+    free(a8);
+    free(b8);
+    free(a32);
+    free(b32);
+    free(c8);
+    free(c32);
+    free(r8);
+    free(r32);
+    return valid;
+}
+
+void test_xGemm_sgemm(void)
+{
+    // Test case 1: Small product (direct path)
+    CU_ASSERT_TRUE(runProduct(3, 5, 7, 0, 1.0f, 0.0f));
+
+    // Test case 2: Square product filling whole micro-kernel tiles
+    CU_ASSERT_TRUE(runProduct(96, 96, 96, 0, 1.0f, 0.0f));
+
+    // Test case 3: Odd dimensions crossing cache block boundaries
+    CU_ASSERT_TRUE(runProduct(130, 70, 257, 0, 1.0f, 0.0f));
+    CU_ASSERT_TRUE(runProduct(251, 17, 300, 0, 1.0f, 0.0f));
+
+    // Test case 4: Scaling factors and accumulation into C
+    CU_ASSERT_TRUE(runProduct(61, 45, 520, 0, -0.5f, 2.0f));
+    CU_ASSERT_TRUE(runProduct(2, 3, 4, 0, 0.25f, 1.0f));
+
+    // Test case 5: Leading dimensions larger than row length
+    CU_ASSERT_TRUE(runProduct(127, 33, 65, 9, 1.5f, 0.5f));
+
+    // Test case 6: Single row and single column
+    CU_ASSERT_TRUE(runProduct(1, 300, 200, 0, 1.0f, 0.0f));
+    CU_ASSERT_TRUE(runProduct(300, 1, 200, 0, 1.0f, 0.0f));
+
+    // Test case 7: Row blocks split into parts between threads of shared pool (uneven number of blocks per part)
+    CU_ASSERT_TRUE(xThreadPool_setSharedThreadCount(3));
+    CU_ASSERT_TRUE(runProduct(845, 150, 300, 0, 1.0f, 0.5f));
+    CU_ASSERT_TRUE(runProduct(250, 64, 600, 3, -1.0f, 0.0f));
+    CU_ASSERT_TRUE(xThreadPool_setSharedThreadCount(0));
+}
+
+void test_xGemm_special(void)
+{
+    float a[64 * 64], b[64 * 64], c[64 * 64];
+    fillArray(a, 64 * 64, 4);
+    fillArray(b, 64 * 64, 5);
+
+    // Test case 1: Zero beta does not read C
+    for (xSize i = 0; i < 64 * 64; i++) {
+        c[i] = NAN;
+    }
+    CU_ASSERT_TRUE(xGemm_sgemm(64, 64, 64, 1.0f, a, 64, b, 64, 0.0f, c, 64));
+    xBool finite = true;
+    for (xSize i = 0; i < 64 * 64; i++) {
+        finite = isnan(c[i]) ? false : finite;
+    }
+    CU_ASSERT_TRUE(finite);
+
+    // Test case 2: Zero inner dimension only scales C
+    for (xSize i = 0; i < 64 * 64; i++) {
+        c[i] = 2.0f;
+    }
+    CU_ASSERT_TRUE(xGemm_sgemm(64, 64, 0, 1.0f, NULL, 0, NULL, 0, 0.5f, c, 64));
+    CU_ASSERT_EQUAL(c[0], 1.0f);
+    CU_ASSERT_EQUAL(c[64 * 64 - 1], 1.0f);
+
+    // Test case 3: Empty result is no-op
+    CU_ASSERT_TRUE(xGemm_sgemm(0, 64, 64, 1.0f, a, 64, b, 64, 0.0f, NULL, 0));
+
+    // Test case 4: Invalid arguments
+    CU_ASSERT_FALSE(xGemm_sgemm(64, 64, 64, 1.0f, NULL, 64, b, 64, 0.0f, c, 64));
+    CU_ASSERT_FALSE(xGemm_sgemm(64, 64, 64, 1.0f, a, 64, NULL, 64, 0.0f, c, 64));
+    CU_ASSERT_FALSE(xGemm_sgemm(64, 64, 64, 1.0f, a, 64, b, 64, 0.0f, NULL, 64));
+    CU_ASSERT_FALSE(xGemm_sgemm(64, 64, 64, 1.0f, a, 63, b, 64, 0.0f, c, 64));
+    CU_ASSERT_FALSE(xGemm_sgemm(64, 64, 64, 1.0f, a, 64, b, 64, 0.0f, c, 32));
+}
+
+void test_xGemm_matrix(void)
+{
+    xMatrix *lhs = xMatrix_new(150, 150);
+    xMatrix *rhs = xMatrix_new(150, 150);
+    for (xSize i = 0; i < 150; i++) {
+        for (xSize j = 0; j < 150; j++) {
+            xMatrix_set(lhs, i, j, (float)((i * 7 + j) % 11) - 5.0f);
+            xMatrix_set(rhs, i, j, (float)((i + j * 3) % 13) - 6.0f);
+        }
+    }
+
+    // Test case 1: Matrix product uses blocked kernel (integer valued data gives exact results)
+    xMatrix *prod = xMatrix_mul(lhs, rhs);
+    CU_ASSERT_PTR_NOT_NULL(prod);
+    xBool exact = true;
+    for (xSize i = 0; i < 150; i++) {
+        for (xSize j = 0; j < 150; j++) {
+            float sum = 0.0f;
+            for (xSize k = 0; k < 150; k++) {
+                sum += xMatrix_get(lhs, i, k) * xMatrix_get(rhs, k, j);
+            }
+            exact = (xMatrix_get(prod, i, j) == sum) ? exact : false;
+        }
+    }
+    CU_ASSERT_TRUE(exact);
+
+    // Test case 2: Result aliasing left operand
+    CU_ASSERT_PTR_EQUAL(xMatrix_mul_inplace(lhs, lhs, rhs), lhs);
+    xBool equal = true;
+    for (xSize i = 0; i < 150; i++) {
+        for (xSize j = 0; j < 150; j++) {
+            equal = (xMatrix_get(lhs, i, j) == xMatrix_get(prod, i, j)) ? equal : false;
+        }
+    }
+    CU_ASSERT_TRUE(equal);
+
+    xMatrix_free(lhs);
+    xMatrix_free(rhs);
+    xMatrix_free(prod);
+}
+
+void test_xGemm_dgemm(void)
+{
+    // Test case 1: Small product (direct path)
+    CU_ASSERT_TRUE(runProductF64(3, 5, 7, 1.0, 0.0));
+
+    // Test case 2: Odd dimensions crossing cache block boundaries
+    CU_ASSERT_TRUE(runProductF64(130, 70, 257, 1.0, 0.0));
+    CU_ASSERT_TRUE(runProductF64(97, 33, 300, -0.5, 2.0));
+}
+
+void test_xGemm_integer(void)
+{
+    // Test case 1: Small product (direct path)
+    CU_ASSERT_TRUE(runProductInt(3, 5, 7, 1, 0));
+
+    // Test case 2: Full and partial tiles, odd depth crossing cache block boundaries
+    CU_ASSERT_TRUE(runProductInt(96, 96, 96, 1, 0));
+    CU_ASSERT_TRUE(runProductInt(130, 70, 257, 1, 0));
+    CU_ASSERT_TRUE(runProductInt(61, 45, 521, -3, 2));
+
+    // Test case 3: Extreme int8 values are multiplied exactly
+    xInt8 a[2 * 64], b[64 * 2];
+    xInt32 c[4];
+    for (xSize i = 0; i < 128; i++) {
+        a[i] = -128;
+        b[i] = (i % 2) ? 127 : -128;
+    }
+    CU_ASSERT_TRUE(xGemm_i8gemm(2, 2, 64, 1, a, 64, b, 2, 0, c, 2));
+    CU_ASSERT_EQUAL(c[0], 64 * 128 * 128);
+    CU_ASSERT_EQUAL(c[1], -64 * 128 * 127);
+
+    // Test case 4: Invalid arguments
+    CU_ASSERT_FALSE(xGemm_i8gemm(2, 2, 64, 1, NULL, 64, b, 2, 0, c, 2));
+    CU_ASSERT_FALSE(xGemm_i32gemm(2, 2, 2, 1, NULL, 2, NULL, 2, 0, c, 2));
+}
+
+int main(void)
+{
+    CU_pSuite pSuite = NULL;
+
+    // initialize CUnit test registry
+    if (CU_initialize_registry() != CUE_SUCCESS) {
+        return CU_get_error();
+    }
+
+    // add a suite to the registry
+    pSuite = CU_add_suite("xGemm_test", NULL, NULL);
+    if (pSuite == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // add the tests to the suite
+    if (CU_add_test(pSuite, "xGemm_sgemm", test_xGemm_sgemm) == NULL ||
+        CU_add_test(pSuite, "xGemm_dgemm", test_xGemm_dgemm) == NULL ||
+        CU_add_test(pSuite, "xGemm_integer", test_xGemm_integer) == NULL ||
+        CU_add_test(pSuite, "xGemm_special", test_xGemm_special) == NULL ||
+        CU_add_test(pSuite, "xGemm_matrix", test_xGemm_matrix) == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // run all tests using the CUnit Basic interface
+    CU_basic_set_mode(CU_BRM_VERBOSE);
+    CU_basic_run_tests();
+    CU_cleanup_registry();
+
+    return CU_get_error();
+}
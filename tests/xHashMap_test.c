@@ -0,0 +1,342 @@
+/**
+ * @file xHashMap_test.c
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief CUnit test for xHashMap module.
+ * @version 0.1
+ * @date 18.10.2026.
+ */
+
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <CUnit/TestDB.h>
+#include <malloc.h>
+#include "xBase/xMemtools.h"
+#include "xBase/xTypes.h"
+#include "xString/xString.h"
+#include "xStructures/xHashMap.h"
+
+void test_xHashMap_new(void)
+{
+    xHashMap *map = NULL;
+
+    // Test case 1: Valid key and value sizes
+    map = xHashMap_new(sizeof(xUInt32), sizeof(xUInt64));
+    CU_ASSERT_PTR_NOT_NULL(map);
+    CU_ASSERT_EQUAL(xHashMap_getSize(map), 0);
+    CU_ASSERT_EQUAL(xHashMap_getCapacity(map), 0);
+    CU_ASSERT_EQUAL(xHashMap_getKeySize(map), sizeof(xUInt32));
+    CU_ASSERT_EQUAL(xHashMap_getValueSize(map), sizeof(xUInt64));
+    CU_ASSERT_EQUAL(xHashMap_isValid(map), true);
+    xHashMap_free(map);
+
+    // Test case 2: Invalid sizes
+    CU_ASSERT_PTR_NULL(xHashMap_new(0, sizeof(xUInt32)));
+    CU_ASSERT_PTR_NULL(xHashMap_new(sizeof(xUInt32), 0));
+
+    // Test case 3: xString keyed map
+    map = xHashMap_newStringKeyed(sizeof(xUInt32));
+    CU_ASSERT_PTR_NOT_NULL(map);
+    CU_ASSERT_EQUAL(xHashMap_getKeySize(map), sizeof(xString *));
+    CU_ASSERT_EQUAL(xHashMap_isValid(map), true);
+    xHashMap_free(map);
+    CU_ASSERT_PTR_NULL(xHashMap_newStringKeyed(0));
+
+    // Test case 4: NULL map
+    CU_ASSERT_EQUAL(xHashMap_getSize(NULL), 0);
+    CU_ASSERT_EQUAL(xHashMap_isValid(NULL), false);
+    xHashMap_free(NULL);  // should not crash
+}
+
+void test_xHashMap_put(void)
+{
+    xHashMap *map = xHashMap_new(sizeof(xUInt32), sizeof(xUInt32));
+
+    // Test case 1: Insert into empty map
+    xUInt32 key = 42, value = 0x12345678;
+    CU_ASSERT_TRUE(xHashMap_put(map, &key, &value));
+    CU_ASSERT_EQUAL(xHashMap_getSize(map), 1);
+    CU_ASSERT_TRUE(xHashMap_getCapacity(map) > 1);
+    CU_ASSERT_TRUE(xHashMap_get(map, &key) && *(xUInt32 *)xHashMap_get(map, &key) == 0x12345678);
+
+    // Test case 2: Overwrite existing key
+    value = 0x9ABCDEF0;
+    CU_ASSERT_TRUE(xHashMap_put(map, &key, &value));
+    CU_ASSERT_EQUAL(xHashMap_getSize(map), 1);
+    CU_ASSERT_TRUE(xHashMap_get(map, &key) && *(xUInt32 *)xHashMap_get(map, &key) == 0x9ABCDEF0);
+
+    // Test case 3: Insert many keys (forces several rehashes)
+    xBool allFound = true;
+    for (xUInt32 i = 0; i < 10000; i++) {
+        xUInt32 v = i * 3;
+        xHashMap_put(map, &i, &v);
+    }
+    for (xUInt32 i = 0; i < 10000; i++) {
+        xUInt32 *v = (xUInt32 *)xHashMap_get(map, &i);
+        if (!v || *v != i * 3) {
+            allFound = false;
+        }
+    }
+    CU_ASSERT_TRUE(allFound);
+    CU_ASSERT_EQUAL(xHashMap_getSize(map), 10000);
+    CU_ASSERT_TRUE(xHashMap_getSize(map) < xHashMap_getCapacity(map));
+
+    // Test case 4: Invalid arguments
+    CU_ASSERT_FALSE(xHashMap_put(NULL, &key, &value));
+    CU_ASSERT_FALSE(xHashMap_put(map, NULL, &value));
+    CU_ASSERT_FALSE(xHashMap_put(map, &key, NULL));
+    CU_ASSERT_EQUAL(xHashMap_getSize(map), 10000);
+
+    xHashMap_free(map);
+}
+
+void test_xHashMap_get(void)
+{
+    xHashMap *map = xHashMap_new(sizeof(xUInt64), sizeof(xUInt8));
+
+    // Test case 1: Lookup in empty map
+    xUInt64 key = 7;
+    CU_ASSERT_PTR_NULL(xHashMap_get(map, &key));
+    CU_ASSERT_FALSE(xHashMap_contains(map, &key));
+
+    // Test case 2: Lookup of present and missing keys
+    xUInt8 value = 'x';
+    xHashMap_put(map, &key, &value);
+    CU_ASSERT_TRUE(xHashMap_contains(map, &key));
+    key = 8;
+    CU_ASSERT_FALSE(xHashMap_contains(map, &key));
+    CU_ASSERT_PTR_NULL(xHashMap_get(map, &key));
+
+    // Test case 3: Returned pointer allows in-place modification
+    key = 7;
+    *(xUInt8 *)xHashMap_get(map, &key) = 'y';
+    CU_ASSERT_EQUAL(*(xUInt8 *)xHashMap_get(map, &key), 'y');
+
+    // Test case 4: Invalid arguments
+    CU_ASSERT_PTR_NULL(xHashMap_get(NULL, &key));
+    CU_ASSERT_PTR_NULL(xHashMap_get(map, NULL));
+
+    xHashMap_free(map);
+}
+
+void test_xHashMap_remove(void)
+{
+    xHashMap *map = xHashMap_new(sizeof(xUInt32), sizeof(xUInt32));
+    for (xUInt32 i = 0; i < 1000; i++) {
+        xHashMap_put(map, &i, &i);
+    }
+
+    // Test case 1: Remove existing and missing keys
+    xUInt32 key = 500;
+    CU_ASSERT_TRUE(xHashMap_remove(map, &key));
+    CU_ASSERT_FALSE(xHashMap_remove(map, &key));
+    CU_ASSERT_FALSE(xHashMap_contains(map, &key));
+    CU_ASSERT_EQUAL(xHashMap_getSize(map), 999);
+
+    // Test case 2: Remove every even key, odd keys stay reachable
+    for (xUInt32 i = 0; i < 1000; i += 2) {
+        xHashMap_remove(map, &i);
+    }
+    xBool consistent = true;
+    for (xUInt32 i = 0; i < 1000; i++) {
+        if (xHashMap_contains(map, &i) != (i % 2 == 1)) {
+            consistent = false;
+        }
+    }
+    CU_ASSERT_TRUE(consistent);
+    CU_ASSERT_EQUAL(xHashMap_getSize(map), 500);
+
+    // Test case 3: Repeated insert/remove cycles do not grow table indefinitely
+    xSize capacity = xHashMap_getCapacity(map);
+    for (xUInt32 i = 100000; i < 200000; i++) {
+        xHashMap_put(map, &i, &i);
+        xHashMap_remove(map, &i);
+    }
+    CU_ASSERT_EQUAL(xHashMap_getCapacity(map), capacity);
+    CU_ASSERT_EQUAL(xHashMap_getSize(map), 500);
+
+    // Test case 4: Invalid arguments
+    CU_ASSERT_FALSE(xHashMap_remove(NULL, &key));
+    CU_ASSERT_FALSE(xHashMap_remove(map, NULL));
+
+    xHashMap_free(map);
+}
+
+void test_xHashMap_clear(void)
+{
+    xHashMap *map = xHashMap_new(sizeof(xUInt32), sizeof(xUInt32));
+    for (xUInt32 i = 0; i < 100; i++) {
+        xHashMap_put(map, &i, &i);
+    }
+
+    // Test case 1: Clear keeps capacity and removes entries
+    xSize capacity = xHashMap_getCapacity(map);
+    xHashMap_clear(map);
+    CU_ASSERT_EQUAL(xHashMap_getSize(map), 0);
+    CU_ASSERT_EQUAL(xHashMap_getCapacity(map), capacity);
+    xUInt32 key = 5;
+    CU_ASSERT_FALSE(xHashMap_contains(map, &key));
+
+    // Test case 2: Map is usable after clearing
+    CU_ASSERT_TRUE(xHashMap_put(map, &key, &key));
+    CU_ASSERT_TRUE(xHashMap_contains(map, &key));
+
+    // Test case 3: Clear NULL map
+    xHashMap_clear(NULL);  // should not crash
+
+    xHashMap_free(map);
+}
+
+void test_xHashMap_reserve(void)
+{
+    xHashMap *map = xHashMap_new(sizeof(xUInt32), sizeof(xUInt32));
+
+    // Test case 1: Reserved map does not rehash while filling
+    xHashMap_reserve(map, 1000);
+    xSize capacity = xHashMap_getCapacity(map);
+    CU_ASSERT_TRUE(capacity >= 1000);
+    for (xUInt32 i = 0; i < 1000; i++) {
+        xHashMap_put(map, &i, &i);
+    }
+    CU_ASSERT_EQUAL(xHashMap_getCapacity(map), capacity);
+
+    // Test case 2: Reserving less than current capacity does nothing
+    xHashMap_reserve(map, 10);
+    CU_ASSERT_EQUAL(xHashMap_getCapacity(map), capacity);
+
+    xHashMap_free(map);
+}
+
+void test_xHashMap_stringKeys(void)
+{
+    xHashMap *map = xHashMap_newStringKeyed(sizeof(xUInt32));
+
+    // Test case 1: Insert and look up using different string objects with same contents
+    xString *key1 = xString_fromCString("alpha");
+    xString *key2 = xString_fromCString("beta");
+    xUInt32 value = 1;
+    CU_ASSERT_TRUE(xHashMap_put(map, key1, &value));
+    value = 2;
+    CU_ASSERT_TRUE(xHashMap_put(map, key2, &value));
+    xString *lookup = xString_fromCString("alpha");
+    CU_ASSERT_TRUE(xHashMap_get(map, lookup) && *(xUInt32 *)xHashMap_get(map, lookup) == 1);
+    xString_free(lookup);
+
+    // Test case 2: Map keeps its own copy of key
+    xString_free(key1);
+    lookup = xString_fromCString("alpha");
+    CU_ASSERT_TRUE(xHashMap_contains(map, lookup));
+
+    // Test case 3: Empty string and prefix are distinct keys
+    xString *empty = xString_new();
+    xString *prefix = xString_fromCString("alph");
+    CU_ASSERT_FALSE(xHashMap_contains(map, empty));
+    CU_ASSERT_FALSE(xHashMap_contains(map, prefix));
+    value = 3;
+    CU_ASSERT_TRUE(xHashMap_put(map, empty, &value));
+    CU_ASSERT_TRUE(xHashMap_get(map, empty) && *(xUInt32 *)xHashMap_get(map, empty) == 3);
+    CU_ASSERT_EQUAL(xHashMap_getSize(map), 3);
+
+    // Test case 4: Remove string key
+    CU_ASSERT_TRUE(xHashMap_remove(map, lookup));
+    CU_ASSERT_FALSE(xHashMap_contains(map, lookup));
+    CU_ASSERT_TRUE(xHashMap_contains(map, key2));
+    CU_ASSERT_EQUAL(xHashMap_getSize(map), 2);
+
+    xString_free(lookup);
+    xString_free(empty);
+    xString_free(prefix);
+    xString_free(key2);
+    xHashMap_free(map);
+}
+
+static xUInt64 foreachKeySum = 0;
+static xUInt64 foreachValueSum = 0;
+
+static xUInt32 foreachOrder[100];
+static xSize foreachVisited = 0;
+
+static void foreachCallback(const void *key, void *value)
+{
+    foreachKeySum += *(const xUInt32 *)key;
+    foreachValueSum += *(xUInt32 *)value;
+}
+
+static void orderCallback(const void *key, void *value)
+{
+    (void)value;
+    foreachOrder[foreachVisited++ % 100] = *(const xUInt32 *)key;
+}
+
+void test_xHashMap_foreach(void)
+{
+    xHashMap *map = xHashMap_new(sizeof(xUInt32), sizeof(xUInt32));
+    for (xUInt32 i = 1; i <= 100; i++) {
+        xUInt32 v = i * 2;
+        xHashMap_put(map, &i, &v);
+    }
+
+    // Test case 1: Every entry is visited exactly once
+    foreachKeySum = 0;
+    foreachValueSum = 0;
+    xHashMap_foreach(map, foreachCallback);
+    CU_ASSERT_EQUAL(foreachKeySum, 5050);
+    CU_ASSERT_EQUAL(foreachValueSum, 10100);
+
+    // Test case 2: Map with same entries hashes with its own seed, so entries are visited in different order
+    xHashMap *other = xHashMap_new(sizeof(xUInt32), sizeof(xUInt32));
+    for (xUInt32 i = 1; i <= 100; i++) {
+        xHashMap_put(other, &i, &i);
+    }
+    xUInt32 order[100];
+    foreachVisited = 0;
+    xHashMap_foreach(map, orderCallback);
+    xMemCopy(order, foreachOrder, sizeof(order));
+    foreachVisited = 0;
+    xHashMap_foreach(other, orderCallback);
+    CU_ASSERT_EQUAL(foreachVisited, 100);
+    CU_ASSERT_FALSE(xMemCmp(order, foreachOrder, sizeof(order)));
+    xHashMap_free(other);
+
+    // Test case 3: NULL arguments
+    xHashMap_foreach(map, NULL);  // should not crash
+    xHashMap_foreach(NULL, foreachCallback);
+
+    xHashMap_free(map);
+}
+
+int main(void)
+{
+    CU_pSuite pSuite = NULL;
+
+    // initialize CUnit test registry
+    if (CU_initialize_registry() != CUE_SUCCESS) {
+        return CU_get_error();
+    }
+
+    // add a suite to the registry
+    pSuite = CU_add_suite("xHashMap_test", NULL, NULL);
+    if (pSuite == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // add the tests to the suite
+    if (CU_add_test(pSuite, "xHashMap_new", test_xHashMap_new) == NULL ||
+        CU_add_test(pSuite, "xHashMap_put", test_xHashMap_put) == NULL ||
+        CU_add_test(pSuite, "xHashMap_get", test_xHashMap_get) == NULL ||
+        CU_add_test(pSuite, "xHashMap_remove", test_xHashMap_remove) == NULL ||
+        CU_add_test(pSuite, "xHashMap_clear", test_xHashMap_clear) == NULL ||
+        CU_add_test(pSuite, "xHashMap_reserve", test_xHashMap_reserve) == NULL ||
+        CU_add_test(pSuite, "xHashMap_stringKeys", test_xHashMap_stringKeys) == NULL ||
+        CU_add_test(pSuite, "xHashMap_foreach", test_xHashMap_foreach) == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // run all tests using the CUnit Basic interface
+    CU_basic_set_mode(CU_BRM_VERBOSE);
+    CU_basic_run_tests();
+    CU_cleanup_registry();
+
+    return CU_get_error();
+}
@@ -0,0 +1,339 @@
+/**
+ * @file xMatrixDecomp_test.c
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief CUnit test for xMatrixDecomp module.
+ * @version 0.1
+ * @date 18.10.2026.
+ */
+
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <CUnit/TestDB.h>
+#include <math.h>
+#include "xBase/xTypes.h"
+#include "xLinear/xMatrix.h"
+#include "xLinear/xMatrixDecomp.h"
+
+// matrix with pseudo-random elements in [-1, 1), plus shift on diagonal (to make it well conditioned)
+static xMatrix *randomMatrix(xSize rows, xSize cols, xUInt32 seed, float shift)
+{
+    xMatrix *mat = xMatrix_new(rows, cols);
+    for (xSize i = 0; i < rows; i++) {
+        for (xSize j = 0; j < cols; j++) {
+            seed = seed * 1664525u + 1013904223u;
+            xMatrix_set(mat, i, j, (float)(seed >> 8) / (float)(1u << 23) - 1.0f + ((i == j) ? shift : 0.0f));
+        }
+    }
+    return mat;
+}
+
+static float maxDifference(const xMatrix *lhs, const xMatrix *rhs)
+{
+    float diff = 0.0f;
+    for (xSize i = 0; i < xMatrix_getRows(lhs); i++) {
+        for (xSize j = 0; j < xMatrix_getCols(lhs); j++) {
+            float d = fabsf(xMatrix_get(lhs, i, j) - xMatrix_get(rhs, i, j));
+            diff = (d > diff) ? d : diff;
+        }
+    }
+    return diff;
+}
+
+// check that product of matrices equals expected matrix within tolerance
+static xBool productMatches(const xMatrix *lhs, const xMatrix *rhs, const xMatrix *expected, float tolerance)
+{
+    xMatrix *prod = xMatrix_mul(lhs, rhs);
+    xBool match = prod && xMatrix_getRows(prod) == xMatrix_getRows(expected) &&
+                  xMatrix_getCols(prod) == xMatrix_getCols(expected) && maxDifference(prod, expected) < tolerance;
+    xMatrix_free(prod);
+    return match;
+}
+
+void test_xMatrixLU(void)
+{
+    // Test case 1: Determinant and solution of small system needing row exchange
+    float elements[9] = {0.0f, 2.0f, 1.0f, 1.0f, 1.0f, 1.0f, 2.0f, 1.0f, 3.0f};
+    xMatrix *small = xMatrix_unflatten(elements, 3, 3);
+    CU_ASSERT_DOUBLE_EQUAL(xMatrix_determinant(small), -3.0, 1e-5);
+    float rhsElements[3] = {7.0f, 6.0f, 13.0f};
+    xMatrix *rhs = xMatrix_unflatten(rhsElements, 3, 1);
+    xMatrix *x = xMatrix_solve(small, rhs);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(x);
+    CU_ASSERT_DOUBLE_EQUAL(xMatrix_get(x, 0, 0), 1.0, 1e-5);
+    CU_ASSERT_DOUBLE_EQUAL(xMatrix_get(x, 1, 0), 2.0, 1e-5);
+    CU_ASSERT_DOUBLE_EQUAL(xMatrix_get(x, 2, 0), 3.0, 1e-5);
+    xMatrix_free(x);
+
+    // Test case 2: Factors of small matrix reproduce permuted matrix
+    xMatrixLU *lu = xMatrixLU_new(small);
+    CU_ASSERT_FALSE(xMatrixLU_isSingular(lu));
+    xMatrix *l = xMatrixLU_getL(lu);
+    xMatrix *u = xMatrixLU_getU(lu);
+    xMatrix *pa = xMatrix_new(3, 3);
+    for (xSize i = 0; i < 3; i++) {
+        for (xSize j = 0; j < 3; j++) {
+            xMatrix_set(pa, i, j, xMatrix_get(small, xMatrixLU_getPermutation(lu, i), j));
+        }
+    }
+    CU_ASSERT_EQUAL(xMatrix_get(l, 0, 0), 1.0f);
+    CU_ASSERT_EQUAL(xMatrix_get(l, 0, 2), 0.0f);
+    CU_ASSERT_EQUAL(xMatrix_get(u, 2, 0), 0.0f);
+    CU_ASSERT_TRUE(productMatches(l, u, pa, 1e-5f));
+    xMatrix_free(l);
+    xMatrix_free(u);
+    xMatrix_free(pa);
+    xMatrixLU_free(lu);
+
+    // Test case 3: Large system spanning several blocks with multiple right-hand sides
+    xMatrix *a = randomMatrix(203, 203, 1, 0.0f);
+    xMatrix *expected = randomMatrix(203, 7, 2, 0.0f);
+    xMatrix *b = xMatrix_mul(a, expected);
+    x = xMatrix_solve(a, b);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(x);
+    CU_ASSERT_TRUE(productMatches(a, x, b, 1e-3f));
+    xMatrix_free(x);
+
+    // Test case 4: Inverse of large matrix
+    xMatrix *inv = xMatrix_inverse(a);
+    xMatrix *identity = xMatrix_identity(203);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(inv);
+    CU_ASSERT_TRUE(productMatches(a, inv, identity, 1e-3f));
+    xMatrix_free(inv);
+
+    // Test case 5: Determinant of triangular matrix with reversed rows (undone by row exchanges)
+    xMatrix *tri = randomMatrix(100, 100, 3, 1.5f);
+    float det = 1.0f;
+    for (xSize i = 0; i < 100; i++) {
+        for (xSize j = i + 1; j < 100; j++) {
+            xMatrix_set(tri, j, i, 0.0f);
+        }
+        det *= xMatrix_get(tri, i, i);
+    }
+    for (xSize i = 0; i < 50; i++) {
+        for (xSize j = 0; j < 100; j++) {
+            float tmp = xMatrix_get(tri, i, j);
+            xMatrix_set(tri, i, j, xMatrix_get(tri, 99 - i, j));
+            xMatrix_set(tri, 99 - i, j, tmp);
+        }
+    }
+    CU_ASSERT_DOUBLE_EQUAL(xMatrix_determinant(tri) / det, 1.0, 1e-4);
+
+    // Test case 6: Singular and invalid matrices
+    for (xSize i = 0; i < 100; i++) {
+        xMatrix_set(tri, i, 70, 0.0f);
+    }
+    lu = xMatrixLU_new(tri);
+    CU_ASSERT_TRUE(xMatrixLU_isSingular(lu));
+    CU_ASSERT_EQUAL(xMatrixLU_determinant(lu), 0.0f);
+    CU_ASSERT_PTR_NULL(xMatrixLU_solve(lu, b));
+    CU_ASSERT_PTR_NULL(xMatrix_inverse(tri));
+    xMatrixLU_free(lu);
+    CU_ASSERT_PTR_NULL(xMatrixLU_new(expected));
+    CU_ASSERT_PTR_NULL(xMatrix_solve(a, rhs));
+    CU_ASSERT_EQUAL(xMatrix_determinant(NULL), 0.0f);
+
+    xMatrix_free(small);
+    xMatrix_free(rhs);
+    xMatrix_free(a);
+    xMatrix_free(expected);
+    xMatrix_free(b);
+    xMatrix_free(identity);
+    xMatrix_free(tri);
+}
+
+void test_xMatrixCholesky(void)
+{
+    // Test case 1: Factor of symmetric positive definite matrix spanning several blocks
+    xMatrix *r = randomMatrix(150, 150, 4, 0.0f);
+    xMatrix *rt = xMatrix_transpose(r);
+    xMatrix *a = xMatrix_mul(r, rt);
+    for (xSize i = 0; i < 150; i++) {
+        xMatrix_set(a, i, i, xMatrix_get(a, i, i) + 150.0f);
+    }
+    xMatrixCholesky *cholesky = xMatrixCholesky_new(a);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(cholesky);
+    xMatrix *l = xMatrixCholesky_getL(cholesky);
+    xMatrix *lt = xMatrix_transpose(l);
+    CU_ASSERT_EQUAL(xMatrix_get(l, 0, 149), 0.0f);
+    CU_ASSERT_TRUE(xMatrix_get(l, 149, 149) > 0.0f);
+    CU_ASSERT_TRUE(productMatches(l, lt, a, 1e-2f));
+
+    // Test case 2: Solution of system
+    xMatrix *expected = randomMatrix(150, 3, 5, 0.0f);
+    xMatrix *b = xMatrix_mul(a, expected);
+    xMatrix *x = xMatrixCholesky_solve(cholesky, b);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(x);
+    CU_ASSERT_TRUE(maxDifference(x, expected) < 1e-4f);
+
+    // Test case 3: Determinant agrees with LU decomposition
+    float elements[4] = {4.0f, 2.0f, 2.0f, 3.0f};
+    xMatrix *small = xMatrix_unflatten(elements, 2, 2);
+    xMatrixCholesky *smallCholesky = xMatrixCholesky_new(small);
+    CU_ASSERT_DOUBLE_EQUAL(xMatrixCholesky_determinant(smallCholesky), 8.0, 1e-5);
+    CU_ASSERT_DOUBLE_EQUAL(xMatrix_determinant(small), 8.0, 1e-5);
+
+    // Test case 4: Matrices which are not positive definite are rejected
+    xMatrix_set(small, 1, 1, 1.0f);
+    CU_ASSERT_PTR_NULL(xMatrixCholesky_new(small));
+    xMatrix_set(a, 100, 100, -1.0f);
+    CU_ASSERT_PTR_NULL(xMatrixCholesky_new(a));
+    CU_ASSERT_PTR_NULL(xMatrixCholesky_new(expected));
+    CU_ASSERT_PTR_NULL(xMatrixCholesky_solve(cholesky, small));
+
+    xMatrixCholesky_free(smallCholesky);
+    xMatrixCholesky_free(cholesky);
+    xMatrix_free(r);
+    xMatrix_free(rt);
+    xMatrix_free(a);
+    xMatrix_free(l);
+    xMatrix_free(lt);
+    xMatrix_free(expected);
+    xMatrix_free(b);
+    xMatrix_free(x);
+    xMatrix_free(small);
+}
+
+void test_xMatrixQR(void)
+{
+    // Test case 1: Tall matrix spanning several blocks is product of orthonormal Q and upper triangular R
+    xMatrix *a = randomMatrix(230, 150, 6, 0.0f);
+    xMatrixQR *qr = xMatrixQR_new(a);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(qr);
+    CU_ASSERT_TRUE(xMatrixQR_isFullRank(qr));
+    xMatrix *q = xMatrixQR_getQ(qr);
+    xMatrix *r = xMatrixQR_getR(qr);
+    xMatrix *qt = xMatrix_transpose(q);
+    xMatrix *identity = xMatrix_identity(150);
+    CU_ASSERT_EQUAL(xMatrix_getRows(q), 230);
+    CU_ASSERT_EQUAL(xMatrix_getCols(q), 150);
+    CU_ASSERT_EQUAL(xMatrix_get(r, 149, 0), 0.0f);
+    CU_ASSERT_TRUE(productMatches(q, r, a, 1e-4f));
+    CU_ASSERT_TRUE(productMatches(qt, q, identity, 1e-4f));
+
+    // Test case 2: Least squares fit of quadratic to noisy samples
+    xMatrix *design = xMatrix_new(100, 3);
+    xMatrix *samples = xMatrix_new(100, 1);
+    for (xSize i = 0; i < 100; i++) {
+        float t = (float)i / 50.0f - 1.0f;
+        xMatrix_set(design, i, 0, 1.0f);
+        xMatrix_set(design, i, 1, t);
+        xMatrix_set(design, i, 2, t * t);
+        xMatrix_set(samples, i, 0, 0.5f - 2.0f * t + 3.0f * t * t + ((i % 2) ? 0.01f : -0.01f));
+    }
+    xMatrix *coef = xMatrix_leastSquares(design, samples);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(coef);
+    CU_ASSERT_DOUBLE_EQUAL(xMatrix_get(coef, 0, 0), 0.5, 1e-2);
+    CU_ASSERT_DOUBLE_EQUAL(xMatrix_get(coef, 1, 0), -2.0, 1e-2);
+    CU_ASSERT_DOUBLE_EQUAL(xMatrix_get(coef, 2, 0), 3.0, 1e-2);
+
+    // Test case 3: Square system solved by QR agrees with LU
+    xMatrix *square = randomMatrix(90, 90, 7, 0.0f);
+    xMatrix *rhs = randomMatrix(90, 2, 8, 0.0f);
+    xMatrix *byQR = xMatrix_leastSquares(square, rhs);
+    xMatrix *byLU = xMatrix_solve(square, rhs);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(byQR);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(byLU);
+    CU_ASSERT_TRUE(maxDifference(byQR, byLU) < 1e-2f);
+
+    // Test case 4: Rank deficient and wide matrices
+    xMatrix *zero = xMatrix_new(10, 3);
+    xMatrixQR *deficient = xMatrixQR_new(zero);
+    CU_ASSERT_FALSE(xMatrixQR_isFullRank(deficient));
+    CU_ASSERT_PTR_NULL(xMatrixQR_solve(deficient, zero));
+    CU_ASSERT_PTR_NULL(xMatrixQR_new(qt));
+    CU_ASSERT_PTR_NULL(xMatrixQR_solve(qr, rhs));
+
+    xMatrixQR_free(deficient);
+    xMatrixQR_free(qr);
+    xMatrix_free(a);
+    xMatrix_free(q);
+    xMatrix_free(r);
+    xMatrix_free(qt);
+    xMatrix_free(identity);
+    xMatrix_free(design);
+    xMatrix_free(samples);
+    xMatrix_free(coef);
+    xMatrix_free(square);
+    xMatrix_free(rhs);
+    xMatrix_free(byQR);
+    xMatrix_free(byLU);
+    xMatrix_free(zero);
+}
+
+void test_xMatrix_solveTriangular(void)
+{
+    // Test case 1: Lower and upper triangular systems spanning several blocks
+    xMatrix *t = randomMatrix(140, 140, 9, 4.0f);
+    xMatrix *lower = xMatrix_duplicate(t);
+    xMatrix *upper = xMatrix_duplicate(t);
+    for (xSize i = 0; i < 140; i++) {
+        for (xSize j = i + 1; j < 140; j++) {
+            xMatrix_set(lower, i, j, 0.0f);
+            xMatrix_set(upper, j, i, 0.0f);
+        }
+    }
+    xMatrix *b = randomMatrix(140, 5, 10, 0.0f);
+    xMatrix *x = xMatrix_solveTriangular(t, b, true, false);  // only lower triangle is read
+    CU_ASSERT_PTR_NOT_NULL_FATAL(x);
+    CU_ASSERT_TRUE(productMatches(lower, x, b, 1e-4f));
+    xMatrix_free(x);
+    x = xMatrix_solveTriangular(t, b, false, false);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(x);
+    CU_ASSERT_TRUE(productMatches(upper, x, b, 1e-4f));
+    xMatrix_free(x);
+
+    // Test case 2: Unit diagonal is not read
+    xMatrix_scalarMul_inplace(t, t, 0.1f);
+    xMatrix_scalarMul_inplace(lower, lower, 0.1f);
+    for (xSize i = 0; i < 140; i++) {
+        xMatrix_set(lower, i, i, 1.0f);
+        xMatrix_set(t, i, i, 0.0f);
+    }
+    x = xMatrix_solveTriangular(t, b, true, true);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(x);
+    CU_ASSERT_TRUE(productMatches(lower, x, b, 1e-4f));
+    xMatrix_free(x);
+
+    // Test case 3: Zero on diagonal and mismatched dimensions
+    CU_ASSERT_PTR_NULL(xMatrix_solveTriangular(t, b, true, false));
+    CU_ASSERT_PTR_NULL(xMatrix_solveTriangular(b, b, true, true));
+    CU_ASSERT_PTR_NULL(xMatrix_solveTriangular(NULL, b, true, true));
+
+    xMatrix_free(t);
+    xMatrix_free(lower);
+    xMatrix_free(upper);
+    xMatrix_free(b);
+}
+
+int main(void)
+{
+    CU_pSuite pSuite = NULL;
+
+    // initialize CUnit test registry
+    if (CU_initialize_registry() != CUE_SUCCESS) {
+        return CU_get_error();
+    }
+
+    // add a suite to the registry
+    pSuite = CU_add_suite("xMatrixDecomp_test", NULL, NULL);
+    if (pSuite == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // add the tests to the suite
+    if (CU_add_test(pSuite, "xMatrixLU", test_xMatrixLU) == NULL ||
+        CU_add_test(pSuite, "xMatrixCholesky", test_xMatrixCholesky) == NULL ||
+        CU_add_test(pSuite, "xMatrixQR", test_xMatrixQR) == NULL ||
+        CU_add_test(pSuite, "xMatrix_solveTriangular", test_xMatrix_solveTriangular) == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // run all tests using the CUnit Basic interface
+    CU_basic_set_mode(CU_BRM_VERBOSE);
+    CU_basic_run_tests();
+    CU_cleanup_registry();
+
+    return CU_get_error();
+}
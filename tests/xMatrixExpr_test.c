@@ -0,0 +1,298 @@
+/**
+ * @file xMatrixExpr_test.c
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief CUnit test for xMatrixExpr module.
+ * @version 0.1
+ * @date 18.10.2026.
+ */
+
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <CUnit/TestDB.h>
+#include <malloc.h>
+#include "xBase/xMemtools.h"
+#include "xBase/xTypes.h"
+#include "xLinear/xMatrix.h"
+#include "xLinear/xMatrixExpr.h"
+#include "xThread/xThreadPool.h"
+
+static float squash(float value) { return value / (1.0f + (value < 0.0f ? -value : value)); }
+
+static float blend(float lhs, float rhs) { return 0.25f * lhs + 0.75f * rhs; }
+
+static float scaleTwo(float value) { return value * 2.0f; }
+
+static float addPair(float lhs, float rhs) { return lhs + rhs; }
+
+static xMatrix *randomMatrix(xSize rows, xSize cols, xUInt32 seed)
+{
+    xMatrix *matrix = xMatrix_new(rows, cols);
+    for (xSize i = 0; i < rows; i++) {
+        for (xSize j = 0; j < cols; j++) {
+            seed = seed * 1664525u + 1013904223u;
+            xMatrix_set(matrix, i, j, (float)(seed >> 8) / (float)(1u << 23) - 1.0f);
+        }
+    }
+    return matrix;
+}
+
+static xBool sameElements(const xMatrix *lhs, const xMatrix *rhs)
+{
+    if (xMatrix_getRows(lhs) != xMatrix_getRows(rhs) || xMatrix_getCols(lhs) != xMatrix_getCols(rhs)) {
+        return false;
+    }
+    for (xSize i = 0; i < xMatrix_getRows(lhs); i++) {
+        for (xSize j = 0; j < xMatrix_getCols(lhs); j++) {
+            float a = xMatrix_get(lhs, i, j);
+            float b = xMatrix_get(rhs, i, j);
+            if (!xMemCmp(&a, &b, sizeof(float))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// computes squash(a * 2 + b) - min(a, b) with fused expression and with separate matrix operations
+static xBool fusedMatchesSequential(xSize rows, xSize cols)
+{
+    xMatrix *a = randomMatrix(rows, cols, 3);
+    xMatrix *b = randomMatrix(rows, cols, 11);
+    xMatrix *fused = xMatrix_new(rows, cols);
+
+    xMatrixExpr *expr = xMatrixExpr_new();
+    xSize inA = xMatrixExpr_input(expr, xMatrix_view(a));
+    xSize inB = xMatrixExpr_input(expr, xMatrix_view(b));
+    xSize sum = xMatrixExpr_add(expr, xMatrixExpr_mul(expr, inA, xMatrixExpr_constant(expr, 2.0f)), inB);
+    xSize root = xMatrixExpr_sub(expr, xMatrixExpr_map(expr, sum, squash), xMatrixExpr_min(expr, inA, inB));
+    xBool ok = xMatrixExpr_eval(expr, root, xMatrix_view(fused));
+
+    xMatrix *scaled = xMatrix_scalarMul(a, 2.0f);
+    xMatrix *added = xMatrix_add(scaled, b);
+    xMatrix *mapped = xMatrix_map(added, squash);
+    xMatrix *expected = xMatrix_new(rows, cols);
+    for (xSize i = 0; i < rows; i++) {
+        for (xSize j = 0; j < cols; j++) {
+            float x = xMatrix_get(a, i, j);
+            float y = xMatrix_get(b, i, j);
+            xMatrix_set(expected, i, j, xMatrix_get(mapped, i, j) - (y < x ? y : x));
+        }
+    }
+    ok = ok && sameElements(fused, expected);
+
+    xMatrixExpr_free(expr);
+    xMatrix_free(a);
+    xMatrix_free(b);
+    xMatrix_free(fused);
+    xMatrix_free(scaled);
+    xMatrix_free(added);
+    xMatrix_free(mapped);
+    xMatrix_free(expected);
+    return ok;
+}
+
+void test_xMatrixExpr_new(void)
+{
+    // Test case 1: New expression is empty
+    xMatrixExpr *expr = xMatrixExpr_new();
+    CU_ASSERT_PTR_NOT_NULL(expr);
+    CU_ASSERT_EQUAL(xMatrixExpr_getNodeCount(expr), 0);
+
+    // Test case 2: Nodes are counted
+    xMatrix *m = xMatrix_new(2, 2);
+    xSize input = xMatrixExpr_input(expr, xMatrix_view(m));
+    xSize constant = xMatrixExpr_constant(expr, 1.0f);
+    CU_ASSERT_EQUAL(input, 0);
+    CU_ASSERT_EQUAL(constant, 1);
+    CU_ASSERT_EQUAL(xMatrixExpr_add(expr, input, constant), 2);
+    CU_ASSERT_EQUAL(xMatrixExpr_getNodeCount(expr), 3);
+
+    // Test case 3: NULL expression
+    CU_ASSERT_EQUAL(xMatrixExpr_getNodeCount(NULL), 0);
+    CU_ASSERT_EQUAL(xMatrixExpr_constant(NULL, 1.0f), XMATRIXEXPR_INVALID);
+    xMatrixExpr_free(NULL);  // should not crash
+
+    xMatrixExpr_free(expr);
+    xMatrix_free(m);
+}
+
+void test_xMatrixExpr_eval(void)
+{
+    // Test case 1: Fused chain matches separate operations bitwise
+    CU_ASSERT_TRUE(fusedMatchesSequential(7, 5));
+    CU_ASSERT_TRUE(fusedMatchesSequential(33, 300));
+
+    // Test case 2: Large result evaluated in parallel row blocks
+    CU_ASSERT_TRUE(xThreadPool_setSharedThreadCount(4));
+    CU_ASSERT_TRUE(fusedMatchesSequential(400, 257));
+    CU_ASSERT_TRUE(xThreadPool_setSharedThreadCount(1));
+    CU_ASSERT_TRUE(fusedMatchesSequential(400, 257));
+
+    // Test case 3: All built-in operations
+    xMatrix *a = randomMatrix(3, 130, 5);
+    xMatrix *b = randomMatrix(3, 130, 9);
+    xMatrix *res = xMatrix_new(3, 130);
+    xMatrixExpr *expr = xMatrixExpr_new();
+    xSize inA = xMatrixExpr_input(expr, xMatrix_view(a));
+    xSize inB = xMatrixExpr_input(expr, xMatrix_view(b));
+    xSize ops[8] = {xMatrixExpr_sub(expr, inA, inB),       xMatrixExpr_div(expr, inA, inB),
+                    xMatrixExpr_max(expr, inA, inB),       xMatrixExpr_neg(expr, inA),
+                    xMatrixExpr_abs(expr, inB),            xMatrixExpr_map2(expr, inA, inB, blend),
+                    xMatrixExpr_mul(expr, inA, inA),       xMatrixExpr_constant(expr, 4.5f)};
+    for (xSize k = 0; k < 8; k++) {
+        CU_ASSERT_TRUE(xMatrixExpr_eval(expr, ops[k], xMatrix_view(res)));
+        xBool ok = true;
+        for (xSize i = 0; i < 3; i++) {
+            for (xSize j = 0; j < 130; j++) {
+                float x = xMatrix_get(a, i, j);
+                float y = xMatrix_get(b, i, j);
+                float expected[8] = {x - y, x / y, (y > x ? y : x), -x, (y < 0.0f ? -y : y), blend(x, y), x * x, 4.5f};
+                ok = ok && xMatrix_get(res, i, j) == expected[k];
+            }
+        }
+        CU_ASSERT_TRUE(ok);
+    }
+    xMatrixExpr_free(expr);
+    xMatrix_free(a);
+    xMatrix_free(b);
+    xMatrix_free(res);
+}
+
+void test_xMatrixExpr_views(void)
+{
+    xMatrix *a = randomMatrix(6, 4, 13);
+    xMatrix *b = randomMatrix(4, 6, 17);
+    xMatrix *res = xMatrix_new(6, 4);
+
+    // Test case 1: Transposed (strided) input
+    xMatrixExpr *expr = xMatrixExpr_new();
+    xSize inA = xMatrixExpr_input(expr, xMatrix_view(a));
+    xSize inB = xMatrixExpr_input(expr, xMatrixView_transpose(xMatrix_view(b)));
+    xSize root = xMatrixExpr_add(expr, inA, inB);
+    CU_ASSERT_TRUE(xMatrixExpr_eval(expr, root, xMatrix_view(res)));
+    xBool ok = true;
+    for (xSize i = 0; i < 6; i++) {
+        for (xSize j = 0; j < 4; j++) {
+            ok = ok && xMatrix_get(res, i, j) == xMatrix_get(a, i, j) + xMatrix_get(b, j, i);
+        }
+    }
+    CU_ASSERT_TRUE(ok);
+
+    // Test case 2: Strided result view
+    xMatrix *big = xMatrix_new(4, 6);
+    CU_ASSERT_TRUE(xMatrixExpr_eval(expr, root, xMatrixView_transpose(xMatrix_view(big))));
+    ok = true;
+    for (xSize i = 0; i < 6; i++) {
+        for (xSize j = 0; j < 4; j++) {
+            ok = ok && xMatrix_get(big, j, i) == xMatrix_get(res, i, j);
+        }
+    }
+    CU_ASSERT_TRUE(ok);
+
+    // Test case 3: Result aliasing input (in-place update)
+    xMatrix *copy = xMatrix_newFromView(xMatrix_view(a));
+    CU_ASSERT_TRUE(xMatrixExpr_bind(expr, inA, xMatrix_view(copy)));
+    CU_ASSERT_TRUE(xMatrixExpr_eval(expr, root, xMatrix_view(copy)));
+    CU_ASSERT_TRUE(sameElements(copy, res));
+
+    // Test case 4: Rebinding input to block of larger matrix
+    xMatrix *wide = randomMatrix(10, 10, 19);
+    CU_ASSERT_TRUE(xMatrixExpr_bind(expr, inA, xMatrix_viewBlock(wide, 2, 3, 6, 4)));
+    CU_ASSERT_TRUE(xMatrixExpr_eval(expr, root, xMatrix_view(res)));
+    ok = true;
+    for (xSize i = 0; i < 6; i++) {
+        for (xSize j = 0; j < 4; j++) {
+            ok = ok && xMatrix_get(res, i, j) == xMatrix_get(wide, i + 2, j + 3) + xMatrix_get(b, j, i);
+        }
+    }
+    CU_ASSERT_TRUE(ok);
+
+    // Test case 5: Mismatched dimensions
+    CU_ASSERT_TRUE(xMatrixExpr_bind(expr, inA, xMatrix_view(b)));
+    CU_ASSERT_FALSE(xMatrixExpr_eval(expr, root, xMatrix_view(res)));
+
+    xMatrixExpr_free(expr);
+    xMatrix_free(a);
+    xMatrix_free(b);
+    xMatrix_free(res);
+    xMatrix_free(big);
+    xMatrix_free(copy);
+    xMatrix_free(wide);
+}
+
+void test_xMatrixExpr_invalid(void)
+{
+    xMatrix *m = xMatrix_new(3, 3);
+    xMatrix_set(m, 1, 1, 2.0f);
+    xMatrixExpr *expr = xMatrixExpr_new();
+    xSize input = xMatrixExpr_input(expr, xMatrix_view(m));
+
+    // Test case 1: Invalid handles propagate
+    xSize bad = xMatrixExpr_add(expr, input, 42);
+    CU_ASSERT_EQUAL(bad, XMATRIXEXPR_INVALID);
+    CU_ASSERT_EQUAL(xMatrixExpr_neg(expr, bad), XMATRIXEXPR_INVALID);
+    CU_ASSERT_EQUAL(xMatrixExpr_map(expr, input, NULL), XMATRIXEXPR_INVALID);
+    CU_ASSERT_EQUAL(xMatrixExpr_map2(expr, input, input, NULL), XMATRIXEXPR_INVALID);
+    CU_ASSERT_FALSE(xMatrixExpr_eval(expr, bad, xMatrix_view(m)));
+    CU_ASSERT_FALSE(xMatrixExpr_eval(NULL, input, xMatrix_view(m)));
+    CU_ASSERT_EQUAL(xMatrixExpr_getNodeCount(expr), 1);
+
+    // Test case 2: Only input nodes can be rebound
+    xSize constant = xMatrixExpr_constant(expr, 1.0f);
+    CU_ASSERT_FALSE(xMatrixExpr_bind(expr, constant, xMatrix_view(m)));
+    CU_ASSERT_FALSE(xMatrixExpr_bind(expr, 99, xMatrix_view(m)));
+
+    // Test case 3: Expression full
+    xSize node = input;
+    while (xMatrixExpr_getNodeCount(expr) < XMATRIXEXPR_MAX_NODES) {
+        node = (xMatrixExpr_getNodeCount(expr) % 2) ? xMatrixExpr_map2(expr, node, constant, addPair)
+                                                    : xMatrixExpr_map(expr, node, scaleTwo);
+    }
+    CU_ASSERT_EQUAL(xMatrixExpr_constant(expr, 0.0f), XMATRIXEXPR_INVALID);
+
+    // Test case 4: Longest chain still evaluates (node count 64: 31 doublings and 31 increments)
+    xMatrix *res = xMatrix_new(3, 3);
+    CU_ASSERT_TRUE(xMatrixExpr_eval(expr, node, xMatrix_view(res)));
+    float expected = 2.0f;
+    for (xSize n = 2; n < XMATRIXEXPR_MAX_NODES; n++) {
+        expected = (n % 2) ? expected + 1.0f : expected * 2.0f;
+    }
+    CU_ASSERT_EQUAL(xMatrix_get(res, 1, 1), expected);
+
+    xMatrixExpr_free(expr);
+    xMatrix_free(m);
+    xMatrix_free(res);
+}
+
+int main(void)
+{
+    CU_pSuite pSuite = NULL;
+
+    // initialize CUnit test registry
+    if (CU_initialize_registry() != CUE_SUCCESS) {
+        return CU_get_error();
+    }
+
+    // add a suite to the registry
+    pSuite = CU_add_suite("xMatrixExpr_test", NULL, NULL);
+    if (pSuite == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // add the tests to the suite
+    if (CU_add_test(pSuite, "xMatrixExpr_new", test_xMatrixExpr_new) == NULL ||
+        CU_add_test(pSuite, "xMatrixExpr_eval", test_xMatrixExpr_eval) == NULL ||
+        CU_add_test(pSuite, "xMatrixExpr_views", test_xMatrixExpr_views) == NULL ||
+        CU_add_test(pSuite, "xMatrixExpr_invalid", test_xMatrixExpr_invalid) == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // run all tests using the CUnit Basic interface
+    CU_basic_set_mode(CU_BRM_VERBOSE);
+    CU_basic_run_tests();
+    CU_cleanup_registry();
+
+    return CU_get_error();
+}
@@ -0,0 +1,209 @@
+/**
+ * @file xMatrixTyped_test.c
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief CUnit test for xMatrixTyped module.
+ * @version 0.1
+ * @date 18.10.2026.
+ */
+
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <CUnit/TestDB.h>
+#include <malloc.h>
+#include "xBase/xTypes.h"
+#include "xLinear/xMatrixTyped.h"
+
+void test_xMatrixTyped_new(void)
+{
+    // Test case 1: Zero-initialized matrices of every type
+    xMatrixF64 *f = xMatrixF64_new(3, 4);
+    xMatrixI32 *i = xMatrixI32_new(3, 4);
+    xMatrixI8 *b = xMatrixI8_new(3, 4);
+    CU_ASSERT_TRUE(xMatrixF64_isValid(f));
+    CU_ASSERT_TRUE(xMatrixI32_isValid(i));
+    CU_ASSERT_TRUE(xMatrixI8_isValid(b));
+    CU_ASSERT_EQUAL(xMatrixF64_getRows(f), 3);
+    CU_ASSERT_EQUAL(xMatrixI8_getCols(b), 4);
+    CU_ASSERT_EQUAL(xMatrixF64_get(f, 2, 3), 0.0);
+    CU_ASSERT_EQUAL(xMatrixI32_get(i, 2, 3), 0);
+
+    // Test case 2: Set, get and fill
+    xMatrixF64_set(f, 1, 2, 0.1);
+    CU_ASSERT_EQUAL(xMatrixF64_get(f, 1, 2), 0.1);  // stored in double precision
+    xMatrixI8_fill(b, -5);
+    CU_ASSERT_EQUAL(xMatrixI8_get(b, 2, 3), -5);
+    xMatrixI32_set(i, 0, 0, 2000000000);
+    CU_ASSERT_EQUAL(xMatrixI32_get(i, 0, 0), 2000000000);
+
+    // Test case 3: Invalid arguments
+    CU_ASSERT_PTR_NULL(xMatrixF64_new(0, 4));
+    CU_ASSERT_EQUAL(xMatrixI32_get(i, 3, 0), 0);
+    CU_ASSERT_EQUAL(xMatrixF64_getRows(NULL), 0);
+    xMatrixI8_free(NULL);  // should not crash
+
+    xMatrixF64_free(f);
+    xMatrixI32_free(i);
+    xMatrixI8_free(b);
+}
+
+void test_xMatrixTyped_elementwise(void)
+{
+    xInt32 lhsData[6] = {1, -2, 3, 2147483647, 5, -6};
+    xInt32 rhsData[6] = {6, 5, -4, 1, 2, 1};
+    xMatrixI32 *lhs = xMatrixI32_unflatten(lhsData, 2, 3);
+    xMatrixI32 *rhs = xMatrixI32_unflatten(rhsData, 2, 3);
+
+    // Test case 1: Integer arithmetic (overflow wraps around)
+    xMatrixI32 *sum = xMatrixI32_add(lhs, rhs);
+    xMatrixI32 *diff = xMatrixI32_sub(lhs, rhs);
+    xMatrixI32 *prod = xMatrixI32_dotmul(lhs, rhs);
+    xMatrixI32 *scaled = xMatrixI32_scalarMul(lhs, 3);
+    CU_ASSERT_EQUAL(xMatrixI32_get(sum, 0, 1), 3);
+    CU_ASSERT_EQUAL(xMatrixI32_get(sum, 1, 0), (xInt32)0x80000000u);
+    CU_ASSERT_EQUAL(xMatrixI32_get(diff, 0, 2), 7);
+    CU_ASSERT_EQUAL(xMatrixI32_get(prod, 0, 2), -12);
+    CU_ASSERT_EQUAL(xMatrixI32_get(scaled, 1, 2), -18);
+
+    // Test case 2: Transpose and duplicate
+    xMatrixI32 *trans = xMatrixI32_transpose(lhs);
+    xMatrixI32 *dup = xMatrixI32_duplicate(lhs);
+    CU_ASSERT_EQUAL(xMatrixI32_getRows(trans), 3);
+    CU_ASSERT_EQUAL(xMatrixI32_get(trans, 2, 1), -6);
+    CU_ASSERT_EQUAL(xMatrixI32_get(dup, 1, 0), 2147483647);
+
+    // Test case 3: Element-wise results of int8 matrices wrap modulo 2^8
+    xMatrixI8 *small = xMatrixI8_new(1, 2);
+    xMatrixI8_fill(small, 100);
+    xMatrixI8 *wrapped = xMatrixI8_add(small, small);
+    CU_ASSERT_EQUAL(xMatrixI8_get(wrapped, 0, 0), -56);
+
+    // Test case 4: Dimension mismatch
+    xMatrixI32 *other = xMatrixI32_new(3, 2);
+    CU_ASSERT_PTR_NULL(xMatrixI32_add(lhs, other));
+    CU_ASSERT_PTR_NULL(xMatrixI32_add_inplace(sum, lhs, other));
+
+    // Test case 5: Flatten
+    xInt32 *flat = xMatrixI32_flatten(prod);
+    CU_ASSERT_EQUAL(flat[3], 2147483647);
+    CU_ASSERT_EQUAL(flat[5], -6);
+
+    free(flat);
+    xMatrixI32_free(lhs);
+    xMatrixI32_free(rhs);
+    xMatrixI32_free(sum);
+    xMatrixI32_free(diff);
+    xMatrixI32_free(prod);
+    xMatrixI32_free(scaled);
+    xMatrixI32_free(trans);
+    xMatrixI32_free(dup);
+    xMatrixI32_free(other);
+    xMatrixI8_free(small);
+    xMatrixI8_free(wrapped);
+}
+
+void test_xMatrixTyped_mul(void)
+{
+    xMatrixF64 *lhs = xMatrixF64_new(70, 90);
+    xMatrixF64 *rhs = xMatrixF64_new(90, 90);
+    xMatrixI8 *lhs8 = xMatrixI8_new(70, 90);
+    xMatrixI8 *rhs8 = xMatrixI8_new(90, 90);
+    for (xSize i = 0; i < 90; i++) {
+        for (xSize j = 0; j < 90; j++) {
+            xMatrixF64_set(lhs, i, j, 1.0 / (double)(i + j + 1));
+            xMatrixF64_set(rhs, i, j, (double)((i * 7 + j) % 11) - 5.0);
+            xMatrixI8_set(lhs8, i, j, (xInt8)((i * 31 + j * 17) % 256 - 128));
+            xMatrixI8_set(rhs8, i, j, (xInt8)((i * 13 + j * 29) % 256 - 128));
+        }
+    }
+
+    // Test case 1: Double precision product matches reference
+    xMatrixF64 *prod = xMatrixF64_mul(lhs, rhs);
+    CU_ASSERT_PTR_NOT_NULL(prod);
+    xBool close = true;
+    for (xSize i = 0; i < 70; i++) {
+        for (xSize j = 0; j < 90; j++) {
+            double sum = 0.0;
+            for (xSize k = 0; k < 90; k++) {
+                sum += xMatrixF64_get(lhs, i, k) * xMatrixF64_get(rhs, k, j);
+            }
+            double delta = sum - xMatrixF64_get(prod, i, j);
+            close = (delta < 1e-12 && delta > -1e-12) ? close : false;
+        }
+    }
+    CU_ASSERT_TRUE(close);
+
+    // Test case 2: Result aliasing left operand
+    xMatrixF64 *square = xMatrixF64_duplicate(rhs);
+    xMatrixF64 *expected = xMatrixF64_mul(rhs, rhs);
+    CU_ASSERT_PTR_EQUAL(xMatrixF64_mul_inplace(square, square, rhs), square);
+    xBool equal = true;
+    for (xSize i = 0; i < 90; i++) {
+        for (xSize j = 0; j < 90; j++) {
+            equal = (xMatrixF64_get(square, i, j) == xMatrixF64_get(expected, i, j)) ? equal : false;
+        }
+    }
+    CU_ASSERT_TRUE(equal);
+
+    // Test case 3: Product of int8 matrices is exact int32 matrix
+    xMatrixI32 *prod8 = xMatrixI8_mul(lhs8, rhs8);
+    CU_ASSERT_PTR_NOT_NULL(prod8);
+    CU_ASSERT_EQUAL(xMatrixI32_getRows(prod8), 70);
+    CU_ASSERT_EQUAL(xMatrixI32_getCols(prod8), 90);
+    xBool exact = true;
+    for (xSize i = 0; i < 70; i++) {
+        for (xSize j = 0; j < 90; j++) {
+            xInt32 sum = 0;
+            for (xSize k = 0; k < 90; k++) {
+                sum += (xInt32)xMatrixI8_get(lhs8, i, k) * (xInt32)xMatrixI8_get(rhs8, k, j);
+            }
+            exact = (xMatrixI32_get(prod8, i, j) == sum) ? exact : false;
+        }
+    }
+    CU_ASSERT_TRUE(exact);
+
+    // Test case 4: Dimension mismatch
+    CU_ASSERT_PTR_NULL(xMatrixI8_mul(rhs8, lhs8));
+    CU_ASSERT_PTR_NULL(xMatrixF64_mul_inplace(lhs, lhs, lhs));
+    CU_ASSERT_PTR_NULL(xMatrixI8_mul_inplace(prod8, rhs8, rhs8));
+
+    xMatrixF64_free(lhs);
+    xMatrixF64_free(rhs);
+    xMatrixF64_free(prod);
+    xMatrixF64_free(square);
+    xMatrixF64_free(expected);
+    xMatrixI8_free(lhs8);
+    xMatrixI8_free(rhs8);
+    xMatrixI32_free(prod8);
+}
+
+int main(void)
+{
+    CU_pSuite pSuite = NULL;
+
+    // initialize CUnit test registry
+    if (CU_initialize_registry() != CUE_SUCCESS) {
+        return CU_get_error();
+    }
+
+    // add a suite to the registry
+    pSuite = CU_add_suite("xMatrixTyped_test", NULL, NULL);
+    if (pSuite == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // add the tests to the suite
+    if (CU_add_test(pSuite, "xMatrixTyped_new", test_xMatrixTyped_new) == NULL ||
+        CU_add_test(pSuite, "xMatrixTyped_elementwise", test_xMatrixTyped_elementwise) == NULL ||
+        CU_add_test(pSuite, "xMatrixTyped_mul", test_xMatrixTyped_mul) == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // run all tests using the CUnit Basic interface
+    CU_basic_set_mode(CU_BRM_VERBOSE);
+    CU_basic_run_tests();
+    CU_cleanup_registry();
+
+    return CU_get_error();
+}
@@ -11,6 +11,11 @@
 #include <CUnit/TestDB.h>
 #include <malloc.h>
 #include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 #include "xBase/xTypes.h"
 #include "xLinear/xMatrix.h"
 
@@ -220,6 +225,132 @@ void test_xMatrix_transpose(void)
     CU_ASSERT_EQUAL(xMatrix_get(transposed, 2, 0), 3.0f);
     xMatrix_free(mat);
     xMatrix_free(transposed);
+
+    // Test case 5: Transposing matrix spanning multiple partial tiles
+    mat = xMatrix_new(100, 37);
+    for (xSize i = 0; i < 100; i++) {
+        for (xSize j = 0; j < 37; j++) {
+            xMatrix_set(mat, i, j, i * 37 + j);
+        }
+    }
+    transposed = xMatrix_transpose(mat);
+    CU_ASSERT_EQUAL(xMatrix_getRows(transposed), 37);
+    CU_ASSERT_EQUAL(xMatrix_getCols(transposed), 100);
+    xBool matches = true;
+    for (xSize i = 0; i < 37; i++) {
+        for (xSize j = 0; j < 100; j++) {
+            matches = (xMatrix_get(transposed, i, j) == j * 37 + i) ? matches : false;
+        }
+    }
+    CU_ASSERT_TRUE(matches);
+    xMatrix_free(mat);
+    xMatrix_free(transposed);
+}
+
+// fill matrix with element indices, transpose it in place and check result
+static xBool transposeInplaceMatches(xSize rows, xSize cols)
+{
+    xMatrix *mat = xMatrix_new(rows, cols);
+    for (xSize i = 0; i < rows; i++) {
+        for (xSize j = 0; j < cols; j++) {
+            xMatrix_set(mat, i, j, i * cols + j);
+        }
+    }
+
+    xBool matches = xMatrix_transpose_inplace(mat) == mat && xMatrix_getRows(mat) == cols && xMatrix_getCols(mat) == rows;
+    for (xSize i = 0; i < cols; i++) {
+        for (xSize j = 0; j < rows; j++) {
+            matches = (xMatrix_get(mat, i, j) == j * cols + i) ? matches : false;
+        }
+    }
+    xMatrix_free(mat);
+    return matches;
+}
+
+void test_xMatrix_transpose_inplace(void)
+{
+    // Test case 1: Transposing NULL matrix
+    CU_ASSERT_PTR_NULL(xMatrix_transpose_inplace(NULL));
+
+    // Test case 2: Transposing square matrices (single element, multiple partial tiles)
+    CU_ASSERT_TRUE(transposeInplaceMatches(1, 1));
+    CU_ASSERT_TRUE(transposeInplaceMatches(70, 70));
+
+    // Test case 3: Transposing non-square matrices
+    CU_ASSERT_TRUE(transposeInplaceMatches(37, 53));
+    CU_ASSERT_TRUE(transposeInplaceMatches(64, 2));
+    CU_ASSERT_TRUE(transposeInplaceMatches(12, 18));
+
+    // Test case 4: Transposing non-square matrices in several column groups (coprime and common divisor dimensions)
+    CU_ASSERT_TRUE(transposeInplaceMatches(517, 1300));
+    CU_ASSERT_TRUE(transposeInplaceMatches(36, 1000));
+    CU_ASSERT_TRUE(transposeInplaceMatches(1000, 36));
+
+    // Test case 5: Transposing row and column vectors
+    CU_ASSERT_TRUE(transposeInplaceMatches(1, 5));
+    CU_ASSERT_TRUE(transposeInplaceMatches(5, 1));
+    CU_ASSERT_TRUE(transposeInplaceMatches(1, 100));
+    CU_ASSERT_TRUE(transposeInplaceMatches(100, 1));
+
+    // Test case 6: Transposing matrices with padded rows (padded layout of result may or may not fit)
+    CU_ASSERT_TRUE(transposeInplaceMatches(20, 100));
+    CU_ASSERT_TRUE(transposeInplaceMatches(100, 20));
+    CU_ASSERT_TRUE(transposeInplaceMatches(300, 256));
+    xMatrix *mat = xMatrix_new(100, 20);
+    xMatrix_transpose_inplace(mat);
+    CU_ASSERT_EQUAL(xMatrix_getStride(mat), 112);
+    xMatrix_transpose_inplace(mat);
+    CU_ASSERT_EQUAL(xMatrix_getStride(mat), 32);
+    xMatrix_free(mat);
+}
+
+void test_xMatrix_layout(void)
+{
+    // Test case 1: Narrow rows are packed, wider rows are padded to whole cache lines
+    xSize cols[6] = {1, 15, 16, 17, 100, 1000};
+    xSize strides[6] = {1, 15, 16, 32, 112, 1008};
+    for (xSize k = 0; k < 6; k++) {
+        xMatrix *mat = xMatrix_new(3, cols[k]);
+        CU_ASSERT_EQUAL(xMatrix_getStride(mat), strides[k]);
+        CU_ASSERT_EQUAL(xMatrix_view(mat).rowStride, strides[k]);
+        xMatrix_free(mat);
+    }
+
+    // Test case 2: Power-of-two widths get extra cache line against cache set conflicts and 4K aliasing
+    xMatrix *mat = xMatrix_new(4, 256);
+    CU_ASSERT_EQUAL(xMatrix_getStride(mat), 272);
+    xMatrix_free(mat);
+    mat = xMatrix_new(4, 1024);
+    CU_ASSERT_EQUAL(xMatrix_getStride(mat), 1040);
+
+    // Test case 3: Every padded row starts on aligned boundary
+    xBool aligned = true;
+    for (xSize i = 0; i < 4; i++) {
+        aligned = ((uintptr_t)xMatrix_viewRow(mat, i).data % XMATRIX_ALIGNMENT == 0) ? aligned : false;
+    }
+    CU_ASSERT_TRUE(aligned);
+    xMatrix_free(mat);
+
+    // Test case 4: Operations on padded matrices do not leak padding into results
+    xMatrix *lhs = xMatrix_new(33, 20);
+    xMatrix *rhs = xMatrix_new(20, 33);
+    xMatrix_fill(lhs, 1.0f);
+    xMatrix_fill(rhs, 2.0f);
+    xMatrix *prod = xMatrix_mul(lhs, rhs);
+    xMatrix *dup = xMatrix_duplicate(prod);
+    float *flat = xMatrix_flatten(dup);
+    xBool exact = true;
+    for (xSize i = 0; i < 33 * 33; i++) {
+        exact = (flat[i] == 40.0f) ? exact : false;
+    }
+    CU_ASSERT_TRUE(exact);
+    CU_ASSERT_EQUAL(xMatrix_getStride(NULL), 0);
+
+    free(flat);
+    xMatrix_free(lhs);
+    xMatrix_free(rhs);
+    xMatrix_free(prod);
+    xMatrix_free(dup);
 }
 
 void test_xMatrix_add(void)
@@ -871,6 +1002,218 @@ void test_xMatrix_unflatten(void)
     xMatrix_free(mat);
 }
 
+static xBool elementsMatch(const xMatrix *lhs, const xMatrix *rhs)
+{
+    if (xMatrix_getRows(lhs) != xMatrix_getRows(rhs) || xMatrix_getCols(lhs) != xMatrix_getCols(rhs)) {
+        return false;
+    }
+    for (xSize i = 0; i < xMatrix_getRows(lhs); i++) {
+        for (xSize j = 0; j < xMatrix_getCols(lhs); j++) {
+            if (xMatrix_get(lhs, i, j) != xMatrix_get(rhs, i, j)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void test_xMatrix_save_load(void)
+{
+    char path[] = "/tmp/xMatrix_test_XXXXXX";
+    int descriptor = mkstemp(path);
+    CU_ASSERT_TRUE_FATAL(descriptor >= 0);
+    close(descriptor);
+    char missing[sizeof(path) + 8];
+    snprintf(missing, sizeof(missing), "%s.missing", path);
+
+    xMatrix *mat = xMatrix_new(37, 100);
+    for (xSize i = 0; i < 37; i++) {
+        for (xSize j = 0; j < 100; j++) {
+            xMatrix_set(mat, i, j, (float)(i * 100 + j) * 0.5f);
+        }
+    }
+
+    // Test case 1: Saved file is .npy with header padded to aligned data offset
+    CU_ASSERT_TRUE(xMatrix_save(mat, path));
+    FILE *file = fopen(path, "rb");
+    char header[128] = {0};
+    CU_ASSERT_EQUAL(fread(header, 1, sizeof(header), file), sizeof(header));
+    fseek(file, 0, SEEK_END);
+    CU_ASSERT_EQUAL(ftell(file), 128 + 37 * 100 * 4);
+    fclose(file);
+    CU_ASSERT_EQUAL(memcmp(header, "\x93NUMPY\x01\x00", 8), 0);
+    CU_ASSERT_EQUAL(header[8], 128 - 10);
+    CU_ASSERT_EQUAL(header[127], '\n');
+
+    // Test case 2: Loaded copy has padded rows and same elements
+    xMatrix *copy = xMatrix_load(path);
+    CU_ASSERT_PTR_NOT_NULL(copy);
+    CU_ASSERT_EQUAL(xMatrix_getStride(copy), xMatrix_getStride(mat));
+    CU_ASSERT_TRUE(elementsMatch(copy, mat));
+    xMatrix_free(copy);
+
+    // Test case 3: Mapped matrix has packed aligned rows and same elements, changes do not reach file
+    xMatrix *mapped = xMatrix_loadMapped(path);
+    CU_ASSERT_PTR_NOT_NULL(mapped);
+    CU_ASSERT_EQUAL(xMatrix_getStride(mapped), 100);
+    CU_ASSERT_EQUAL((uintptr_t)xMatrix_view(mapped).data % XMATRIX_ALIGNMENT, 0);
+    CU_ASSERT_TRUE(elementsMatch(mapped, mat));
+    xMatrix_set(mapped, 0, 0, 42.0f);
+    xMatrix_free(mapped);
+    mapped = xMatrix_loadMapped(path);
+    CU_ASSERT_EQUAL(xMatrix_get(mapped, 0, 0), 0.0f);
+
+    // Test case 4: Mapped matrix works with other operations
+    xMatrix *sum = xMatrix_add(mapped, mat);
+    CU_ASSERT_EQUAL(xMatrix_get(sum, 36, 99), 3699.0f);
+    xMatrix_transpose_inplace(mapped);
+    CU_ASSERT_EQUAL(xMatrix_getRows(mapped), 100);
+    CU_ASSERT_EQUAL(xMatrix_get(mapped, 99, 36), xMatrix_get(mat, 36, 99));
+    xMatrix_free(sum);
+    xMatrix_free(mapped);
+    xMatrix_free(mat);
+
+    // Test case 5: One-dimensional array is loaded as single row
+    file = fopen(path, "wb");
+    const char vector[] = "\x93NUMPY\x01\x00\x76\x00{'descr': '<f4', 'fortran_order': False, 'shape': (3,), }";
+    fwrite(vector, 1, sizeof(vector) - 1, file);
+    for (xSize k = sizeof(vector) - 1; k < 127; k++) {
+        fputc(' ', file);
+    }
+    fputc('\n', file);
+    float values[3] = {1.0f, 2.0f, 3.0f};
+    fwrite(values, sizeof(float), 3, file);
+    fclose(file);
+    mat = xMatrix_loadMapped(path);
+    CU_ASSERT_EQUAL(xMatrix_getRows(mat), 1);
+    CU_ASSERT_EQUAL(xMatrix_getCols(mat), 3);
+    CU_ASSERT_EQUAL(xMatrix_get(mat, 0, 2), 3.0f);
+    xMatrix_free(mat);
+
+    // Test case 6: Invalid and truncated files are rejected
+    CU_ASSERT_PTR_NULL(xMatrix_load(missing));
+    CU_ASSERT_PTR_NULL(xMatrix_loadMapped(missing));
+    CU_ASSERT_FALSE(xMatrix_save(NULL, path));
+    file = fopen(path, "wb");
+    fwrite(vector, 1, sizeof(vector) - 1, file);
+    fclose(file);
+    CU_ASSERT_PTR_NULL(xMatrix_load(path));
+    CU_ASSERT_PTR_NULL(xMatrix_loadMapped(path));
+    file = fopen(path, "wb");
+    fputs("not a matrix file", file);
+    fclose(file);
+    CU_ASSERT_PTR_NULL(xMatrix_load(path));
+    CU_ASSERT_PTR_NULL(xMatrix_loadMapped(path));
+    unlink(path);
+}
+
+void test_xMatrix_view(void)
+{
+    xMatrix *mat = xMatrix_new(4, 5);
+    for (xSize i = 0; i < 4; i++) {
+        for (xSize j = 0; j < 5; j++) {
+            xMatrix_set(mat, i, j, i * 5 + j);
+        }
+    }
+
+    // Test case 1: Views of invalid matrix and out of range blocks are invalid
+    CU_ASSERT_FALSE(xMatrixView_isValid(xMatrix_view(NULL)));
+    CU_ASSERT_FALSE(xMatrixView_isValid(xMatrix_viewBlock(mat, 2, 2, 3, 1)));
+    CU_ASSERT_FALSE(xMatrixView_isValid(xMatrix_viewBlock(mat, 0, 0, 0, 1)));
+    CU_ASSERT_FALSE(xMatrixView_isValid(xMatrix_viewRow(mat, 4)));
+    CU_ASSERT_TRUE(isnan(xMatrixView_get(xMatrix_view(mat), 4, 0)));
+
+    // Test case 2: Block, row and column views share memory with matrix
+    xMatrixView block = xMatrix_viewBlock(mat, 1, 2, 2, 3);
+    CU_ASSERT_EQUAL(block.rows, 2);
+    CU_ASSERT_EQUAL(block.cols, 3);
+    CU_ASSERT_EQUAL(xMatrixView_get(block, 1, 2), 14.0f);
+    xMatrixView_set(block, 0, 0, -1.0f);
+    CU_ASSERT_EQUAL(xMatrix_get(mat, 1, 2), -1.0f);
+    CU_ASSERT_EQUAL(xMatrixView_get(xMatrix_viewRow(mat, 3), 0, 4), 19.0f);
+    CU_ASSERT_EQUAL(xMatrixView_get(xMatrix_viewCol(mat, 3), 2, 0), 13.0f);
+    CU_ASSERT_EQUAL(xMatrixView_get(xMatrixView_block(block, 1, 1, 1, 2), 0, 1), 14.0f);
+
+    // Test case 3: Transposed view swaps indices
+    xMatrixView transposed = xMatrixView_transpose(block);
+    CU_ASSERT_EQUAL(transposed.rows, 3);
+    CU_ASSERT_EQUAL(transposed.cols, 2);
+    CU_ASSERT_EQUAL(xMatrixView_get(transposed, 2, 1), 14.0f);
+
+    // Test case 4: Matrix created from transposed view
+    xMatrix *copy = xMatrix_newFromView(transposed);
+    CU_ASSERT_EQUAL(xMatrix_getRows(copy), 3);
+    CU_ASSERT_EQUAL(xMatrix_getCols(copy), 2);
+    CU_ASSERT_EQUAL(xMatrix_get(copy, 0, 0), -1.0f);
+    CU_ASSERT_EQUAL(xMatrix_get(copy, 2, 1), 14.0f);
+    CU_ASSERT_PTR_NULL(xMatrix_newFromView(xMatrix_view(NULL)));
+
+    xMatrix_free(copy);
+    xMatrix_free(mat);
+}
+
+void test_xMatrixView_ops(void)
+{
+    xMatrix *lhs = xMatrix_new(6, 6);
+    xMatrix *rhs = xMatrix_new(6, 6);
+    for (xSize i = 0; i < 6; i++) {
+        for (xSize j = 0; j < 6; j++) {
+            xMatrix_set(lhs, i, j, i + j);
+            xMatrix_set(rhs, i, j, i * j);
+        }
+    }
+
+    // Test case 1: Element-wise operation on blocks writes only into result block
+    xMatrix *res = xMatrix_new(6, 6);
+    xMatrixView target = xMatrix_viewBlock(res, 2, 2, 3, 3);
+    CU_ASSERT_TRUE(xMatrixView_add(target, xMatrix_viewBlock(lhs, 0, 0, 3, 3), xMatrix_viewBlock(rhs, 3, 3, 3, 3)));
+    CU_ASSERT_EQUAL(xMatrix_get(res, 2, 2), 0.0f + 9.0f);
+    CU_ASSERT_EQUAL(xMatrix_get(res, 4, 4), 4.0f + 25.0f);
+    CU_ASSERT_EQUAL(xMatrix_get(res, 1, 1), 0.0f);
+    CU_ASSERT_EQUAL(xMatrix_get(res, 5, 5), 0.0f);
+
+    // Test case 2: Operations on transposed views and in-place result
+    xMatrixView rows = xMatrix_viewBlock(lhs, 0, 0, 2, 6);
+    CU_ASSERT_TRUE(xMatrixView_scalarMul(xMatrix_viewCol(res, 0), xMatrixView_transpose(xMatrix_viewRow(lhs, 1)), 2.0f));
+    CU_ASSERT_EQUAL(xMatrix_get(res, 5, 0), 12.0f);
+    CU_ASSERT_TRUE(xMatrixView_map2(rows, rows, xMatrixView_transpose(xMatrix_viewBlock(rhs, 0, 0, 6, 2)), dummyMap2));
+    CU_ASSERT_EQUAL(xMatrix_get(lhs, 1, 5), 6.0f + 5.0f);
+
+    // Test case 3: Matrix product of transposed and block views
+    xMatrix *prod = xMatrix_new(3, 3);
+    xMatrix *expected = xMatrix_new(3, 3);
+    for (xSize i = 0; i < 3; i++) {
+        for (xSize j = 0; j < 3; j++) {
+            float sum = 0.0f;
+            for (xSize k = 0; k < 4; k++) {
+                sum += xMatrix_get(lhs, k, i) * xMatrix_get(rhs, 2 + k, 3 + j);
+            }
+            xMatrix_set(expected, i, j, sum);
+        }
+    }
+    xMatrixView lhsT = xMatrixView_transpose(xMatrix_viewBlock(lhs, 0, 0, 4, 3));
+    CU_ASSERT_TRUE(xMatrixView_mul(xMatrix_view(prod), lhsT, xMatrix_viewBlock(rhs, 2, 3, 4, 3)));
+    xBool matches = true;
+    for (xSize i = 0; i < 3; i++) {
+        for (xSize j = 0; j < 3; j++) {
+            matches = (xMatrix_get(prod, i, j) == xMatrix_get(expected, i, j)) ? matches : false;
+        }
+    }
+    CU_ASSERT_TRUE(matches);
+
+    // Test case 4: Invalid views and mismatched dimensions
+    CU_ASSERT_FALSE(xMatrixView_add(target, xMatrix_view(NULL), xMatrix_viewBlock(rhs, 0, 0, 3, 3)));
+    CU_ASSERT_FALSE(xMatrixView_sub(target, xMatrix_view(lhs), xMatrix_view(rhs)));
+    CU_ASSERT_FALSE(xMatrixView_map(target, target, NULL));
+    CU_ASSERT_FALSE(xMatrixView_mul(xMatrix_view(prod), xMatrix_view(lhs), xMatrix_view(rhs)));
+
+    xMatrix_free(lhs);
+    xMatrix_free(rhs);
+    xMatrix_free(res);
+    xMatrix_free(prod);
+    xMatrix_free(expected);
+}
+
 int main(void)
 {
     CU_pSuite suite = NULL;
@@ -897,6 +1240,8 @@ int main(void)
         (CU_add_test(suite, "xMatrix_fill", test_xMatrix_fill) == NULL) ||
         (CU_add_test(suite, "xMatrix_identity", test_xMatrix_identity) == NULL) ||
         (CU_add_test(suite, "xMatrix_transpose", test_xMatrix_transpose) == NULL) ||
+        (CU_add_test(suite, "xMatrix_transpose_inplace", test_xMatrix_transpose_inplace) == NULL) ||
+        (CU_add_test(suite, "xMatrix_layout", test_xMatrix_layout) == NULL) ||
         (CU_add_test(suite, "xMatrix_add", test_xMatrix_add) == NULL) ||
         (CU_add_test(suite, "xMatrix_sub", test_xMatrix_sub) == NULL) ||
         (CU_add_test(suite, "xMatrix_mul", test_xMatrix_mul) == NULL) ||
@@ -911,7 +1256,10 @@ int main(void)
         (CU_add_test(suite, "xMatrix_map2", test_xMatrix_map2) == NULL) ||
         (CU_add_test(suite, "xMatrix_mapScalar", test_xMatrix_mapScalar) == NULL) ||
         (CU_add_test(suite, "xMatrix_flatten", test_xMatrix_flatten) == NULL) ||
-        (CU_add_test(suite, "xMatrix_unflatten", test_xMatrix_unflatten) == NULL)) {
+        (CU_add_test(suite, "xMatrix_unflatten", test_xMatrix_unflatten) == NULL) ||
+        (CU_add_test(suite, "xMatrix_save_load", test_xMatrix_save_load) == NULL) ||
+        (CU_add_test(suite, "xMatrix_view", test_xMatrix_view) == NULL) ||
+        (CU_add_test(suite, "xMatrixView_ops", test_xMatrixView_ops) == NULL)) {
         CU_cleanup_registry();
         return CU_get_error();
     }
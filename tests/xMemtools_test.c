@@ -47,6 +47,143 @@ void test_xMemCmp(void)
     CU_ASSERT_FALSE(xMemCmp("Hello, World!", NULL, 13));
 }
 
+void test_xMemCompare(void)
+{
+    xSize mismatch = 0;
+
+    // Test case 1: Comparing equal memory blocks
+    CU_ASSERT_EQUAL(xMemCompare("Hello, World!", "Hello, World!", 13, &mismatch), 0);
+    CU_ASSERT_EQUAL(mismatch, 13);
+
+    // Test case 2: First block precedes second
+    CU_ASSERT_TRUE(xMemCompare("Hello, Universe!", "Hello, World!", 13, &mismatch) < 0);
+    CU_ASSERT_EQUAL(mismatch, 7);
+
+    // Test case 3: First block follows second
+    CU_ASSERT_TRUE(xMemCompare("Hello, World!", "Hello, Universe!", 13, &mismatch) > 0);
+    CU_ASSERT_EQUAL(mismatch, 7);
+
+    // Test case 4: Bytes are ordered as unsigned values
+    CU_ASSERT_TRUE(xMemCompare("\x80", "\x7F", 1, NULL) > 0);
+
+    // Test case 5: Comparing empty memory blocks
+    CU_ASSERT_EQUAL(xMemCompare("A", "B", 0, &mismatch), 0);
+    CU_ASSERT_EQUAL(mismatch, 0);
+
+    // Test case 6: NULL blocks
+    CU_ASSERT_EQUAL(xMemCompare(NULL, NULL, 5, NULL), 0);
+    CU_ASSERT_TRUE(xMemCompare(NULL, "A", 1, &mismatch) < 0);
+    CU_ASSERT_EQUAL(mismatch, 0);
+    CU_ASSERT_TRUE(xMemCompare("A", NULL, 1, NULL) > 0);
+
+    // Test case 7: Single difference at every position of large blocks
+    xUInt8 *block1 = (xUInt8 *)malloc(1024);
+    xUInt8 *block2 = (xUInt8 *)malloc(1024);
+    CU_ASSERT_TRUE_FATAL(block1 != NULL && block2 != NULL);
+    for (xSize i = 0; i < 1024; i++) {
+        block1[i] = block2[i] = (xUInt8)(i * 11);
+    }
+    xBool foundAll = true;
+    for (xSize size = 1; size <= 1000; size += 37) {
+        for (xSize pos = 0; pos < size; pos++) {
+            block2[pos] = (xUInt8)(block1[pos] + 1);
+            if (xMemCompare(block1, block2, size, &mismatch) == 0 || mismatch != pos || xMemCmp(block1, block2, size)) {
+                foundAll = false;
+            }
+            block2[pos] = block1[pos];
+        }
+        if (xMemCompare(block1, block2, size, &mismatch) != 0 || mismatch != size || !xMemCmp(block1, block2, size)) {
+            foundAll = false;
+        }
+    }
+    CU_ASSERT_TRUE(foundAll);
+    free(block1);
+    free(block2);
+}
+
+static xSize naiveFind(const xUInt8 *block, xSize size, const xUInt8 *needle, xSize needleSize, xBool last)
+{
+    xSize found = XSIZE_MAX;
+    for (xSize i = 0; i + needleSize <= size; i++) {
+        xSize j = 0;
+        while (j < needleSize && block[i + j] == needle[j]) {
+            j++;
+        }
+        if (j == needleSize) {
+            found = i;
+            if (!last) {
+                break;
+            }
+        }
+    }
+    return found;
+}
+
+void test_xMemFind(void)
+{
+    // Test case 1: Finding bytes and short needles
+    CU_ASSERT_EQUAL(xMemFindByte("Hello, World!", 13, 'o'), 4);
+    CU_ASSERT_EQUAL(xMemFindByte("Hello, World!", 13, 'x'), XSIZE_MAX);
+    CU_ASSERT_EQUAL(xMemFind("Hello, World!", 13, "World", 5), 7);
+    CU_ASSERT_EQUAL(xMemFind("Hello, World!", 13, "d!", 2), 11);
+    CU_ASSERT_EQUAL(xMemFind("Hello, World!", 13, "Worlds", 6), XSIZE_MAX);
+    CU_ASSERT_EQUAL(xMemFindLast("Hello, World!", 13, "o", 1), 8);
+    CU_ASSERT_EQUAL(xMemFindLast("abcabcabc", 9, "abc", 3), 6);
+
+    // Test case 2: Empty needles and invalid arguments
+    CU_ASSERT_EQUAL(xMemFind("abc", 3, "", 0), 0);
+    CU_ASSERT_EQUAL(xMemFindLast("abc", 3, "", 0), 3);
+    CU_ASSERT_EQUAL(xMemFind(NULL, 3, "a", 1), XSIZE_MAX);
+    CU_ASSERT_EQUAL(xMemFind("abc", 3, NULL, 1), XSIZE_MAX);
+    CU_ASSERT_EQUAL(xMemCount("abc", 3, "", 0, false), 0);
+
+    // Test case 3: Counting overlapping and non-overlapping occurrences
+    CU_ASSERT_EQUAL(xMemCount("abababababababa", 15, "aba", 3, false), 4);
+    CU_ASSERT_EQUAL(xMemCount("abababababababa", 15, "aba", 3, true), 7);
+    CU_ASSERT_EQUAL(xMemCount("Hello, World!", 13, "o", 1, false), 2);
+
+    // Test case 4: Random blocks over small alphabets match naive search at every vector boundary
+    xUInt8 block[300], needle[40];
+    xUInt32 seed = 12345;
+    xBool allMatch = true;
+    for (int round = 0; round < 2000 && allMatch; round++) {
+        xSize alphabet = 2 + (xSize)(round % 3);
+        xSize size = (xSize)(round * 7) % 300;
+        xSize needleSize = 1 + (xSize)(round % 13) * (round % 4 == 0 ? 3 : 1);
+        for (xSize i = 0; i < size; i++) {
+            seed = seed * 1103515245U + 12345U;
+            block[i] = (xUInt8)('a' + (seed >> 16) % alphabet);
+        }
+        for (xSize i = 0; i < needleSize; i++) {
+            seed = seed * 1103515245U + 12345U;
+            needle[i] = (xUInt8)('a' + (seed >> 16) % alphabet);
+        }
+        xSize expected = naiveFind(block, size, needle, needleSize, false);
+        xSize expectedLast = naiveFind(block, size, needle, needleSize, true);
+        allMatch = (xMemFind(block, size, needle, needleSize) == expected) &&
+                   (xMemFindLast(block, size, needle, needleSize) == expectedLast);
+    }
+    CU_ASSERT_TRUE(allMatch);
+
+    // Test case 5: Adversarial inputs finished by Two-Way search give correct results
+    static xUInt8 large[20000];
+    xUInt8 pattern[64];
+    for (xSize i = 0; i < sizeof(large); i++) {
+        large[i] = 'a';
+    }
+    for (xSize i = 0; i < sizeof(pattern); i++) {
+        pattern[i] = 'a';
+    }
+    pattern[32] = 'b';
+    CU_ASSERT_EQUAL(xMemFind(large, sizeof(large), pattern, sizeof(pattern)), XSIZE_MAX);
+    CU_ASSERT_EQUAL(xMemFindLast(large, sizeof(large), pattern, sizeof(pattern)), XSIZE_MAX);
+    large[15000] = 'b';
+    CU_ASSERT_EQUAL(xMemFind(large, sizeof(large), pattern, sizeof(pattern)), 15000 - 32);
+    CU_ASSERT_EQUAL(xMemFindLast(large, sizeof(large), pattern, sizeof(pattern)), 15000 - 32);
+    CU_ASSERT_EQUAL(xMemCount(large, sizeof(large), pattern, 16, true), (15000 - 15) + (4999 - 15));
+    CU_ASSERT_EQUAL(xMemCount(large, sizeof(large), pattern, 16, false), 15000 / 16 + 4999 / 16);
+}
+
 void test_xMemCopy(void)
 {
     // Test case 1: Copying memory block with multiple characters
@@ -115,6 +252,32 @@ void test_xMemCopy(void)
     CU_ASSERT_TRUE(xMemCmp(dest, "HelloHel", 8));
     CU_ASSERT_TRUE(xMemCmp(src10, "HelloHelloHel", 13));
     free(src10);
+
+    // Test case 11: Copying large blocks at every combination of small alignment offsets
+    xUInt8 *src11 = (xUInt8 *)malloc(4096 + 64);
+    xUInt8 *dest11 = (xUInt8 *)malloc(4096 + 64);
+    CU_ASSERT_TRUE_FATAL(src11 != NULL && dest11 != NULL);
+    for (xSize i = 0; i < 4096 + 64; i++) {
+        src11[i] = (xUInt8)(i * 7 + 3);
+    }
+    xBool copiedAll = true;
+    for (xSize size = 1; size <= 4096; size = size * 3 + 1) {
+        for (xSize srcOff = 0; srcOff < 33; srcOff += 3) {
+            for (xSize destOff = 0; destOff < 33; destOff += 5) {
+                xMemSet(dest11, 0, 4096 + 64);
+                xMemCopy(dest11 + destOff, src11 + srcOff, size);
+                for (xSize i = 0; i < 4096 + 64; i++) {
+                    xUInt8 expected = (i >= destOff && i < destOff + size) ? src11[srcOff + i - destOff] : 0;
+                    if (dest11[i] != expected) {
+                        copiedAll = false;
+                    }
+                }
+            }
+        }
+    }
+    CU_ASSERT_TRUE(copiedAll);
+    free(src11);
+    free(dest11);
 }
 
 void test_xMemMove(void)
@@ -185,6 +348,46 @@ void test_xMemMove(void)
     CU_ASSERT_TRUE(xMemCmp(dest, "Hello, World!", 8));
     CU_ASSERT_TRUE(xMemCmp(src10, "HelloHello, World!", 13));
     free(src10);
+
+    // Test case 11: Moving large overlapping blocks in both directions
+    xUInt8 *buf11 = (xUInt8 *)malloc(2048);
+    xUInt8 *ref11 = (xUInt8 *)malloc(2048);
+    CU_ASSERT_TRUE_FATAL(buf11 != NULL && ref11 != NULL);
+    xBool movedAll = true;
+    for (xSize size = 17; size <= 1024; size = size * 2 + 3) {
+        for (xSize shift = 1; shift < 80; shift += 7) {
+            // move towards higher addresses
+            for (xSize i = 0; i < 2048; i++) {
+                buf11[i] = ref11[i] = (xUInt8)(i * 13 + size);
+            }
+            xMemMove(buf11 + 512 + shift, buf11 + 512, size);
+            for (xSize i = size; i > 0; i--) {
+                ref11[512 + shift + i - 1] = ref11[512 + i - 1];
+            }
+            for (xSize i = 0; i < 2048; i++) {
+                if (buf11[i] != ref11[i]) {
+                    movedAll = false;
+                }
+            }
+
+            // move towards lower addresses
+            for (xSize i = 0; i < 2048; i++) {
+                buf11[i] = ref11[i] = (xUInt8)(i * 17 + shift);
+            }
+            xMemMove(buf11 + 512 - shift, buf11 + 512, size);
+            for (xSize i = 0; i < size; i++) {
+                ref11[512 - shift + i] = ref11[512 + i];
+            }
+            for (xSize i = 0; i < 2048; i++) {
+                if (buf11[i] != ref11[i]) {
+                    movedAll = false;
+                }
+            }
+        }
+    }
+    CU_ASSERT_TRUE(movedAll);
+    free(buf11);
+    free(ref11);
 }
 
 void test_xMemSet(void)
@@ -228,38 +431,116 @@ void test_xMemSet(void)
     char dest8[14];
     xMemSet(dest8, 'A', 5);
     CU_ASSERT_TRUE(xMemCmp(dest8, "AAAAA", 5));
+
+    // Test case 9: Setting large blocks at different alignments without touching surrounding memory
+    xUInt8 *dest9 = (xUInt8 *)malloc(4096 + 64);
+    CU_ASSERT_TRUE_FATAL(dest9 != NULL);
+    xBool setAll = true;
+    for (xSize size = 1; size <= 4096; size = size * 3 + 2) {
+        for (xSize offset = 0; offset < 33; offset += 3) {
+            for (xSize i = 0; i < 4096 + 64; i++) {
+                dest9[i] = 0x5A;
+            }
+            xMemSet(dest9 + offset, 0xC3, size);
+            for (xSize i = 0; i < 4096 + 64; i++) {
+                if (dest9[i] != ((i >= offset && i < offset + size) ? 0xC3 : 0x5A)) {
+                    setAll = false;
+                }
+            }
+        }
+    }
+    CU_ASSERT_TRUE(setAll);
+    free(dest9);
 }
 
 void test_xMemHash(void)
 {
-    // TESTS ARE APPLICABLE FOR 64-BIT FNV-1A HASH FUNCTION ONLY
+    // TESTS ARE APPLICABLE FOR WYHASH-STYLE HASH FUNCTION WITH SECRETS DERIVED FROM SEED ONLY
     // ADAPT TESTS FOR OTHER HASH FUNCTIONS IF IMPLEMENTATION CHANGES
 
     // Test case 1: Hashing memory block with multiple characters
-    CU_ASSERT_EQUAL(xMemHash("Hello, World!", 13), 0x6EF05BD7CC857C54);
+    CU_ASSERT_EQUAL(xMemHash("Hello, World!", 13), 0xC7060B6CF961CCD1);
 
     // Test case 2: Hashing empty memory block
-    CU_ASSERT_EQUAL(xMemHash("", 0), 0xCBF29CE484222325);
+    CU_ASSERT_EQUAL(xMemHash("", 0), 0xEA42E9B78CF01D63);
 
     // Test case 3: Hashing memory block with single character
-    CU_ASSERT_EQUAL(xMemHash("A", 1), 0xAF63FC4C860222EC);
+    CU_ASSERT_EQUAL(xMemHash("A", 1), 0x37F679DEBFE59E1A);
 
     // Test case 4: Hashing memory block with special characters
-    CU_ASSERT_EQUAL(xMemHash("1234567890", 10), 0x63510217CACFB1A4);
+    CU_ASSERT_EQUAL(xMemHash("1234567890", 10), 0x05346FC34F63FCB4);
 
     // Test case 5: Hashing block of memory containing larger elements
     // note: on big-endian systems, hash will be different and thus test will fail
     xUInt32 src5[] = {0x12345678, 0x9ABCDEF0};
-    CU_ASSERT_EQUAL(xMemHash(src5, 2 * sizeof(xUInt32)), 0xFF670306131F3495);
+    CU_ASSERT_EQUAL(xMemHash(src5, 2 * sizeof(xUInt32)), 0x02D113A78EA1A952);
 
     // Test case 6: Hashing memory block with non-printable characters
-    CU_ASSERT_EQUAL(xMemHash("\x01\x52\x10", 3), 0xD1BA33186813D8FE);
+    CU_ASSERT_EQUAL(xMemHash("\x01\x52\x10", 3), 0x4B020A20B713325D);
 
     // Test case 7: Hashing memory block with NULL address
-    CU_ASSERT_EQUAL(xMemHash(NULL, 0), 0xcbf29ce484222325);
+    CU_ASSERT_EQUAL(xMemHash(NULL, 0), 0xEA42E9B78CF01D63);
+    CU_ASSERT_EQUAL(xMemHash(NULL, 13), 0);
 
     // Test case 8: Partial hashing of memory block
-    CU_ASSERT_EQUAL(xMemHash("Hello, World!", 5), 0x63F0BFACF2C00F6B);
+    CU_ASSERT_EQUAL(xMemHash("Hello, World!", 5), 0xCA6BD46997456C97);
+
+    // Test case 9: Reference vectors of seeded hash
+    CU_ASSERT_EQUAL(xMemHashSeeded("a", 1, 1), 0x3D1DDBA24476FCE4);
+    CU_ASSERT_EQUAL(xMemHashSeeded("abc", 3, 2), 0xB9DDD692B89CE53C);
+    CU_ASSERT_EQUAL(xMemHashSeeded("message digest", 14, 3), 0x89A279BEF9F051D3);
+    CU_ASSERT_EQUAL(xMemHashSeeded("abcdefghijklmnopqrstuvwxyz", 26, 4), 0x38D1455883826857);
+    CU_ASSERT_EQUAL(xMemHashSeeded("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", 62, 5), 0xFF8CC82AC56AE0F9);
+    CU_ASSERT_EQUAL(
+        xMemHashSeeded("12345678901234567890123456789012345678901234567890123456789012345678901234567890", 80, 6),
+        0xB0445C699E3386EF);
+
+    // Test case 10: Different seeds produce different hashes
+    CU_ASSERT_NOT_EQUAL(xMemHashSeeded("Hello, World!", 13, 1), xMemHashSeeded("Hello, World!", 13, 2));
+    CU_ASSERT_EQUAL(xMemHashSeeded("Hello, World!", 13, 0), xMemHash("Hello, World!", 13));
+
+    // Test case 11: 128-bit hash extends 64-bit one
+    xHash128 wide = xMemHash128("Hello, World!", 13, 0);
+    CU_ASSERT_EQUAL(wide.low, 0xC7060B6CF961CCD1);
+    CU_ASSERT_EQUAL(wide.high, 0xF7174E54C74255D4);
+
+    // Test case 12: Streaming hash matches one-shot hash regardless of how input is split
+    xUInt8 data[300];
+    for (xSize i = 0; i < sizeof(data); i++) {
+        data[i] = (xUInt8)(i * 131 + 7);
+    }
+    xBool streamMatches = true;
+    for (xSize size = 0; size <= sizeof(data); size += 7) {
+        for (xSize chunk = 1; chunk < 100; chunk += 9) {
+            xMemHashState state;
+            xMemHashInit(&state, 42);
+            for (xSize i = 0; i < size; i += chunk) {
+                xMemHashUpdate(&state, data + i, (size - i < chunk) ? size - i : chunk);
+            }
+            xHash128 oneShot = xMemHash128(data, size, 42);
+            xHash128 streamed = xMemHashFinal128(&state);
+            if (xMemHashFinal(&state) != xMemHashSeeded(data, size, 42) || streamed.low != oneShot.low ||
+                streamed.high != oneShot.high) {
+                streamMatches = false;
+            }
+        }
+    }
+    CU_ASSERT_TRUE(streamMatches);
+
+    // Test case 13: Input words equal to fixed constants do not make hash independent of other input or seed
+    xUInt8 first[64] = {0xDB, 0x28, 0xB4, 0xA0, 0xD1, 0x7E, 0x03, 0xE7, 0x01};
+    xUInt8 second[64] = {0xDB, 0x28, 0xB4, 0xA0, 0xD1, 0x7E, 0x03, 0xE7, 0x02};
+    xUInt8 key[16] = {0xD1, 0x7E, 0x03, 0xE7, 0, 0, 0, 0, 0xDB, 0x28, 0xB4, 0xA0};
+    xBool collides = false;
+    for (xUInt64 seed = 1; seed <= 100; seed++) {
+        xHash128 firstWide = xMemHash128(first, sizeof(first), seed);
+        xHash128 secondWide = xMemHash128(second, sizeof(second), seed);
+        if (firstWide.low == secondWide.low || firstWide.high == secondWide.high ||
+            xMemHashSeeded(key, sizeof(key), seed) == xMemHashSeeded(key, sizeof(key), seed + 1)) {
+            collides = true;
+        }
+    }
+    CU_ASSERT_FALSE(collides);
 }
 
 void test_xMemSwap(void)
@@ -314,7 +595,9 @@ int main(void)
     }
 
     // add the tests to the suite
-    if (CU_add_test(pSuite, "xMemCmp", test_xMemCmp) == NULL || CU_add_test(pSuite, "xMemCopy", test_xMemCopy) == NULL ||
+    if (CU_add_test(pSuite, "xMemCmp", test_xMemCmp) == NULL ||
+        CU_add_test(pSuite, "xMemCompare", test_xMemCompare) == NULL || CU_add_test(pSuite, "xMemFind", test_xMemFind) == NULL ||
+        CU_add_test(pSuite, "xMemCopy", test_xMemCopy) == NULL ||
         CU_add_test(pSuite, "xMemMove", test_xMemMove) == NULL || CU_add_test(pSuite, "xMemSet", test_xMemSet) == NULL ||
         CU_add_test(pSuite, "xMemHash", test_xMemHash) == NULL || CU_add_test(pSuite, "xMemSwap", test_xMemSwap) == NULL) {
         CU_cleanup_registry();
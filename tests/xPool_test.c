@@ -0,0 +1,284 @@
+/**
+ * @file xPool_test.c
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief CUnit test for xPool module.
+ * @version 0.1
+ * @date 18.10.2026.
+ */
+
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <CUnit/TestDB.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <stdint.h>
+#include "xBase/xMemtools.h"
+#include "xBase/xTypes.h"
+#include "xMemory/xAllocator.h"
+#include "xMemory/xPool.h"
+#include "xString/xString.h"
+#include "xStructures/xList.h"
+#include "xStructures/xQueue.h"
+
+void test_xPool_new(void)
+{
+    // Test case 1: Pool with default page size
+    xPool *pool = xPool_new(0, false);
+    CU_ASSERT_PTR_NOT_NULL(pool);
+    CU_ASSERT_EQUAL(xPool_getPageCount(pool), 0);
+    CU_ASSERT_PTR_NOT_NULL(xPool_getAllocator(pool));
+    xPool_free(pool);
+
+    // Test case 2: Pool with thread caches and page size too small for largest object
+    pool = xPool_new(64, true);
+    CU_ASSERT_PTR_NOT_NULL(pool);
+    void *obj = xPool_alloc(pool, XPOOL_MAX_OBJECT_SIZE);
+    CU_ASSERT_PTR_NOT_NULL(obj);
+    xPool_release(pool, obj, XPOOL_MAX_OBJECT_SIZE);
+    xPool_free(pool);
+
+    // Test case 3: Free NULL pool
+    xPool_free(NULL);  // should not crash
+    CU_ASSERT_PTR_NULL(xPool_getAllocator(NULL));
+    CU_ASSERT_EQUAL(xPool_getPageCount(NULL), 0);
+}
+
+void test_xPool_alloc(void)
+{
+    xPool *pool = xPool_new(4096, false);
+
+    // Test case 1: Objects are distinct, aligned and writable
+    xUInt8 *a = (xUInt8 *)xPool_alloc(pool, 24);
+    xUInt8 *b = (xUInt8 *)xPool_alloc(pool, 24);
+    CU_ASSERT_PTR_NOT_NULL(a);
+    CU_ASSERT_PTR_NOT_NULL(b);
+    CU_ASSERT_TRUE(a + 24 <= b || b + 24 <= a);
+    CU_ASSERT_EQUAL((uintptr_t)a % XPOOL_SIZE_CLASS_GRANULARITY, 0);
+    CU_ASSERT_EQUAL((uintptr_t)b % XPOOL_SIZE_CLASS_GRANULARITY, 0);
+    xMemSet(a, 0xAA, 24);
+    xMemSet(b, 0xBB, 24);
+    CU_ASSERT_EQUAL(a[23], 0xAA);
+    CU_ASSERT_EQUAL(xPool_getPageCount(pool), 1);
+
+    // Test case 2: Released object is reused by same size class
+    xPool_release(pool, a, 24);
+    CU_ASSERT_PTR_EQUAL(xPool_alloc(pool, 32), a);
+    CU_ASSERT_EQUAL(b[0], 0xBB);
+
+    // Test case 3: Different size classes get their own pages
+    void *c = xPool_alloc(pool, 100);
+    CU_ASSERT_PTR_NOT_NULL(c);
+    CU_ASSERT_EQUAL(xPool_getPageCount(pool), 2);
+
+    // Test case 4: Many objects span multiple pages
+    xBool valid = true;
+    for (xUInt32 i = 0; i < 1000; i++) {
+        xUInt32 *p = (xUInt32 *)xPool_alloc(pool, 16);
+        if (!p || (uintptr_t)p % XPOOL_SIZE_CLASS_GRANULARITY) {
+            valid = false;
+        } else {
+            *p = i;
+        }
+    }
+    CU_ASSERT_TRUE(valid);
+    CU_ASSERT_TRUE(xPool_getPageCount(pool) > 3);
+
+    // Test case 5: Large objects are forwarded to backing allocator
+    xSize pages = xPool_getPageCount(pool);
+    xUInt8 *large = (xUInt8 *)xPool_alloc(pool, 8192);
+    CU_ASSERT_PTR_NOT_NULL(large);
+    xMemSet(large, 0, 8192);
+    xPool_release(pool, large, 8192);
+    CU_ASSERT_EQUAL(xPool_getPageCount(pool), pages);
+
+    // Test case 6: Invalid arguments
+    CU_ASSERT_PTR_NULL(xPool_alloc(NULL, 16));
+    CU_ASSERT_PTR_NULL(xPool_alloc(pool, 0));
+    xPool_release(pool, NULL, 16);  // should not crash
+    xPool_release(NULL, b, 16);     // should not crash
+
+    xPool_free(pool);
+}
+
+void test_xPool_allocator(void)
+{
+    xPool *pool = xPool_new(0, false);
+    const xAllocator *allocator = xPool_getAllocator(pool);
+
+    // Test case 1: Reallocation inside size class keeps object in place
+    xUInt8 *obj = (xUInt8 *)xAllocator_alloc(allocator, 20);
+    xMemSet(obj, 0x5A, 20);
+    CU_ASSERT_PTR_EQUAL(xAllocator_realloc(allocator, obj, 20, 30), obj);
+
+    // Test case 2: Reallocation to other size class and to large object preserves data
+    obj = (xUInt8 *)xAllocator_realloc(allocator, obj, 30, 200);
+    CU_ASSERT_PTR_NOT_NULL(obj);
+    CU_ASSERT_TRUE(obj && obj[19] == 0x5A);
+    obj = (xUInt8 *)xAllocator_realloc(allocator, obj, 200, 4000);
+    CU_ASSERT_PTR_NOT_NULL(obj);
+    CU_ASSERT_TRUE(obj && obj[0] == 0x5A && obj[19] == 0x5A);
+    xAllocator_free(allocator, obj, 4000);
+
+    // Test case 3: List nodes churn without requesting new pages
+    xList *list = xList_newWithAllocator(sizeof(xUInt64), allocator);
+    for (xUInt64 i = 0; i < 100; i++) {
+        xList_pushBack(list, &i);
+    }
+    xSize pages = xPool_getPageCount(pool);
+    for (xUInt64 i = 0; i < 10000; i++) {
+        free(xList_popFront(list));
+        xList_pushBack(list, &i);
+    }
+    CU_ASSERT_EQUAL(xPool_getPageCount(pool), pages);
+    CU_ASSERT_EQUAL(xList_getSize(list), 100);
+    CU_ASSERT_EQUAL(*(xUInt64 *)xList_peekBack(list), 9999);
+    xList_free(list);
+
+    // Test case 4: String headers and their contents
+    xString *str = xString_newWithAllocator(allocator);
+    xString *hello = xString_append(str, "Hello, pool!", 12);
+    xString *copy = xString_copy(hello);
+    CU_ASSERT_EQUAL(xString_getLength(copy), 12);
+    CU_ASSERT_TRUE(xMemCmp(xString_getData(copy), "Hello, pool!", 12));
+    xString_free(copy);
+    xString_free(hello);
+    xString_free(str);
+
+    xPool_free(pool);
+}
+
+typedef struct WorkerArgs_s {
+    xPool *pool;
+    xUInt32 id;
+    xBool valid;
+} WorkerArgs;
+
+static void *poolWorker(void *arg)
+{
+    WorkerArgs *args = (WorkerArgs *)arg;
+    xUInt32 *objects[64];
+
+    args->valid = true;
+    for (xUInt32 round = 0; round < 500; round++) {
+        for (xUInt32 i = 0; i < 64; i++) {
+            objects[i] = (xUInt32 *)xPool_alloc(args->pool, 16 + (i % 4) * 16);
+            if (!objects[i]) {
+                args->valid = false;
+                return NULL;
+            }
+            objects[i][0] = args->id;
+            objects[i][1] = i;
+        }
+        for (xUInt32 i = 0; i < 64; i++) {
+            if (objects[i][0] != args->id || objects[i][1] != i) {
+                args->valid = false;
+            }
+            xPool_release(args->pool, objects[i], 16 + (i % 4) * 16);
+        }
+    }
+    xPool_flushThreadCache();
+
+    return NULL;
+}
+
+void test_xPool_threadCache(void)
+{
+    xPool *pool = xPool_new(0, true);
+
+    // Test case 1: Objects are not shared between threads using same pool
+    pthread_t threads[4];
+    WorkerArgs args[4];
+    for (xUInt32 i = 0; i < 4; i++) {
+        args[i].pool = pool;
+        args[i].id = i + 1;
+        pthread_create(&threads[i], NULL, poolWorker, &args[i]);
+    }
+    for (xUInt32 i = 0; i < 4; i++) {
+        pthread_join(threads[i], NULL);
+        CU_ASSERT_TRUE(args[i].valid);
+    }
+
+    // Test case 2: Objects flushed by workers are reused instead of requesting new pages
+    xSize pages = xPool_getPageCount(pool);
+    CU_ASSERT_TRUE(pages > 0);
+    void *objects[256];
+    for (xUInt32 i = 0; i < 256; i++) {
+        objects[i] = xPool_alloc(pool, 16);
+    }
+    CU_ASSERT_EQUAL(xPool_getPageCount(pool), pages);
+    for (xUInt32 i = 0; i < 256; i++) {
+        xPool_release(pool, objects[i], 16);
+    }
+
+    // Test case 3: Alternating between pools keeps objects cached for both of them
+    xPool *other = xPool_new(0, true);
+    void *obj = xPool_alloc(pool, 16);
+    xPool_release(pool, obj, 16);
+    void *otherObj = xPool_alloc(other, 16);
+    CU_ASSERT_PTR_NOT_NULL(otherObj);
+    xPool_release(other, otherObj, 16);
+    CU_ASSERT_PTR_EQUAL(xPool_alloc(pool, 16), obj);
+    CU_ASSERT_PTR_EQUAL(xPool_alloc(other, 16), otherObj);
+    xPool_release(pool, obj, 16);
+    xPool_release(other, otherObj, 16);
+
+    // Test case 4: Using more pools than thread cache slots evicts least recently used caches
+    xPool *extra[4];
+    for (xUInt32 i = 0; i < 4; i++) {
+        extra[i] = xPool_new(0, true);
+        xPool_release(extra[i], xPool_alloc(extra[i], 32), 32);
+    }
+    for (xUInt32 i = 0; i < 4; i++) {
+        xPool_free(extra[i]);
+    }
+    xPool_free(other);
+    obj = xPool_alloc(pool, 16);
+    CU_ASSERT_PTR_NOT_NULL(obj);
+    xPool_release(pool, obj, 16);
+
+    // Test case 5: Queue backed by pool with thread caches
+    xQueue *queue = xQueue_newWithAllocator(sizeof(xUInt32), xPool_getAllocator(pool));
+    for (xUInt32 i = 0; i < 1000; i++) {
+        xQueue_enqueue(queue, &i);
+    }
+    xUInt32 *front = (xUInt32 *)xQueue_dequeue(queue);
+    CU_ASSERT_TRUE(front && *front == 0);
+    free(front);
+    CU_ASSERT_EQUAL(xQueue_getSize(queue), 999);
+    xQueue_free(queue);
+
+    xPool_free(pool);
+}
+
+int main(void)
+{
+    CU_pSuite pSuite = NULL;
+
+    // initialize CUnit test registry
+    if (CU_initialize_registry() != CUE_SUCCESS) {
+        return CU_get_error();
+    }
+
+    // add a suite to the registry
+    pSuite = CU_add_suite("xPool_test", NULL, NULL);
+    if (pSuite == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // add the tests to the suite
+    if (CU_add_test(pSuite, "xPool_new", test_xPool_new) == NULL ||
+        CU_add_test(pSuite, "xPool_alloc", test_xPool_alloc) == NULL ||
+        CU_add_test(pSuite, "xPool_allocator", test_xPool_allocator) == NULL ||
+        CU_add_test(pSuite, "xPool_threadCache", test_xPool_threadCache) == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // run all tests using the CUnit Basic interface
+    CU_basic_set_mode(CU_BRM_VERBOSE);
+    CU_basic_run_tests();
+    CU_cleanup_registry();
+
+    return CU_get_error();
+}
@@ -204,6 +204,96 @@ void test_xQueue_copy(void)
     xQueue_free(queue);
 }
 
+void test_xQueue_ring(void)
+{
+    xQueue *queue = xQueue_new(sizeof(xUInt32));
+
+    // Test case 1: Default backend is ring buffer with power of 2 capacity
+    CU_ASSERT_EQUAL(xQueue_getBackend(queue), XQUEUE_BACKEND_RING);
+    CU_ASSERT_EQUAL(xQueue_getCapacity(queue), 0);
+    xUInt32 value = 0;
+    xQueue_enqueue(queue, &value);
+    xSize capacity = xQueue_getCapacity(queue);
+    CU_ASSERT_TRUE(capacity > 0 && (capacity & (capacity - 1)) == 0);
+
+    // Test case 2: Elements wrapped around end of buffer keep their order when buffer grows
+    xUInt32 next = 1, expected = 0;
+    xBool ordered = true;
+    for (xSize i = 0; i < capacity - 1; i++, next++) {
+        xQueue_enqueue(queue, &next);
+    }
+    for (xSize i = 0; i < capacity / 2; i++, expected++) {
+        ordered = (xQueue_dequeueInto(queue, &value) && value == expected) ? ordered : false;
+    }
+    for (xSize i = 0; i < capacity; i++, next++) {
+        xQueue_enqueue(queue, &next);
+    }
+    CU_ASSERT_TRUE(xQueue_getCapacity(queue) > capacity);
+    CU_ASSERT_EQUAL(xQueue_getSize(queue), next - expected);
+    CU_ASSERT_EQUAL(*(const xUInt32 *)xQueue_peek(queue), expected);
+
+    // Test case 3: Copy of wrapped queue
+    xQueue *copy = xQueue_copy(queue);
+    CU_ASSERT_EQUAL(xQueue_getSize(copy), xQueue_getSize(queue));
+    for (xUInt32 i = expected; i < next; i++) {
+        ordered = (xQueue_dequeueInto(copy, &value) && value == i) ? ordered : false;
+    }
+    CU_ASSERT_EQUAL(xQueue_getSize(copy), 0);
+    xQueue_free(copy);
+
+    // Test case 4: Long run of interleaved enqueue and dequeue keeps capacity bounded
+    capacity = xQueue_getCapacity(queue);
+    for (xSize i = 0; i < 100000; i++, next++, expected++) {
+        xQueue_enqueue(queue, &next);
+        ordered = (xQueue_dequeueInto(queue, &value) && value == expected) ? ordered : false;
+    }
+    CU_ASSERT_TRUE(ordered);
+    CU_ASSERT_EQUAL(xQueue_getCapacity(queue), capacity);
+
+    // Test case 5: Dequeue into from empty or NULL queue
+    xQueue_clear(queue);
+    CU_ASSERT_FALSE(xQueue_dequeueInto(queue, &value));
+    CU_ASSERT_FALSE(xQueue_dequeueInto(NULL, &value));
+    CU_ASSERT_FALSE(xQueue_dequeueInto(queue, NULL));
+
+    // Cleanup
+    xQueue_free(queue);
+}
+
+void test_xQueue_backend(void)
+{
+    xQueue *queue = xQueue_newWithBackend(sizeof(xUInt32), XQUEUE_BACKEND_LIST, NULL);
+    xUInt32 values[] = {1, 2, 3, 4, 5};
+
+    // Test case 1: List backend
+    CU_ASSERT_PTR_NOT_NULL(queue);
+    CU_ASSERT_EQUAL(xQueue_getBackend(queue), XQUEUE_BACKEND_LIST);
+    for (xSize i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        xQueue_enqueue(queue, &values[i]);
+    }
+    CU_ASSERT_EQUAL(xQueue_getSize(queue), 5);
+    CU_ASSERT_EQUAL(*(const xUInt32 *)xQueue_peek(queue), 1);
+    xUInt32 value = 0;
+    CU_ASSERT_TRUE(xQueue_dequeueInto(queue, &value));
+    CU_ASSERT_EQUAL(value, 1);
+    xUInt32 *front = (xUInt32 *)xQueue_dequeue(queue);
+    CU_ASSERT_TRUE(front && *front == 2);
+    free(front);
+
+    // Test case 2: Copy keeps backend
+    xQueue *copy = xQueue_copy(queue);
+    CU_ASSERT_EQUAL(xQueue_getBackend(copy), XQUEUE_BACKEND_LIST);
+    CU_ASSERT_EQUAL(xQueue_getSize(copy), 3);
+    xQueue_free(copy);
+
+    // Test case 3: Invalid backend
+    CU_ASSERT_PTR_NULL(xQueue_newWithBackend(sizeof(xUInt32), (xQueueBackend)42, NULL));
+    CU_ASSERT_PTR_NULL(xQueue_newWithBackend(0, XQUEUE_BACKEND_LIST, NULL));
+
+    // Cleanup
+    xQueue_free(queue);
+}
+
 int main(void)
 {
     CU_pSuite pSuite = NULL;
@@ -228,7 +318,9 @@ int main(void)
         CU_add_test(pSuite, "test_xQueue_dequeue", test_xQueue_dequeue) == NULL ||
         CU_add_test(pSuite, "test_xQueue_peek", test_xQueue_peek) == NULL ||
         CU_add_test(pSuite, "test_xQueue_clear", test_xQueue_clear) == NULL ||
-        CU_add_test(pSuite, "test_xQueue_copy", test_xQueue_copy) == NULL) {
+        CU_add_test(pSuite, "test_xQueue_copy", test_xQueue_copy) == NULL ||
+        CU_add_test(pSuite, "test_xQueue_ring", test_xQueue_ring) == NULL ||
+        CU_add_test(pSuite, "test_xQueue_backend", test_xQueue_backend) == NULL) {
         CU_cleanup_registry();
         return CU_get_error();
     }
@@ -0,0 +1,260 @@
+/**
+ * @file xSparseMatrix_test.c
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief CUnit test for xSparseMatrix module.
+ * @version 0.1
+ * @date 18.10.2026.
+ */
+
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <CUnit/TestDB.h>
+#include <malloc.h>
+#include <math.h>
+#include "xBase/xTypes.h"
+#include "xLinear/xMatrix.h"
+#include "xLinear/xSparseMatrix.h"
+#include "xThread/xThreadPool.h"
+
+// dense matrix with about one element in `sparsity` non-zero, at pseudo-random positions
+static xMatrix *randomSparse(xSize rows, xSize cols, xUInt32 seed, xUInt32 sparsity)
+{
+    xMatrix *mat = xMatrix_new(rows, cols);
+    for (xSize i = 0; i < rows; i++) {
+        for (xSize j = 0; j < cols; j++) {
+            seed = seed * 1664525u + 1013904223u;
+            if ((seed >> 8) % sparsity == 0) {
+                xMatrix_set(mat, i, j, (float)((seed >> 12) % 17) - 8.0f);
+            }
+        }
+    }
+    return mat;
+}
+
+static xBool matricesEqual(const xMatrix *lhs, const xMatrix *rhs, float tolerance)
+{
+    if (xMatrix_getRows(lhs) != xMatrix_getRows(rhs) || xMatrix_getCols(lhs) != xMatrix_getCols(rhs)) {
+        return false;
+    }
+    for (xSize i = 0; i < xMatrix_getRows(lhs); i++) {
+        for (xSize j = 0; j < xMatrix_getCols(lhs); j++) {
+            if (fabsf(xMatrix_get(lhs, i, j) - xMatrix_get(rhs, i, j)) > tolerance) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void test_xSparseMatrix_new(void)
+{
+    // Test case 1: Unordered COO triplets with duplicates
+    xSize rowIndices[6] = {2, 0, 1, 2, 0, 2};
+    xSize colIndices[6] = {1, 3, 0, 1, 0, 0};
+    float values[6] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+    xSparseMatrix *csr = xSparseMatrix_newFromCOO(3, 4, 6, rowIndices, colIndices, values, XSPARSEMATRIX_CSR);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(csr);
+    CU_ASSERT_EQUAL(xSparseMatrix_getRows(csr), 3);
+    CU_ASSERT_EQUAL(xSparseMatrix_getCols(csr), 4);
+    CU_ASSERT_EQUAL(xSparseMatrix_getNonZeroCount(csr), 5);
+    CU_ASSERT_EQUAL(xSparseMatrix_getFormat(csr), XSPARSEMATRIX_CSR);
+    CU_ASSERT_EQUAL(xSparseMatrix_get(csr, 2, 1), 5.0f);
+    CU_ASSERT_EQUAL(xSparseMatrix_get(csr, 0, 3), 2.0f);
+    CU_ASSERT_EQUAL(xSparseMatrix_get(csr, 1, 1), 0.0f);
+    const xSize *pointers = xSparseMatrix_getPointers(csr);
+    const xSize *indices = xSparseMatrix_getIndices(csr);
+    CU_ASSERT_TRUE(pointers[0] == 0 && pointers[1] == 2 && pointers[2] == 3 && pointers[3] == 5);
+    CU_ASSERT_TRUE(indices[0] == 0 && indices[1] == 3 && indices[3] == 0 && indices[4] == 1);
+    CU_ASSERT_EQUAL(xSparseMatrix_getValues(csr)[4], 5.0f);
+
+    // Test case 2: Same triplets in CSC format
+    xSparseMatrix *csc = xSparseMatrix_newFromCOO(3, 4, 6, rowIndices, colIndices, values, XSPARSEMATRIX_CSC);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(csc);
+    pointers = xSparseMatrix_getPointers(csc);
+    CU_ASSERT_TRUE(pointers[0] == 0 && pointers[1] == 3 && pointers[2] == 4 && pointers[3] == 4 && pointers[4] == 5);
+    CU_ASSERT_EQUAL(xSparseMatrix_get(csc, 2, 0), 6.0f);
+    CU_ASSERT_EQUAL(xSparseMatrix_get(csc, 2, 1), 5.0f);
+
+    // Test case 3: Compressed arrays are validated and copied
+    xSize csrPointers[4] = {0, 2, 3, 5};
+    xSize csrIndices[5] = {0, 3, 0, 0, 1};
+    float csrValues[5] = {5.0f, 2.0f, 3.0f, 6.0f, 5.0f};
+    xSparseMatrix *copy = xSparseMatrix_newFromCompressed(3, 4, csrPointers, csrIndices, csrValues, XSPARSEMATRIX_CSR);
+    xMatrix *dense = xSparseMatrix_toDense(csr);
+    xMatrix *copyDense = xSparseMatrix_toDense(copy);
+    CU_ASSERT_TRUE(matricesEqual(dense, copyDense, 0.0f));
+    csrIndices[1] = 0;  // not ascending within row
+    CU_ASSERT_PTR_NULL(xSparseMatrix_newFromCompressed(3, 4, csrPointers, csrIndices, csrValues, XSPARSEMATRIX_CSR));
+    csrIndices[1] = 4;  // out of range
+    CU_ASSERT_PTR_NULL(xSparseMatrix_newFromCompressed(3, 4, csrPointers, csrIndices, csrValues, XSPARSEMATRIX_CSR));
+
+    // Test case 4: Invalid triplets
+    rowIndices[0] = 3;
+    CU_ASSERT_PTR_NULL(xSparseMatrix_newFromCOO(3, 4, 6, rowIndices, colIndices, values, XSPARSEMATRIX_CSR));
+    CU_ASSERT_PTR_NULL(xSparseMatrix_newFromCOO(0, 4, 0, NULL, NULL, NULL, XSPARSEMATRIX_CSR));
+    xSparseMatrix *empty = xSparseMatrix_newFromCOO(3, 4, 0, NULL, NULL, NULL, XSPARSEMATRIX_CSR);
+    CU_ASSERT_EQUAL(xSparseMatrix_getNonZeroCount(empty), 0);
+    CU_ASSERT_EQUAL(xSparseMatrix_get(empty, 2, 3), 0.0f);
+    CU_ASSERT_EQUAL(xSparseMatrix_get(NULL, 0, 0), 0.0f);
+
+    xSparseMatrix_free(csr);
+    xSparseMatrix_free(csc);
+    xSparseMatrix_free(copy);
+    xSparseMatrix_free(empty);
+    xMatrix_free(dense);
+    xMatrix_free(copyDense);
+}
+
+void test_xSparseMatrix_convert(void)
+{
+    // Test case 1: Dense to sparse and back in both formats
+    xMatrix *dense = randomSparse(70, 90, 1, 10);
+    xSparseMatrix *csr = xSparseMatrix_newFromDense(dense, XSPARSEMATRIX_CSR);
+    xSparseMatrix *csc = xSparseMatrix_newFromDense(dense, XSPARSEMATRIX_CSC);
+    xMatrix *fromCSR = xSparseMatrix_toDense(csr);
+    xMatrix *fromCSC = xSparseMatrix_toDense(csc);
+    CU_ASSERT_TRUE(matricesEqual(dense, fromCSR, 0.0f));
+    CU_ASSERT_TRUE(matricesEqual(dense, fromCSC, 0.0f));
+    CU_ASSERT_EQUAL(xSparseMatrix_getNonZeroCount(csr), xSparseMatrix_getNonZeroCount(csc));
+    CU_ASSERT_TRUE(xSparseMatrix_getNonZeroCount(csr) < 70 * 90 / 5);
+
+    // Test case 2: Conversion between formats matches direct construction
+    xSparseMatrix *converted = xSparseMatrix_convert(csr, XSPARSEMATRIX_CSC);
+    xSize nnz = xSparseMatrix_getNonZeroCount(csc);
+    xBool same = true;
+    for (xSize k = 0; k < nnz; k++) {
+        same = (xSparseMatrix_getIndices(converted)[k] == xSparseMatrix_getIndices(csc)[k] &&
+                xSparseMatrix_getValues(converted)[k] == xSparseMatrix_getValues(csc)[k])
+                   ? same
+                   : false;
+    }
+    for (xSize j = 0; j <= 90; j++) {
+        same = (xSparseMatrix_getPointers(converted)[j] == xSparseMatrix_getPointers(csc)[j]) ? same : false;
+    }
+    CU_ASSERT_TRUE(same);
+    xSparseMatrix *back = xSparseMatrix_convert(converted, XSPARSEMATRIX_CSR);
+    xMatrix *backDense = xSparseMatrix_toDense(back);
+    CU_ASSERT_TRUE(matricesEqual(dense, backDense, 0.0f));
+
+    // Test case 3: Transpose
+    xSparseMatrix *transposed = xSparseMatrix_transpose(csr);
+    xMatrix *transposedDense = xSparseMatrix_toDense(transposed);
+    xMatrix *expected = xMatrix_transpose(dense);
+    CU_ASSERT_EQUAL(xSparseMatrix_getFormat(transposed), XSPARSEMATRIX_CSC);
+    CU_ASSERT_EQUAL(xSparseMatrix_getRows(transposed), 90);
+    CU_ASSERT_TRUE(matricesEqual(expected, transposedDense, 0.0f));
+    CU_ASSERT_PTR_NULL(xSparseMatrix_convert(NULL, XSPARSEMATRIX_CSR));
+
+    xSparseMatrix_free(csr);
+    xSparseMatrix_free(csc);
+    xSparseMatrix_free(converted);
+    xSparseMatrix_free(back);
+    xSparseMatrix_free(transposed);
+    xMatrix_free(dense);
+    xMatrix_free(fromCSR);
+    xMatrix_free(fromCSC);
+    xMatrix_free(backDense);
+    xMatrix_free(transposedDense);
+    xMatrix_free(expected);
+}
+
+// compare sparse products of both formats with dense product
+static void checkProducts(xSize rows, xSize inner, xSize width, xUInt32 sparsity)
+{
+    xMatrix *dense = randomSparse(rows, inner, 7, sparsity);
+    for (xSize j = 0; j < inner; j++) {
+        xMatrix_set(dense, 0, j, 1.0f);  // dense first row (like hub vertex of graph)
+    }
+    xMatrix *rhs = randomSparse(inner, width, 8, 1);
+    xMatrix *expected = xMatrix_mul(dense, rhs);
+    xSparseMatrix *csr = xSparseMatrix_newFromDense(dense, XSPARSEMATRIX_CSR);
+    xSparseMatrix *csc = xSparseMatrix_newFromDense(dense, XSPARSEMATRIX_CSC);
+
+    // matrix products (integer-valued elements make all products exact)
+    xMatrix *byCSR = xSparseMatrix_mul(csr, rhs);
+    xMatrix *byCSC = xSparseMatrix_mul(csc, rhs);
+    CU_ASSERT_TRUE(matricesEqual(expected, byCSR, 0.0f));
+    CU_ASSERT_TRUE(matricesEqual(expected, byCSC, 0.0f));
+
+    // vector products with first column of dense operand
+    xMatrix *rhsTransposed = xMatrix_transpose(rhs);
+    float *x = xMatrix_flatten(rhsTransposed);
+    float yCSR[1024];
+    float yCSC[1024];
+    CU_ASSERT_TRUE(xSparseMatrix_mulVector(csr, x, yCSR));
+    CU_ASSERT_TRUE(xSparseMatrix_mulVector(csc, x, yCSC));
+    xBool same = true;
+    for (xSize i = 0; i < rows; i++) {
+        same = (yCSR[i] == xMatrix_get(expected, i, 0) && yCSC[i] == xMatrix_get(expected, i, 0)) ? same : false;
+    }
+    CU_ASSERT_TRUE(same);
+
+    free(x);
+    xMatrix_free(rhsTransposed);
+    xMatrix_free(dense);
+    xMatrix_free(rhs);
+    xMatrix_free(expected);
+    xMatrix_free(byCSR);
+    xMatrix_free(byCSC);
+    xSparseMatrix_free(csr);
+    xSparseMatrix_free(csc);
+}
+
+void test_xSparseMatrix_mul(void)
+{
+    // Test case 1: Small products computed on calling thread
+    checkProducts(30, 40, 5, 4);
+    checkProducts(1, 50, 1, 2);
+
+    // Test case 2: Large products split between threads
+    xThreadPool_setSharedThreadCount(4);
+    checkProducts(1024, 900, 150, 20);
+    checkProducts(600, 1000, 3, 3);
+    checkProducts(1000, 400, 1, 4);
+    xThreadPool_setSharedThreadCount(1);
+
+    // Test case 3: Incompatible and aliasing operands
+    xMatrix *dense = randomSparse(20, 20, 9, 3);
+    xSparseMatrix *csr = xSparseMatrix_newFromDense(dense, XSPARSEMATRIX_CSR);
+    xMatrix *wrong = xMatrix_new(19, 4);
+    CU_ASSERT_PTR_NULL(xSparseMatrix_mul(csr, wrong));
+    CU_ASSERT_PTR_NULL(xSparseMatrix_mul_inplace(dense, csr, dense));
+    CU_ASSERT_FALSE(xSparseMatrix_mulVector(csr, NULL, NULL));
+    CU_ASSERT_PTR_NULL(xSparseMatrix_mul(NULL, dense));
+
+    xMatrix_free(dense);
+    xMatrix_free(wrong);
+    xSparseMatrix_free(csr);
+}
+
+int main(void)
+{
+    CU_pSuite pSuite = NULL;
+
+    // initialize CUnit test registry
+    if (CU_initialize_registry() != CUE_SUCCESS) {
+        return CU_get_error();
+    }
+
+    // add a suite to the registry
+    pSuite = CU_add_suite("xSparseMatrix_test", NULL, NULL);
+    if (pSuite == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // add the tests to the suite
+    if (CU_add_test(pSuite, "xSparseMatrix_new", test_xSparseMatrix_new) == NULL ||
+        CU_add_test(pSuite, "xSparseMatrix_convert", test_xSparseMatrix_convert) == NULL ||
+        CU_add_test(pSuite, "xSparseMatrix_mul", test_xSparseMatrix_mul) == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // run all tests using the CUnit Basic interface
+    CU_basic_set_mode(CU_BRM_VERBOSE);
+    CU_basic_run_tests();
+    CU_cleanup_registry();
+
+    return CU_get_error();
+}
@@ -0,0 +1,183 @@
+/**
+ * @file xStringMatcher_test.c
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief CUnit test for xStringMatcher module.
+ * @version 0.1
+ * @date 18.10.2026.
+ */
+
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <CUnit/TestDB.h>
+#include <malloc.h>
+#include "xBase/xMemtools.h"
+#include "xBase/xTypes.h"
+#include "xString/xString.h"
+#include "xString/xStringMatcher.h"
+
+// matches collected by scan callback
+typedef struct {
+    xStringMatch matches[64];
+    xSize count;
+    xSize limit;
+} MatchList;
+
+static xBool collectMatch(void *context, const xStringMatch *match)
+{
+    MatchList *list = (MatchList *)context;
+    if (list->count < 64) {
+        list->matches[list->count] = *match;
+    }
+    list->count++;
+    return list->count < list->limit;
+}
+
+void test_xStringMatcher_new(void)
+{
+    const xChar *patterns[3] = {"he", "she", "his"};
+    xSize lengths[3] = {2, 3, 3};
+
+    // Test case 1: Automaton has one state per distinct prefix
+    xStringMatcher *matcher = xStringMatcher_new(patterns, lengths, 3);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(matcher);
+    CU_ASSERT_EQUAL(xStringMatcher_getPatternCount(matcher), 3);
+    CU_ASSERT_EQUAL(xStringMatcher_getStateCount(matcher), 8);
+    xStringMatcher_free(matcher);
+
+    // Test case 2: Invalid arguments and empty patterns are rejected
+    const xChar *invalid[2] = {"a", NULL};
+    xSize invalidLengths[2] = {1, 1};
+    xSize emptyLengths[2] = {1, 0};
+    CU_ASSERT_PTR_NULL(xStringMatcher_new(NULL, lengths, 3));
+    CU_ASSERT_PTR_NULL(xStringMatcher_new(patterns, NULL, 3));
+    CU_ASSERT_PTR_NULL(xStringMatcher_new(patterns, lengths, 0));
+    CU_ASSERT_PTR_NULL(xStringMatcher_new(invalid, invalidLengths, 2));
+    CU_ASSERT_PTR_NULL(xStringMatcher_new(patterns, emptyLengths, 2));
+
+    // Test case 3: NULL matcher is handled by all functions
+    CU_ASSERT_EQUAL(xStringMatcher_getPatternCount(NULL), 0);
+    CU_ASSERT_EQUAL(xStringMatcher_countIn(NULL, "abc", 3), 0);
+    CU_ASSERT_FALSE(xStringMatcher_findFirstIn(NULL, "abc", 3, NULL));
+    xStringMatcher_free(NULL);
+}
+
+void test_xStringMatcher_scan(void)
+{
+    const xChar *patterns[5] = {"he", "she", "his", "hers", "he"};
+    xSize lengths[5] = {2, 3, 3, 4, 2};
+    xStringMatcher *matcher = xStringMatcher_new(patterns, lengths, 5);
+    xString *str = xString_fromCStringS("ushers this", 11);
+
+    // Test case 1: All overlapping matches are reported by end index, longest first
+    MatchList list = {.count = 0, .limit = 100};
+    CU_ASSERT_EQUAL(xStringMatcher_scan(matcher, str, collectMatch, &list), 5);
+    CU_ASSERT_EQUAL_FATAL(list.count, 5);
+    xSize expected[5][3] = {{1, 1, 4}, {0, 2, 4}, {4, 2, 4}, {3, 2, 6}, {2, 8, 11}};
+    for (xSize i = 0; i < 5; i++) {
+        CU_ASSERT_EQUAL(list.matches[i].pattern, expected[i][0]);
+        CU_ASSERT_EQUAL(list.matches[i].start, expected[i][1]);
+        CU_ASSERT_EQUAL(list.matches[i].end, expected[i][2]);
+    }
+
+    // Test case 2: Callback stops scanning
+    list.count = 0;
+    list.limit = 2;
+    CU_ASSERT_EQUAL(xStringMatcher_scan(matcher, str, collectMatch, &list), 2);
+
+    // Test case 3: Counting and first match
+    CU_ASSERT_EQUAL(xStringMatcher_count(matcher, str), 5);
+    xStringMatch match;
+    CU_ASSERT_TRUE(xStringMatcher_findFirst(matcher, str, &match));
+    CU_ASSERT_EQUAL(match.pattern, 1);
+    CU_ASSERT_EQUAL(match.start, 1);
+    CU_ASSERT_TRUE(xStringMatcher_findFirstIn(matcher, "aahis", 5, &match));
+    CU_ASSERT_EQUAL(match.pattern, 2);
+    CU_ASSERT_EQUAL(match.start, 2);
+    CU_ASSERT_FALSE(xStringMatcher_findFirstIn(matcher, "no match", 8, &match));
+    CU_ASSERT_EQUAL(xStringMatcher_countIn(matcher, "", 0), 0);
+
+    xString_free(str);
+    xStringMatcher_free(matcher);
+}
+
+void test_xStringMatcher_keywords(void)
+{
+    // generate keywords and text over small alphabet, so keywords often overlap and share prefixes and suffixes
+    static xChar words[300][8];
+    const xChar *patterns[300];
+    xSize lengths[300];
+    static xChar text[5000];
+    xUInt32 seed = 777;
+    for (xSize p = 0; p < 300; p++) {
+        lengths[p] = 1 + p % 6;
+        for (xSize i = 0; i < lengths[p]; i++) {
+            seed = seed * 1103515245U + 12345U;
+            words[p][i] = (xChar)('a' + (seed >> 16) % 4);
+        }
+        patterns[p] = words[p];
+    }
+    for (xSize i = 0; i < sizeof(text); i++) {
+        seed = seed * 1103515245U + 12345U;
+        text[i] = (xChar)('a' + (seed >> 16) % 5);
+    }
+    xStringMatcher *matcher = xStringMatcher_new(patterns, lengths, 300);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(matcher);
+
+    // Test case 1: Number of matches equals sum of overlapping counts of all keywords
+    xString *str = xString_fromCStringS(text, sizeof(text));
+    xSize expected = 0;
+    for (xSize p = 0; p < 300; p++) {
+        expected += xString_count_overlapping(str, patterns[p], lengths[p]);
+    }
+    CU_ASSERT_EQUAL(xStringMatcher_count(matcher, str), expected);
+    MatchList list = {.count = 0, .limit = XSIZE_MAX};
+    CU_ASSERT_EQUAL(xStringMatcher_scan(matcher, str, collectMatch, &list), expected);
+
+    // Test case 2: First match ends where earliest keyword occurrence ends
+    xSize firstEnd = XSIZE_MAX;
+    for (xSize p = 0; p < 300; p++) {
+        xSize index = xString_find(str, patterns[p], lengths[p]);
+        if (index != XSIZE_MAX && index + lengths[p] < firstEnd) {
+            firstEnd = index + lengths[p];
+        }
+    }
+    xStringMatch match;
+    CU_ASSERT_TRUE(xStringMatcher_findFirst(matcher, str, &match));
+    CU_ASSERT_EQUAL(match.end, firstEnd);
+    CU_ASSERT_TRUE(xMemCmp(text + match.start, patterns[match.pattern], lengths[match.pattern]));
+
+    xString_free(str);
+    xStringMatcher_free(matcher);
+}
+
+int main(void)
+{
+    CU_pSuite pSuite = NULL;
+
+    // initialize CUnit test registry
+    if (CU_initialize_registry() != CUE_SUCCESS) {
+        return CU_get_error();
+    }
+
+    // add a suite to the registry
+    pSuite = CU_add_suite("xStringMatcher_test", NULL, NULL);
+    if (pSuite == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // add the tests to the suite
+    if (CU_add_test(pSuite, "xStringMatcher_new", test_xStringMatcher_new) == NULL ||
+        CU_add_test(pSuite, "xStringMatcher_scan", test_xStringMatcher_scan) == NULL ||
+        CU_add_test(pSuite, "xStringMatcher_keywords", test_xStringMatcher_keywords) == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // run all tests using the CUnit Basic interface
+    CU_basic_set_mode(CU_BRM_VERBOSE);
+    CU_basic_run_tests();
+    CU_cleanup_registry();
+
+    return CU_get_error();
+}
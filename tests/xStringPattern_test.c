@@ -0,0 +1,163 @@
+/**
+ * @file xStringPattern_test.c
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief CUnit test for xStringPattern module.
+ * @version 0.1
+ * @date 18.10.2026.
+ */
+
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <CUnit/TestDB.h>
+#include <malloc.h>
+#include "xBase/xMemtools.h"
+#include "xBase/xTypes.h"
+#include "xString/xString.h"
+#include "xString/xStringPattern.h"
+
+void test_xStringPattern_new(void)
+{
+    // Test case 1: Pattern holds copy of needle
+    xChar needle[6] = "error";
+    xStringPattern *pattern = xStringPattern_new(needle, 5);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(pattern);
+    needle[0] = 'E';
+    CU_ASSERT_EQUAL(xStringPattern_getLength(pattern), 5);
+    CU_ASSERT_TRUE(xMemCmp(xStringPattern_getData(pattern), "error", 5));
+    xStringPattern_free(pattern);
+
+    // Test case 2: Empty needle is allowed, NULL needle is not
+    pattern = xStringPattern_new("", 0);
+    CU_ASSERT_PTR_NOT_NULL(pattern);
+    CU_ASSERT_EQUAL(xStringPattern_getLength(pattern), 0);
+    xStringPattern_free(pattern);
+    CU_ASSERT_PTR_NULL(xStringPattern_new(NULL, 3));
+
+    // Test case 3: NULL pattern is handled by all functions
+    CU_ASSERT_EQUAL(xStringPattern_getLength(NULL), 0);
+    CU_ASSERT_PTR_NULL(xStringPattern_getData(NULL));
+    CU_ASSERT_EQUAL(xStringPattern_findIn(NULL, "abc", 3), XSIZE_MAX);
+    CU_ASSERT_EQUAL(xStringPattern_count(NULL, NULL), 0);
+    xStringPattern_free(NULL);
+}
+
+void test_xStringPattern_find(void)
+{
+    xString *str = xString_fromCStringS("GET /index 200; GET /error 500; POST /error 500", 47);
+    xStringPattern *pattern = xStringPattern_new("/error", 6);
+
+    // Test case 1: First, next and last occurrence
+    CU_ASSERT_EQUAL(xStringPattern_find(pattern, str), 20);
+    CU_ASSERT_EQUAL(xStringPattern_findFrom(pattern, str, 21), 37);
+    CU_ASSERT_EQUAL(xStringPattern_findFrom(pattern, str, 38), XSIZE_MAX);
+    CU_ASSERT_EQUAL(xStringPattern_findLast(pattern, str), 37);
+
+    // Test case 2: Counting occurrences
+    CU_ASSERT_EQUAL(xStringPattern_count(pattern, str), 2);
+    xStringPattern_free(pattern);
+    pattern = xStringPattern_new("aba", 3);
+    xString *periodic = xString_fromCStringS("abababababababa", 15);
+    CU_ASSERT_EQUAL(xStringPattern_count(pattern, periodic), 4);
+    CU_ASSERT_EQUAL(xStringPattern_count_overlapping(pattern, periodic), 7);
+    xString_free(periodic);
+    xStringPattern_free(pattern);
+
+    // Test case 3: Searching raw buffers line by line
+    const xChar *lines[3] = {"ok", "status 500 here", "500"};
+    pattern = xStringPattern_new("500", 3);
+    CU_ASSERT_EQUAL(xStringPattern_findIn(pattern, lines[0], 2), XSIZE_MAX);
+    CU_ASSERT_EQUAL(xStringPattern_findIn(pattern, lines[1], 15), 7);
+    CU_ASSERT_EQUAL(xStringPattern_findIn(pattern, lines[2], 3), 0);
+    xStringPattern_free(pattern);
+
+    // Test case 4: Results match xString functions for every needle taken from the string
+    xBool allMatch = true;
+    xSize length = xString_getLength(str);
+    for (xSize start = 0; start < length; start += 3) {
+        for (xSize len = 1; start + len <= length && len <= 12; len++) {
+            const xChar *needle = xString_getData(str) + start;
+            pattern = xStringPattern_new(needle, len);
+            if (xStringPattern_find(pattern, str) != xString_find(str, needle, len) ||
+                xStringPattern_findLast(pattern, str) != xString_findLast(str, needle, len) ||
+                xStringPattern_count(pattern, str) != xString_count(str, needle, len)) {
+                allMatch = false;
+            }
+            xStringPattern_free(pattern);
+        }
+    }
+    CU_ASSERT_TRUE(allMatch);
+
+    // Test case 5: Empty needle and needle longer than string
+    pattern = xStringPattern_new("", 0);
+    CU_ASSERT_EQUAL(xStringPattern_find(pattern, str), 0);
+    CU_ASSERT_EQUAL(xStringPattern_findLast(pattern, str), length - 1);
+    CU_ASSERT_EQUAL(xStringPattern_count(pattern, str), 0);
+    xStringPattern_free(pattern);
+    xString *shortStr = xString_fromCStringS("GET", 3);
+    pattern = xStringPattern_new("GET /", 5);
+    CU_ASSERT_EQUAL(xStringPattern_find(pattern, shortStr), XSIZE_MAX);
+    CU_ASSERT_EQUAL(xStringPattern_findLast(pattern, shortStr), XSIZE_MAX);
+    xStringPattern_free(pattern);
+    xString_free(shortStr);
+    xString_free(str);
+}
+
+void test_xMemFinder(void)
+{
+    // Test case 1: Rare bytes are preferred for candidate filter
+    xMemFinder finder;
+    xMemFinderInit(&finder, "the #quick fox", 14);
+    CU_ASSERT_EQUAL(finder.rare[0], 4);
+    CU_ASSERT_NOT_EQUAL(finder.rare[1], 4);
+
+    // Test case 2: Periodic adversarial input is searched in linear time with correct result
+    static xChar block[50000];
+    xChar needle[200];
+    xMemSet(block, 'a', sizeof(block));
+    xMemSet(needle, 'a', sizeof(needle));
+    needle[0] = 'b';
+    xMemFinderInit(&finder, needle, sizeof(needle));
+    CU_ASSERT_EQUAL(xMemFinderFind(&finder, block, sizeof(block)), XSIZE_MAX);
+    CU_ASSERT_EQUAL(xMemFinderFindLast(&finder, block, sizeof(block)), XSIZE_MAX);
+    block[40000] = 'b';
+    CU_ASSERT_EQUAL(xMemFinderFind(&finder, block, sizeof(block)), 40000);
+    CU_ASSERT_EQUAL(xMemFinderFindLast(&finder, block, sizeof(block)), 40000);
+    CU_ASSERT_EQUAL(xMemFinderCount(&finder, block, sizeof(block), true), 1);
+
+    // Test case 3: Invalid finder never matches
+    xMemFinderInit(&finder, NULL, 3);
+    CU_ASSERT_EQUAL(xMemFinderFind(&finder, block, sizeof(block)), XSIZE_MAX);
+    CU_ASSERT_EQUAL(xMemFinderCount(&finder, block, sizeof(block), false), 0);
+}
+
+int main(void)
+{
+    CU_pSuite pSuite = NULL;
+
+    // initialize CUnit test registry
+    if (CU_initialize_registry() != CUE_SUCCESS) {
+        return CU_get_error();
+    }
+
+    // add a suite to the registry
+    pSuite = CU_add_suite("xStringPattern_test", NULL, NULL);
+    if (pSuite == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // add the tests to the suite
+    if (CU_add_test(pSuite, "xStringPattern_new", test_xStringPattern_new) == NULL ||
+        CU_add_test(pSuite, "xStringPattern_find", test_xStringPattern_find) == NULL ||
+        CU_add_test(pSuite, "xMemFinder", test_xMemFinder) == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // run all tests using the CUnit Basic interface
+    CU_basic_set_mode(CU_BRM_VERBOSE);
+    CU_basic_run_tests();
+    CU_cleanup_registry();
+
+    return CU_get_error();
+}
@@ -11,11 +11,26 @@
 #include <CUnit/TestDB.h>
 #include <malloc.h>
 #include <math.h>
+#include <pthread.h>
 #include "xBase/xMemtools.h"
 #include "xBase/xTypes.h"
 #include "xMemory/xDefer.h"
 #include "xString/xString.h"
 
+// allocator counting live allocations to verify heap traffic of strings
+static void *countingAlloc(void *ctx, xSize size)
+{
+    (*(xSize *)ctx)++;
+    return malloc(size);
+}
+
+static void countingFree(void *ctx, void *ptr, xSize size)
+{
+    (void)size;
+    (*(xSize *)ctx)--;
+    free(ptr);
+}
+
 void test_cstrlen(void)
 {
     // Test case 1: Length of string with multiple characters
@@ -182,6 +197,81 @@ void test_xString_substring(void)
     CU_ASSERT_EQUAL(xString_getData(sub), NULL);
 }
 
+// copy and split string shared with other threads, dropping every copy again
+static void *copyRepeatedly(void *arg)
+{
+    const xString *str = (const xString *)arg;
+    for (xSize i = 0; i < 1000; i++) {
+        xString *copy = xString_copy(str);
+        xSize count = 0;
+        xString **parts = xString_split(str, " ", 1, &count);
+        xString_freeSplit(parts, count);
+        xString_free(copy);
+    }
+    return NULL;
+}
+
+void test_xString_inline(void)
+{
+    XDEFER_SCOPE
+    xSize blocks = 0;
+    xAllocator allocator = {countingAlloc, NULL, countingFree, &blocks};
+
+    // Test case 1: Short string and its copies take single allocation each
+    xString *str = xString_newWithAllocator(&allocator);
+    DEFER(xString_free, str);
+    xString *key = xString_append(str, "ok", 2);
+    DEFER(xString_free, key);
+    CU_ASSERT_EQUAL(blocks, 2);
+    xString *copy = xString_copy(key);
+    DEFER(xString_free, copy);
+    CU_ASSERT_EQUAL(blocks, 3);
+    CU_ASSERT_PTR_NOT_EQUAL(xString_getData(copy), xString_getData(key));
+    CU_ASSERT_TRUE(xMemCmp(xString_getData(copy), (const void *)"ok", 2));
+
+    // Test case 2: Long string allocates single data block holding its reference counter, copies only allocate structure
+    xString *line = xString_append(str, "identifier longer than inline buffer", 36);
+    DEFER(xString_free, line);
+    CU_ASSERT_EQUAL(blocks, 5);
+    xString *shared = xString_copy(line);
+    DEFER(xString_free, shared);
+    CU_ASSERT_EQUAL(blocks, 6);
+    CU_ASSERT_PTR_EQUAL(xString_getData(shared), xString_getData(line));
+
+    // Test case 3: Inline string grows into heap and shrinks back when optimized
+    xString *grown = xString_append(key, ", longer than inline buffer", 27);
+    DEFER(xString_free, grown);
+    CU_ASSERT_EQUAL(xString_getLength(grown), 29);
+    CU_ASSERT_TRUE(xMemCmp(xString_getData(grown), (const void *)"ok, longer than inline buffer", 29));
+    xString *sub = xString_substring(grown, 0, 2);
+    DEFER(xString_free, sub);
+    xSize before = blocks;
+    xString_optimize(sub);
+    CU_ASSERT_EQUAL(blocks, before);
+    CU_ASSERT_EQUAL(xString_getCapacity(sub), 2);
+    CU_ASSERT_TRUE(xMemCmp(xString_getData(sub), (const void *)"ok", 2));
+
+    // Test case 4: Substring of short string is independent copy
+    xString *part = xString_substring(key, 1, 2);
+    DEFER(xString_free, part);
+    CU_ASSERT_EQUAL(xString_getLength(part), 1);
+    CU_ASSERT_EQUAL(xString_getData(part)[0], 'k');
+    xString_clear(key);
+    CU_ASSERT_EQUAL(xString_getData(part)[0], 'k');
+
+    // Test case 5: Const string is copied and split by several threads at once
+    xString *text = xString_fromCString("identifier longer than inline buffer");
+    DEFER(xString_free, text);
+    pthread_t threads[4];
+    for (xSize i = 0; i < 4; i++) {
+        CU_ASSERT_EQUAL(pthread_create(&threads[i], NULL, copyRepeatedly, (void *)text), 0);
+    }
+    for (xSize i = 0; i < 4; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    CU_ASSERT_TRUE(xMemCmp(xString_getData(text), (const void *)"identifier longer than inline buffer", 36));
+}
+
 void test_xString_find(void)
 {
     XDEFER_SCOPE
@@ -302,6 +392,14 @@ void test_xString_count(void)
     // Test case 6: Pattern found multiple times in the string with overlapping occurrences
     count = xString_count(str, "abc", 3);
     CU_ASSERT_EQUAL(count, 4);
+
+    xString_clear(str);
+    str = xString_append(str, "abababababababa", 15);
+    DEFER(xString_free, str);
+
+    // Test case 7: Overlapping occurrences are counted once
+    count = xString_count(str, "aba", 3);
+    CU_ASSERT_EQUAL(count, 4);
 }
 void test_xString_count_overlapping(void)
 {
@@ -536,6 +634,15 @@ void test_xString_replaceAll(void)
     DEFER(xString_free, str);
     CU_ASSERT_EQUAL(xString_getLength(str), 12);
     CU_ASSERT_TRUE(xMemCmp(xString_getData(str), (const void *)"123123123123", 12));
+
+    // Test case 9: Overlapping matches are replaced from the left
+    xString_clear(str);
+    str = xString_append(str, "aaaaa", 5);
+    DEFER(xString_free, str);
+    str = xString_replaceAll(str, "aa", 2, "b", 1);
+    DEFER(xString_free, str);
+    CU_ASSERT_EQUAL(xString_getLength(str), 3);
+    CU_ASSERT_TRUE(xMemCmp(xString_getData(str), (const void *)"bba", 3));
 }
 
 void test_xString_remove(void)
@@ -633,6 +740,120 @@ void test_xString_insert(void)
     CU_ASSERT_TRUE(xMemCmp(xString_getData(str), (const void *)"Hi, Universe, Hello, World!!", 28));
 }
 
+void test_xString_split(void)
+{
+    XDEFER_SCOPE
+    xString *str = xString_new();
+    xString **parts = NULL;
+    xSize count = 0;
+    DEFER(xString_free, str);
+
+    // base string: "id,,name,value,longer than inline buffer"
+    str = xString_append(str, "id,,name,value,longer than inline buffer", 40);
+    DEFER(xString_free, str);
+
+    // Test case 1: Parts include empty fields and share data of original string
+    parts = xString_split(str, ",", 1, &count);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(parts);
+    CU_ASSERT_EQUAL(count, 5);
+    CU_ASSERT_EQUAL(xString_getLength(parts[0]), 2);
+    CU_ASSERT_PTR_EQUAL(xString_getData(parts[0]), xString_getData(str));
+    CU_ASSERT_EQUAL(xString_getLength(parts[1]), 0);
+    CU_ASSERT_EQUAL(xString_getLength(parts[2]), 4);
+    CU_ASSERT_PTR_EQUAL(xString_getData(parts[2]), xString_getData(str) + 4);
+    CU_ASSERT_TRUE(xMemCmp(xString_getData(parts[3]), (const void *)"value", 5));
+    CU_ASSERT_EQUAL(xString_getLength(parts[4]), 25);
+    xString_freeSplit(parts, count);
+
+    // Test case 2: Part copied from array outlives array and original string (parts of short string are copies)
+    xString *line = xString_fromCString("id,name");
+    parts = xString_split(line, ",", 1, &count);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(parts);
+    xString *kept = xString_copy(parts[1]);
+    DEFER(xString_free, kept);
+    xString_freeSplit(parts, count);
+    xString_free(line);
+    CU_ASSERT_EQUAL(xString_getLength(kept), 4);
+    CU_ASSERT_TRUE(xMemCmp(xString_getData(kept), (const void *)"name", 4));
+
+    // Test case 3: Modifying part does not change original string and other parts
+    xString *path = xString_fromCString("a::b::c");
+    DEFER(xString_free, path);
+    parts = xString_split(path, "::", 2, &count);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(parts);
+    CU_ASSERT_EQUAL(count, 3);
+    xString *changed = xString_append(parts[1], "!", 1);
+    DEFER(xString_free, changed);
+    xString_clear(parts[0]);
+    CU_ASSERT_EQUAL(xString_getLength(changed), 2);
+    CU_ASSERT_EQUAL(xString_getLength(parts[0]), 0);
+    CU_ASSERT_TRUE(xMemCmp(xString_getData(parts[1]), (const void *)"b", 1));
+    CU_ASSERT_TRUE(xMemCmp(xString_getData(path), (const void *)"a::b::c", 7));
+    xString_freeSplit(parts, count);
+
+    // Test case 4: String without delimiter and empty string give single part
+    parts = xString_split(path, ";", 1, &count);
+    CU_ASSERT_EQUAL(count, 1);
+    CU_ASSERT_EQUAL(xString_getLength(parts[0]), 7);
+    xString_freeSplit(parts, count);
+    xString *empty = xString_new();
+    DEFER(xString_free, empty);
+    parts = xString_split(empty, ",", 1, &count);
+    CU_ASSERT_EQUAL(count, 1);
+    CU_ASSERT_EQUAL(xString_getLength(parts[0]), 0);
+    xString_freeSplit(parts, count);
+
+    // Test case 5: Invalid arguments
+    CU_ASSERT_PTR_NULL(xString_split(NULL, ",", 1, &count));
+    CU_ASSERT_EQUAL(count, 0);
+    CU_ASSERT_PTR_NULL(xString_split(str, "", 0, &count));
+    CU_ASSERT_PTR_NULL(xString_split(str, ",", 1, NULL));
+}
+
+void test_xString_splitNext(void)
+{
+    XDEFER_SCOPE
+    xString *str = xString_new();
+    xStringSplitIterator iter;
+    const xChar *part = NULL;
+    xSize len = 0;
+    DEFER(xString_free, str);
+
+    // base string: "x\ty\t\tz"
+    str = xString_append(str, "x\ty\t\tz", 6);
+    DEFER(xString_free, str);
+
+    // Test case 1: Iterator returns views into string data, same parts as xString_split
+    xString_splitBegin(&iter, str, "\t", 1);
+    CU_ASSERT_TRUE(xString_splitNext(&iter, &part, &len));
+    CU_ASSERT_PTR_EQUAL(part, xString_getData(str));
+    CU_ASSERT_EQUAL(len, 1);
+    CU_ASSERT_TRUE(xString_splitNext(&iter, &part, &len));
+    CU_ASSERT_PTR_EQUAL(part, xString_getData(str) + 2);
+    CU_ASSERT_EQUAL(len, 1);
+    CU_ASSERT_TRUE(xString_splitNext(&iter, &part, &len));
+    CU_ASSERT_EQUAL(len, 0);
+    CU_ASSERT_TRUE(xString_splitNext(&iter, &part, &len));
+    CU_ASSERT_EQUAL(len, 1);
+    CU_ASSERT_EQUAL(*part, 'z');
+    CU_ASSERT_FALSE(xString_splitNext(&iter, &part, &len));
+    CU_ASSERT_FALSE(xString_splitNext(&iter, &part, &len));
+
+    // Test case 2: Empty string gives single empty part
+    xString *empty = xString_new();
+    DEFER(xString_free, empty);
+    xString_splitBegin(&iter, empty, ",", 1);
+    CU_ASSERT_TRUE(xString_splitNext(&iter, &part, &len));
+    CU_ASSERT_EQUAL(len, 0);
+    CU_ASSERT_FALSE(xString_splitNext(&iter, &part, &len));
+
+    // Test case 3: Invalid arguments give no parts
+    xString_splitBegin(&iter, NULL, ",", 1);
+    CU_ASSERT_FALSE(xString_splitNext(&iter, &part, &len));
+    xString_splitBegin(&iter, str, ",", 0);
+    CU_ASSERT_FALSE(xString_splitNext(&iter, &part, &len));
+}
+
 void test_xString_compare(void)
 {
     XDEFER_SCOPE
@@ -1289,12 +1510,12 @@ void test_xString_hash(void)
     // Test case 1: Normal string
     str = xString_fromCStringS("Hello, World!", 13);
     DEFER(xString_free, str);
-    CU_ASSERT_EQUAL(xString_hash(str), 0x6EF05BD7CC857C54);
+    CU_ASSERT_EQUAL(xString_hash(str), 0xC7060B6CF961CCD1);
 
     // Test case 2: Empty string
     str = xString_fromCStringS("", 0);
     DEFER(xString_free, str);
-    CU_ASSERT_EQUAL(xString_hash(str), 0xCBF29CE484222325);
+    CU_ASSERT_EQUAL(xString_hash(str), 0xEA42E9B78CF01D63);
 
     // Test case 3: NULL address
     CU_ASSERT_EQUAL(xString_hash(NULL), 0);
@@ -1302,17 +1523,17 @@ void test_xString_hash(void)
     // Test case 4: String with embedded NULL characters
     str = xString_fromCStringS("Hello, \0World!", 14);
     DEFER(xString_free, str);
-    CU_ASSERT_EQUAL(xString_hash(str), 0x78866f6ECA47C59E);
+    CU_ASSERT_EQUAL(xString_hash(str), 0x6B08C747FDF2E848);
 
     // Test case 5: Smaller copy length than actual string
     str = xString_fromCStringS("Hello, World!", 5);
     DEFER(xString_free, str);
-    CU_ASSERT_EQUAL(xString_hash(str), 0x63F0BFACF2C00F6B);
+    CU_ASSERT_EQUAL(xString_hash(str), 0xCA6BD46997456C97);
 
     // Test case 6: Null character string
     str = xString_fromCStringS("\0", 1);
     DEFER(xString_free, str);
-    CU_ASSERT_EQUAL(xString_hash(str), 0xAF63BD4C8601B7DF);
+    CU_ASSERT_EQUAL(xString_hash(str), 0xCE4BBD165858B13B);
 
     // Test case 7: Long string
     str = xString_fromCStringS(
@@ -1327,14 +1548,14 @@ void test_xString_hash(void)
         "felis id est convallis, ut malesuada lectus ullamcorper. Suspendisse tellus.",
         1023);
     DEFER(xString_free, str);
-    CU_ASSERT_EQUAL(xString_hash(str), 0x7EBF6D96502617ad);
+    CU_ASSERT_EQUAL(xString_hash(str), 0xCA7F89252AE84D8D);
 
-    // Test case 8: Known collision case (for 64-bit FNV-1a hashing function)
+    // Test case 8: Known collision case of 64-bit FNV-1a hashing function (previous implementation) no longer collides
     str = xString_fromCStringS("8yn0iYCKYHlIj4-BwPqk", 20);
     xString *str2 = xString_fromCStringS("GReLUrM4wMqfg9yzV3KQ", 20);
     DEFER(xString_free, str);
     DEFER(xString_free, str2);
-    CU_ASSERT_EQUAL(xString_hash(str), xString_hash(str2));
+    CU_ASSERT_NOT_EQUAL(xString_hash(str), xString_hash(str2));
 }
 
 int main(void)
@@ -1361,6 +1582,7 @@ int main(void)
         CU_add_test(pSuite, "xString_fromCString", test_xString_fromCString) == NULL ||
         CU_add_test(pSuite, "xString_fromCStringS", test_xString_fromCStringS) == NULL ||
         CU_add_test(pSuite, "xString_substring", test_xString_substring) == NULL ||
+        CU_add_test(pSuite, "xString_inline", test_xString_inline) == NULL ||
         CU_add_test(pSuite, "xString_find", test_xString_find) == NULL ||
         CU_add_test(pSuite, "xString_findLast", test_xString_findLast) == NULL ||
         CU_add_test(pSuite, "xString_count", test_xString_count) == NULL ||
@@ -1370,6 +1592,8 @@ int main(void)
         CU_add_test(pSuite, "xString_replaceAll", test_xString_replaceAll) == NULL ||
         CU_add_test(pSuite, "xString_remove", test_xString_remove) == NULL ||
         CU_add_test(pSuite, "xString_insert", test_xString_insert) == NULL ||
+        CU_add_test(pSuite, "xString_split", test_xString_split) == NULL ||
+        CU_add_test(pSuite, "xString_splitNext", test_xString_splitNext) == NULL ||
         CU_add_test(pSuite, "xString_compare", test_xString_compare) == NULL ||
         CU_add_test(pSuite, "xString_compareIgnoreCase", test_xString_compareIgnoreCase) == NULL ||
         CU_add_test(pSuite, "xString_toCString", test_xString_toCString) == NULL ||
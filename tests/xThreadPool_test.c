@@ -0,0 +1,246 @@
+/**
+ * @file xThreadPool_test.c
+ * @author 0xDontCare (https://github.com/0xDontCare)
+ * @brief CUnit test for xThreadPool module.
+ * @version 0.1
+ * @date 18.10.2026.
+ */
+
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <CUnit/TestDB.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "xBase/xMemtools.h"
+#include "xBase/xTypes.h"
+#include "xLinear/xMatrix.h"
+#include "xThread/xThreadPool.h"
+
+#define LOOP_COUNT 10007
+
+typedef struct LoopState_s {
+    atomic_uint visits[LOOP_COUNT];  // number of times each index was processed
+    atomic_uint chunks;              // number of chunks processed
+    xBool aligned;                   // whether all chunks started at multiple of grain
+    xSize grain;                     // expected chunk size
+    xThreadPool *pool;               // pool used for nested loops (NULL if none)
+} LoopState;
+
+static void visitRange(void *context, xSize begin, xSize end)
+{
+    LoopState *state = (LoopState *)context;
+    if (begin % state->grain || (end - begin != state->grain && end != LOOP_COUNT)) {
+        state->aligned = false;
+    }
+    for (xSize i = begin; i < end; i++) {
+        atomic_fetch_add(&state->visits[i], 1);
+    }
+    atomic_fetch_add(&state->chunks, 1);
+}
+
+static void nestedRange(void *context, xSize begin, xSize end)
+{
+    (void)begin;
+    (void)end;
+    LoopState *state = (LoopState *)context;
+    LoopState *inner = (LoopState *)calloc(1, sizeof(LoopState));
+    inner->aligned = true;
+    inner->grain = 1000;
+    xThreadPool_parallelFor(state->pool, LOOP_COUNT, inner->grain, visitRange, inner);
+    if (atomic_load(&inner->chunks) != (LOOP_COUNT + 999) / 1000) {
+        state->aligned = false;
+    }
+    free(inner);
+}
+
+static xBool visitedOnce(LoopState *state)
+{
+    for (xSize i = 0; i < LOOP_COUNT; i++) {
+        if (atomic_load(&state->visits[i]) != 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void test_xThreadPool_new(void)
+{
+    // Test case 1: Explicit thread count
+    xThreadPool *pool = xThreadPool_new(3);
+    CU_ASSERT_PTR_NOT_NULL(pool);
+    CU_ASSERT_EQUAL(xThreadPool_getThreadCount(pool), 3);
+    xThreadPool_free(pool);
+
+    // Test case 2: Thread count of online processors
+    pool = xThreadPool_new(0);
+    CU_ASSERT_PTR_NOT_NULL(pool);
+    CU_ASSERT_TRUE(xThreadPool_getThreadCount(pool) >= 1);
+    xThreadPool_free(pool);
+
+    // Test case 3: Single-threaded pool and NULL pool
+    pool = xThreadPool_new(1);
+    CU_ASSERT_EQUAL(xThreadPool_getThreadCount(pool), 1);
+    xThreadPool_free(pool);
+    CU_ASSERT_EQUAL(xThreadPool_getThreadCount(NULL), 1);
+    xThreadPool_free(NULL);  // should not crash
+}
+
+void test_xThreadPool_parallelFor(void)
+{
+    xThreadPool *pool = xThreadPool_new(4);
+    LoopState *state = (LoopState *)calloc(1, sizeof(LoopState));
+
+    // Test case 1: Every index is processed exactly once in fixed chunks
+    for (xSize round = 0; round < 20; round++) {
+        xMemSet(state, 0, sizeof(LoopState));
+        state->aligned = true;
+        state->grain = 64;
+        CU_ASSERT_TRUE(xThreadPool_parallelFor(pool, LOOP_COUNT, state->grain, visitRange, state));
+        CU_ASSERT_TRUE(visitedOnce(state));
+        CU_ASSERT_TRUE(state->aligned);
+        CU_ASSERT_EQUAL(atomic_load(&state->chunks), (LOOP_COUNT + 63) / 64);
+    }
+
+    // Test case 2: Loop without pool runs serially with same chunks
+    xMemSet(state, 0, sizeof(LoopState));
+    state->aligned = true;
+    state->grain = 64;
+    CU_ASSERT_TRUE(xThreadPool_parallelFor(NULL, LOOP_COUNT, state->grain, visitRange, state));
+    CU_ASSERT_TRUE(visitedOnce(state));
+    CU_ASSERT_EQUAL(atomic_load(&state->chunks), (LOOP_COUNT + 63) / 64);
+
+    // Test case 3: Nested loops complete without deadlock
+    xMemSet(state, 0, sizeof(LoopState));
+    state->aligned = true;
+    state->pool = pool;
+    CU_ASSERT_TRUE(xThreadPool_parallelFor(pool, 8, 1, nestedRange, state));
+    CU_ASSERT_TRUE(state->aligned);
+
+    // Test case 4: Invalid arguments and empty loop
+    CU_ASSERT_FALSE(xThreadPool_parallelFor(pool, LOOP_COUNT, 0, visitRange, state));
+    CU_ASSERT_FALSE(xThreadPool_parallelFor(pool, LOOP_COUNT, 1, NULL, state));
+    CU_ASSERT_TRUE(xThreadPool_parallelFor(pool, 0, 1, visitRange, state));
+
+    free(state);
+    xThreadPool_free(pool);
+}
+
+static float squash(float value) { return value / (1.0f + (value < 0.0f ? -value : value)); }
+
+static float blend(float lhs, float rhs) { return 0.25f * lhs + 0.75f * rhs; }
+
+// run every parallel matrix operation and store concatenated results
+static float *matrixResults(const xMatrix *lhs, const xMatrix *rhs, xSize *count)
+{
+    xMatrix *results[6] = {xMatrix_mul(lhs, rhs), xMatrix_add(lhs, rhs),        xMatrix_dotmul(lhs, rhs),
+                           xMatrix_map(lhs, squash), xMatrix_map2(lhs, rhs, blend), xMatrix_transpose(lhs)};
+    xSize size = xMatrix_getRows(lhs) * xMatrix_getCols(lhs);
+    float *data = (float *)malloc(6 * size * sizeof(float));
+    for (xSize i = 0; i < 6; i++) {
+        float *flat = xMatrix_flatten(results[i]);
+        xMemCopy(data + i * size, flat, size * sizeof(float));
+        free(flat);
+        xMatrix_free(results[i]);
+    }
+    *count = 6 * size;
+    return data;
+}
+
+typedef struct ResizeState_s {
+    const xMatrix *lhs;  // left operand of products
+    const xMatrix *rhs;  // right operand of products
+    atomic_bool stop;    // set when runner should finish
+    xBool valid;         // whether all products were computed
+} ResizeState;
+
+static void *sharedLoopRunner(void *arg)
+{
+    ResizeState *state = (ResizeState *)arg;
+    while (!atomic_load(&state->stop)) {
+        xMatrix *product = xMatrix_mul(state->lhs, state->rhs);
+        state->valid = state->valid && product;
+        xMatrix_free(product);
+    }
+    return NULL;
+}
+
+void test_xThreadPool_shared(void)
+{
+    xMatrix *lhs = xMatrix_new(300, 300);
+    xMatrix *rhs = xMatrix_new(300, 300);
+    xUInt32 seed = 7;
+    for (xSize i = 0; i < 300; i++) {
+        for (xSize j = 0; j < 300; j++) {
+            seed = seed * 1664525u + 1013904223u;
+            xMatrix_set(lhs, i, j, (float)(seed >> 8) / (float)(1u << 23) - 1.0f);
+            seed = seed * 1664525u + 1013904223u;
+            xMatrix_set(rhs, i, j, (float)(seed >> 8) / (float)(1u << 23) - 1.0f);
+        }
+    }
+
+    // Test case 1: Shared pool is created on demand
+    CU_ASSERT_TRUE(xThreadPool_setSharedThreadCount(1));
+    CU_ASSERT_PTR_NOT_NULL(xThreadPool_getShared());
+    CU_ASSERT_EQUAL(xThreadPool_getThreadCount(xThreadPool_getShared()), 1);
+
+    // Test case 2: Matrix operations give bitwise identical results for any thread count
+    xSize count = 0;
+    float *serial = matrixResults(lhs, rhs, &count);
+    CU_ASSERT_TRUE(xThreadPool_setSharedThreadCount(4));
+    CU_ASSERT_EQUAL(xThreadPool_getThreadCount(xThreadPool_getShared()), 4);
+    float *parallel = matrixResults(lhs, rhs, &count);
+    CU_ASSERT_TRUE(xMemCmp(serial, parallel, count * sizeof(float)));
+    CU_ASSERT_TRUE(xThreadPool_setSharedThreadCount(3));
+    float *odd = matrixResults(lhs, rhs, &count);
+    CU_ASSERT_TRUE(xMemCmp(serial, odd, count * sizeof(float)));
+
+    // Test case 3: Thread count changed while other thread keeps running loops on shared pool
+    ResizeState resize = {lhs, rhs, ATOMIC_VAR_INIT(false), true};
+    pthread_t runner;
+    pthread_create(&runner, NULL, sharedLoopRunner, &resize);
+    for (xSize i = 0; i < 20; i++) {
+        CU_ASSERT_TRUE(xThreadPool_setSharedThreadCount(1 + i % 4));
+    }
+    atomic_store(&resize.stop, true);
+    pthread_join(runner, NULL);
+    CU_ASSERT_TRUE(resize.valid);
+
+    free(serial);
+    free(parallel);
+    free(odd);
+    xMatrix_free(lhs);
+    xMatrix_free(rhs);
+}
+
+int main(void)
+{
+    CU_pSuite pSuite = NULL;
+
+    // initialize CUnit test registry
+    if (CU_initialize_registry() != CUE_SUCCESS) {
+        return CU_get_error();
+    }
+
+    // add a suite to the registry
+    pSuite = CU_add_suite("xThreadPool_test", NULL, NULL);
+    if (pSuite == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // add the tests to the suite
+    if (CU_add_test(pSuite, "xThreadPool_new", test_xThreadPool_new) == NULL ||
+        CU_add_test(pSuite, "xThreadPool_parallelFor", test_xThreadPool_parallelFor) == NULL ||
+        CU_add_test(pSuite, "xThreadPool_shared", test_xThreadPool_shared) == NULL) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    // run all tests using the CUnit Basic interface
+    CU_basic_set_mode(CU_BRM_VERBOSE);
+    CU_basic_run_tests();
+    CU_cleanup_registry();
+
+    return CU_get_error();
+}